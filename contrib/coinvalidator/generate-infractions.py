@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+# Copyright (c) 2018 The Blocknet developers
+# Distributed under the MIT software license, see the accompanying
+# file COPYING or http://www.opensource.org/licenses/mit-license.php.
+'''
+Script to generate the static infraction table for coinvalidator.cpp.
+
+This script expects a text file with lines in the format
+
+    <txid>\t<address>\t<amount>\t<amount in coins>
+
+The amount in coins must be the amount divided by COIN, printed with
+six decimals, it is not stored in the table.
+
+The output will be a data structure with the infractions in binary format:
+
+   static constexpr InfractionSpec infractionsStatic[] = {
+   ...
+   };
+
+This should be written to `src/coinvalidatorinfractions.h`.
+'''
+
+from binascii import a2b_hex
+import hashlib
+import sys
+
+b58chars = '123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz'
+
+def b58decode_check(v):
+    n = 0
+    for c in v:
+        n = n * 58 + b58chars.index(c)
+    data = n.to_bytes(25, 'big')
+    payload, checksum = data[:21], data[21:]
+    if hashlib.sha256(hashlib.sha256(payload).digest()).digest()[:4] != checksum:
+        raise ValueError('Invalid address checksum %s' % v)
+    return payload
+
+def parse_line(line):
+    (txid, address, amount, coins) = line.split('\t')
+    amount = int(amount)
+    if len(txid) != 64 or amount <= 0:
+        raise ValueError('Invalid infraction %s' % line)
+    if '%f' % (amount / 100000000) != coins:
+        raise ValueError('Amount in coins does not match amount %s' % line)
+    # uint256 byte order
+    return (bytearray(reversed(a2b_hex(txid))), b58decode_check(address), amount)
+
+def process_infractions(g, f, structname):
+    g.write('static constexpr InfractionSpec %s[] = {\n' % structname)
+    first = True
+    for line in f:
+        line = line.strip()
+        if not line:
+            continue
+        if not first:
+            g.write(',\n')
+        first = False
+
+        (txid, address, amount) = parse_line(line)
+        txidstr = ','.join(('0x%02x' % b) for b in txid)
+        addressstr = ','.join(('0x%02x' % b) for b in address)
+        g.write('    {{%s}, {%s}, %i}' % (txidstr, addressstr, amount))
+    g.write('\n};\n')
+
+def main():
+    if len(sys.argv)<2:
+        print(('Usage: %s <path_to_infractions_txt>' % sys.argv[0]), file=sys.stderr)
+        exit(1)
+    g = sys.stdout
+    g.write('#ifndef BLOCKDX_COINVALIDATORINFRACTIONS_H\n')
+    g.write('#define BLOCKDX_COINVALIDATORINFRACTIONS_H\n')
+    g.write('/**\n')
+    g.write(' * List of infractions loaded by CoinValidator::LoadStatic\n')
+    g.write(' * AUTOGENERATED by contrib/coinvalidator/generate-infractions.py\n')
+    g.write(' *\n')
+    g.write(' * Each line contains a txid in uint256 byte order, an address as\n')
+    g.write(' * version byte and hash160, and the amount.\n')
+    g.write(' */\n')
+    with open(sys.argv[1], 'r') as f:
+        process_infractions(g, f, 'infractionsStatic')
+    g.write('#endif // BLOCKDX_COINVALIDATORINFRACTIONS_H\n')
+
+if __name__ == '__main__':
+    main()
@@ -7,6 +7,7 @@
 
 #include "serialize.h"
 
+#include <stdint.h>
 #include <vector>
 
 class COutPoint;
@@ -97,4 +98,47 @@ public:
     void UpdateEmptyFull();
 };
 
+/**
+ * RollingBloomFilter is a probabilistic "keep track of most recently inserted" set.
+ * Construct it with the number of items to keep track of, and a false-positive
+ * rate. Unlike CBloomFilter, by default nTweak is set to a cryptographically
+ * secure random value for you. Similarly rather than clear() the method
+ * reset() is provided, which also changes nTweak to decrease the impact of
+ * false-positives.
+ *
+ * contains(item) will always return true if item was one of the last N to 1.5*N
+ * insert()'ed ... but may also return true for items that were not inserted.
+ *
+ * Memory usage is fixed at construction, about 1.8 bytes per element at
+ * fp rate 0.1% and 7 bytes per element at 1e-6.
+ */
+class CRollingBloomFilter
+{
+public:
+    // A random bloom filter calls GetRand() at creation time.
+    // Don't create global CRollingBloomFilter objects, as they may be
+    // constructed before the randomizer is properly initialized.
+    CRollingBloomFilter(unsigned int nElements, double nFPRate);
+
+    void insert(const std::vector<unsigned char>& vKey);
+    void insert(const uint256& hash);
+    bool contains(const std::vector<unsigned char>& vKey) const;
+    bool contains(const uint256& hash) const;
+
+    void reset();
+
+    //! Number of items tracked before the oldest start to be forgotten
+    unsigned int capacity() const { return nEntriesPerGeneration * 2; }
+    //! Size of the filter data in bytes
+    size_t memoryUsage() const { return data.size() * sizeof(uint64_t); }
+
+private:
+    int nEntriesPerGeneration;
+    int nEntriesThisGeneration;
+    int nGeneration;
+    std::vector<uint64_t> data;
+    unsigned int nTweak;
+    int nHashFuncs;
+};
+
 #endif // BITCOIN_BLOOM_H
@@ -4,9 +4,9 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include "coinvalidator.h"
+#include "coinvalidatorinfractions.h"
 
-#include <fstream>
-#include "s3downloader.h"
+#include <algorithm>
 #include "util.h"
 
 /**
@@ -20,29 +20,30 @@ const int CoinValidator::CHAIN_HEIGHT = 101651;
  * @return
  */
 bool CoinValidator::IsCoinValid(const uint256 &txId) const {
-    // A coin is valid if its tx is not in the infractions list
-    boost::mutex::scoped_lock l(lock);
-    return infMap.count(txId.ToString()) == 0;
+    // A coin is valid if its tx is not in the infractions list. The list is
+    // an immutable sorted snapshot so lookups on the CheckTransaction path
+    // take no lock and allocate nothing.
+    std::shared_ptr<const std::vector<uint256>> txIds = std::atomic_load(&infTxIds);
+    return !txIds || !std::binary_search(txIds->begin(), txIds->end(), txId);
 }
 bool CoinValidator::IsCoinValid(uint256 &txId) const {
-    boost::mutex::scoped_lock l(lock);
-    return infMap.count(txId.ToString()) == 0;
+    return IsCoinValid(static_cast<const uint256 &>(txId));
 }
 bool CoinValidator::IsCoinValid(const std::string &txId) const {
-    boost::mutex::scoped_lock l(lock);
-    return infMap.count(txId) == 0;
+    return IsCoinValid(uint256(txId));
 }
 
 /**
  * Returns true if the exploited coin is being sent to the redeem address. This checks amounts against
  * the exploit db.
- * @param scripts
+ * @param exploited Exploited inputs
+ * @param recipients Outputs of the spending transaction, empty outputs are skipped
  * @return
  */
-bool CoinValidator::RedeemAddressVerified(std::vector<RedeemData> &exploited,
-                                          std::vector<RedeemData> &recipients) {
+bool CoinValidator::RedeemAddressVerified(const std::vector<RedeemData> &exploited,
+                                          const std::vector<CTxOut> &recipients) {
     boost::mutex::scoped_lock l(lock);
-    if (recipients.empty())
+    if (std::none_of(recipients.begin(), recipients.end(), [](const CTxOut &out) { return !out.IsEmpty(); }))
         return false;
 
     static const std::string redeemAddress = "BmL4hWa8T7Qi6ZZaL291jDai4Sv98opcSK";
@@ -51,7 +52,8 @@ bool CoinValidator::RedeemAddressVerified(std::vector<RedeemData> &exploited,
     // Add up all exploited inputs by send from address
     CAmount totalExploited = 0;
     for (auto &expl : exploited) {
-        if (!infMap.count(expl.txid)) // fail if infraction not found
+        const std::string explTxId = expl.txid.ToString();
+        if (!infMap.count(explTxId)) // fail if infraction not found
             return false;
 
         // Get address of tx
@@ -62,13 +64,13 @@ bool CoinValidator::RedeemAddressVerified(std::vector<RedeemData> &exploited,
         std::string explAddr = explAddress.ToString();
 
         // If we've already added up infractions for this utxo address, skip
-        std::string guid = expl.txid + "-" + explAddr;
+        std::string guid = explTxId + "-" + explAddr;
         if (explSeen.count(guid))
             continue;
 
         // Find out how much exploited coin we need to spend in this utxo
         CAmount exploitedAmount = 0;
-        std::vector<InfractionData> &infs = infMap[expl.txid];
+        std::vector<InfractionData> &infs = infMap[explTxId];
         for (auto &inf : infs) {
             if (inf.address == explAddr)
                 exploitedAmount += inf.amount;
@@ -87,13 +89,15 @@ bool CoinValidator::RedeemAddressVerified(std::vector<RedeemData> &exploited,
     // Add up total redeem amount
     CAmount totalRedeem = 0;
     for (auto &rec : recipients) {
+        if (rec.IsEmpty())
+            continue;
         CTxDestination recipientDest;
         if (!ExtractDestination(rec.scriptPubKey, recipientDest)) // if bad recipient destination then fail
             return false;
         CBitcoinAddress recipientAddress(recipientDest);
         // If recipient address matches the redeem address count spend amount
         if (recipientAddress.ToString() == redeemAddress)
-            totalRedeem += rec.amount;
+            totalRedeem += rec.nValue;
     }
 
     // Allow spending inputs if the total redeem amount spent is greater than or equal to exploited amount
@@ -119,9 +123,9 @@ bool CoinValidator::IsLoaded() const {
 void CoinValidator::Clear() {
     boost::mutex::scoped_lock l(lock);
     infMap.clear();
+    publishTxIds();
     lastLoadH = 0;
     infMapLoaded = false;
-    downloadErr = false;
 }
 
 /**
@@ -130,11 +134,14 @@ void CoinValidator::Clear() {
  */
 std::vector<InfractionData> CoinValidator::GetInfractions(const uint256 &txId) {
     boost::mutex::scoped_lock l(lock);
-    return infMap[txId.ToString()];
+    // find instead of operator[], an empty entry would mark the tx invalid
+    auto it = infMap.find(txId.ToString());
+    if (it == infMap.end())
+        return std::vector<InfractionData>();
+    return it->second;
 }
 std::vector<InfractionData> CoinValidator::GetInfractions(uint256 &txId) {
-    boost::mutex::scoped_lock l(lock);
-    return infMap[txId.ToString()];
+    return GetInfractions(static_cast<const uint256 &>(txId));
 }
 std::vector<InfractionData> CoinValidator::GetInfractions(CBitcoinAddress &address) {
     boost::mutex::scoped_lock l(lock);
@@ -147,102 +154,6 @@ std::vector<InfractionData> CoinValidator::GetInfractions(CBitcoinAddress &addre
     return infs;
 }
 
-/**
- * Loads the infraction list.
- * @param loadHeight
- * @return
- */
-bool CoinValidator::Load(int loadHeight) {
-    boost::mutex::scoped_lock l(lock);
-
-    // Ignore if we've already loaded the list at the load height
-    if (lastLoadH == loadHeight && infMapLoaded)
-        return false;
-    infMapLoaded = true;
-
-    // Clear old data
-    infMap.clear();
-
-    // Load from cache if our loaded chain height is under current chain height
-    ifstream f(getExplPath().string());
-    if (f.good()) { // only proceed to load from cache if the file exists
-        try {
-            std::ifstream cacheFile(getExplPath().string(), std::ios::in | std::ifstream::binary);
-            if (cacheFile) {
-                bool isLastLoadH = true;
-                // Get lines from file
-                std::vector<std::string> lines;
-                for (std::string line; getline(cacheFile, line); ) {
-                    // Check first line for last load height
-                    if (isLastLoadH) {
-                        isLastLoadH = false;
-                        int blockH = getBlockHeight(line);
-                        // Do not proceed if this cache file is out of date
-                        if (!blockH || blockH < loadHeight)
-                            break;
-                        // Skip first line since it's the block height
-                        lastLoadH = blockH; // set the load height
-                        continue;
-                    }
-                    lines.push_back(line);
-                }
-                cacheFile.close();
-
-                // Add lines to memory after file is safely closed (this can fail)
-                if (!lines.empty()) {
-                    bool failed = false;
-                    for (std::string &line : lines) {
-                        if (!addLine(line, infMap)) { // populate hash
-                            LogPrintf("Coin Validator: Failed to parse hash item: %s\n", line);
-                            std::cout << "Coin Validator: Failed to parse hash item: " + line << std::endl;
-                            failed = true;
-                        }
-                    }
-
-                    // If we didn't fail return, otherwise proceed to load from network
-                    if (!failed) {
-                        LogPrintf("Coin Validator: Loading from cache: %u\n", lastLoadH);
-                        return true;
-                    }
-                }
-
-            } // if cache file doesn't exist or is old, proceed to load from network
-        } catch (std::exception &e) {
-            LogPrintf("Coin Validator: Failed to load from cache, trying from network: %s\n", e.what());
-            // proceed to try network
-        }
-    }
-
-    std::string err;
-    std::list<std::string> lst;
-    if (!downloadList(lst, err) || lst.empty()) {
-        LogPrintf("Coin Validator: Failed to load from network: %s\n", err);
-        infMapLoaded = false;
-        return false;
-    }
-
-    // Load hash from list
-    for (std::string &line : lst) {
-        addLine(line, infMap);
-    }
-
-    // Save to disk
-    std::ofstream file(getExplPath().string(), std::ios::out | std::ofstream::binary);
-    file << std::to_string(loadHeight) << std::endl;
-    for (auto &item : infMap) {
-        for (auto &inf : item.second)
-            file << inf.ToString() << std::endl;
-    }
-    file.close();
-
-    // set the load height
-    lastLoadH = loadHeight;
-    LogPrintf("Coin Validator: Loading from network: %u\n", loadHeight);
-
-    // No longer loading list
-    return true;
-}
-
 /**
  * Loads the infraction list from code.
  * @return
@@ -258,86 +169,34 @@ bool CoinValidator::LoadStatic() {
     // Clear old data
     infMap.clear();
 
-    // Load infractions into memory
-    std::vector<string> infractions = getExplList();
-    for (std::string &line : infractions) {
-        bool result = addLine(line, infMap);
-        if (!result) {
-            LogPrintf("Coin Validator: Failed to read infraction: %s\n", line);
-            assert(result);
-        }
+    // Load infractions into memory from the table compiled in, no parsing needed
+    for (const InfractionSpec &spec : infractionsStatic) {
+        uint256 txId;
+        memcpy(txId.begin(), spec.txid, sizeof(spec.txid));
+        const std::vector<unsigned char> address(spec.address, spec.address + sizeof(spec.address));
+        const InfractionData inf(txId.ToString(), EncodeBase58Check(address), spec.amount,
+                                 static_cast<double>(spec.amount) / COIN);
+        infMap[inf.txid].push_back(inf);
     }
 
+    publishTxIds();
+
     lastLoadH = CHAIN_HEIGHT;
     LogPrintf("Coin Validator: Ready: %u\n", lastLoadH);
     return true;
 }
 
 /**
- * Return cached file path.
- * @return
+ * Publishes the sorted txids of the infraction map for lock free lookups.
+ * Call with lock held after the map changed.
  */
-boost::filesystem::path CoinValidator::getExplPath() {
-    return GetDataDir() / "expl.txt";
-}
-
-/**
- * Adds the data to internal hash.
- * @return
- */
-bool CoinValidator::addLine(std::string &line, std::map<std::string, std::vector<InfractionData>> &map) {
-    std::stringstream os(line);
-    os.imbue(std::locale::classic());
-    std::string t;
-    std::string a;
-    CAmount amt = 0;
-    double amtd = 0;
-    os >> t >> a >> amt >> amtd;
-
-    if (t.empty() || a.empty() || amt == 0 || amtd == 0)
-        return false;
-
-    // Make sure parsed line matches expected
-    assert(line == t + "\t" + a + "\t" + std::to_string(amt) + "\t" + CoinValidator::AmountToString(amtd));
-
-    const InfractionData inf(t, a, amt, amtd);
-    std::vector<InfractionData> &infs = map[inf.txid];
-    infs.push_back(inf);
-
-    return true;
-}
-
-/**
- * Get block height from line.
- * @return
- */
-int CoinValidator::getBlockHeight(std::string &line) {
-    std::stringstream os(line);
-    os.imbue(std::locale::classic());
-    int t = 0; os >> t;
-    if (t > 0)
-        return t;
-    else
-        return 0;
-}
-
-/**
- * Download the list. Return false if error occurred.
- * @return
- */
-bool CoinValidator::downloadList(std::list<std::string> &lst, std::string &err) {
-    auto cb = [&lst, &err](const std::list<std::string> &list, const std::string error) -> void {
-        if (!error.empty())
-            err = error;
-        lst = list;
-    };
-
-    // Wait for response
-    S3Downloader::create(cb)->downloadList(boost::posix_time::seconds(downloadErr ? 45 : 30));
-
-    // Report error
-    downloadErr = !err.empty();
-    return err.empty();
+void CoinValidator::publishTxIds() {
+    auto txIds = std::make_shared<std::vector<uint256>>();
+    txIds->reserve(infMap.size());
+    for (auto &item : infMap)
+        txIds->push_back(uint256(item.first));
+    std::sort(txIds->begin(), txIds->end());
+    std::atomic_store(&infTxIds, std::shared_ptr<const std::vector<uint256>>(txIds));
 }
 
 /**
@@ -368,2011 +227,3 @@ CoinValidator& CoinValidator::instance() {
 std::string InfractionData::ToString() const {
     return txid + "\t" + address + "\t" + std::to_string(amount) + "\t" + CoinValidator::AmountToString(amountH);
 }
-
-/**
- * Return the infraction list.
- * @return
- */
-std::vector<string> CoinValidator::getExplList() {
-    std::vector<string> r = {
-            "00c0a0a887c2663e563494bd87f0ce279698d3e4f60fa3c5c39893f7fce8c336\tBd7369M24t6Gqf5w3a7ForwPAXivFd77Fm\t5169788868\t51.697889",
-            "00c2408da7c5d0bbbbc4aeeeae43f25d97fb6ba9c00a0203091af33a2c5276d7\tBiAL8CnyG5CtpSBtMF1tk8NR7ZdMJGwcWe\t976769513\t9.767695",
-            "010ad51e7758ce5310a1d198b545d1c97cd037e65b36b66dee4efd35d541c336\tBgZwqV1PjC57Fz1mRpePNyDmcvNRMdaQ87\t999997981\t9.999980",
-            "014cb5a5f3e02ab9dddef2bb8f2d65cd55b2ed29c37e13242646b692b402b424\tBbRkK2qXsiH23KvkKZnYvfgXYWEe5rUTYn\t577801400\t5.778014",
-            "017c52bbe546253bb60226836315b781f1538fd460c215c8d2a3e09da1e3f703\tBja2orRyemqvviSn7C3j1QJsYmRX1s4XQs\t5508344635\t55.083446",
-            "01c10562132869f552b07376967f353225563ee45d8cd8c5a301b422ab75210a\tBnfYoE787WEqihRsV7otpzdi2NxbL7EzW8\t999989673\t9.999897",
-            "01e982b410c1b7d75d11344f35865a16dc931449e49723ed2aaea50514e5d1b4\tBYacopnBG9fnJWdxVCuwjo9pXcZRddG85W\t569679609\t5.696796",
-            "0287d57419c09e60aacb18e21c14b808140af531ecd809019a9733c7a0962323\tBjguzbxyuTfWoMRCyEe7nQLRfNGX9dgeUq\t999986850\t9.999868",
-            "02922a5521adf61cff24c1d1a4024b0777e912c8db13461ac1e041f1082faafe\tBg5FoNbCt53WzW82chx6BkBh21jS3qLfpu\t632019106\t6.320191",
-            "02d764d3d6e5949923802658eea848be01da85c3763dbd56736e62b02ee04ee6\tBgrZwSs61jM7W8xhNm2NRUkAWYXUUWoibX\t749506740\t7.495067",
-            "02da36ec5ea8cfd4fa83c0c6e415accbcbfb421160d5005fbd8c6e59b2c72303\tBZHvwhjnCmmXTp4PHAAchnYgNnRXkMJAeG\t749506080\t7.495061",
-            "02fb399b6117c398f79d5a0a7058b3289fe8037da3df9b1ae2e31dc4fe6d92fd\tBrSzWjATCoDq3dpkqtB5WFNynyqsS9z7a3\t571879709\t5.718797",
-            "02fd0847c0133587f7c00a78cacf7b108719ebc8b8bdb19f79140899915a0c69\tBk3Vysy8enGF2LTxkwMJJc5bPXN3sYpj7M\t6119411581\t61.194116",
-            "03b5ca05b7416e96c859aef4c5b4bdd5ae8b5775ccd30272fefe20815b62fdd5\tBe7BVfPTJULnczJd7rVry5vSYS9vt952Kc\t1566655935\t15.666559",
-            "03d1de4ca32dc8e3f9456404d366184d857fcec19d8e43cd402732cad0559a41\tBiLdyt1zVnZP8B3Hvg91be2yB3AtGaTahm\t658837483\t6.588375",
-            "0428863fe1c2a8844c9cf42bb26f238ace849f8749787784be764e138d56e349\tBcetZMbowtsTvPbkSxYsgfnmDvP3RPiw1m\t563574331\t5.635743",
-            "0453407dacff13a915bace1b10b0672c7e363ab546f30a4ca80fc53b5adfa932\tBfKKqeADuJWuu1qzw887neJs2n2tQE99qt\t1100394789\t11.003948",
-            "04716899a0b8659b6e7fba872e036fb8d0b05a4a9e4bba3053ea01fce888cc58\tBavfJ7k4f4XGHsYEj2keaQ8iWB3jJHZK3o\t632025079\t6.320251",
-            "04c7ab4dcb0e4c06855fc819c5560b6776ebfc95aeed183cd783b5c5f303d01e\tBVjo5fJNoAdsJ7hWjvJaV3kVkfgmzZZWgw\t5169794367\t51.697944",
-            "0507ae1f1709b745c457b0f71aa905584460289e2d31158c710c803e4fef1e2e\tBfxPXEPu1UvLiA1b3ptvgRPGjpBWZYNuy8\t1358638347\t13.586383",
-            "05248bb5cfd2f923709eaff293d61931593cfc0bd02d3846a7ac5dec7a2daf07\tBdadKL66CYKSKxBwCwPzBxMoz6cvFQt4X4\t6864559191\t68.645592",
-            "05a59a647059d261da87ddccb5fc63f142054eedd981fda565d3b8bf313a6446\tBfLZwqYuoQrinJVXqGhf2jqz4HCMGg5drp\t5911731219\t59.117312",
-            "05da529e5107cae29c1b426a23fc1f41ceb6a9efe1bff119056ad5c3a48a0ed0\tBWvrRpV62UkWoiF8Xje1XgQZdHZAHmjaBW\t1484934710\t14.849347",
-            "05de293219f66e5b62bf396655833536a98561764e83049d1499759d14f31d40\tBUrMqLVJ3Ufssm1Ep6fdcv1g9wVJ2athkc\t7645581364\t76.455814",
-            "062e35b510be51eef7534d16067bd68ab185b7990821b55f82a7998ac06703d4\tBYsb4P4b2JXLjfRn3ZEh27rZPmwZJQEL3N\t594441839\t5.944418",
-            "064c73f90e4fd92eabbf8372bf1d23d292da58d4f15aa56f151249f07898ca19\tBY6vxWsremqm4zpBMZPQpQu64jXoGyRGzF\t6403965529\t64.039655",
-            "064ef274d36f037897cb86b4c1f163705a8bfa9c219540c42d0c23d43534a335\tBWjKTo2sbN29Qh4DqCTK2u7GisR5wuDXCx\t6874992539\t68.749925",
-            "0676bf46e6035e284f8b977b273df3a89aed0279abac3e6d9a89da110907093c\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "06c21ce7571f67c539edbf924cf69ca81efb1e6c663e8a74db954341a62badc1\tBi7DAJeVwGT8aphg2J68Tb2BdokTZAzS9n\t6249994713\t62.499947",
-            "0762a9861c8c7671529dc2ddc2f154cdfd7bc43a196d29df650007bc8c2de87e\tBjx2YPbh3qeWE26fzUN6VQQqDkv3cVAicb\t464155928\t4.641559",
-            "07bd375e356c39af4d0ef7be01db001e9a4a1432900636b8bd98087a8a04a288\tBpGEhtdVtZ6FNVTsRYzkjwCog7uKkvRrsR\t2669987315\t26.699873",
-            "07db80339f21544d63c295c3bab9814045ab32248dbee2437706b55e7da245f3\tBnZ4BbqiquRcLbzU2YqJKKJJvzCJXo9Jq2\t474418517\t4.744185",
-            "080c33884d378c2e758fffa0f4b271398c024d196dea0408690a290a091a9eed\tBhjne3XLcq4w5qVPnrbmXQhnbpyyfTVcXH\t632019111\t6.320191",
-            "08259ade37c90d557474f4cb87f978a037b8ddcbc297f61d61ef2fbc533d3f4e\tBaEPAjidxDNHcxpXK5WkJpuXkyCk1kz21Y\t6249992489\t62.499925",
-            "086c72719d03bec8adc89471a065f0b0fd646192e8f9ce3260120908556f0ff9\tBgET4LyTxb9iZsnSFCYyH84jKCgTY7MvtU\t1598043686\t15.980437",
-            "0889119e62e3fd3bf446ea0e5e03e45aef1b0c199882c4fb2d59b733f2b35943\tBY9hbgxyeb6uYYpd94Y6HhuoANSmnAZpsJ\t5911741717\t59.117417",
-            "08afce3af8ea862d8fc3f137168ce427d3b47ddcf0cf2f35432538113a2f9857\tBq456zVvEg6wbHWdzvLhpp4YnAwhexpH6U\t7134335991\t71.343360",
-            "0947e51bbe885669eb8e9916f20093012f3ba7371d8f0dd0b619a5aa22d5d1e7\tBUn4HWSj7D1zu1zaPM7QTobBF8coeQ43tu\t7134335677\t71.343357",
-            "0a00219fcbfafde024ca1132bdc280b11c77d1dd6afdfa672f415864f1f3c8cd\tBVV4M8UhuRG55La73JbKUygnByeyJN8TRw\t999997969\t9.999980",
-            "0a68925568d3082ad026e316cc6cb0ad7a5610507382d86dbaa2882c0025ab73\tBjuznJxbC1UedQhXoxvjUYv4zqxwQURUBE\t569679597\t5.696796",
-            "0a80410299b1c4241920b4a509cdc1405f31a13f837f0bf8c6fc934f0d15e8f4\tBVM3WC3kzLp2ufdHTahN6mLfQFW2V1xgYR\t5169789734\t51.697897",
-            "0a93d837a14655417bb845bdca485c7056d5bacb98cafd55ad214c316c733813\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "0b176e6fea42c5ddee4a288badd9f8bb16353d68b00307b477c86e8ab601d3a3\tBozbKUFJ36cu1QBDbuyoc8cJsNW5bNe66b\t474419374\t4.744194",
-            "0b95625c53a6a2e5ae943b1f985e0f25ed39e5e575672b9aa7bc3d1ffd2c4d01\tBof6uMAzC2guXsmDpW6tbFvqdv54HWDwc8\t882549872\t8.825499",
-            "0bb7115b3f1d80148fdf721564f5f1e755115877d9a8211914f2c880d603fefc\tBVT65K2gWw7WT1DHfAswUAfmVuoyw1SfDh\t472620808\t4.726208",
-            "0bbe9fa70f95733971a2ea8f936d175124b8baf8ea21d4ccaeef049a78a545f3\tBoBNCpo86UjqpUduCTrxwbW3qLTQ5W4eXS\t6249994727\t62.499947",
-            "0be082a965d560e51c0d705d73c6341656e78f55c9d872c655a9abfedb869955\tBjiwYW9178CsxAosCzevqcS1mM4wu3WFKN\t658837483\t6.588375",
-            "0bf11a8cde2852673b4cb0dd608c03244ca4f8273a11e32d4c455b84620a2768\tBdDC8kFGnRdUZBiL4pjzMp6Jz7QisQAPgB\t6100231973\t61.002320",
-            "0c28280a79d3d2a0e3ac757b1414079c6db5f31f1bf7d9da93e845289f08d46b\tBayBvHdUWWcxDbmUR9hsZE1u9Bcb5vUKTs\t1069995971\t10.699960",
-            "0c3e4db85cdbccfba7638131f41613ff31cc10e0bede564e0824dca41adc4dae\tBY7BHuJ2fyDThqrQ3g6rpYQWDSugm8WD8m\t4159988738\t41.599887",
-            "0c5723f51f180e7979d84d44f3e16f802c510792fa4bf1ea7033c845b9ad34ed\tBe9n1smhLHLyFBv5MdnjJEMJEvGmDv8USA\t9351241971\t93.512420",
-            "0ca0f4318aff9c3c6fb55aa5ab7ec368c4d2b9bd42171568d682e27ddf936cda\tBpsKEdNcUsi2UwfgRazijoZ7QB5J349UCA\t6289741905\t62.897419",
-            "0dd42ea9fc67d64a177bd20f5f9bc4496efaeab0cdb7b33b6552a27c3f808f1c\tBaBN9s4faLCaB1bu9GyeTSuuJkr6ryWpTR\t594441907\t5.944419",
-            "0eca59d96eb00b20dd34cff2159d8d132f037e2ed31f4f38a93c2971e958b35e\tBUcP8T2F2uY6FzQETvDGMWHMZZLY95v5v9\t599446437\t5.994464",
-            "0f119e8f892578ed7ab84896844a69e6d8bc0f7e7efc339e665ba04da1606fbf\tBbDJNMybY1SwQTq1syoTuAu17zJDVNEbG8\t6249989830\t62.499898",
-            "0f3f920adf7127e1b2e3f14993b28b25ff57ce9500d1d643263ed4f4023ba83c\tBVNchJewgVVZp3N1dZyy5jXueY72yGNAm7\t7781016541\t77.810165",
-            "0f55c8f484ad79ccf59eb4e57efd42955151ce65944013c61dfd3dd6235248f6\tBfsFScf42cUYNfCygkdaZ6PHt13gKsQEKe\t577801196\t5.778012",
-            "0f8d724503030c33ef9e4abfae61bf1f6de5b7ce7ba15b92972e992a6bbea2f5\tBfwiYtneeEi8ceLiWWjxCnAPUpdJQrFFEE\t291897000000\t2918.970000",
-            "0fa65db2833bced355c6ea6f5782563568fc0f383975e618ed64960578cf9ecb\tBg2vGUv5cs1KyYvvSxwQxZTmYQLZcuzc2T\t611549415\t6.115494",
-            "0fb0fab0e49ed6a1a29fcf170471e0beb0362bec4218765b87daef13e61709c8\tBi3ML7enFyEFKh3zGfgXVePq2x9XHDtiTB\t999989672\t9.999897",
-            "10bdb881db1c71c605faf211b439bde8ae77a971fc10763aa3df0f7f445f4d71\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "10e6ee341ad55c1773edd5bdf60e8a550c3fe229d1f2adbfc4598bfbcd0fa122\tBaUJAdC4okYhsdy6oMWw7PBRspWZd9uvLS\t3259247132\t32.592471",
-            "10f7cad8db2fb3f8fab9af927070e8530e48c9ae061521b50782a154c6af8a24\tBmUYLjkqKesh43ukFnvJ6ZUjVShp7uLJWD\t6874996412\t68.749964",
-            "1164d5f189c28b9f41425f757f5123ce4800589489fabc4f50ad36d2ab05b091\tBWiuzqJw6XKpCD2F9TYSBGybJfYU8UbqM7\t442031918\t4.420319",
-            "117c5074686fa82f48956379225d9e4c51087266c10c139201f6ef42083e78b2\tBoashusebn2irJuYqyQUYSk76QaTmgPAxH\t1100394758\t11.003948",
-            "11ba7e4effe90b91add8889b5de8b5d6b6f79968fcf8fd358f0b4334d19321f1\tBeitgWFfRG47UT6Vsc9TieKEwfu1Lx3CEM\t749506740\t7.495067",
-            "11e5f18c674c35a1477f90df089280ce047944fac830e3da39a177fac3e401a9\tBYuMbdaW7bYU6ftQzTRVyG5EbymJHrMPKU\t577801083\t5.778011",
-            "121f1bcbabcaaab5d52ed7a96c3016393b10a56fe801ec4039ce30fa2625cc27\tBrfsDRannggco1GTMveQaDSsZSpWAcPQy8\t594441839\t5.944418",
-            "12488d4860cb04d4e29a2e8cd7767143f32ee99fbb8e6a056b4ced0ffb504718\tBdsQGhrt9McZcg2WFEHNK8DJx1fwCa3xec\t6100230583\t61.002306",
-            "125c1db42fb6ee7adf67d46bf196c8678e813b2532139152985700f6536c5fc1\tBTzXoUtrREvxis583hfyDpvfaku1JNLqPg\t632025079\t6.320251",
-            "12638ffb95d4d5121959fcc35c2be3259862858c82e46540d5351c8363b05384\tBiifK6uwJKWfo3rvoTgEDPjmGfXgB6AjvC\t70000000\t0.700000",
-            "1267b5a29401925f6d7e1af5723ceec674b8340672496316ba9a42b8d48499d2\tBau4RG1KcT6uACPrLxo2ZGSXgkxCKMVGwu\t6027136441\t60.271364",
-            "12dd0668153121bf7a9c586714bb7250a00e3d210312f6add03f1d12a25bfc38\tBixmYYbTF1m3rFaNU3synqq918BJSD1khu\t692701661\t6.927017",
-            "12e3934365adf36368391cc6367fb600d2932026184d010f36b07b9df5516221\tBm8vR8aExDn4uLLcrBKRvQ5kpi9T6Smvuk\t1484934710\t14.849347",
-            "12e7b8a83041ca78a5b1c9c5cb44df02033cf6b0acc5097361a4552c9a246530\tBe9c85AJZBAFpaqbZLSMk5TvqcTnBTi1hL\t6027136283\t60.271363",
-            "13824d5a1c8650b7a83195bca854f5b5603e49cf9b2cc4ad85df3df2d5e47d3a\tBWCMqon825Vxw3NFDvVatuwbH9naT22scB\t672205627\t6.722056",
-            "13a0956731b59493189cbac96d8ecfc5226d1c788e119e124c5e73403fae3386\tBjcNEn3wwUrJjXYAiZ7d6MgqzUBwd1yX4d\t594441919\t5.944419",
-            "13a1e12c60069ba3f29679f2bf724518ca6282ea26cfe1563b2fec56279eb34c\tBXZPf1qw22Lhnqichk6DnLk2KvtCYpRw4o\t472620832\t4.726208",
-            "13a879923ff27b55129bc5aa9a62f5cfeca78c468a7b324543855082643c4b65\tBXh3KJTF3y494976rstpbvU8mWU23iNTAW\t15211808834\t152.118088",
-            "13a879923ff27b55129bc5aa9a62f5cfeca78c468a7b324543855082643c4b65\tBpGvkjHd49WDRYHygWm8eeB1AxzYN3RLEP\t15211811684\t152.118117",
-            "145aca405fe3fd9a2ad9fe53ad82b5b922c6578baf537be2e0b39bcdbb34ac49\tBhE4QWoKkEXH6hvFw4ar87QAHroZ4awdKx\t9351240034\t93.512400",
-            "147b56c60ad5b536e52eb03272b001b61a665d19362f6361446702691bb8a88f\tBZQd25LEJGpNfSPgPRfFimhvXagKH5BhN7\t142000000\t1.420000",
-            "149e3c4307547f0402fca3a4145140774c547eba4f976d12241f8ca4fdad4c47\tBnAKtx6G5r5JsA8gTQacn5LFVb7qR79oBA\t1598043686\t15.980437",
-            "14cd2306d67d8c2f64cfaf99956c1653a62ce382bde1941b22a46e656820c8bb\tBobUgPPSAxLpvVPknoP6ACe4UE8f4ED7XP\t5401785043\t54.017850",
-            "15006d30660f11b1d0250904e2629228de56bd797a9d1f95803b39ede62d4287\tBk3nxWQp1okxCpGE6dM4GNpZQ3xjHYivPq\t6638872278\t66.388723",
-            "152180987718f083f8031decbb60fac0e72567115037e4d488189a5b416d0ed5\tBryRaDAJeBAv66zZ7b5d5zmxFRrngbU37e\t474419386\t4.744194",
-            "154491ad99b059296699abc86080ded31c8ad23b08da7616f856983768bd8aaa\tBdFePqRbGdqXJ1ZYrTGyZfDGuuSBhhymca\t507796956\t5.077970",
-            "1559bafcf37e874e375aea23e424d85c768bdb8aa765a8cc113588e30de0cdd6\tBVwt1woBujSGrsfQK9cgCLNLnD7eSgNeFZ\t672205627\t6.722056",
-            "159be2e9adca813da62df1b8c92d3702b0c34b38a0998de7e4ee0000f97dda6b\tBo49PxujL2VdaZPLzkZGC7sREGJCBawGNk\t7641202319\t76.412023",
-            "162311656f4194180c990bedb8b05de42f8e4d26768f4ec5b66621583392aef4\tBgEcUrf2TMk8xzES24xAypqKSvcXofLusB\t9333743415\t93.337434",
-            "16959e35d18429a8bd1162d32e13ff006cb3311dc9a1a7ecbe79db8e5ce81984\tBpLPMjDVRDp6PKr3i5PeWhwfb2BKhu7s4X\t670643104\t6.706431",
-            "169f3eda242870512c827c2ff464941b7259fbc7d2ae1e9a9328b908333279cb\tBqfH9AvA9X9Rg87JyCGpG89DSGG96V7KJC\t6874982533\t68.749825",
-            "16cbf7df487ebd8cb72eb515617ed05c02df7b58378aebba0cd5190e54a5ab09\tBdJrhAtozmG8QtbrXSugFEW49RyETtuuaK\t5911733778\t59.117338",
-            "170036e9bd3275a5627d794f7714407a175fc40fee5002dfee7d073ad146fb31\tBpjrZ6XsfFL25jZ3KVY9J7mpUqDVCCbUoR\t7641204596\t76.412046",
-            "174e12ae1abef61c43e8c9c623e9b46a57513d2047965a4b2bb6aa2c84984de1\tBgCyeSjbqAhKGQ6WqAoyvJMBPJ4ZG8GPnw\t1528039430\t15.280394",
-            "17e6d4a603c997669a9a2f0c66be9ebbab14e59c5e20f77b718c80824c36172d\tBc4FBYhnLczcJ3HPUQr8kmB8FMG7aFDL2N\t1288633224\t12.886332",
-            "18406052f6d928b2d821a79f7a859ea1b8bce6560aa695ac5eea3b4cc8ead3f6\tBnUweBzV23KgkBJbVSvEZAjESzyfUZLADm\t842294205\t8.422942",
-            "18b7b43b77c7dfdb49c0ecfd636a7bc01a6ba6567a58236be408d821cfba0495\tBfwpe3WS93HuzWYAewFhrWfDvJkFa6Tz1N\t9351240195\t93.512402",
-            "18b7b72568e276f6132620b1b674b8ced23705695ee675b92b5c7852da16306a\tBchY5nu8JH15zJnzXg6XpCJL66hgkx2Vu3\t632019065\t6.320191",
-            "193716ee659df968bfdc3f2e1fbd016cc9f4e0960686f314dc650682c093d3dc\tBU3xJmdHsQ1TvV9CuUxUSnPjUZHj8DtVD5\t1100394758\t11.003948",
-            "194e0324e4cc0a0fe49f0bf189f1f83f86de7cdb63a07c8b035a27aaaa7b3e44\tBhvGfTbUdTLUWuSD8qSP1Thz4bJmj84Ls5\t6100235072\t61.002351",
-            "19e0bef1df2779e114031e364aeb9b3ab384fd0a6a9ebfefab0a5f27263e7ffe\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "1a1d1181ec034eed65c984efec34b595d7c7b786a4971acfc3c3b71780cea86e\tBmzhmt9TfoW5SP4fqBKnwPZQFycmnucyk9\t5169793551\t51.697936",
-            "1a2cd9a6f833ba5b9f384fc856a60fbcfb789df915efec4eac116da485636628\tBc8xnFrVnX86YCzawJoWZrFV6LJqLD6Z9F\t99998058\t0.999981",
-            "1a2fee07a0f8cde1d02b9a5b925bec06dd91d69bdfecacd4c5c374b7a38efda8\tBjiwAupga1GMfJSxBsbarYyGNbhKNkCMP4\t139077876\t1.390779",
-            "1a88a203115cfa672d218a5d30aaa134ba7da5ebfcce6630a875906dd1940410\tBhVymPj1qHF8Mn5dNg8VhGLgXbJx3EKtko\t7147063886\t71.470639",
-            "1abbf33269ef0b2f95164c72b7cd0efad74684cdc532326dc64e9f812a0c302a\tBeNCbyVjKHAtexG3KHebXPFyfQEjQuo4x4\t493569322\t4.935693",
-            "1b0c70900f209ec9dbe2982d1b4cd9aa447488a6801a59c25c7da148b65a349e\tBjonfwqGwiU5WPpKAM5gGAB6xD5qpXa5Kf\t5607804130\t56.078041",
-            "1b140446950142374a2b7b94bf22c81281505e5e56870165e989a0a8ad60ccee\tBqEbkHHnwsfju8wzMjauruygrT8SaCvVKr\t632019065\t6.320191",
-            "1b292cb8059ecc6f3fd889671edfe7fb1b18212d9b800047186fbb4ae162b605\tBWSosBGCEoeU7Pk1oN4EEpFnKZt5JewwH7\t6864559643\t68.645596",
-            "1b646adc0795312551e0580974a65a43631579a92761e67e854b899806cdaa5e\tBejVVcr5ECStiudnKRnawJc1ooP72rAThW\t658837471\t6.588375",
-            "1b6d41233d4e8004169087a2e80aa242f4159d92eae0b1f42b1c3181cdfd0b05\tBoWhneVyQ1vAKvZKBfDkYLVppbrPW4uYGj\t6874982091\t68.749821",
-            "1b935f8cde62d60be48585b7d7565583c322499496be0f8909207f9aaf9f60a1\tBq763raWZip5jWJbU3jmpXdLLo5iDamKNk\t5066375985\t50.663760",
-            "1bbd070566c9bc4df737fbd05da51a98236f1d98887eed1e1d45a8901b66b6d7\tBm4zXMxqaEnGzwvvFPMqNEXvXS9hqB6gj4\t1030390501\t10.303905",
-            "1c6890f3988dce75d9142e4bd55fee24d1f901d1ff4669597493338b85fa8088\tBVaUTMN2vyUSzK7RJSMdzKY5h7ujh5c1E5\t999986863\t9.999869",
-            "1c6ad58e417fdcbbe96c35b61870587b18a5ab527d13e9e2feec4ece1cc2ba5d\tBpBetBdwZMXD8YneemMwKVTuvdjVnm84U2\t1484934710\t14.849347",
-            "1cb6e1d47b54dee30364fe9ee5bda1d578db84b4be2f3db571a78f7b5064a695\tBfwYWb2aXezNayCEDwQ1oENe6TSdhLBhdK\t979192855\t9.791929",
-            "1cb70a2bac0fa601377909f421a0198e30116133e2efe96e21fbb643d42ae6c0\tBVH5G4JGC9zCHvKbWbshc1n2bAJPntcais\t599890336\t5.998903",
-            "1ce68d056625ab651149728e57413ca4e1e3d7b8705ef68f3c52b5c58a91bbe0\tBc2W2xVGgd4aEVniEEfSB8xabE6fDVyJ5A\t512036158\t5.120362",
-            "1d19ac1533bf229a1df1b5531581efdbb8fd307456b6b92791d7693a5ac75453\tBa3i6YsXbBjA1e3EreY6vwZzCBsuGyJQos\t1485407119\t14.854071",
-            "1d4e9f06216b17c8b8f37b6ef70f469d9f9078edea284fd9bad0698f8718a208\tBf2HsLwZPyJRnqVaTTb4fKfxjMwRFCNQLG\t632025079\t6.320251",
-            "1eaf320203d0b049360c31f32c5100490d080becdc6164228359daf7dab6869b\tBen8WbC1HQ51E6yBVCzSc7rNt8kmP5Bhqj\t750292645\t7.502926",
-            "1f09641b9915da17b87b8438afb29d9729eb74894ae8c7518939c4002aeb643b\tBVAuLRx4bJpq5u1iXrxLfeHgsHZ7xiFPV5\t5401783820\t54.017838",
-            "1f6a8069d602ff594b12b70880f9a36775a51fad243f62b9d872a6cbdc0520d9\tBW3BjRz373SWi1VxWNksHV3ag5zfp9pZiF\t939024839\t9.390248",
-            "1f90b59c14af5a75c09049c9b18fb024f84ec8965c5398eab060b9fec92f9c5b\tBYeDsPWHm1hyqNYB2iZimtLnJRJJhrS6V1\t749506092\t7.495061",
-            "1fa726fd43356ba2f7c469dbcb982374c3444b3750ce9ef62ec820415223888d\tBbHCxG4mPci2LX1yoR7YJx5EmDQBWfLpLR\t594441919\t5.944419",
-            "1fd4be60349bab76bb73b861cf8d57d702558eca1762c5cd2eb8de4c94e39977\tBYi67nadFqn23eN7r355fMQYqLoBancHfp\t598858327\t5.988583",
-            "203989983ad087aa49c3a0abde1fd8255d3ac297fdb547fed73def58822e0983\tBer4AvotzxM3cNLUFVWrDnZmuRgS1fA5U1\t7147059218\t71.470592",
-            "20655f90865bf23a926772f9604b6438c7bcc0d93cbd00cc6addb350d5a66bbc\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "2090fa26150d1baa73c607cffdfefa5c814e009b5673169e1570fef5508681bd\tBpFg7sacBgQ4p38WWksmzXoi51dY5zCMRr\t9401984755\t94.019848",
-            "20b2a30bf76110f2f3fa90a75488c64fadb08b6c2e597917962e5532c70f9113\tBWeyQMHd2wQjWsatDjpen1joPv258fCGSF\t577801196\t5.778012",
-            "20ee0dee74536417abe351afa9624346644207c16e5ad33634e53fe7ac941a0e\tBapQw7zkk1Wbnh43L3m1vKZYiUAyHXobNV\t6249985817\t62.499858",
-            "211b389b3874ac61c1cd8f7d931ae6636caf24bb9940e750e6a4c355bff262f0\tBeKTZGjTzEjRVtKTdoBra6DC2da2dooWSK\t979192866\t9.791929",
-            "211d260cb80a215e8711dfd7ff05857758958c87b39c9168004e9aabc23b6a3b\tBkj1eTaV6SRsmvAoWnq424MP6zvSVutcBe\t5169788929\t51.697889",
-            "2140dbb0e9eb21c6ef459bc274cbf9cd9e1f2c9e203e23b48f580f6d693fc6b4\tBqPgE8GPCtQzKNUtEU42gGA6LrqXBMyUZE\t999995135\t9.999951",
-            "214706d15a156c1d462aa56a1ade39a026e19dc99e6d2dc9a211f274c0187fb9\tBcLfhAPvUXy8yjxMiFK6AP4gfjrq5s1KT7\t500000000\t5.000000",
-            "214706d15a156c1d462aa56a1ade39a026e19dc99e6d2dc9a211f274c0187fb9\tBgEKp4zSK75adMGKT8vH5homi82d1pNLZj\t500000000\t5.000000",
-            "2149ac2108d3e67b327c66fab6b1789ec3d42b660fd28ed54bcec0b89c979571\tBhsYEomDM9T7FanU4TCJ2Zgaut2aKypeXD\t976769501\t9.767695",
-            "2171f0526e73f3169e2ee8208839ace764373eae93ca83a1c31ed6c764d1100f\tBbDrJVQpxki2gyS4Xee29bsX7bjn2zbuVs\t999989686\t9.999897",
-            "2173b3e29e02484f91e876f5376833e97091c1eb78bf6d68d1e77ecd905e3983\tBj1AhwhVmvMf8PXc3Hc96imxZwaYKFuaEh\t7641209899\t76.412099",
-            "2173b3e29e02484f91e876f5376833e97091c1eb78bf6d68d1e77ecd905e3983\tBkkx3f2Ntc53AGK3CKivEzDukeiNegZvFf\t7641207036\t76.412070",
-            "21cacd4473c7116a8b42f463a46c7a42f722c9411877d5f08993280654fa6d24\tBfGySxj4fQp4ceraHVzLnwNYJ9VkBCTuGi\t5401788379\t54.017884",
-            "21cacd4473c7116a8b42f463a46c7a42f722c9411877d5f08993280654fa6d24\tBkqpMsWHko6BGNPTxPUUvZd4QcCGELKQo5\t5401785516\t54.017855",
-            "220d6f61fc2288035eef978ac212e9ba5ce714f815721e09dbc5a9fc89ebadf4\tBZ6k8gLfdoQ1PmWmiwNW8ZVqemummi9tyq\t692701870\t6.927019",
-            "228bebf8b450f5e9ce08b77d49345e5f3a22acbe10ccb84a5d74a1307f6dd538\tBYwjDPntRqU2Kah5ZhfYthHmvX55hGk1Gb\t6083333072\t60.833331",
-            "22a6418f23d04284e02a1661d451b614151125d45ed586644c621c361f85f0b5\tBcFyuMTTjzHR83cmafQUiLhY9wGHCnTRBa\t976767590\t9.767676",
-            "22bff2e95c4afdaa92afa452036760cce00d88c6b2e0505834c0d3fbf00343aa\tBneAMyt23RoRMjq7yN7vyCrUoT1VbgqKGF\t1100394789\t11.003948",
-            "22ddd45faf7455c10177042d753d51b5685fcc79a7948fe4994803501d2ab1c5\tBkBeRy7RBZoS9kqmHMMPN5DnHsKwxgg2z2\t6027136295\t60.271363",
-            "22fd55a84e6943f9c70c1549836f7f7ff614565df0ff9f57df17c0894ea1ea03\tBWVPqmNzFX9unNu7dTxtAVEihqw2B6fh3C\t575921411\t5.759214",
-            "233488d347479eab5f55766443dad7858faca1a5c1a0cd533e4d132053eda693\tBaxWtwNCbmkiV4VpTaTUmByD59xyWj1Bmw\t7132210683\t71.322107",
-            "236c88585e1aae5b3646a660d00f7e90f04526858be2d95267ba844414246d0f\tBbdPy4qosnvw8GKuGEGJMgLxtUKv94Fwmw\t1484934722\t14.849347",
-            "236f85a282595016aafa49e2240ecda7663e6385c6a3f353ef2e55d9e0fbb90e\tBXExT9uFgPZsPuNcjZe834ZLskVGyNPc9B\t6864562477\t68.645625",
-            "2372a6aea2f486aa1b48840f8d6e7a812936007b9fe5b2898983cf60c9caf8f6\tBjzYBpC2n8iMBdL45SL4pRUAAuwgTvMEaA\t999995315\t9.999953",
-            "23bf55ad6d997e27a6ab6599ec755f7dfedf45f623b9ba1887ec8eaf88d42793\tBqqfWZpqoNe27rRiXTJtfZijaLZMw5Bp84\t7134339399\t71.343394",
-            "23bf55ad6d997e27a6ab6599ec755f7dfedf45f623b9ba1887ec8eaf88d42793\tBrBsocsSvF7avQtr96JeA1Zd6fFWqQ8bdQ\t7134342249\t71.343422",
-            "2490a3ed0ec3657aa746e92b86b99837da8091f65f5dc4463a8594290afc4cac\tBpyGbuNQXEJdPoeS2Qf9ksQ1vR4NVPuCrn\t1598043686\t15.980437",
-            "24c9c10249a32d6e15987e7ce13c231a155ca9a4472ac47afc3413d4f8bc0d67\tBgZrQHnBgFEwVQjgUNSS6dKuRcxy1BDDYq\t622696863\t6.226969",
-            "24dd0a98f6135aad8ecd1008279e88b08e21fe418e1fea9516e4c2122f439772\tBX2DpMP77hP1DNY3Vk8weQBaKc92nXFhAD\t7558329462\t75.583295",
-            "2515feec74984c05f7be8f8fd7afcc879897b2381d08a53e998aee2d79f0e2c4\tBmLixz23XwYt4HN3eyHQaZGCGYGdXarKT5\t999995327\t9.999953",
-            "257466b8904cff496b56f8c0838b2a37689b908fcb1c74ad0ac3e3d182ffe9e5\tBggfELrfWaQR8eh9GXkSkwePhoEENpN2Tt\t4726295433\t47.262954",
-            "259f516642fe4131a68a0c2fcfe49832f9615ec46a885a16f3a355ce11e8194c\tBVaUM9X9YyukN1jWDvo2k1WZUhU3XQ7hzX\t1000000000\t10.000000",
-            "259f516642fe4131a68a0c2fcfe49832f9615ec46a885a16f3a355ce11e8194c\tBWHmob4mBTfzSwyonxQbThjCzcECS6U5xJ\t798739852\t7.987399",
-            "259f516642fe4131a68a0c2fcfe49832f9615ec46a885a16f3a355ce11e8194c\tBakeQurpYBTW1uDc8PXBbf5DLzCRUui1QY\t798739852\t7.987399",
-            "259f516642fe4131a68a0c2fcfe49832f9615ec46a885a16f3a355ce11e8194c\tBhic8QHVAqcG9zTqkSYhw2QLZpDtYhVyqh\t798739852\t7.987399",
-            "259f516642fe4131a68a0c2fcfe49832f9615ec46a885a16f3a355ce11e8194c\tBnEoxmzEzbiL8caDnKerFEaDBaP3tGcGEc\t798739852\t7.987399",
-            "259f516642fe4131a68a0c2fcfe49832f9615ec46a885a16f3a355ce11e8194c\tBoJtXsApkdiqxMkjjVkZnBaA417bEPHzYG\t728734840\t7.287348",
-            "259f516642fe4131a68a0c2fcfe49832f9615ec46a885a16f3a355ce11e8194c\tBprwbU9A8F5tkMNQFZf5e4XfXpK8Lhj8AF\t798739852\t7.987399",
-            "259f516642fe4131a68a0c2fcfe49832f9615ec46a885a16f3a355ce11e8194c\tBqJeJZ63Ms517QPHUYpP5MnahjjiLgF87e\t798739851\t7.987399",
-            "259f516642fe4131a68a0c2fcfe49832f9615ec46a885a16f3a355ce11e8194c\tBqafgHEKbE1qqppRdnCBxV2VgAoRn2E523\t798739852\t7.987399",
-            "259f516642fe4131a68a0c2fcfe49832f9615ec46a885a16f3a355ce11e8194c\tBrqS494DSGwaGDYyBxM8Ue8u2NKbfiu8M2\t798739852\t7.987399",
-            "25c9acac0778326f3cc2561f66cd09be2764467d032face94528e36c735eb428\tBbY2L3nehQzh4Jrkr9ZMkKTXrxCUPDjzXi\t9358620699\t93.586207",
-            "25cf5ec0b81511fa1ade82374bd66008ab12916e4605d0b032d57bbc1f619504\tBpVKXUciu8dTqzV2DaxqcEJ4vtWe695i2U\t6100230607\t61.002306",
-            "261859411a876f42fa508c8074e25846aee9009fb876acab5247bdf29d88e10e\tBV9jSc1NYnk545oKmhQd12aXAnJqk4cDtr\t1484934722\t14.849347",
-            "262d6e58d1546a65d11f75da5bc9189f7738eefe20661c174d4cbc4f405e734c\tBrWqqYq9pKSgRLNNRPicABCLg89PvCb5yH\t577801071\t5.778011",
-            "266c46bef89b712d9c328e7578f01b3c3aae559ccf02a4ad8ef53eaa0f878d8f\tBWzDDudfeEBwGqrNFXFZtp1gebcPcytBs6\t139077876\t1.390779",
-            "2671b25d88dcac109f57617d8d96cabd419e969c92f36e68ff06e47df666eecf\tBhkGF1iHMsaNNnfkoMU5k9gTLNdwq9ybCb\t2300789972\t23.007900",
-            "269ce36a687ef1bb90a8e476003b5c52f1eb563eed6648d6487bb5d59db38425\tBkhNxdMT7MVa1GYdS2Exby2S73DmgMdmN1\t842294205\t8.422942",
-            "269dda92762b3c608ebe3b293fc8b2d9acecf84969e114397916d188c8ebf455\tBXACdNvisnZ6okdwyKvb4J4sWUWcovxX32\t569679622\t5.696796",
-            "2746f13d9cd3485c4adbb721c88da79098e435110a3535440bf90edaf4bacd57\tBofWJXCmmQPFU8YxuQqVCT4mToBQTU7tsA\t6874991833\t68.749918",
-            "276177b56305ceed9e6e78016c596b42c3e9537ecf25ce37697f18cd7c6c6b80\tBZT58d3Bz2rwCPci2NDxDgLc9JnRZQcH2R\t462928410\t4.629284",
-            "2764be97934de786e495d41e0b3e3dfa86858ad8727c4e49415b471a19ee0ea0\tBh3qnFPy4nhz9PL7rAWzpXoxSvjhDgpRiv\t70000000\t0.700000",
-            "2817cef1824cdc5a9cc4571ba18cde1ad053407f7543c57703d88efce62fac10\tBj6EYUkEGtUkvAof33QcWzfpcsc3Adjob8\t7558327836\t75.583278",
-            "282e8dea7826b1a3d1ccfbf4de7c00ab4a967db890a533d7e7b38210458e01e3\tBgGawYZgrYA1iPtpNz8Xc2Yn4bYabXjYup\t6864562524\t68.645625",
-            "28a268f2c19e5a1a3b96774ffa1af375b4345399db290db5a862ac5562f7aed7\tBnrYGfotWe4a1KWX1fzNvTxw8U3McVVM9F\t598858339\t5.988583",
-            "28f9e6edfb50fedd8b9e62cf23f9f40bb9f46d0c18ec7f6072979c15d67f2e00\tBr5HDLb42seP465WH4SwoYgWvVKhkBVQ5U\t1414930185\t14.149302",
-            "29672c0fa546585a64685f138960a8edd94246427315ce702ced66ea149ef9f7\tBrAke4z4WKM78pjSwHhnCUkZhrfMtR9siC\t594441574\t5.944416",
-            "2a3a02701a11dacf4206aed548894655d0b7a23bc84ec6f4d3d112cd8229c356\tBrrNjF5VDEeHNFUew2JbwqqTkxPmW4cd1k\t139077876\t1.390779",
-            "2a3b296f10ab0a6f067b50ceee6c173974b1b3734aac7af01db2293c02708d55\tBZV3TNrB2XS7TPWYYfeUCL3iC6sowahLPZ\t594966628\t5.949666",
-            "2a864b9ace627dd15f38a68dca6f14d31080cfc4907601d9bf97226ee8f50483\tBc3C2TQ1WvWyJdPi272aan8xoo6D7nsBYq\t999989660\t9.999897",
-            "2af4f1f704cb9b035835f0b1aa3c6f76fddbb4988da3f48cbaf902d9c7108517\tBjdjD5LEX9YjSEfixZXd1M6xfocozMVhDu\t6100229224\t61.002292",
-            "2b43503d2a937a6ecc15ee45dc182bebae4932f9b43844e7b1b0ba98ea6e9413\tBVGyqQ73SKcJfebBAjz6HqT9wuD7fgS4aF\t999997981\t9.999980",
-            "2c38fa6aa33928ef87d89176fb2ee610cc5824f8164df1299468b6d1ed2d6569\tBo2XZ6Gimv2v1C7osnuDtzEcky5PbTKrSd\t474419374\t4.744194",
-            "2d25c8d3982139016331f789a6813c359f37a738513553b8096027642e481811\tBnUiR25BwqXykwEeFzMLeGJPTiwPkB3wEf\t670643104\t6.706431",
-            "2d263614537f6e1b7f25b665a63555160a91d146b32a07871de974869da726f2\tBbhSVRZop1wWrAGhBTddtQURNGe7pgSEx6\t750292657\t7.502927",
-            "2d674f78cbf557f97e2be94cc2a733ca140ca7e4e416fb9ef2ddbbed9c0fe4dc\tBYJcERT8ptstz6dhQc46VDX8G9s1c2Jr84\t474419386\t4.744194",
-            "2d7444cb5fddefd99f913a680a1dbb0ec14f8150ba0ef4ab87f766abfdb183ab\tBXAuwwfG7VYRJaPiCcYt9gNfP8CGGTd4PF\t9749992333\t97.499923",
-            "2db47fab1c59a6c79b6c5575abd8673e1aff1b08a5048c01b5f9af5c03c3011d\tBWcTDNFFSbjy9N7aZ8mD4Cdhxjz4kd6qU3\t6100230456\t61.002305",
-            "2e04d120c9b2e8eb5d28973a4421cab161186898ee9824b4dbd0e275d8ff9d4d\tBUezEW98b1NvGYP8cVMqZkNGs2zLT84jNL\t749506080\t7.495061",
-            "2e775191393c61e9b6366b34119cc4db4e56992f0d5ee6490803576cb39154c3\tBnaa2v9Zgag6rqc9MPP73rJSoWmtr4MfAn\t999997969\t9.999980",
-            "2e8e198d14943872e8650c53d7832d3e73e90ca20ed6a33483e448f48676aba5\tBrpUVYTcR4KkunJcL8hEoALmRM96p1XUTM\t1100394758\t11.003948",
-            "2edeeb41ca7c3d3a51577cdffefd56be0ba64cfa2259329b5d222bb36c45ff07\tBgYQLuv3SGdmeUvgqjUbuMZuRUomCxEfGK\t1484934722\t14.849347",
-            "2f2dadff390dba0244b9f87632dfa8bb91c61122af371de4b3b040dd3fff5379\tBpBnEgbPGKceAyFiNkAqC98GLGPHKHi69F\t472620820\t4.726208",
-            "2f32470935038b30ed5b6f8813c085f7a10708a62df70c67c3ef5bb9195cd8d7\tBXwxSSntCAgn3w7g4nwGVSDoCoCFTsX7LJ\t7134335346\t71.343353",
-            "2f5dca4abb395a2e27e53cd30043f9842d30b93c5f03e8baf65bf3a0686a26a9\tBaTqQtkv2PFwSZ6nQRBnpa4vxjciEeJYf8\t2151717610\t21.517176",
-            "2f9ad213b9863570638fceb07393fd418096fe5d7ed645475012ef62c5685a06\tBUvHwUiRrhcatJDYNfg9VDJXY1ZL5ekiUZ\t577801400\t5.778014",
-            "3006169c3aac09a944b9b4a43895f2549ad37f3c0a060e5a1b45efff80aa8f70\tBj6T6Un7QigtUUWM6rxjEk32joSedinSbb\t1288880619\t12.888806",
-            "302afc8642b4260d6bbf0b5f25b2c5b09f91702e8cd52fb9226102d064dfa677\tBiMLCN3wNaoVHPZVQMbood2z76uwpMpdvJ\t9358619068\t93.586191",
-            "3030e8525d382eeaec619ef0ff6e5e056016165b823d53797fb04a6de3affa73\tBqUt8P1JnTFZqCXqaPjhicuKCpdiRM1ff6\t972211838\t9.722118",
-            "30986a1447e090cf9e4ed6ed0dcf9f68146914c06b1918cc07dca83c4ea211e3\tBoq1PNpzqXWpKDZmUVrpcHtf8Nf6MAeJ3a\t6119413801\t61.194138",
-            "309f2b2aa67bcf886595b4f4dce105c58a0ce4c708da54f8913a5d9ca4a6f1b7\tBVpqEdyAbVmtGdZiau9TWkT6k6pggjkoRe\t6027136283\t60.271363",
-            "30c76033e65e4aecaf7c18f6ebfabe9a90df4a162f69ef6c538e8a38ec8db773\tBjfqvanJmecct387ESQisApF2mm2W7GAkK\t5607801150\t56.078012",
-            "30d797b6154294e9b67fd41a9a6964e82ecc72569e40b837ca705d9c3f9ef992\tBZFmxTrG4EwSwJzUg5PboRWBn7Qn4wCmui\t2300790296\t23.007903",
-            "30edafebc680926f45d5a6a9005991fd85b924727ff80d9a58f780bb24c04f8d\tBYz8CfgA7Ee3Tq4gCHFdFaA7ihbuDFmoA3\t594966640\t5.949666",
-            "3127074520aff8009a6216cb0a5d78eb21036231e02373677744793b31de7712\tBeZe1FBdF2UpcpTKVh4uXX4bSc6LsS1G5a\t577801071\t5.778011",
-            "317a809c1d7cd8e6fb25994b2fa7b6c0784c583e0f3e1fa5ccd16c6abcbc13e0\tBdDguJWFkiNSmrvtFkWZyKCA8ERAzqMU8b\t5837489881\t58.374899",
-            "31b85b6cbd3ea913e29eca7d972e9c4387f323af86a1bc03fb06283aeb964dd0\tBqBr1zGSoyNWxtUb9NSkS2SoNRqF8oGQUn\t594441907\t5.944419",
-            "31bdd8fc3883fba9c572991aaa52ace8727700e3773bff316c9a62fcdd81889f\tBjwtguaDXHQKk6R4TLmS85sBKzef5xqU4p\t999997981\t9.999980",
-            "32bd100dfc46a8e91e6aee4dbec8aa1fd4244c6c51259c9d81d231b8dfee8622\tBXu3bpZv17csy3X5y5q5TQKRkbQgMDD6HF\t402616296\t4.026163",
-            "32e6d169b92f7890f22c0957f66d9cc2611b69395cac443d89e6163ec1a4d4b9\tBm2pbpiu1G3hc2v7rTFsLHm2ES5RX9PfhM\t906764502\t9.067645",
-            "32eb3f9367953a805d90be6567efa27a91dfd7452348f24f03898cf44bc18ca8\tBdN5K4bc2Z5UEd1sdYPnLqX6ueNxncWqCz\t764547753\t7.645478",
-            "3327e7810ab037983618198e6f6610e70767ce2824b3e7b27fc157a93aaf97f0\tBWyuu7K4Ky5Tj2RTDsxXrGCmDtaAwEL2TQ\t749506740\t7.495067",
-            "336ae1a6c7894b5083067a75d0d2cbdcf0c13dcd36c19fa1b22a99579c9ebc5c\tBYovESA2Sv3h4dVaAax2Ky7GgjLL9evLBH\t32412611613\t324.126116",
-            "336ae1a6c7894b5083067a75d0d2cbdcf0c13dcd36c19fa1b22a99579c9ebc5c\tBeRZMsz4bYZNAYjjZwJ5zHEog9gBPYG6gM\t32412614476\t324.126145",
-            "3388eb0578d250fc10747224d891ef6ff36c5715fe8bd7decf0ff3c64da50a4a\tBU8dwGt5Knr3vTBKnZ3Ei1p1zfY5mDdCsV\t5012481526\t50.124815",
-            "33ebba734c6832fb6d341aceb45591a5e111c8d9ff7a54a0703fb9006f06b45a\tBhRF5vQCPrYFkm8WLQXTs8KNXbwfHp452Q\t5066374777\t50.663748",
-            "348f2fda3d1409461d5798902d4dfba7d9a51e38a827e1acaf67c531ff37b372\tBnaDGn2ab9S5QVJF2ukBK9V4Qu8rxmVAio\t999989674\t9.999897",
-            "3498096be143200396376bb87ccf9fa9fbeb0ab565a9af3c6d98afd5ae33fa5e\tBbKhPdfPt51AjefN3K1sGCnS7TGQRRh8G6\t976767578\t9.767676",
-            "34f69bcaf1f2568713daa24ac88f2489c36b946f22521b01f5df0081ae0566ab\tBkBxJhtDpQSdUfzk3aeGM23jjocwEzdDM6\t7645580963\t76.455810",
-            "3526a733a3e6d29bde3ba1180060fec10f5c1b7c23f91c7c99166bb443d36817\tBZevwb92SxyarbNyZMcG5TUozy2TmxtxM7\t939024827\t9.390248",
-            "3540b16b86369e6f6dddc1fd5645b3f808e69e3ffe2724aa3889e4674df7dfaf\tBiNLx5RnncRaqqBKXPW4ENQSGcHyGTq2Qw\t6299054213\t62.990542",
-            "35a342fae23103b5ff0f14edb2ff81f11807644a160de2ed9f11a9d834eb0988\tBXgMxrDr4wFhrR7MPQQSWQtyoGmzeJAXz6\t7781011860\t77.810119",
-            "35dfaf62106d3d33a231e85cea3967bc99f927c3ddb26a2a1e111ec9cf5e30d8\tBXdhsW4awqvFiwiMWSfBhx1f4ADSsgh5pR\t6249996534\t62.499965",
-            "36630d12a681576228e69622347466318ff5916bcef50bddf4dc069c3da96252\tBqAv4kzNq6MxbYUMyBiYqmSspVz5jUvaWK\t9354321816\t93.543218",
-            "369013d93fd317a2428db4615b4dcb638bce26b9aad82f99a6248f99015a4aac\tBbZv4L5X4DTy3uG3gxMqkHH4E3y3oAjVb8\t6249991713\t62.499917",
-            "36bf8ff3a9dd39c0112f1e9e913afdfca466de9bd0aea298a3f785ecc87fee32\tBij6Yyo16YpC5FW7ouMXLsM1hCjghvRCMq\t999989258\t9.999893",
-            "36f246b6d310f9b683e415001377421d2eb48f21372942f7b956e05312351fd4\tBqA3QNmdu3M6UWRvbWGDF7FjSUvLdLxE7Y\t5066373128\t50.663731",
-            "371a6fb44310f87ace105638b57a8ccd9377a95420929e8d102d6b0e627b5dab\tBoGJomzdVAjn81WdsdkSk7oQQmnzR5wuya\t6249997565\t62.499976",
-            "3729152de80260178c936353d3f4cd7ddf81672c85b10d72a65f9dd46f749e4f\tBiNuSX9Wvw26UYirPhtMsVDDfXRmrrm4FJ\t5153623755\t51.536238",
-            "3757a56a0923bc0872bb3c89bc16efc3dd794fa320edff4335a1de57f1f7195e\tBrxjdmpHqc5K1AWBi5MYvF7kTmvxqiGVDG\t432920130\t4.329201",
-            "3772cd4d2d5864a9daf7452695f9d2c23a90f61fd429302b6de126c272893d8f\tBhfu3tx81UX8z8VsmZYY2KKh1kJMUuQJzE\t392923394\t3.929234",
-            "37d876af6352595deb5a66c5295807379d42049213e4d77d6a58e3ec6cd87c54\tBVYQkyAj6F3tAga9eDiCkwQTmNh7WpJwk7\t239998956\t2.399990",
-            "38cf3367dcbf90e6a0199c1d4124f8d9ae39e6356c259bde0a9d048f57d73689\tBbd6pdCqTGgwJ4xswF1ZNi6TYZhyaJNfix\t299994800\t2.999948",
-            "38f685c9f0862ee908d0a9b8d99985c7e95764e834e636a0f4cef17aa25abfb0\tBYw1ciQ8f92pRZESK4bysA5iEqDBGZnWZ9\t6588228153\t65.882282",
-            "394070282fb48c4a77ed6bcbb1a7000bfb82c3df09ed8d14e29ef493970a3f67\tBXZVAbhUqowQSTy9Vqrr15XrKYREfLNS3H\t764556845\t7.645568",
-            "394070282fb48c4a77ed6bcbb1a7000bfb82c3df09ed8d14e29ef493970a3f67\tBZ1xoXNsNvzTaBy64jVkCFn1L6ttKUSTkU\t694551839\t6.945518",
-            "394070282fb48c4a77ed6bcbb1a7000bfb82c3df09ed8d14e29ef493970a3f67\tBgPrvmuB6f9fMkjAUvxhVAQC6YYDFvoJWo\t764556845\t7.645568",
-            "394070282fb48c4a77ed6bcbb1a7000bfb82c3df09ed8d14e29ef493970a3f67\tBguU7eiWzz7P849tpLwrwXadvwYZZmaKbJ\t1000000000\t10.000000",
-            "394070282fb48c4a77ed6bcbb1a7000bfb82c3df09ed8d14e29ef493970a3f67\tBhrxV3zHYbzKpfKAAjTUGYiVVx17XGMf3T\t764556845\t7.645568",
-            "394070282fb48c4a77ed6bcbb1a7000bfb82c3df09ed8d14e29ef493970a3f67\tBig21nEFz7tm86QLfdiJ8vPrkWmgtJ4FKv\t764556845\t7.645568",
-            "394070282fb48c4a77ed6bcbb1a7000bfb82c3df09ed8d14e29ef493970a3f67\tBircjcnBvXx6ivY3FPZRwWXrEtGNpbKyd5\t764556845\t7.645568",
-            "394070282fb48c4a77ed6bcbb1a7000bfb82c3df09ed8d14e29ef493970a3f67\tBjTJDbD13NPkYPP23ZqPnCCzHQkys66fhC\t764556844\t7.645568",
-            "394070282fb48c4a77ed6bcbb1a7000bfb82c3df09ed8d14e29ef493970a3f67\tBqyq9QC6xDHZXopoqryBh4hrVYgUunP8jg\t764556845\t7.645568",
-            "394070282fb48c4a77ed6bcbb1a7000bfb82c3df09ed8d14e29ef493970a3f67\tBrK52NZ6qAJXntpPWJpHu263wTmfRDux1x\t764556845\t7.645568",
-            "3963e19916ac57660e164e1ca0630aa1ccc20a97f062ecaab092991c98867b84\tBoCYZmRGRcVeCVRuYQsfLKY1HpCMiy9TrR\t6027136453\t60.271365",
-            "39779d24b9e516a22cca09991eb539c7e44c7064a559710e5cbf6ed5fcdc329f\tBcjpBgVnq8B3MdC8MkXp1Ct7Guhj1KwoYy\t7134334056\t71.343341",
-            "3a57eadf8fee76c25bf692bf079e2e2a2fd04def56b65aa9b36382a9f63cbf01\tBa8obszKmYQKNivmY1sFDu4eH89exPANtt\t588833228\t5.888332",
-            "3ad286054b84e827fa99b32c9e7add29a1d1d7568ca48337914d6ecf43cc181d\tBUM5Es48rCFoRBtYx2hE78f27X1oG2tyDb\t999997969\t9.999980",
-            "3b09881253bb5b09461f33e38e6c648f20cbbdeed3c5e214b623418b1a97f0a7\tBeszSA9M7mrGY9aLX4HQqWvxjtvi1dsH4B\t9399364261\t93.993643",
-            "3b2363077910f85c2d03473b016fbb986cc964574750c71a1aee92e1af32c4db\tBU25wy7RGuDYy8nAn59p3nSfC26KnsBG1p\t999997981\t9.999980",
-            "3bc6b787caac726f17f0222bdc6bdc29bb1341b52eb26a6eee3a740841ecec00\tBfZm7TkUaGwFeFQ81Ym8TV46GxRQ4AUxVc\t269997070\t2.699971",
-            "3bd4a4a03afced5d35ac5da46f137b725c16b1b2e907e1508383cefd0dbb0cd8\tBn9d4SexvHaXvd8scxWan3Wn75LVuDXyHP\t641884708\t6.418847",
-            "3c2c3bb5590b992fc9a1b38488562f96f38a053fe1f7cdc9e108df91c95acd48\tBTwDpicXgF6163y8CmNjs8aBPNamTduffG\t1485407094\t14.854071",
-            "3c3db38444b38f263ab6c1e025aa10c1dde21756311f229f74de770ed61925db\tBYTmywfwQPwcpuyvqtuPeFR53Zc9Pb7QTL\t594441586\t5.944416",
-            "3c432bea1b2ecf3b262b32b9494348062e3e910cdaccb8fa66876cf68d58a411\tBqNpYqz1PPUTwdiTCYHSVYwfDUjKViEEg2\t232029955609\t2320.299556",
-            "3cc1a8586238c15099ca764dea4de6f1a3b251ff1a38ad222556022bb42fde48\tBd56BprRATHC9UUjRW27tt4WnUJJNtxejf\t6864556343\t68.645563",
-            "3cdf274e34684563ac052ffa7544520828066fd327da960ea956fe4cae699651\tBen2n8TYzYVRqt3aUKMdy1m2W11LPgYnVg\t125123976280\t1251.239763",
-            "3d45975a23e63e1a3698c0b5d1eadb1c8e138d3007ad10803134267242aca87a\tBj3jMLi45jBCSDLGTc5UR2veJVdBgiCUJZ\t999986827\t9.999868",
-            "3d73353f197f4c0e0172c72a2ddddd13fead4d7b62f33801abc1d4822caba920\tBZWeZeFTs4WrdErJih2fg4zkH3Jvo68zMU\t1364047290\t13.640473",
-            "3e3566ea77517f3d00c4bf7a0d8e3e34eef319ba1d58f1447ee0ac20b9182560\tBk1ixCvAVRzdDcGCyrkcCCgLwR9xUt1Jun\t749506740\t7.495067",
-            "3e62b42c0d0096c0192e16b577c5f2e40a4ddab238be1949c9e19fbee41b60fe\tBUqfWuXeEeu9BchiVRSuNzAcZgFvDJeBEW\t9351243042\t93.512430",
-            "3e6979a21a27e519ac0cd077280b386304738d5b4bb290148bd08b5e3389717a\tBkoG6igRhHZsx4rXBkEY4tCVsqemTeTcyv\t594441919\t5.944419",
-            "3ea4b691ef83380a363b36d707bfc80cc6ba0429e01ff22825f2b0f3229391b2\tBTujPm43kxBAEdaNYuSuE9dxyLV6ZG587X\t474418529\t4.744185",
-            "3f1e04f2d6b4d8ad4e2e1458c29b8e553e424437e82848613e289bc0c6106546\tBfZRHoRg4En67qqihwEin3YFYJdHEgadfs\t6027136441\t60.271364",
-            "3f236e5998659ee8e49e37f74959932b77f8ffa44d5506e180984629d133bbc3\tBiCAC4PS6AMRnEy94qtfMcEASd9GybpWSA\t999997981\t9.999980",
-            "3f48ce717a1293a9953e4a3f026e08f8322538848be43d4b042987e933ee90e9\tBWzUt1ZqBb3gLpxigs3Eup9XUjdLhLsMyM\t1383770271\t13.837703",
-            "4005f7378ed65656ee052a81a29a054306855b70e1813466c93e98cd640316a3\tBXV8wwUq8FrpK287nUdpGeXFdRD6qs3LxL\t611549415\t6.115494",
-            "40135de1cb6b9e005500ec6a8a1939d393acb7099dfc69ed6b444343bfeacbd8\tBmvVmE6pxpqs2xaAQrYJHt8yMkdv1BPZPN\t9333740437\t93.337404",
-            "40184c498bd6ec2e9269de51ae1eefa11d46ee6f725f985cf273786135a8db24\tBboSNqm18kPhxjXJYGEZhmzVNUC49ABkuK\t672205640\t6.722056",
-            "402ee936937c7f57cde00a4a542ed6341b2840b56d209182e35048fd1cfcbf9e\tBYAGwYXJgumessAL62NRHeDh2Tmye6cKnB\t594441839\t5.944418",
-            "40d778a70953d634d77d6bcfcc2c9322a703822a51d314c0ec19dcf6168badd4\tBjiZtmspnMwpGFfW47WPzRnbmHEXLA5oy3\t4796297799\t47.962978",
-            "411fb3433be08b4a091ba548f5a1edc1563b75062fdc41c5261ac32298f2d191\tBX2QBKBQPpnJC9hWQBEn6jmSQSyfKupYnY\t6249991007\t62.499910",
-            "4141d25d74afd229d7984738da85a6376e247ef740d8e5a59e1e817ebae7225f\tBg7K1NzdJvdvnX8apupaMrRuh1YLUfuVxo\t432920130\t4.329201",
-            "41b2eaa4cc276b10bb46937a06b512c8c927f76cddf213e8c2f1d0a7e3551e88\tBiGd8wLtrSXnNtK3Jupyd8uwQhy3DxjrBE\t6264045600\t62.640456",
-            "41b6666d15961271517c430f2192b6026cf8c9f16497d4ee85836d02e8ffa0bc\tBmjjbsvGrtH9toeZjKDzts3XoH4Dqh3pvP\t762213772\t7.622138",
-            "421347760ac841c98c63c0e6223fb4e8bd87433ed72d4732b570fc60efcc17f9\tBUUWE2PLEgiy3ZKJy58oDURkCR3fVuaQMJ\t474419386\t4.744194",
-            "421f9939ad682fa6806dbce3cb6996abd66eccace5037074cdc49952092acb48\tBep1DDyMqiH2XxPx4LpEGZDwaCyhcKK9ET\t670643092\t6.706431",
-            "423d655d8e751ebd157dc8194932b76a39a7f2290d942782007d9c19f68ff6d2\tBnzzGpPCLNoRyMH71eJ5jJPmwetPk66ZEH\t764556254\t7.645563",
-            "42b391bde10c099ec954367299da1c1a546d538d7ae1e37ecb6493f45159bd1f\tBXVfoqpmQj9JNZMirApApZ5dbYVs5fJZpn\t299994752\t2.999948",
-            "430656644adcd81a2fe048ba6aa6428476085408de8d83eea5e8bb101c226d2e\tBZR946JsoxYCosMRYbfiNbSCExXSjA8L97\t692701649\t6.927016",
-            "434a27e123adf6f8720e0c38d5ec3fffd6ca434ddaba67a86f6f259313a28ba1\tBkB7FTH3N3syf6efB4NSRNXkGgmUNnSBZM\t602201367\t6.022014",
-            "4377768e359575cd2d2415e9845c3e476e022bf5eaef128fb1d55309e3895716\tBophJCETSSdtByQePkStz7c5AhTMDLiuGx\t5401786484\t54.017865",
-            "438273c0a535c36b8cf07061665b6f4da5731d04ac9d7042e83cdaeb3fe344ea\tBgJoJg4Pb7Lai2DZBGseZoWCPEmdD2jdJf\t672205627\t6.722056",
-            "4388ff92c2a0a1bec5b83219c2fcd9a361aa7089920871173dfded8b1b8355d2\tBiYVGpqf6MJ6m3x6TcEU6BbYCh9FWCfgir\t4796297400\t47.962974",
-            "43b39a7daa8ba6eed9a9445f1df1d2eefa434127231c7fb1eea4d7c416b016d6\tBZpofSxgSRrgkA8m1g73jF7zEhFtwoPHu9\t8088665063\t80.886651",
-            "44af58926acaaec380f93e9cf2f0da94dabd8750a7792c7a38f34a9d874a0af7\tBetDnwwqWA6coL62KgaZPjUv3LmSgpHfme\t7132216796\t71.322168",
-            "44af58926acaaec380f93e9cf2f0da94dabd8750a7792c7a38f34a9d874a0af7\tBj1kW2zNEZcbzpCDDyvoDVwTj4FTFbK5AN\t7132213946\t71.322139",
-            "44e77435b50945b81c46baab919e4542ddc101f4c784d7e69a5d9287f9afeedf\tBepMCiwF8kGKTwkVu8tmPHujhNyyEJdM2c\t512036158\t5.120362",
-            "4556470b351f437732df1dc1bc62ac3c5ad5242e294b7f6ef92f53e47bf36168\tBpPYyYyquzDoGVeZNsugZGgGa3HAdD6UqW\t5455538798\t54.555388",
-            "45ae0ab014f49278ae3d358fd5d513756fff6e5f82fb13b4cf16c852d7128fdc\tBi6QJo4As7XYWs8xExDibsim7QanLrGGbE\t976767590\t9.767676",
-            "4700291a525c9db6e8de4cc454f025c32f0183067560bd2901b5e0b3bb61dfdd\tBrRxyaiqGYSDj6mDbxGYjLRnptp3XFYnGD\t6588241515\t65.882415",
-            "4738a0074b50a9d2e4ee475a4b4829c3a51b61681c0faaa70caab242b00cd5eb\tBXNWmWBHfxjzMQhT89e5Dy5T11NidT6Txc\t632019088\t6.320191",
-            "4749f9824b896bcfd6dd6f6b5d833407809f4279521db4bac5a200b2d420a9f6\tBit4neTR1A6qYcR9SG1BnCbumZpq8Ewasm\t2029998952\t20.299990",
-            "47707293518027c525027d988e850aa95ffc7c3c624466f6688678148fc49f6c\tBfzPdNDprZv9x1oDUz9C4kFj93RWJZmewE\t7605906072\t76.059061",
-            "47707293518027c525027d988e850aa95ffc7c3c624466f6688678148fc49f6c\tBkF99iKAMr8JNZAr2Wribj3k4yv5iDHwWL\t7605903209\t76.059032",
-            "4782f4af88df0a3bb7d2de62383af738a8cf5834955b191f80ac5815e20329ee\tBUB1wXjumXZyEEfPpqRYq2TNgus4FoeYJX\t5401783695\t54.017837",
-            "47b0a9c35131a0cd44caf136475b57a106bb63f7576ed7881a486d422b55e2ae\tBnC4JpQ4w3zgYkQ3QabmyegRVvmbsomVDx\t594441851\t5.944419",
-            "4816cd93451a3d742121a9b7d701a8c3456901502e418cba99df244517670aa7\tBXBUqsjZKfK1k15eDdwLxVfoMH7VCTGkWi\t918468380\t9.184684",
-            "483a4bd14ea516f9630226460386182650166b32beb71f45c7f54cecfc559c8a\tBpwVcuLAmDeVchq34htGfHwHkAMN6rgJot\t976769513\t9.767695",
-            "48799e1d2b2c98a30a04077af2f49083e1d87ec3a9460a9309fc3811ce31f8bf\tBcc6qVnfBbe6rwjq3cVxUAZgpMH4i8C1e8\t5941913013\t59.419130",
-            "4888caf77067973d56b1a7c605dbf89d32567050dfe9af89bc24971fde5ca217\tBWERKTGfSTLqDkzhDBW6fFLTva2XWiPx8V\t3358225171\t33.582252",
-            "488c6e31f7b61145f6fc72b6195d594b4442f53e072680557da75d35223c5a6b\tBncHb8YNSFwWr5oajFyiBZpqiwbBBVd6nc\t594441851\t5.944419",
-            "48bd212091863b4f6160b06963e30d950868e176e218db1967f7270507c5fe01\tBWW5EyGPFXqCScwcqet6KjWpkLMTXMM5pL\t7645577972\t76.455780",
-            "48cc2bd6219e053691d8f159ae0d4df762c541b861933dd4ae294aab05663741\tBeQ7bkTg5CkyKsr5YT8gqPA3K3zR1NnMKn\t749506080\t7.495061",
-            "49e8221cc7a00a1a36d93a6610637fde90d5bd91a42c9e3a93997c69bdcf3cb9\tBZhk89UZrZnPgxagv5QG2ugYiiTJ4CdW2t\t6083339480\t60.833395",
-            "4a70bb93d4b15e9ded32fc0dafba448c2fe8002d82b8f053017dcb56e50aeb9b\tBanUgWKr38anv9FGjLEEHmmyt2W2gEjgCz\t6249996332\t62.499963",
-            "4b9c7c3b4331d36ea792770eae0574591061c4908cea494eff5e233623ffa531\tBd8gkMVqA6biL3cZjWR3p57wvA15xfGXkA\t999997981\t9.999980",
-            "4ba932ae50892db8eaa6609631e75249c890ebbfe697ee55a17a6e1025bb4983\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "4bb6a325e6e6dba8b2df0056c58981483f86cd321c94052b27cb4bcdf66817cc\tBit4neTR1A6qYcR9SG1BnCbumZpq8Ewasm\t2499973896\t24.999739",
-            "4bd89a71b0ab71a16d77ddbd7fa79412c3e2d4b0cd56d6144ee055fc8ef343b3\tBj9WKL4v6TckbCVJqprD7CB6jn1ZQ44r2R\t5977023157\t59.770232",
-            "4be6d91d8229f733728ba094f2e4e6a7fba74c774b134bc9f54a7561cc1f273b\tBh1NmQgL9Zeji3CndABnCXyPXpdfXu9q8e\t6027135951\t60.271360",
-            "4c5321c7f4cb5b7c0ce5e22af110eda3a8e4e771cc1924842772ef0d03ebeedf\tBo8cSsZyGa6t1PWydiiFWnCMZs9EMpxrRM\t749506740\t7.495067",
-            "4c827350edb72823b8a35e6524bf621486841171a3112ffd21d3da92fdf7d71a\tBWhDxYowVQ7EsKBFDyRr4fpBw7gKaQN7qN\t611549427\t6.115494",
-            "4ca447954f8c1ae8c7095c0870aaf95a43c7918ad139645d39012b865674bc7f\tBr9Eoy2iozZeXyefA4rdJKmnhHjbDH9gW7\t3259244214\t32.592442",
-            "4cbd38e3c08fe40a83839ab9d05c07abeee4bbe3a467a61f4de523d8c2fd59da\tBikt2kSUJxuxm4gzYTWAmVt3WGUXo7dj3t\t7558319694\t75.583197",
-            "4d00f5656624d72694fd11949dfd3bd061eafa5eb01a3399b889e4c0a7ed811a\tBoYHaPUHa3rVJJCK1wVzr3fWDjE5rZodcQ\t1484934722\t14.849347",
-            "4d081e579909ed6c9e5f81b455798c9d1d6f32834ac8381a4bdf7791904c4854\tBVKWYFQjyNtj1Wjd9buwgGd2FrDD6GDWr8\t6588241122\t65.882411",
-            "4d1c65af479d5979c49dbca7a84f1c9035e8b230954a1ec5da4a1ce672c281db\tBi5kwRYqRWXfX7cBQa7wJQaboWYz23Dq6k\t139077876\t1.390779",
-            "4d52c1b3c59c4ce7d8404859597b3412713d28b16e9019edba8636ab570dc8dc\tBgjQRwwd2hDWxVp9KCiCfLbrX7aP8hBhTh\t6040059064\t60.400591",
-            "4e933a8d785994d0f14e5abc2f381bee4f2f86f2bd9d70617477801b9581db8e\tBrG1FTJTP6APdTcBYdtkSiDhsuGEHV8oVn\t6935809085\t69.358091",
-            "4efd2470a8dc8ed0fae72e17fd89e815b63c1b3eba8cbc5738b7a0ad7f9eab21\tBWYZdgaq1e7dABgT2CVJZrnoqLf1iyxVrQ\t507796389\t5.077964",
-            "4f279eae735b74002cb61aec26b472027262a9007b792cb0afb34db43142c0c3\tBay3boYfgDEsnN3s3pR4q7nCeK1bb9Y2tZ\t15207495801\t152.074958",
-            "4f279eae735b74002cb61aec26b472027262a9007b792cb0afb34db43142c0c3\tBf6xTZf55FcSho8PDXurJeNDeR5wuC47jf\t15207492951\t152.074930",
-            "4f33052bdd5f875f554250b1470a78343c046bcf01ed7ef6cb823248bf2b24d3\tBrwB4Ja9e6dcYyyzfssRVngAoEzxqSz4Ve\t6027136283\t60.271363",
-            "4fe1d178b847dd66c069a0bcf31ae64365531111a97cfbf6da6c01ae75b5bc40\tBcGwFuvwc6JJejjrzTE598mDi4Lun5z6rS\t8749994003\t87.499940",
-            "4ff9b8ac7c5a7ff3999dde9742a136daf41023402a3f8ab9754b1cfdc8eb3c31\tBZPM8uTh7tY2HosQaPwgNAXSxUvBEecBiu\t999997969\t9.999980",
-            "5003c1fffeb8e8cf42295d80753403858cbe9ed47f27af4c09d40cd3e96f0720\tBs3xBEyumvS5mR8j2C67zFxgtWbDSAhBdQ\t611546677\t6.115467",
-            "5017c2da553cfe3ee23defc43a3d50199e81b3a01ff3c16684669208b0912792\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "5037092a889f7e9f5cc376d6b1281cebc5dcb3db3cb0bceda4f156d561565c29\tBqPL3RsMMS9PKs1dAJaPaZQ2Gbo1BCwQEp\t679501069\t6.795011",
-            "5087c93b43154bfae117b15708ee16d85f4c284fc5fb9df2d3853b5dd0e81d83\tBiAPo6pTCYoJYC4TVMNcbuqK7owtEbbQPr\t764556266\t7.645563",
-            "516bf7bf9a17c9372f61812aba546ec48119deb8f7a2e078de8c60c1d9e7dd85\tBirTjt4EYXk1RPkGTh9gv8dERj5LvDsxVV\t670643104\t6.706431",
-            "518bfbe6e800ed7a60f0794e6755a6f6fcf3743e622de24ba58693e4a20f1c64\tBgDxhqshuAWHwUneNmXhoeWpv6dzXCjL27\t5401787095\t54.017871",
-            "51acc0fa765a2313e6c86efd1156cdba0662026c70007902487e7d763e518be1\tBqYoxUQM9w8sgjyZiGbGQoGQHCkLvnjxn1\t800000000\t8.000000",
-            "51b8efdc894a007b8149c401ba664b008e3af966ea935f77746a6d76d3ee497a\tBcWaR6gndqURGTkkfy2XEUzt4Nc1SdRDPo\t99998636\t0.999986",
-            "51ec8782b9ed59c22cc647b3729483663ce1b58e47bf4520efed767c8ab59ee6\tBZerELsYeuvmj6FmtgRegMJ5uQ3MA4Tet3\t5508340954\t55.083410",
-            "525585a832391780156d3f2e515c15e7bdec04e0aab1eea7b0c48772fef06079\tBi8zxgyYhsBnRXkbj66PLnnFuvAVXWkWZc\t7269236921\t72.692369",
-            "5257ee54d7a118a6d9cc03ff6d6496f2a394fb7031f5f97aba80663e4ba35afa\tBjzERysBHwmbzLEV5MHNThcn9chwo9TEiv\t918465404\t9.184654",
-            "5259a12def90cb23866c7d23e93e4d947da62db96163b31c62ee11afe9906792\tBYKKcmWJSQWoe8iFP68eDYp1ZveM7ZBk8F\t9351237218\t93.512372",
-            "5289438641d4cabd751b484585c527794d4db3f7436b12dafe5f4db1d56dbe7f\tBVPThkRcjkVtqYAU42PeqsK4b1oCY381p5\t662728755\t6.627288",
-            "5289438641d4cabd751b484585c527794d4db3f7436b12dafe5f4db1d56dbe7f\tBWHF8bvY1Fx5HsdguYW1CYxeRX36QkoRJF\t592723751\t5.927238",
-            "5289438641d4cabd751b484585c527794d4db3f7436b12dafe5f4db1d56dbe7f\tBXpB1pkjVRWvN2cSpwVxAdSMXJSUmWj6cB\t1000000000\t10.000000",
-            "5289438641d4cabd751b484585c527794d4db3f7436b12dafe5f4db1d56dbe7f\tBaAjxjwz47R1Ccx8i3HsSo5Z8Gj1eSdkum\t662728755\t6.627288",
-            "5289438641d4cabd751b484585c527794d4db3f7436b12dafe5f4db1d56dbe7f\tBeYPXoiPVxfpayrjMUhxj59Wf3vXFNcTDs\t662728755\t6.627288",
-            "5289438641d4cabd751b484585c527794d4db3f7436b12dafe5f4db1d56dbe7f\tBgBykXw4xn1cpGd9B7KyLBMgoTXMAU31KJ\t662728755\t6.627288",
-            "5289438641d4cabd751b484585c527794d4db3f7436b12dafe5f4db1d56dbe7f\tBnA8NpramtxUFG3XG91vqJgjAqBvMqvw23\t662728755\t6.627288",
-            "5289438641d4cabd751b484585c527794d4db3f7436b12dafe5f4db1d56dbe7f\tBnvnxWJucYW4iDivDJFyd88v82jqFTeFP1\t662728755\t6.627288",
-            "5289438641d4cabd751b484585c527794d4db3f7436b12dafe5f4db1d56dbe7f\tBqBAk9C5gEqAZCb4UCunrWXkqHzrnEbnvW\t662728755\t6.627288",
-            "5289438641d4cabd751b484585c527794d4db3f7436b12dafe5f4db1d56dbe7f\tBqx41cLoBNHeKYJLFB58o6p1W76uTgYodY\t662728755\t6.627288",
-            "52a3f72f2627d5563ce9ccd42f7ff46b9fedb270bc525dedc384a0cb0d942626\tBeCqa2qgVagFooejbHh6DDwkuiSPjJx3u5\t2300789961\t23.007900",
-            "52b811ab75f7de7d6a4e896d788b914e5193f488b94eedd92294a9e4b4d4139a\tBp5W8bHG7hB9YHqrWunBrdycZMPxYCHnaQ\t5508342070\t55.083421",
-            "52e2aeb229c092bdb2b2b54f3ec964f6d213fbbe13dc80bac95c1b18e9da55c0\tBjJAudpbjwAv1NFtUe3xrKBGqYdQVaU7oD\t999997969\t9.999980",
-            "53098b5a0d9c274124b9deca301b2bc299874d8243c967441fb514ca451c21a4\tBUndte1F2HkPCwZ5eh2o7PTKX3UaxrKeHr\t598860126\t5.988601",
-            "53098b5a0d9c274124b9deca301b2bc299874d8243c967441fb514ca451c21a4\tBWVprewSV8wLd4SWJQxJqkwMBP79U6zEoa\t598860126\t5.988601",
-            "53098b5a0d9c274124b9deca301b2bc299874d8243c967441fb514ca451c21a4\tBWWJLoBayHCKP9GpfkjYqx2ZhyPLeRutPC\t598860125\t5.988601",
-            "53098b5a0d9c274124b9deca301b2bc299874d8243c967441fb514ca451c21a4\tBcWjj6GKGdwDEusaWtmizRsms9Q2Woht3f\t598860126\t5.988601",
-            "53098b5a0d9c274124b9deca301b2bc299874d8243c967441fb514ca451c21a4\tBeN7Nf7nTARzJLDrBPKNB159wh5f6bB7H8\t1000000000\t10.000000",
-            "53098b5a0d9c274124b9deca301b2bc299874d8243c967441fb514ca451c21a4\tBgcUAsG8XPDMzwzr7t8zAnVtK3tByQD3ps\t528855116\t5.288551",
-            "53098b5a0d9c274124b9deca301b2bc299874d8243c967441fb514ca451c21a4\tBjE79hKF99Xb5kYN3xc2ZeACWx46kjtjZY\t598860126\t5.988601",
-            "53098b5a0d9c274124b9deca301b2bc299874d8243c967441fb514ca451c21a4\tBnuLKpx6WurQ56ai8z1A7sHaFAoQHRHBHX\t598860125\t5.988601",
-            "53098b5a0d9c274124b9deca301b2bc299874d8243c967441fb514ca451c21a4\tBoD21ub9Wo2FnyBg6UzPiDbetKPJQZpVtE\t598860126\t5.988601",
-            "53098b5a0d9c274124b9deca301b2bc299874d8243c967441fb514ca451c21a4\tBotooujbxZ1f7ErBTVCeCyvhWuMxhTncgD\t598860126\t5.988601",
-            "5318cc77aedf34ba1bdc34289a707460f540029fc5a29e8696ecb72d093b5cd6\tBZxnUo7nQssEtBwniHFKuGXz8RawGS225t\t512036183\t5.120362",
-            "5349ed9b2c5c78817f24fd6e3534c3c24701dfb2a39d9e41e30ce29dc25b61b6\tBoGBvADHkMpgTNrnM1qeg2YYLfLvgNbgLJ\t749506080\t7.495061",
-            "53bf679ff6f5d3eaae0943881501572d5413f144436937edb050b34958ae8c47\tBiTbJQTJcrGf5N5vazpSYuDRs76revDBun\t9351240028\t93.512400",
-            "54343f3daad1bdc38e60d5c2c3069e2e9fbd900627a50c1382205ed5ee0792be\tBfMnzzcHbZ1pSxaQArTmDmeTqjHg5fNSvC\t534160463\t5.341605",
-            "545b05f7a9b9af11b02e861d88a99ce421c53b08b0b4c3f5a652ddc94660c89a\tBnjKWWNksKaawsAVtusCx31Hjbnr37bhSW\t5169790549\t51.697905",
-            "546cbe515da3870e661a4dd139c8bdd7204a9df47a858f55f163b647f0078c4d\tBs4BU4fts51jM9CbSx1cLgHAJKS3ajpszS\t6249995624\t62.499956",
-            "5477ac359a036f045b575c90b3043b827b7c06cd7114750623b4356590ab97b5\tBpUMtRqNovPhtc2TUsmuem8mDq3GeyLQb9\t299997740\t2.999977",
-            "5499fafca249fbae8ef4c2effa2a55a56579ffb5c0221a0cf3f620b012946800\tBcBkGrqVJ5fbWZuQMhMDAWJjYyppcJ5edd\t1220424455\t12.204245",
-            "549e35cbfa0c10402b5609d6a6c157995645bfdfe9825b5853f45563eb9c517c\tBZzQQuCbUwYHthzy3u3SNjxJFcMxpKQMLo\t5911738497\t59.117385",
-            "549fd149caef10030b79898dd0766981ad646f79753bcd9cdefe0d33b731a913\tBbF6EtQkXwMjzn5zZzAntWkWVtmW6sEZ4w\t7641209086\t76.412091",
-            "549fd149caef10030b79898dd0766981ad646f79753bcd9cdefe0d33b731a913\tBjCQP7PEvAbaR6wqNJvbSJ88e58n89d56a\t7641206223\t76.412062",
-            "54be165a69a568d11dcecb29b73d274725ddd57358ef8dbddee83fdf8e5b1958\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "54f4056b73ed1ed2fa8fe9854761e584aca3c1d64e2dcd42d1dc4b9edb32a304\tBeuKmPSYMG2hLY4koqn5HpLaEMKdgyHZyA\t343868997457\t3438.689975",
-            "54f811fb5dda5c5dc812d0cc6dd0ee4ee48161c0ea4061f5e601f6baad13d80f\tBV1KtroYxgNSr5mjpMuhp2Pxzeu1Bnfjbq\t9432756545\t94.327565",
-            "552865a01624472aaf757aac5eeef0983d28922ef77fa8ff9e3aa8813a3a8554\tBfSXHciCRKMKXUa3JdQe96jtjkmzJEHM2S\t611549415\t6.115494",
-            "55f3825c57a1550b11b0a5bacb84dc165608b415830c24118107ec5989eced5a\tBgqMxSdFUTsthHCyAzGMBY27KfEfPCxwju\t6100232070\t61.002321",
-            "5609a2932ecc481afbad8d81e390197d6240ccf0f28745e1d9751bc3ac1b98ed\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "562321c8d7ceaa067f0ec9b104a5572fe238576977689ce8d46271119237b4a9\tBj1nzAoDpXvhamCo1U8He1JGHT9M2TN4q8\t1484934710\t14.849347",
-            "5635f5cd1867fa90eaedeef9c05160f403d5ac24a9fa60ddb30c7d22ddbb607d\tBjyHvsCd7AGrr7SdVCzzwqLysMLmctKaUa\t9351244667\t93.512447",
-            "5669c4bb6b54706f799adcd1da14b570b1370b039016de31568635a96ede3c4a\tBZyGrwKx8ctZVgeHa4mRGMpcfvjYiA6z2v\t692701870\t6.927019",
-            "56d2c46b0fe0efc7d01af8756d4aa72ef91a44369ff90780275c8dbc34ca2a8f\tBfCaatCBWMhd3NeTrecVFQ3bg6tZssmsji\t462928398\t4.629284",
-            "57490f681a3b0df620d5940974f925ec3e4b2c186f0146ae07e2825447604548\tBkb6KHVn3aLWNT7eyCbsxHX6KWHAUgCxce\t999997969\t9.999980",
-            "57b1696f84702d0b53572f75f20eb1fa3ddec7fd551bbf8a5370fbf1bd0fa471\tBd9BMgrYhTH3tSPveXpNERmwfeD3P98KgC\t7134338583\t71.343386",
-            "57cdc79c3073b52014c9b997f4e79e7de47bb198a72ae5c69f10f2cf4c47578a\tBbz5YK6nqbQSWFahNn2A6EoDqFpsYTGf3e\t749506740\t7.495067",
-            "57d6a12dadae27c389728956b32d86f84221ef7c279dbae2f9dbc6bf2795d9d0\tBV34wcL3SHrWc4tZetGbAGArhTaXDytFXT\t5012484870\t50.124849",
-            "5809b19282717c0b1c8c8176c09cb20f5c4477fb7ac0709b560da13f9192a004\tBjBKwZ4D45fq1JtkReiTKmKcTznPisVgMX\t5066380804\t50.663808",
-            "5875060580819c5a13dab56d3c41a910ee96c839b25206b9a7c899334ef0b829\tBWeZZoDFr3s4tLeDoTQ9DwPuaPG8PhBLDH\t7134335299\t71.343353",
-            "592efb2ab0d1f550e71b4343282923d7147f0dd16cb05e861e006e6a7a5576d1\tBcxWkJwmUZzrHNyhNFq6xqfuEFtirWm2fY\t692701649\t6.927016",
-            "59487c5a1d579b67439bdbbb9464eb5b15072036f4db8fe7421a38d6eb6e93b0\tBWd4k69T7DUzae7qZf54V8dJLS8uPi7Ndm\t577801071\t5.778011",
-            "597860616204c5beb9e5307ec6bb87d51d3304691ef19640684b8c577bdae59b\tBjzLjnwwXGV329UWEtYMqPqxHJEvUXGg17\t7558328621\t75.583286",
-            "599007f91bc7f457bcc175cecebd2753bc3ada54c5534f583e8438be46438749\tBfQa7VVyP97SurRo6VFsCnsnEY4p5oqjTv\t524962100\t5.249621",
-            "59be78cf6f80aeca7002a26d46009fb2d08c13a40507d0065c4950a73ae87d80\tBZnjnDiGSTu4BfeJYLpUa1g61iryVudT8z\t6249993544\t62.499935",
-            "59c4d55cfe79a72ef027adacb5f28f489f1504217d1c6d744c1e85e143f55864\tBcwEEZtEFLx3ViLcjrMx4ZG96sbK81z6Ju\t472620820\t4.726208",
-            "5a34d8f103c88d128ac7cddb7176b4b74f5e9811e8ac349ac253008d16b89b1f\tBYSv6iyigVa4co3WwNQTKohqU8oDUJhAQ2\t6100235060\t61.002351",
-            "5a491b7b3e6edf88a26b08e5f63d57146b9be84be0e71406302dbe7635007a30\tBhyK8R6btWAhnc47VaFhZTagLx6gjQCxzF\t6864559204\t68.645592",
-            "5a6e4957607d4694ddd3f2d3dcd9d2f3cfb0f357ccd3c3f2cce591038bda092b\tBqfnrqsRqeiMvBZC28PwzR46SadZpAbZRJ\t1566653077\t15.666531",
-            "5a8aaf3b23d23a9b2e93d697936c6f894bd8cf56ad0a5abae141f91d386b1711\tBiPTqpudv4byxs1rFJ1AnDcCViKUhxQaaj\t6249992627\t62.499926",
-            "5add839f6f3578239086731b0d336114f9819a97591fbcced06699acaef96925\tBWUY9AxpGUqRqstFDHNcEd9e2bPZRJoj7Z\t7132215434\t71.322154",
-            "5add839f6f3578239086731b0d336114f9819a97591fbcced06699acaef96925\tBkgnK4GSpjh6KXwMwJcmBUWjuSHXmBiifk\t7132218297\t71.322183",
-            "5ae23d15f5d74cdd7bc40f3c4789ea4108b6c64f1f4a0f02bf22e7d091f63d83\tBrEEhuX1mSb8dFEYmgL3MAG1LXaVoqbTAf\t999997581\t9.999976",
-            "5b2cb8bbb971ce922254c6c8f5638671ad94b8df4502d8a8e1d567697ed83feb\tBovmaSzmyd1uzo1KeW9Q2pa1sYJCDFNX4g\t764544907\t7.645449",
-            "5b33da94262c4886040b0a6ea06cfda57480b9582e13b959230943d3f141b1c1\tBjBeAQ5TVPC8icKd5U54AX5naW5cCyRF6n\t679502487\t6.795025",
-            "5b81e42c25007352387c7721ceceb79b5a7448d25758b58861de4b23a463b97b\tBYHBS6CmBxDPccChAFjTPpyYPwDHsKyAR2\t569679609\t5.696796",
-            "5b8666eee5993c2caaff339679adc4deceaf92524a531d288afa799a37f6f10f\tBarLF2QQQhtZyVfU1J7XHgbr8yWZJL5vdf\t7059952903\t70.599529",
-            "5bc45cc7a8800c62f595e8846ff1103b4dd12036f898d46db2897a65c7d4a858\tBhYKKzUgGoMVpjVgqMTiZvv4g3cUB2Nvjr\t979193329\t9.791933",
-            "5bd028a110beb7772dd99c061d0abfb6d10bdce4bebd08df792a2b180f583a13\tBiFiNbupSkMGNDjMAg1cyCP8GqLNg6Yv24\t534160451\t5.341605",
-            "5be465d1c13d2630a0cb8654e987676871942f0d46e329d7ef554ffaa3bdb631\tBgUe25zr9CtqdW8RY8jxCZhiichrHWCYh4\t541545169\t5.415452",
-            "5be8777c6045123a1120ebd4d30f80ed2859fa19e5dfb8b411d6456f326369a8\tBg8W1ojYTFjuoWExxit69dsjMASi2a5L4L\t5066379231\t50.663792",
-            "5cc4ebc1e9e82771fedaefc0af29b05dbb11a0c06d090cf971c40661c06bfbe5\tBVjwQWgvVrL2QCuC4LjhwM7JzeGR9cSESW\t700000000\t7.000000",
-            "5d0a41de531c27e6e212ab80f95f946505e54361128fcd29e458ae1e3d2948d9\tBk9sgPHVSREnrpHisZAnzQXWEYbMC8VaeH\t5724989545\t57.249895",
-            "5d1b1d3fab4427c936decb3c52ebd3c9acb6d4d48f311a67c6d5d7fb1c2e90e9\tBjHLCDpbL8KxbN5HDcfp4TdccV8xtB9KfX\t6299054189\t62.990542",
-            "5d4ff90274d3a3264bc579060612d2f56f39fb115233830202465d960c1396b5\tBTtaywZRGzUptgP4jXmJe42FnHCxnUuuf4\t750289922\t7.502899",
-            "5d6e1d7cfd0c8597a27fc5f79d660f9f5ddb59f909daef10da01fbe22cf2d733\tBcLfhAPvUXy8yjxMiFK6AP4gfjrq5s1KT7\t208202997224\t2082.029972",
-            "5d92deec7340f567934ad8ddbbc8459ceb9d436c8365903a442c6ef456e9a2e4\tBcFzxbDhXfkBumTz4Gs7NiLdaidRXgXVok\t9351244667\t93.512447",
-            "5db61717e69abec0163ecdea911e5781d706a296ce08b4797b4cb699e464b388\tBdoBSDfDD9yhjLMbjjPuJVwhN8fKhpCS5M\t3288217304\t32.882173",
-            "5de1751d7adbfb8ee9da48769c70f63d626b001f4241a877daeabb4a796e5dd3\tBWuzdCGpmuNxXfxGGXkPzagpAvbZENw7LR\t4056099129\t40.560991",
-            "5de5006925d078fbafe8419ad8ef7756d72048ff1971c9a5f41f56cd4fb5fd9b\tBpADaz9HxEfV5g2xu4jFceBVmsD71SCwRB\t5957129266\t59.571293",
-            "5dfec64a2da9f0b056594ca2cc43d17ec9731a11d6bdeedeb749ecc804280179\tBWMLpBpqF5WQGuQAcotwEwjAppDUAucvVn\t6119983856\t61.199839",
-            "5e0168dd756633ceb9e64b2c6cbaa82bd0a8ee2bfb7c2c5ae7165defe39a8747\tBgANioXZySuA5aFT3gDbHisRfpxd4JEsA7\t9713956288\t97.139563",
-            "5e019daec499236df015e7a1a6d246702c8f87e41f18d5b222471f1aece6c388\tBk3UsPB55y8EYj3Za7HUXnttKfNKjKqNsx\t139077876\t1.390779",
-            "5e6837932d21350e22ac949dab4241617d0a76901ebcf71d7a6e49bcda5f44ea\tBZv2KPUrypRivk8bZtnsoRPZ9FfCuRvd5s\t575921388\t5.759214",
-            "5e8743d0c83614ca8e2a7528d77e84292528d144737ef41a9848a397499d5c27\tBUFELnf3AVJTQHfSZKN3J2NbS934DZzhUB\t512036170\t5.120362",
-            "5e8d4b75088329c7b11355b714fcc70d240965a2aff217d5fabfcbb0b080a8e1\tBesdA68gPS2HVPLRk7GW6kKYow1AFZ8SkC\t5607804378\t56.078044",
-            "5ee2e43112f0f119cb8d2bf4f83599c9a4c79db75a84a143ea84b8b5c3430e35\tBnm1k2QyeDRtxR9UuDC67aL191htMoBTxE\t6299050950\t62.990510",
-            "5f3b6b02571db7c01e234c1055da87096ce62567db2c5534ea7993c5ab611900\tBqZgiJFMrQEiMtdDxBMBL1o7B5kusf2BPe\t999997981\t9.999980",
-            "5fbc55e843c679d61e074f35db631cdb886ccfd0bc8d6ff8b25effdecae54ab0\tBYMx4zeuq5m48fL71iSztvXU8zj8HzmdqU\t1000000000\t10.000000",
-            "5fbc55e843c679d61e074f35db631cdb886ccfd0bc8d6ff8b25effdecae54ab0\tBZDqgFe6RdQTcsK3yZWMmSHQqoDNfJW9ij\t577803065\t5.778031",
-            "5fbc55e843c679d61e074f35db631cdb886ccfd0bc8d6ff8b25effdecae54ab0\tBbdETCbNvyahu7rbkz1dse3VPf9JoXWKse\t577803065\t5.778031",
-            "5fbc55e843c679d61e074f35db631cdb886ccfd0bc8d6ff8b25effdecae54ab0\tBbyZpaCuHB2LjJtdNpav5S129S5ZfxBZLA\t577803065\t5.778031",
-            "5fbc55e843c679d61e074f35db631cdb886ccfd0bc8d6ff8b25effdecae54ab0\tBf4MfdRPMyq6KsBqBC7jd1N8eW6vM7Liq5\t577803065\t5.778031",
-            "5fbc55e843c679d61e074f35db631cdb886ccfd0bc8d6ff8b25effdecae54ab0\tBiuQn9AMC7brnXgzb6QRbUyuhGQnUouTms\t577803065\t5.778031",
-            "5fbc55e843c679d61e074f35db631cdb886ccfd0bc8d6ff8b25effdecae54ab0\tBko3DL5kT7yavJcfNEFvotu6nCzXHdvv1G\t577803065\t5.778031",
-            "5fbc55e843c679d61e074f35db631cdb886ccfd0bc8d6ff8b25effdecae54ab0\tBqiKYY9Mv6L9XDDscmhQH5i83RxBdYT8mf\t507798061\t5.077981",
-            "5fbc55e843c679d61e074f35db631cdb886ccfd0bc8d6ff8b25effdecae54ab0\tBqxnVZw3qcFBu6SxeQ7qb7KTefs6J4TL8d\t577803065\t5.778031",
-            "5fbc55e843c679d61e074f35db631cdb886ccfd0bc8d6ff8b25effdecae54ab0\tBrDgQFv12rBGp65wnPKae6XABDqoFCpygC\t577803065\t5.778031",
-            "602cef299d033b934ba272bc66c8eb4f41426ece8ab4c10921e81b5059e9fe16\tBZbgJUvVvye5LHF321qW4X6jqZXGfN8QFS\t6289735797\t62.897358",
-            "6061ef47b389d827699eec777fef2c28f068c3ef0e689fb815a442d45fd6b762\tBi1bX15SoWNwLP8ett7qFrCFPtb36WdvNN\t976767567\t9.767676",
-            "6093cb727fab98600292b9732980b445d4af91f2efc5c59966693288a9d555dd\tBbVxNErc2ErgTVZ3s4bPuVgKzQChMtEMio\t5169787891\t51.697879",
-            "60e44304bea094e408e8c3e3d9ef34267f8c431a3751b0b1681ddf000f96d31d\tBf2MKghySyr8zL7wLokrm2M6TLpHXfqUU1\t5401782053\t54.017821",
-            "61105e00416a63d0779d40da1bc3b376ce5fab354dc169a665630052c35baf3b\tBZU63MZenhjZQSgpdku6mTv7o2bbM1nTzv\t1364047289\t13.640473",
-            "6170bfb6ffd5b72306fc3d40b3d3168cdb6d60b0b76533825695ecc22134aadd\tBkpMUS5DHuntTEs8EJHdtn1viytRgnagUY\t6027136283\t60.271363",
-            "619a708a7abbb754fd5fb4498ff9b648de3443e474eccc4475020726bbc39d0a\tBjUdApMj4rGsa9DGghgiWBBBLoRgNvkWeB\t4796303267\t47.963033",
-            "619a875ecc420fa76c752d96ccc8b3188596e92114991aae1d83f8ce5ee9d521\tBWCQw8jNAMKniLiTzA1u2LSZMQzjYeqhuN\t882549883\t8.825499",
-            "61d02fe921bd2f3a8120aab27617cd94dc8a78acbbaa8212e4a4bd06197684f7\tBkjHWhxd8UjZ3KS1ajSzarpHuUqy43wGwG\t999992508\t9.999925",
-            "6237bcc321d3ea95c715340af6d2b4799359e25e55710036b59b60a5f0cf7210\tBo8eBFvAN2epDNCiJmPcE9iDfdjtGGNZMP\t2499983563\t24.999836",
-            "628390901d809e7fab82dcdfeaa90f58cf61302b3bb7e7ba4efb16fb41bfc688\tBVYQkyAj6F3tAga9eDiCkwQTmNh7WpJwk7\t169998690\t1.699987",
-            "62d208ad23c514d1b9ae11712eb4a46aa965ac7062a8ab91fbe26cf633500de3\tBfpQpTfQRZmXBxrHegjL8xzFuWnK55uCT5\t32412613081\t324.126131",
-            "62d208ad23c514d1b9ae11712eb4a46aa965ac7062a8ab91fbe26cf633500de3\tBkcWtWzQ7TDncvK9uY2mfyQuVEw4er5NJd\t32412615944\t324.126159",
-            "62d274955875fda17fce694652b190cd2ae26412c65f6e74ab3a4bcaf6ea41f8\tBUSobbmmFv21diffyfxTtsycwicrzvxFFW\t733319136\t7.333191",
-            "6302f2fb5cf1c0dc9c9959517148e3b2429f72fad1c14bc124e5e10b47f773a8\tBX5t8jwLF5Fx5LpHXTK6CMx2cgn6fewtnK\t7641207858\t76.412079",
-            "6320232d7d998898e3bea6f24d2fd2f60ca3300cbbc5c6ef676b631cb41fb8d2\tBrBxwHQchRNvW8iSKCXEDcoGg5MRBAh2xx\t524436865\t5.244369",
-            "633d2c60b68266177b0915a986c4535b3ab787f12367158d5b57c287e91a9500\tBed7RV1SmDQNtd8sP6cSbSKpKb9x6i2os2\t9351241665\t93.512417",
-            "6398a4de8e8b05fe4d4a100a5420f3f4de52490ec1c3a462f1223a95e6af64a0\tBodPLNABmHKa4dy9Aknem8NtBjhoTbpzvk\t5169789505\t51.697895",
-            "6399102cf1bc863687180a34b20fd61dac05335c568777e3c8bffa072cf9aab8\tBmoynw9RSaKXfkemZjWZangrDznX2wEH5M\t670643092\t6.706431",
-            "63cce79d8c538e46a1aab3488cd7d623189e7b68466d6e833b51b6ba2fcd19d2\tBVv2jcHAJoYSxurnPE39bhWjZpmmJK8b3e\t976767579\t9.767676",
-            "63fda902e83b6f0eb1badbb95114ca608ad1ea7dcd9fd72ed627ddaeff65373b\tBkwLwqwDJ91JBxtxkG2KL5Ge8NTD3oeQDS\t474418529\t4.744185",
-            "646e5ec8aa023eaed08a8131d1543220fc73b52075565c987e2d3d4cbd03ef1e\tBUzPCmUHHVtU8TLGtpvh3eS7wvLPeXZbvR\t1100394758\t11.003948",
-            "64aa140619f65fe206ba919971d2d07ff124dc38eac88a96e155f1681081d3cb\tBWYNks1fWLsaK8QQLKqKmuzicYyMSGttcU\t692701661\t6.927017",
-            "650989041ca41bc800db7a6fcbddb8168a350a74f22927e2ad8314256c96c7f1\tBpzaRUKtG2LmRepyEVRNP2iow1EGYM4XAP\t939024827\t9.390248",
-            "65471324c66a9fa9c25e8c493fbf2241b47393423ae6c1bec1ed72cf8b91b022\tBkhCBpRhWx5A95Nd74QeduEXNb46mEkoMm\t1936941765\t19.369418",
-            "655942ccf190d6c8e4b188ad5be9cd9b096694010aea4d4ef977117b4ec4a5f2\tBqjarXTYtzegzR4yPSPRzD3wUUW7tD2wCv\t432920118\t4.329201",
-            "659d8677a35db866b96d32b4094e805e8ebde3bfed3dc7957b46b2c3dd40e512\tBrCWWDzpdBCtGgh8LNBa6Aqfeody1d4fXZ\t6638869041\t66.388690",
-            "65bcdd874ffd5e8f4c14fda886572dc7e97597182223689f0fccd11a14c420d0\tBhpzqKfrp3aEi5FgjsP5XZ9XxxErLBxbYD\t3259244215\t32.592442",
-            "65d9fbfaf759e76ddc55740fbf2f767594a3ab68b231b74ab2503a9295f20d85\tBYjZ59TGzhjy2Gi1atCQvxs9K1ZQddH6y2\t9166279005\t91.662790",
-            "660d74a4b8a2dd8dac0b8e052cdb1cbdf0de50db44d1b5a4c39ba5995a391e6e\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "68040a87e7406eb393b871061f7c20d271a9fd44a4d3c1e5533c8b79aa121a31\tBeYMufwjaT9WLaomGgjzTJ61cRKXMeAwaG\t999997981\t9.999980",
-            "68514548a4dfc5cd0a07ef57cceb940e9d6d5c86b891a34304401096cbf9741f\tBZbdJQKEG8TRG29YrEJuwPXexPMbLF8nX6\t1383770283\t13.837703",
-            "68b38eee939d9bb1c42dcc41860ab091adb6882cb0b7cdd0c70933bcea861a33\tBoKn7NJZ9vh5pFq7suMtH7k7X5hLHZDGnv\t7134336913\t71.343369",
-            "6919b3ee53369dd274babb38c4f2217b8acef2e69d2144b573564cf2f2ed3132\tBWkUHG6sUuarMH9g4DZRUgEnf2qs8PLUr3\t6638873629\t66.388736",
-            "693c2e95eaadaacc2d82aeb9d2e0ee5a5d636b4522838b436b48147804dd6e90\tBd9CRG3JKJHGiWfhwPKhSvnFsh3sR4VvRg\t762213772\t7.622138",
-            "69c02b568f163e14a6633919c5488f577ca69bd04186b30a61e40b65cca0ca47\tBjAVhYvwA1L1Aej2DjjRmPvTbG9fDGoAe9\t611546689\t6.115467",
-            "69e4d77af8d2713a7d70d2802071137a902d618bc8d42b948c8950da2bf46751\tBfwsVt4CpWdqBzvoVv4rdkggtMNy7cTwtC\t6249993150\t62.499932",
-            "6a21137cfaf8f47c6e9f3773e943db864349e29199b507b158cd65d836542c9e\tBca1xHrVCxWsf4Cq7mF1rP3ayoMoQrhbCM\t6289735833\t62.897358",
-            "6a8b7de29801b6aff6dfc4d9c349353805a1c238dcd265d9b9b0898fb3bba45b\tBa96HjkovoAnc29HVtXJ9Qou6PHSuCsBV8\t4159985866\t41.599859",
-            "6a94bf2d0a04fe5d8fb31b234dc037b8266dc5c526c395ad8438f38e685b617d\tBaCmcg81adwvactPt2c1cziYHz8Y6xSu5q\t611549427\t6.115494",
-            "6a9f798dd6284539d970a169dc18fd42389c2679743c3631902dff19ad2707f9\tBVomftq3GzVuh5BWSFbn2NehYwLpxmH7cx\t7134330395\t71.343304",
-            "6af52eea8f7bfd15fe9b651ddde2d99d139274a9ad108f650d6bd82943facaea\tBg1yNZwX6JumbJDaVbMMVBydgNDeP7BPjH\t598858339\t5.988583",
-            "6b6f2d1f34c66fb6a144e9dab390e18042dd07be0e5bf63e070c7dafbb29fe4e\tBa71fzn8fMsTUQk9h1TorPNXvxUbd9iuNc\t5455541189\t54.555412",
-            "6bd69546aaa813d929f22a10aa824496eb102f744d3e364f9295880a267e19f9\tBmwWKWpjG1FgNP7NDYWnCYhw9m7aMVsV9n\t9358623690\t93.586237",
-            "6bf69f5302d76ec6ad902aab837a6237709fe23a3e3d60654f0907dbe5ebf7bc\tBVNVYSgjCxJdiT258GHKJ6QfxGCFpRk5rG\t632025091\t6.320251",
-            "6c27dce18d0e29a194c48a903feef108d43745b7a299b665f2e54ae0562c7532\tBVQWcvdM99jbjCGzWnxiQ8tbgrp9DhNFvH\t663314127\t6.633141",
-            "6c31d9a58f028fc4343c4f76b9e4b572a4e0e79a9bddbabb90b7362a5127683a\tBUdzsu97xZVtRWrk9Rm7wPWdQ1fx4SA7rb\t6249981729\t62.499817",
-            "6c9efd145c4030cb67f53e6b86733875da0f6be44bc73f27175ecf4a9809ee4c\tBqQiNQ5CQ5Xbho3fEajzF4zbT5Yb1fZ8DJ\t6249991508\t62.499915",
-            "6d0a84789b867822e08ebca12bda71a5fed5dd1b23513956fa8ca04cf6951bf3\tBrPLDsFypsnFQySQGqSrKHJmXDiGLVvrUX\t5012486522\t50.124865",
-            "6d48b2376e58c94d54f4038a4ea5c397aba0c98195b77ce9e4d5e5b6344b9ce4\tBb3vcGijvNLDrbretSavPgaUiJ3NvChpsF\t842294228\t8.422942",
-            "6d9321a4cb704c02523819d6ec66fd9b1ce4d174ae8d1988e1b80a1f49ec3806\tBVvTt78p3vk4xikH7XfbBqNsNi18pp9ZsR\t9358622071\t93.586221",
-            "6da411a4cd0091122b2fccd21ba0cf18ad1cc55950d282e3e97632f6cb667060\tBYv5KKaEqCaibHht4U5BNrEZDcDHGDzVh5\t404414382\t4.044144",
-            "6dd7a42c0ee50b8a79049c808aff3926d1604b98c740673069c87e7a7feabc49\tBUB9mddz2qWb9VCH3UbmxSUksG7bbgwGGF\t5401786181\t54.017862",
-            "6de593c9237bcf21a5e2d6e6869b49b2e2cc93da4828776dbcce18a4207cd054\tBhbMvCxmQL1wEJ2nheNpV5qLrPxq9rtcZW\t7759964066\t77.599641",
-            "6e564eb9c1083c237a7a634dea1c0ccc2d223d3c0084fd876bf68376660b18d8\tBh8gBuDLp3g5cLxUxmBGTjNrRoccx8cgED\t7132216268\t71.322163",
-            "6e88af096ce253ef7bf40fce3023878baa353014e9044e830823a3e891372cb1\tBY49qKAo4LZwT37HLAeg7rxtEPankqURuL\t5401789847\t54.017898",
-            "6e88af096ce253ef7bf40fce3023878baa353014e9044e830823a3e891372cb1\tBbCAcprHb34uGrRKxWatKLqthnEq7oZ3jp\t5401786984\t54.017870",
-            "6ea30112902b21f52a1ab66c9bdc1c1d1351781df6f13816316105c5d5e2269e\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "6eb7f9fff8089bc6364a7601e75d491a8c67a00ac19e93c82105f0b6f7768615\tBkHCTr3b2VmVsgRoKsPTWBEjBMnSpfJuRE\t9354318542\t93.543185",
-            "6f4c8b5fae090fb7a01a2d82373c93016c0003c28f9b21839927884f16537256\tBXeWX7WHUnJ7WLxBnVYVRzrZeGLLEBK34D\t6588241641\t65.882416",
-            "6f60d4f3f4daeb87b1d1a6be1b7cd0297762db7a9e504e28964fb60dd29f8975\tBkHtuCV65Rvao33aFSZ9sh8GMqYGVEWyHQ\t7652675617\t76.526756",
-            "6ff3893d92572ce145929ddf10472d5b5f68f62e79079855b7ca536ab0c1b654\tBmFMbvgNjA4YXz9i8b9hxQkPjMyXjLoinZ\t6588239427\t65.882394",
-            "701d9567fde197442bee11f2c206fe0835db83f5ad5b7f6fae9c19312c4098c2\tBb11sY3ZGZLWVy6drwN6xCqzN9yDU3UpSW\t976767579\t9.767676",
-            "70887151fcac710d2f1a778d0526bbc7035b5b3958174e6ac17d4587d064474a\tBmPs51RaPCWSD2itk2XWxSGJbB8x2k6Bek\t5607807368\t56.078074",
-            "70aea2d1c8f86f52a1b96b1cd580c087eea4db0c1782da48697dc954ac92de49\tBXVfoqpmQj9JNZMirApApZ5dbYVs5fJZpn\t299995330\t2.999953",
-            "711d537760b573b0756c430731902ad2cc8c76eea87f5f6f85ae42eadc60281b\tBZnjgVzGSN6vqZHRiudq6jdWsAnrSvxgZD\t577801196\t5.778012",
-            "713503ee7ee72eece86cd1a23cbfab6a881f64fc7a8f309f54cefeb7b499b3a1\tBoWQHzgvHx6DSxQ6akT1gNYYnCBoKuhwEH\t7269241013\t72.692410",
-            "7200eecff4b3ebbcc790547fff8f2724f71156651f38a3e2faa3138c601be4cc\tBUFnC1d2WfB6aiBmdKRqsQ4udBt5FMjBxo\t1288877784\t12.888778",
-            "72442a01bb426929aa8bfdc7d4c0eef23c225a3bc48b5d538faf3d9589e90edf\tBrfkfKv3bsJhe9jiDVQaPwPVTSpaBdpXQo\t1598043686\t15.980437",
-            "7245f1046e65dba38caf89127c5d7eff2a31e9bc7b45623ca0f1533d12698c3c\tBbd6pdCqTGgwJ4xswF1ZNi6TYZhyaJNfix\t99998058\t0.999981",
-            "727d3f6fbd115248eeaf41f85efcc4802bfc4e72c643a4e0c23ffecf3855d975\tBUDqWyTmren92T7ipB2PH9fWG48Q7FVTwU\t9690945853\t96.909459",
-            "729369d25cc6c687e94797c1a65c586c3f9121a9abf5b783a15d179e5205b76b\tBhLywsZsAys85bSw8LivVAerEf6vqGk11j\t6289741478\t62.897415",
-            "729d215a1bbf4fdbf57c554bb6bb27a37f64656695aa6f38360b158900a7ab70\tBhvrRYhoS9kWfa8dquLWfUMoGh1e3ZcBLV\t528853800\t5.288538",
-            "73631ddbf8802f4e7882f149f6d3e49c9efb3a1ad3b6c676ed085ad9bfdb1ff3\tBYCXSDHqisEuMKrsG5ozoiHKwFBeCzA3rc\t9354320147\t93.543201",
-            "737d2142db6225ae0013e8bda4690f5500fead930109a4d78d04f8cdd6805984\tBjbRrGMxybTRDDHeEoV2ZPeydb4QbAmgWH\t5721524792\t57.215248",
-            "7434ba605755ba70dbbd127ec8b0e1d5ed9ef406506dcb865f535e256789ec5c\tBXKvTNh6tFbmKB5gfGJ9MEK3yyJSPmvgzi\t999997969\t9.999980",
-            "74703544db72f2a73fb2bcb56c9a4d3daf5b93e9db3d1be14970388401baca06\tBfe9AvTv999uzZzBWso69jvSH9a6QwJAHN\t8749985904\t87.499859",
-            "748ad7a52ca4125ba78941db7707cd2409650238f46ee93aa1fd0f3b4e684f8e\tBX7ink94z5vcGyVECUWwN1eJ8c63W79Hkd\t1936938930\t19.369389",
-            "749c1f46561acb157704bbcf83035992962cd71a21f70b73ac9e7b40707819ab\tBoM3hj9uzG1RU44J5J2pP6qpZc4j7pqpPG\t6119418428\t61.194184",
-            "74dbe1bdae0027ad3e395b275127d7e6158096e7ec006134f159d28b15039a03\tBriMr7222aQDzQchKjg3Njd92YV6hbEgmG\t939024827\t9.390248",
-            "750bedba9e5e5c1dccb970482ad63f10021a5b53038b4dd7ffb647d60dd6682c\tBXRQ8296FGWmwgLUt6ygY5LadoiWoduwDT\t6864562601\t68.645626",
-            "75301115b965008d2ccd7b2059068f1cf718d2dd0b1230f6c55c2fd10464dc88\tBmiVvAPkfLMGf4DPrHk6H6dVnMe81xnmd1\t6299054189\t62.990542",
-            "754efc0f21a79f5eb3f22a852948c44ca04265726628374b34745dce06d7b52f\tBUWkEqs66LovwrbipdKXLnm1CeXJA5QSXv\t594441586\t5.944416",
-            "759ddd7e2076d9d5de98babb4d4d1921a96d4a1d1891299ac46ad201f3761e58\tBZ9ZM4w7dPphPiKn3BbWuEGHCF97q8vBJi\t598858327\t5.988583",
-            "75e1ce20c95d803bd5f6e110bfff73a03aa50eec0a2994e8e1fec241e9fed3a5\tBfz1o58SdcFccFJGhFsLmXPYSi5iSqin3d\t7147065641\t71.470656",
-            "77349a2eeea952b582d1089faf4583cfdb18084e289b39194d56f6d4cf96f0b8\tBdCJayLRaW4GJPiHzjE94LuHR1PysikDau\t577801196\t5.778012",
-            "7746f8e788d066269364401f9093a2d1794080626c0850a30c9cb8e84ab1566c\tBUDAXgXEvHxHCKadBVNbSzYdMDsKMwGMJV\t692701661\t6.927017",
-            "776bd3bc9ea900355c9089c319539cd602cad5041eabcb82bc232fed4555646b\tBZLmmrPrvAFTRA2agGZtcUt852B6xGYhUn\t577801208\t5.778012",
-            "7770da5a70f4561f87c18657b8c9fd043ca824956a718bd1e0dbeaf2ef2c6a3e\tBjRYR5YJedh2ktLAHo2P3aheAKBZQzQmg3\t6119415414\t61.194154",
-            "77c247480233b31498bab211d169bf3b0f81bb0506e3ae11a73987b7905bd2d8\tBbd4nmPXVs6kfXWFSVNtcHGUf63EpfGf8Q\t3358227994\t33.582280",
-            "7860bcf0c0019cab564c8299dd9fc37bc679182d3530958dcbc400ad63d2245a\tBqNpYqz1PPUTwdiTCYHSVYwfDUjKViEEg2\t70000000\t0.700000",
-            "78d192484e65572019b1c0550007624ba2e3329de655972b76d44b16301c55dc\tBeRXrSoRJLGetMpdmrrvQy1Z5bXDRn5pix\t8135473244\t81.354732",
-            "7924feaaa96322fa9df00935a56b40f2c37b9ef258e6daa3b0a762d6c6633b07\tBVhRwhZYuT6SX9HZA3AEAwHx8U9Fovj49j\t5401785784\t54.017858",
-            "792a53d226710670e6e63a9ecdc526d262305c4215ddf04beb89b46031d03459\tBnRA56GcEHbCXKruvHqZCgUnuVVJkkj1QP\t599890423\t5.998904",
-            "7935afd8a7bf64973fb141364ff0ac53145afa40a6febb00f5e01b884132e7fe\tBiqFgAUMDX4dX6iYMt2HwasxqLDs3m7PZJ\t6299051331\t62.990513",
-            "79453cb71dc900b2b4aaf15cdc7c91c818a323ee5ca141f64f68bcd55a8f2d6c\tBeReA7LruDAS9TMdadZD1owAP5BiaZDEib\t999989272\t9.999893",
-            "79d501d0815d2737444fe71425eade76cee4c66e27ea3c13617711b90649cea1\tBUMVqrESNJ7CarLzTB1ktPXF8ydnSBYrvs\t611549415\t6.115494",
-            "7a4d0300719ffdb844446b4084930bc46106ece643ed7f2a46893dd28405fee8\tBWdYijtuyT1EK5Z5SM4GvWGyoD3H1JN729\t562014074\t5.620141",
-            "7a9beec197c0c6c25c213bfc60972521302aec2b00c6d87f5843569d6ab10a12\tBmzGB7MRCeToKSgoysiNWpFYzNQf8y54fQ\t999992507\t9.999925",
-            "7b2fce10426a9dfd1832edc66503455c3ba1415868f247c8d3e345ed68ef861f\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "7b5860a1a1ef39333f356cdeaebb0896cc62771d5df0ceb6a631a4b113ccf88e\tBUc3YJDndFeWCusaKt2K2pfKiiU96YfsbY\t979193306\t9.791933",
-            "7b6cdeb1aa1fc7a6290d96e81d27c8f65deaa7099c8bac9b03c2f5e9459a9fe6\tBh9EQGXRkomfsAGi8DyZKz31fn9KMAAejG\t9690948686\t96.909487",
-            "7ba1528a05d2147fe04f2e42033bf451a609ef24ad22ea0837c2307e1599f5d5\tBiZTLZwjJasXLDEt42YMMutbmsWqdrhiht\t4796300622\t47.963006",
-            "7bd28609713b8088f1c943075451182e23d9e4fba050fbf057512c3f1f854b8f\tBjakYkgr4pmBuAtQ3y93NEp2hnxE6cE4uJ\t999995134\t9.999951",
-            "7bf2c7e8e12c59e97f3949756f713226fb6a7375b0e8383948c3d8c0c2305eeb\tBhTYPpXcb426h3ogFy5MB9rQFEPSS2SHRa\t15211807326\t152.118073",
-            "7bf2c7e8e12c59e97f3949756f713226fb6a7375b0e8383948c3d8c0c2305eeb\tBksLxzdUQDpR3imx8bWucftrjJgn8ATagw\t15211810189\t152.118102",
-            "7c1d270fec35daa18a83af0a79d8462ad45d30188918abafd3800372226bb4a8\tBg2LP4B5aM36p323Sz5k2XkRoikCSiQeJm\t1598043674\t15.980437",
-            "7c7579d18809c77b4813689554dd9f2223013b91198623266685dc380df378dd\tBXswJx5ENXbFHCxpYiQjBcPxZ7iU3dkg7g\t1485407094\t14.854071",
-            "7c77fc00fe02c83f832ea66d421dbdb29907b836152a872b0425ceb2b253b36b\tBqCZw6K1nkyZJGcB2BaZ6pdWtwnGnvQD3C\t764556266\t7.645563",
-            "7cf1580753c0d271a3b6ccfe27b9046daba149b118432a2eb55eca7bfc5cc473\tBpAVgE3jJBhfVP4zfu6MAnD3fAa4FDR31Q\t976769501\t9.767695",
-            "7d1e9bbeaaa1cc826218b8ebcdd4cb1c70ebc1c001cfb5db0069d12173edb8f7\tBXNeL4Eo6AkKntCbdyYfssfJmpozPaDif2\t9351238710\t93.512387",
-            "7d6174c5a95ff62c2c93f081dbe753ec45ea5a046b51c0c4a97ef01a459a440e\tBdUAwjDeQEbQd98r1wknUvoZT88ZnoRo9t\t474419374\t4.744194",
-            "7db40ed328baf6e035752792e221ec0d5121bb7c4a5e90e2c83467ac0c9e7195\tBgEKp4zSK75adMGKT8vH5homi82d1pNLZj\t100779971110\t1007.799711",
-            "7dd20bd4a749f1c48eb9492361e86b71d6dba39d12dc3257253c976749b8ef99\tBZHtBVKKiayrzu11vyKrVcyag6XpUGRm23\t999997969\t9.999980",
-            "7dd861c1c934041ae169da3e4b6d841a62918b24604ffdf32b9bfc60a0aae83a\tBWVJZV3iCEazDjfE6WNx5e8XYGHby8737j\t9399369500\t93.993695",
-            "7de932de068089de3830199b759dd05f118de12d0f3cee9e1d4362c4fb09267a\tBoGX8UJPbmm85jnLWjZuqN2CZ8gBoqchVg\t764556254\t7.645563",
-            "7e35ac84701fa4898d94760c64ada5db34a288f62ef10f5482071300580003a6\tBXmyvtEfbWuzPih89fxWhUrJfPRoyMKSUU\t1496650920\t14.966509",
-            "7fcd426637cd20040cbb8e666ff47cc1d1db328cc4bb2d3ed6700407ad187443\tBiFNGiQuKoK5FcCaRJ3n2RGrGh457YXuwW\t7269241356\t72.692414",
-            "7fe0c1a73f88e28341c56b618a66a483785ac19411115d79e47ec3ea9a2ebfee\tBfrZbAbUsajG3gb2AhYRBmaSUsFxdcUzgM\t569679597\t5.696796",
-            "7ff8c47318f9695a727cb008838b9d2dc6ef7766157e2cc6f20b52bbc1e35d03\tBpTXrUECy1VLs7USFifJ8RJf5d2AabTFq3\t918465392\t9.184654",
-            "80101dfec3c5426adb404880e1cb175c2a984c191e45e3cfb45926019a87a3b2\tBWRNQ4SzNHBc7NfrsxnWhNVkTJk2D9L48u\t5911730491\t59.117305",
-            "807594d337b0c9353c52a8001d6f6f4e3811f8945a0dfd0319700b9b5d91ef34\tBUKF7y1Ee6hkNTfpgJs89dKjeVtCYiksZk\t6864559250\t68.645593",
-            "8136b8a3b0f10632b2a28b36e6d3823e92e713497c48f0d6f59c3f74378c33f0\tBoivbM3WA91oChjMkLs98R6QjRx9KgishG\t577801400\t5.778014",
-            "813d022cf352a2da811075834da08550d65a3007fb628e0a7cb8be14850d8389\tBd49WZer6hqn7RfHVfE7WTiEDQe3rX9U5X\t692701858\t6.927019",
-            "8156843e050e9938ac95fd2d44764fb4884cee429ba2b5098688b25303db57cd\tBix6j6WrWRziEeShicDLZ2KQE4Q4xGATK9\t670643092\t6.706431",
-            "8199de2934364aa3479c2bc4555c540fb9a72201e5568849a6f6813a250558fb\tBcidLW8bN36on3MwmGae52unwAFJZjV3Lb\t999997981\t9.999980",
-            "81afe54661ac9aa28df5f43ae770a7188bd28abf2aa72b6a91aa9cecb2f5764a\tBZ6nwajfmUjFmkbiznX48EZkLYTSNMLerk\t599890411\t5.998904",
-            "830d3862c34b45d1694d30a47144283a69330a1809d11fa5a59d96f33142cbd9\tBngHbyYJW115Yzm8byDGjyj4g3QfUS9eLN\t2300789972\t23.007900",
-            "833fe288660880e1d7e6c1d9980c2c0859143291f73998dcd7def2fd9b82084a\tBmhRhN7aQwDnVWyHrHktE8MiNkZodPqL4y\t6249989694\t62.499897",
-            "846fc58dff0651f2d4baad6e7cc993d16b2cecacb0c28eae9ccb92eb9352d4ea\tBoD7Pa1U3TFtzikPoMy1Kq16mNvNDetocq\t918468237\t9.184682",
-            "847829dc98f0329ff54e9ccee7b9b07edf683e37790ece41b8cc446c1c0c818e\tBhbQwdE8oJqhYYxbn3XixbUnoXqDPd634U\t1598043674\t15.980437",
-            "84ffab34a088eabd388af955baa69be2bcd57138c5f41fc4df84f87950a7e6ac\tBmEByDQQUm8LBQwrqS3whVU9haW4KbQBdG\t362915107\t3.629151",
-            "851854b2b79f910ec5bf2d0f8c0b88d74a67f470b5e5a18c5952b2b46cb60d51\tBhFcas1P5aMzk8e9hvChsp6You3EG9h8cu\t1415402095\t14.154021",
-            "853abd6a6c32ee911bc25e576de11f7b1db85c3453e6ee06e3ff81852431734a\tBnaf3hf2FfZctKUaPjaWaUMft3uVk7a5z9\t918465415\t9.184654",
-            "85471648d87cdc76e5fc5d0ba2f7ef26c1acfa1a2d91f4216bb37ec9c7872095\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "854f669f8eca178a51a3c8f8f3bfedde618e726d95fc1a122712647b523a2a6d\tBV8mUBPAvFD4pFzgsAjLQtUbjqN2t6N4Sn\t906762569\t9.067626",
-            "8581efa346b8c3f0b448f0f7d58849a762eb2660bb50fa62bb4713bc6dfc0683\tBoMD5yZNSecbu49hupyrYDUAF5GAgpCv2M\t5066370294\t50.663703",
-            "859d7e9dfbe4593d82d9f7d4579181ab83072850afc68d2ed978e9d1dfa186ee\tBjxCJuksBNyyEnRstTmtdScX9jFhBTn7Fx\t749506080\t7.495061",
-            "85a95ab93746ba8b5d905e468c01cb92874cface0d5317f52a0c56ca958f2939\tBbExCYTagJy1UX2xQLk1Ma9uSXD2r2DAHK\t462928410\t4.629284",
-            "85b0a8a65bbce9527a97507826223615bf91aa0124b20d6b5ce339373c8dd21b\tBawKddVywWyGxRscj26smLPnQo2AakUgbG\t432920130\t4.329201",
-            "85b88eb4f90cfc358c1a248484f8182e65224725c04b0c762e62b89cd38ac441\tBoUd1eMyD7FEyXE6E6Ht3WPzQCpEiD51HE\t5272202783\t52.722028",
-            "85e9c3e823fd07fbbe0460e085766d07f87e4e830564be779a4ce73701a8ffa5\tBZnETa8uHqcdT5sSWeqkKmRYTYHR8gazMV\t4159988736\t41.599887",
-            "85f41e43f7cbf691effd2182988fddbd1cf9efe609bac5b2fc571d0b58d6df26\tBmPAjJxarqEPVraQeHvwb6ddWMonZ8z8Wu\t577801388\t5.778014",
-            "8608614d5436a13badaa7b39d5986b59cb4dc1779ad321ca2853e6525a2a33b0\tBfVTgonS6qbTspzvbr2XQQp2VTaYqKA12p\t882549883\t8.825499",
-            "865d693c7d8f529dccea38d4f6bd5b1314ee589004349150c4fa22e62493160f\tBZiiFdzj2ExepySPBydzv9YWT9oFnVqZgK\t999997981\t9.999980",
-            "86d59e677621c92f4225186b1d575809e77b5ab6da26315d42c01647788a1ced\tBomMJwZfene89trkzYL6tCCzDaLE3gAtqH\t2300790296\t23.007903",
-            "86e15fc370da85729326aef24f1c71ccb8ff8a2a485376868e2bfcb165ece167\tBpdeZd2FxoSPa2dB1YiCVdwhFCMVBYFfZZ\t7147061259\t71.470613",
-            "872d042f0fd0aceb79fe3ddfbbbf8fcf8954d70a477ca4ddab034b169f9bb665\tBoCEdfVgBByX1cBxRtDyE28VGYptn3zBkM\t151467420\t1.514674",
-            "879c0cf573d3d27499848da4c972828345ca3928e0a6d7901b61fc429e5a3970\tBrqfBjpgC8WvzfsyvRSi6LHMC3FkZpj1Zf\t1220424432\t12.204244",
-            "87d4adb3745ff7393316154ef9fa3f54c5e6f130c0f104072cb4c5f13d1ea58a\tBh1diBm6ufkdiYwR1dwQigSk2srFqM5Kz6\t599446413\t5.994464",
-            "87e2a8672c3aad59feda0b3caf0d9bc3c40aca2f2b8eae0536479da024352156\tBdaCAyMJKD2oNLGH4iFBdquBtnhSAQwwBM\t7558331600\t75.583316",
-            "88181f4169a60e5481b547644e8af432938a1bb74816da54fa83789a90b085d6\tBXbpvWGNrRzQNKFcgbC5X2t68mnSchn1e3\t764547987\t7.645480",
-            "88327672a793f06941832246cd734c845dc46b7447fb28cfc3294d1b0f35759b\tBcPaS1HD1G8MQeyEQnFaUhQiX8TjfNDoAi\t5169788303\t51.697883",
-            "88561ecbee6cc667762580173b21574af7faed96165430a23167c371c0fe3cb3\tBdkaQrkQzeHza5f2AYYpHgoa63pp7ijqoR\t432920118\t4.329201",
-            "889e3f72fd2241c3a28f367ad872c45c0453de7564d0f42548df9724b49d782a\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "88a2458133773355013afb962fcbe06091b1995edeea53fd300c5d6c7801aa31\tBkaeh2ZnBMgdr3kHKv9myjtX4KbrfquWnz\t108115930718\t1081.159307",
-            "88f175960af58917c0f3e808bb3a448818280b7b340df11ef2ed3c89f8e2ea75\tBhgbq1SGPcmW8jei6s3L1XokvvNzfFHvf7\t5012484823\t50.124848",
-            "88f1f6311ca4324e5e8f074999be1dd94b4d869bf7398f1f1838bf776db6b0d2\tBXmvetyz5z8Somdd4xVWCVxBXP8MvmruMi\t499674599\t4.996746",
-            "895b2f9960f923cc71db3dd44d289fb6845496d41ec5b1f279a4c05052056bb6\tBpczAr1DfoRTLu6NiKJ8Bt9jtvnJLSu9A9\t512036170\t5.120362",
-            "89e86e1fb90bb48a47173f26f9b1b9a01c50e5fb3624271762bffac332f49a48\tBecXjU7FZ3KUgWjbZAE7L8dSoqSFRb2Cgr\t1100394789\t11.003948",
-            "8a22eac6fe4990c11eaca7d76d3665bee4cc1ae724dcff0809c7764e9c8eb92d\tBgXSS1uKPgiWgwfuEjpnP7L1PjtYYGLEAP\t7081005400\t70.810054",
-            "8a3fb7a7e59a01d5cafe60f33753b419aa6ac5d28b58eaaaa67fcb52779bd380\tBUXvJrAqyMtzEMa5mgEgmwNCEH2mdtYshH\t976769501\t9.767695",
-            "8a4e0377b5b946cc0dc7a2a9dd28609ad8839485ca718532c1c9f5dcfeab0651\tBiuuumJSZhqceL8v1ECkQBfuU2zuCRXEBv\t918468582\t9.184686",
-            "8a89a069aca899b529b10fc94ec29bc4b74f706f4270117991c6a8a1b749c3be\tBcAEfSR6ijVwXm24mYoDhYYyBJNJ3osCr4\t5401786699\t54.017867",
-            "8ad8b4d82eb46d1fc4028b3783af4ac01aa6136df0caa00800237cf763ab7efd\tBnrBpZCEB5YE53fEPCraoahPeM2kH8Ks8d\t9749993958\t97.499940",
-            "8adf4b7064d41fff1385cea310adfe317a361a573c4c3ccdb47a4c2fe44ec672\tBiYuHK57vhKVFqpjUdx1x9JByL9uz1ddGW\t6874994769\t68.749948",
-            "8aef9669c5698af4b975f4323a37febdb7de18fcc6aa3bbbaf0d63022d1f41df\tBnT2umFmYAy5DuMRufeXVx6U69Hi98RGuq\t1598043686\t15.980437",
-            "8b40e1971653cd65ca7070b9ce231602f5365d7801305160b29c7bdcaa267b29\tBrVahSMdHnR7fb4SaWhqF9BXJ3kbJbo4ZH\t577801388\t5.778014",
-            "8b8669d58ac7e74dec820d663b8a601c7cfc1f99152bcd1207ab3e0732e79bdf\tBWH2SdqD2tCvzH5Eb1s4SCyZHrgRkh2r3z\t8088661956\t80.886620",
-            "8bb3b818ec25bb6f49c4ed8ded219935b8fc1751eaab2fdbcc03f755ceebd4a2\tBkv6cXrf9ntxbWKJ5prwc7rwnZFg2PDjW3\t474418529\t4.744185",
-            "8c111dbc9dd90bb9d1dec9503df2b81cd171e7e2f184f32b9c24a32a5012e1af\tBYg9BpbpvqLRwZ9e9GrHqdQ4BqPaTQWjhE\t976767590\t9.767676",
-            "8c157935eb7242db69b27e6b99b555612d839a04b25885a75bd39a8213cac012\tBUkyFezq34xfcTEgP5A1L3rw65MPWxqPEc\t764556266\t7.645563",
-            "8c2333f7760e925e1bcd41ee87b67c87c8b0a78cb70a14942f4834a9a206b146\tBkxe24QFisGVjUYPthtzRGUwmmo3kX7eMr\t5169791908\t51.697919",
-            "8c5c4ba0b1971e17d456c7bb2e7a5b023dc0b739b833370fdb2247628c6db935\tBZdB8Zfp2UZz4gMvgiKBUe5KuXQzug1bFV\t695559991026\t6955.599910",
-            "8c6046930eef603f3d59f92472a164725ffe741eb8c0f70da7f9e7ad11f745fc\tBpiiKGBNuztQy58D6kwQ3HzsGVSE5tmfJP\t2151717586\t21.517176",
-            "8c7ff314a65b3e339ed14f9900b54bd2ba966a12e68208d6403c57bbdc70fbcc\tBnDjrZpVnHLqwW7Rup4rB6qJYfZtkfty49\t375085997740\t3750.859977",
-            "8d05dfd76a9a88a4efbdd66b8a6e5ffb9dbc2845ceeea74bc316afd1d9f62be4\tBZNLMzBLKQv4x3rAkGpPCVYq5HHsZoadxk\t750289946\t7.502899",
-            "8d59ea9ffc32db0d5ba34a8ae694ba8c29f3b94cbec9a868daa7d509771b3b48\tBr4LH4WFbSRDbaGGaLaoCRkDTHVekkQYtD\t9690945851\t96.909459",
-            "8d5eb3a67289db763aab527696498534b72b44261ed9ffeabeacdb610fef183b\tBh2WDgrbTA2XsANT71QyCYZ5vMJhiFMuKz\t5066378051\t50.663781",
-            "8d70f5e6a782d8351f4d0b7d70b4c24af0a76e0ea4ebc10841ffcfb393978110\tBiFnF83CRvGc6W8yCb9TBebjjFC5ZcNviz\t611546689\t6.115467",
-            "8d9ec2588441a8485dca3aeadc5f942d84c9b0cd538c652b6b75f2bacfe7c003\tBrWZZH3RzaXeqeAuUvDMpA5L7PqXNNiygE\t8749987565\t87.499876",
-            "8dadc87d8947886d7904ec3993b3aa6b97ed59ce76b1e855644f85d5e05be8f7\tBhZvSFvrFhKHUMKN15xxLNrLUudmyJLMSW\t6100230588\t61.002306",
-            "8e19045cf4d90cd8491b2a435a4b2f28cd9ef2b3b5a3d3e27f872d82a7a9dc64\tBhZqU443j66hgFPot1asD3TWL5n74nDw1r\t500130857646\t5001.308576",
-            "8e523b85a13b4a91d6c57ea10f38616963b974b9ef58e7037623cb96ff75defd\tBVaUCyQRtN9b6ShRAQUqj267xVPrA1V4vh\t499993821\t4.999938",
-            "8e89730d01dc23dc28c46f4d4699a985c222dffb4bf917ec94d402b8b2f61d99\tBpe5difgfzU3miZpVdu2FjLufC3uLUZJMm\t999997969\t9.999980",
-            "8eb797aa7455c3fa118a9f84e466caa7747eadb77d8b60ac6922fe777a90b8d3\tBrXBhgutEfujirvn97Nmr3eWzgXDPnm48g\t999995134\t9.999951",
-            "8f3f286252b685cdc7c3c7e584a91133e5d5ac1197248c146fc42a686725b1a9\tBgNy6RXWdsbjChQDegiEFEv91BKe1nLDfu\t6299050938\t62.990509",
-            "8f40c991bbe094dac848f5de0132f27c8a96879dfd100aae5e29052923421f83\tBmPvcL4vzoVQZjNMpbnVPmJUngGWsEJLFD\t979192866\t9.791929",
-            "8f4195a15f61da875efeebcbb895b3024ea520ae6891de98e2c932df26d30fe3\tBUSCstt7bMGbrhMxpdXdJrY7WKV3dA3X7A\t6249988997\t62.499890",
-            "8f9783027844148eb058181d478a8a330b6bb1b32635d6e1bd80d91c2fb622a3\tBrbT9EhcTFRehUZUvwe55JvQcJGx7YKcQC\t999989264\t9.999893",
-            "904127f1f413e3cd67a288d47e7ff58455e2190540ea199c761c1e9189757136\tBnrZhYichee95zTaaomCWdzgYGw8PfKpju\t999997969\t9.999980",
-            "9062fdd445f3bee286a6e1be91208aebd340c3f53212cbb7f69ccdc9225479b4\tBmBTL22Lz1ZJVU8mr52o2i4P7qiZXD2iPq\t4089980885\t40.899809",
-            "90e8b3efd5c5b36d8d4a250791d9d0b658c524efe61ce48abbd638ca4e39433b\tBWJa3ebwFR7vPrs6wuCGvkfGXgupifpkmR\t1485407106\t14.854071",
-            "90fae9c388a9a2a7899c1f8b18dad5cbc605b3516bf9a55a1f920799ec709d2a\tBWUrzm6yPy6URzu4jum3STMkQRXeWDVGap\t15207493294\t152.074933",
-            "90fae9c388a9a2a7899c1f8b18dad5cbc605b3516bf9a55a1f920799ec709d2a\tBcvGU354ZGNPwPoJvMSSiVRjewjcukvB7x\t15207496157\t152.074962",
-            "912a07c5c1d6454b2851171ec248a1187146bc4f9716a3325561cc860fd76061\tBaePAi3bdHh7RC9tho6AAscngQf5mNxqzu\t600638100\t6.006381",
-            "912b7e12a5c8873d4138c486e3a7ffa340eb84af809f3dc86823d24dd3d1cb5a\tBZPqnxB89HwVFZCERQWNDt3KGa6LBXSg7D\t3280400342\t32.804003",
-            "91526889574192629dbd4440d109ead6b45844c7da172c3e9b0449c6bb7911ec\tBVYQkyAj6F3tAga9eDiCkwQTmNh7WpJwk7\t269997630\t2.699976",
-            "9185364299e9aa9619bfecbadb5fe84101c04435d9b7fb46a9b38640f206c9ba\tBdb2Ak7kDwYggwzBuXdFCZgZ9TRKb12fi9\t9999989448\t99.999894",
-            "91977be14d85f6837ec82fe16362531b798d8921bef0c4874f03fc07b7bf77b1\tBVR6aoGZaCzwfB8iJMg3q41PkexkkTWUKN\t6864559202\t68.645592",
-            "91c7ff3f572440c6d3265012131fa61e19af38b22270dea4e624692211ed3362\tBfViGvUjmU59C3WVkhrEUiY97DjEuckbTU\t2300790296\t23.007903",
-            "91c80413f4d941f3932bf1cf7b9403670c43515e3a92d93731d54d8827139a75\tBks75JN8fW2RVrG1rUAQezCvUiUe5qERF9\t5911744719\t59.117447",
-            "9207dc21c6930754a21b8a39dee755487301e0a6e4aff017a4deddf49dad309a\tBWJPo53KYJ1FbLrKaSwtNScWnqjtCNkUeb\t672205627\t6.722056",
-            "921b3dd11daf0f3fd53a38e3da84cecc2d2aeecd29249638686ae357c43f7496\tBUXS3BsEsAguETWJPBf7X5N7fbqD4851Fu\t6289739047\t62.897390",
-            "92359fedf4e232f12f55faabee31f2f02b6298b4c0da1e88eb482f007832a2db\tBdEEdadkf154mPQTPQMAcL8u7qt6JvpWfc\t99998058\t0.999981",
-            "923fc6ee3ba7520490a499edf6995aae3a823caa1d4ff30f875b7facdfe97b35\tBhUkNdpq92KqpGiUnw5wkuQz5hWKq5pEr6\t1288877808\t12.888778",
-            "9279a8c72918827112b5df27d7c5585c5e6ddc6d2a04877006e92dfa6b9fd0ac\tBmguUGcDEbLdFgXuNAELAUgLSn9LBM38Wf\t1566650254\t15.666503",
-            "92819daf7e39dacba0a002a9ba596be5555c624152cdde48b84f8a6451abc9bd\tBXVfoqpmQj9JNZMirApApZ5dbYVs5fJZpn\t99998636\t0.999986",
-            "92a469c0dcd4db883b920da24280598e6c87e4e4497ea398a2347c196cc1e0cd\tBpmtayxZtPyo5ezMx5Jo9wf2F8efDF1hwG\t6027136441\t60.271364",
-            "92d72117ee70491146c5bdc1c2c201db63f4048164b5635ebd44b10430df88ad\tBn29DuD73k8eBUPAMrpvUTxGvn2waix3qk\t8088662750\t80.886628",
-            "932306b0893fd1601054e5a349277f4746fc76e5fe4605acf828165e5f8438aa\tBfZ7auY519QD46xzgPtPxMC9SVgJcchRf4\t632021524\t6.320215",
-            "9362a11336aa6fa56a451c519128be45b6de0f857a3932d8b636f7d8ca169047\tBVSfQECPuWLT51vfsiRxx1KM5cFU8cmyzy\t563576766\t5.635768",
-            "936fc4b6c460ba176bcba42d2dfe4cba808d490b449ef3e09b7ca6c8f4c12d61\tBbtJt4tWPramRJuspN39CwNQkvJENM3qB7\t7781025309\t77.810253",
-            "938dd1d5fe06d0a30f4bb4f0c3d0432ab7c77df6b447e22eb887eb59eb4941ea\tBewwUGsKt6UvCjAUswAtwnoUJSRimg8P5z\t15207491801\t152.074918",
-            "938dd1d5fe06d0a30f4bb4f0c3d0432ab7c77df6b447e22eb887eb59eb4941ea\tBojddS68Z2NiJEQ5TdFyERTjK8E1nnsXEt\t15207494664\t152.074947",
-            "93d06f2461e8e6614a8d65d7bba378b0401fa6020500d85f0eb92f22a41e893c\tBiwcJDDzvoquj7GgHEdCeCPn74NJQe5XQY\t999997981\t9.999980",
-            "93ee886da4e6d502387447092624cd340658d72e1506fcb7961536ac21987606\tBbtJePNtXQ58cZKAwBPanpv7UFpdtLMsmi\t115216020\t1.152160",
-            "93ee886da4e6d502387447092624cd340658d72e1506fcb7961536ac21987606\tBese6u2nah78qhAPQYpgr1KAyPNWWD2uvq\t115216020\t1.152160",
-            "93ee886da4e6d502387447092624cd340658d72e1506fcb7961536ac21987606\tBgqEr8sq6QenGSRLBEZYkh57b9mvkVVSej\t115216019\t1.152160",
-            "93ee886da4e6d502387447092624cd340658d72e1506fcb7961536ac21987606\tBm22pKGhs8nErHzugZNeDjrFxwjNUsXQzW\t115216020\t1.152160",
-            "93ee886da4e6d502387447092624cd340658d72e1506fcb7961536ac21987606\tBnwr8SsxjF8n7EmQCSwhD2cdGybHw9Xe3q\t115216020\t1.152160",
-            "93ee886da4e6d502387447092624cd340658d72e1506fcb7961536ac21987606\tBphvJPTSFFQyWgMctCcVPdvwqhShPP4W7e\t1000000000\t10.000000",
-            "93ee886da4e6d502387447092624cd340658d72e1506fcb7961536ac21987606\tBpvjfoxFvDCe3zXy5iCC1xFLWSLrdHpxbn\t115216020\t1.152160",
-            "93ee886da4e6d502387447092624cd340658d72e1506fcb7961536ac21987606\tBqLW3xbjxUsABC3VwPveCZRsKZNgeLi5GL\t115216020\t1.152160",
-            "93ee886da4e6d502387447092624cd340658d72e1506fcb7961536ac21987606\tBqXJpStAtbf2kMEC3ujXoQTsLx3AdUpxzM\t115216020\t1.152160",
-            "93eefc5e9c839eca96b1b216884648cca5fe8eb5c2eee67afd3a91f15d89d80a\tBhmGriEAJwzCn2Vr4kXAwhbRFWpXBuXgRX\t6829562397\t68.295624",
-            "94120e3004775852a706ef86b444e6f29f666e43cf8226187d159b36ed8a8f84\tBmzfP8jJ9MWNUz2mdrg8NQ1fcPZVPh1tGK\t999997762\t9.999978",
-            "94505ba3ae8fc134165b45c2536a5a285f10eea90daa25675f86b05ac8e78646\tBgUD7NugeTKcMmMAyFPfrViRGZaJUeN7Fe\t999992119\t9.999921",
-            "94520178b31aabd5277e5695d8763d2931ea19e8d04b6670cd0c79e4018c9816\tBcXRYA24xJm3SK6LzTEshKdRYA9MjDuifR\t5837496262\t58.374963",
-            "946968926602652fe2716d5a3ad7ff2f7b9a6dc5576567aeed21a8b9434eb287\tBVYQkyAj6F3tAga9eDiCkwQTmNh7WpJwk7\t939991118\t9.399911",
-            "9472c62984c152b39dbd72742ffb7d81d3a70b6b33f3f01cf3f7a167a3b5d27d\tBX2zedtkpchqi1vdkkJ7CDWJEB9unMepDd\t563574331\t5.635743",
-            "947529dd09214bef2fc62884ac4975460ecbae7a74e996822cd07c75cccfbd77\tBmooJSeopFCUTPR4b1SU3YExvFu23xtMrc\t5066375556\t50.663756",
-            "94b18ecde99745bd3006ceaebefd3c389fe08708ed655f5d4b0da7119232b589\tBdVLimbGcWHod3Z23TVDv6AeJgEVDbj2WQ\t9354323421\t93.543234",
-            "94c20a41f859b1263eb8d86efe9ae56f2588964fd4e23535aa21310bbf1ea218\tBYvn1e7p8TUadQnBJ4mCDUJeHFEW7sHVdm\t6874995475\t68.749955",
-            "94e9b858def16272dd712fbeb0f2eda7ff10b97710a9e3c5d31a34b30e7f5963\tBV23dAZ5wsMj1XTBpAayexYCfxDhxJ59iH\t5169789686\t51.697897",
-            "94ff93ad205ef02054565373eb96ebb42c4f1f367b0c61aafe0ed09141ebaf50\tBbkXVhedANmpPdVXT5qy1tv8pZuDEcTfsP\t6027136283\t60.271363",
-            "950a8296aa299395bcd69b4834d34bf6de6fca2a057636ed070b9c0c66bd4a3d\tBUnw7fFLfwV5VMu5HQaE3goV3BM8xgSdGm\t976770014\t9.767700",
-            "9510817302321e13cd0b02d21944efd15df9b4b1c1aebb8d91b613b00547192d\tBc2PDLyVURBCc5xnbP2uQXyXLoJFRUnWqA\t5169791916\t51.697919",
-            "95305577395cec6346debeb08fd5aba50b1aa5f6e04c50fcd2bb221521cdc20d\tBhciLZ3aa8P4v1NfF8Yke1pJ1ukWKATCvc\t5911734962\t59.117350",
-            "953f86d57a4f798f5d5f696d8bfb13a2d7f9d0083e6f05bc5b3a20e05bc76a65\tBUSDUR44ZaxwVVsupV3WMEG94jKv5RvPVz\t944374441\t9.443744",
-            "953f86d57a4f798f5d5f696d8bfb13a2d7f9d0083e6f05bc5b3a20e05bc76a65\tBWMRT5VaSU3aPnTEa3YZXBSFJ1L8e6k5Vb\t944374441\t9.443744",
-            "953f86d57a4f798f5d5f696d8bfb13a2d7f9d0083e6f05bc5b3a20e05bc76a65\tBbmpZAeDAocqYDjsLWTUCs2YHHP8WBjqrn\t944374441\t9.443744",
-            "953f86d57a4f798f5d5f696d8bfb13a2d7f9d0083e6f05bc5b3a20e05bc76a65\tBfatB4x7b7CVYrKLvFmD2jDxEQgaz765LB\t944374441\t9.443744",
-            "953f86d57a4f798f5d5f696d8bfb13a2d7f9d0083e6f05bc5b3a20e05bc76a65\tBnGJiuNcveph8sYHpGYttXtAufqZxSuoSh\t1000000000\t10.000000",
-            "953f86d57a4f798f5d5f696d8bfb13a2d7f9d0083e6f05bc5b3a20e05bc76a65\tBodm4cWruoMojRiaWXKP4JphTV2R3XhaWD\t944374441\t9.443744",
-            "953f86d57a4f798f5d5f696d8bfb13a2d7f9d0083e6f05bc5b3a20e05bc76a65\tBp8MnK9vJUpGCpuFdneevCysJHP8hC2YHk\t944374441\t9.443744",
-            "953f86d57a4f798f5d5f696d8bfb13a2d7f9d0083e6f05bc5b3a20e05bc76a65\tBpkcKwxADDPyMfc7uuLjkcY5GJbAV9xWc8\t944374441\t9.443744",
-            "953f86d57a4f798f5d5f696d8bfb13a2d7f9d0083e6f05bc5b3a20e05bc76a65\tBqobQq4NY7rD2d5QypNVdaojjhVx46zKjw\t874370181\t8.743702",
-            "953f86d57a4f798f5d5f696d8bfb13a2d7f9d0083e6f05bc5b3a20e05bc76a65\tBrFXdiLvBcc8FvxmsFxERbq4ZqPNjDEb2w\t944374441\t9.443744",
-            "95577a9d37b3241953367a9b1a5fe50278c24b019d8b4fafca51920fec3cfa5b\tBXH2c2yJM8NkdZpwHBoQjSsRcmE4Te7XKH\t2300792408\t23.007924",
-            "9562e00729ca3b6478d88dce7d4bc6d1c232eec09dcf74738aab1b0f54a00ec1\tBUr3iBaBSfjJHbxDgagJvzvydpF7SosHTu\t979327994\t9.793280",
-            "9562e00729ca3b6478d88dce7d4bc6d1c232eec09dcf74738aab1b0f54a00ec1\tBX1nxmbGbTCmMn5g2tLGueD2L1LfjhQFb3\t909323741\t9.093237",
-            "9562e00729ca3b6478d88dce7d4bc6d1c232eec09dcf74738aab1b0f54a00ec1\tBXWymTjx7GAd9noAuC1ibzQKgw1UGZSy7G\t979327994\t9.793280",
-            "9562e00729ca3b6478d88dce7d4bc6d1c232eec09dcf74738aab1b0f54a00ec1\tBYmJRtYRRufs9km6dARGapFYhvoyBQN7S2\t979327994\t9.793280",
-            "9562e00729ca3b6478d88dce7d4bc6d1c232eec09dcf74738aab1b0f54a00ec1\tBb1hakDdEpWdfBoFxb4ABrS9RxpXUQyurz\t979327993\t9.793280",
-            "9562e00729ca3b6478d88dce7d4bc6d1c232eec09dcf74738aab1b0f54a00ec1\tBbRaKAthekt6RLuqgMa5D6nYrieJdyv6ME\t979327994\t9.793280",
-            "9562e00729ca3b6478d88dce7d4bc6d1c232eec09dcf74738aab1b0f54a00ec1\tBevHcRJBK8GHcS3AGczD4nooh4dvr4A6Lq\t979327994\t9.793280",
-            "9562e00729ca3b6478d88dce7d4bc6d1c232eec09dcf74738aab1b0f54a00ec1\tBjZZpnEMLG1oLoJoPx2gabuiFCHeEEm3F5\t979327994\t9.793280",
-            "9562e00729ca3b6478d88dce7d4bc6d1c232eec09dcf74738aab1b0f54a00ec1\tBjq4DaPCbNKVfAZMe77SrBVwDdNgNMGY2m\t1000000000\t10.000000",
-            "9562e00729ca3b6478d88dce7d4bc6d1c232eec09dcf74738aab1b0f54a00ec1\tBqRFEN1gD9uH1jLoqxzqMawDWhUm889JBr\t979327994\t9.793280",
-            "95660b4b48fa096e4b36a78cb8995d66257e2ca587aed57b803d79f3d157390f\tBpZg1J8ketXNpgPobVj31eEJGQhKHRZUam\t976769501\t9.767695",
-            "956e885a66053ea853954e7bacfa9ac8efeed48842f4506f4558fd294480e2c8\tBVrf3u4b8TYzWyUDchwrZ6WSAoSBGxXrKy\t6249990287\t62.499903",
-            "9577ef0ae09d266f45c67d0d17f864503a8bf55d09dc29c8d06d950b8685f185\tBaeAmCPAqsh21GSfMWNYRFg6BBEQM5ASCX\t999997751\t9.999978",
-            "957d3379ae851b28e06c34d0fd02592ea2fd5af5e85ab3cd21a80467c516e2ac\tBnnJwNHqVN5Q6aHUw1KSajuTt7bT4qhCmE\t9749995324\t97.499953",
-            "958186d397f1cae8a2b598ad338dc60ad250e2f8435d258f32b900deea32061b\tBU9kJzBrAFz3UrqcpYh6R8tGePoLhQ1sj5\t2151717599\t21.517176",
-            "95993a169f0070c37344ef822ee9d58e1610fe84a2342f4fe7b4ffbe99949588\tBhQEKhA2DBK4nUGfY7U1DQuyTL7cRhbU5e\t1220426890\t12.204269",
-            "95bcf32e6e7b6edfb9ae53de2886d14fc7045e5e3c6906012bcdce30b65d3510\tBZi8111WYvrYPCYQKPrWfQXnRTPsZod1Jw\t6864561703\t68.645617",
-            "95bfadbda2ad354093f3925994b99b132b498bc2778def41faab4ec27a98c418\tBZNGCwUYaCfDpuQraRbuPHLvrJsYe2q68k\t658837471\t6.588375",
-            "95c1190b0d59b406e81751babd4f46e83e016d4b89471e967d2ba68aadeb7883\tBgAuwzxAqYaw3CtePCg332xrbJ9C6uiPdS\t632019077\t6.320191",
-            "9601d9bc9e3bce86c1f45b3a4c5b5885ac40c1032422ee87d1c6e7aab559bcbb\tBYNWzuVsKQtJZVat2iZpGaWsa5gGXbdixX\t6949870933\t69.498709",
-            "9601d9bc9e3bce86c1f45b3a4c5b5885ac40c1032422ee87d1c6e7aab559bcbb\tBn3sNgVXX3imZVKyq8nQdTVuqffboZBLtA\t6949867931\t69.498679",
-            "9610397a7c981239dd4de35e091de73e3dc9374f977ab8ff33a5c3f55e0d33fe\tBZCU1SMDyDVqvRFJv45dhiPMeSe4gabUkF\t5401788715\t54.017887",
-            "9610397a7c981239dd4de35e091de73e3dc9374f977ab8ff33a5c3f55e0d33fe\tBdgBWEma1E2H5KjumTpvE4y46mkDXMoqeQ\t5401785452\t54.017855",
-            "961effe84bdf9aa950128beceed0bfb4bccc5eba9120180b06bfbb8c27601cd7\tBVmJmPYyzGd7SkSJraJQv8uV9Pmj1ntbh8\t6249993761\t62.499938",
-            "96ab4d0761122cb94eca3dd8fa5b6120677d9a8459253cff32845f5d92aca74d\tBXUhg7iBrhvtbynU62Ssv6xRyDAhZqafsq\t9351242541\t93.512425",
-            "96ab4d0761122cb94eca3dd8fa5b6120677d9a8459253cff32845f5d92aca74d\tBpNUGm7sAbrVGBZJ2prJMw5iKRqJynE77u\t9351245477\t93.512455",
-            "96b3200efd270047a3c883884248037e3616ae8196b9a5e67e463510c4eca6eb\tBjLfhb8GFQiZexbCqyoxezATPqd4go5r74\t7781017524\t77.810175",
-            "96c54e111b5bb5303062073515507fea4e814491b1bced246f62ae211ace1f85\tBXoGhcnYYUtbetxfM1gmBm7DD3ztVq9rZQ\t9713955237\t97.139552",
-            "96e635dca2ba3e5541ef2505432e5ecfa3404f45bb27dcbc297704c745672516\tBhEijnryH2cY1ydXr7xquJFaDVXqyytnoX\t561049416\t5.610494",
-            "9704f87d918566bef5469c6b67780394aa8d7c5ab2fadfe900408e3dcbb4d499\tBYJT4BDQKTtMcdSLhPqP7cWni2uv4Q98s8\t611549136\t6.115491",
-            "9723e58d693927a4a1f5375a6d9ab79539afdb0040c1331bd0bfb6d136cc5420\tBaFyGYygTXCJ7RSGr6KUSrDFRQ2qxmMoEZ\t4056099068\t40.560991",
-            "973a272581d5e91d8b239dd3263bbc54ff7bbea9fae6a0f0a3a1ee63831b5a09\tBev7qC52aLEB55MNiKmEVVYvU94QjPwYzY\t507796079\t5.077961",
-            "975f9b87b98580b2e7dcc930e62067bda2a70163db2050a93f26f6fb52d34a3d\tBrDhiiBto521qpRdizqgpTK1xqAxL24xm8\t6299053294\t62.990533",
-            "976e40e2a379c2790803d5fd231be9b3bd47b05669b4f17d141dc258a8a4671c\tBVs18TXz5PyozhPWEVa5P3VcMnDoD6Q8Yg\t1598043674\t15.980437",
-            "978dd21e6f3f6907fea9ebdf3e805bf21af44ee4d01db3349d745e0eb8b7f688\tBdX1ojEKQUPq5fLQ6jADcubsPeJ4FbhRzm\t4056101427\t40.561014",
-            "97d2ed6390f2124872be15fcc7fd8ed6213c4e5323d96c8c0c0529d27120ae75\tBWza2GiQMnCNpbX2KbYrxN3tttfLcXZDUn\t672205615\t6.722056",
-            "97d965216cae8d71c4d3c0644df9661c75d7d5c1135e83765c01ede45199bcd8\tBXyvcZhztRFsaP1MHL76ZkFHPfTJsDoS8c\t6249994359\t62.499944",
-            "97d965216cae8d71c4d3c0644df9661c75d7d5c1135e83765c01ede45199bcd8\tBe1PhbNdqWdiNZXUr18Lw181rnChs3Hdba\t6249997350\t62.499974",
-            "97d97f114084125ebd56ca6f11e965e4442c448d3de67624f8b78255509d5e9d\tBmx936k2tjXtFtS9SPj6mRHXoo9RYSkwPR\t6249994510\t62.499945",
-            "97e25b03a5269ea7e4a9ed9cce77cd369e6fca93c92661f69d8667fcf863a427\tBgYEnk1oP368tNYnbpR7Ynyz7BzcJ56dt2\t6100232880\t61.002329",
-            "97e7633db2bdc3b287e7ede9440d7db0162a372b04b543b46de4975bd5d0c4f4\tBddDn9NqBDs2ZFjh9jDQrcu3qypB2go1pj\t632019083\t6.320191",
-            "97f51e3524d92ff879e83b118b9f460e3f45bd9e2b0abc35ad3bc89f84d66bb8\tBY9cJPeEDiVBWdzSScDq94Wp3R2TyCdUqN\t999995365\t9.999954",
-            "9803e23180692b9e60582d630a641c3c638b977d9d06dc56d2276b63d95b54c2\tBVqV2RFvY7Ju2sLBcHZpdnPFvoimqMbAjk\t6864565047\t68.645650",
-            "98061a9893897a89541a528c4b5b03b981bfce4a5358a158a65ae858f55e815f\tBVUvKEzWzwC7PWCLTAtSRNYx4Yd2s9jMm1\t7645581378\t76.455814",
-            "9824088c80d5ad6d815ba2d6ffa625884a107f6433ad846cae6fe924de8b2dd3\tBX786FiBQ8yNCLhFmdL4RiAUU8smZWHjkR\t641887167\t6.418872",
-            "9835b2b599ecb1af4efe330e94f85813a44dfa914eb3a2d5c31da8f409bfa9f5\tBkCNND8JLP36dgymWFfAaCF8y5wRg2XPSQ\t9351242469\t93.512425",
-            "9835b2b599ecb1af4efe330e94f85813a44dfa914eb3a2d5c31da8f409bfa9f5\tBo3jws6DiDjpxa7DexTKGTtbSHfZA87QkA\t9351245471\t93.512455",
-            "9850aa6ab5ee95a6dfa938e78ac48ca4cd8e0df01e392e51311ad50dc715b399\tBawbEf8d9SJauJ3Z7PneUpL2uEae1G5J1C\t4159988738\t41.599887",
-            "986ea6b52c9ed14eecdffe143db23741a0cbf36f7783754b4b448e1f8be6a9db\tBkYbrKjeCWT82QVYPKmR9VLNh52VMtFtmx\t6864559629\t68.645596",
-            "9873ad91c04d0e05177c1b13840e2e0830618bd0ba4cb0713021e9f2efbc006b\tBXWsnXcKdg92PjVyixpJgLX2Df8ZBAsHrg\t3259252384\t32.592524",
-            "9896c1fc5879319d765679c3489b30bd758dd2c5d5641b9aa00cef1c2d60c2bd\tBrnnC2Jv4LxL4iz6uKcWya1eNVPECGEr44\t10803578477\t108.035785",
-            "98980621a3b37196037bbafc137e1343ee5d3dbbe4e425b17d6f4ebbb052d5d6\tBmhpB7jnbefTY7MFYW6CSDz4xbtvvemvKQ\t5012488120\t50.124881",
-            "98b2e2e698b4b5ec16fbebbdd5f7511fc1a8195ff5ee81e338524d236be11804\tBf59FFUHGryusHWSWdD4AF5bqq8kSSuTXU\t764547552\t7.645476",
-            "98ef9a3378beb58f932a5013a9fb81fc4d62487a0e249ddb223ba21ee33ad72d\tBUk9vXBecaQdrs3PtbZZysH7iYXcuRMQ1V\t2151720033\t21.517200",
-            "990984af4e4583a5579154b19ac6457ce20dbb5caad2c8d4fb7dbf0e7e1d0424\tBmCZkrdCXedkwB45HVvL1BVUz23d8CZjbo\t577801388\t5.778014",
-            "99576bf6b94f0142c4d724058494932dbc5fe811ddd5933d42cc97d6ca0c617d\tBiTBr6rgEW5M1maAx5qvzjDc73u2spszVy\t2300790296\t23.007903",
-            "9972262efc6b353445cc83c957a020b473d22d036f68607da78d24a6a857102a\tBYvQuRJgD95oq6nSC5bMP46tBed55Hf3uP\t1100394770\t11.003948",
-            "99bdd1d0d8647056ebd29d8e8f4cd3d9a5cb6e1fab840ed31f6092d61a4b7d63\tBXqbvTThcmkA5iyi44A9HjAtCpHPMGDUAi\t918465416\t9.184654",
-            "99d299c905e1962d19d6de2e61ff5a4d47c1f5fae92e9c34842b72eb628d5c8c\tBetvFWXQsMQNmRYGKuAFSWQHV2UnUFfiS2\t680290094\t6.802901",
-            "99eadc8a8f0f4eb41d255a6254039671cc1edf2a7d37b9217653db6f475db1f5\tBYfyjk2CWq7yMb8PVP2qjdQzZsSxh2rrLG\t670643104\t6.706431",
-            "99f8c6918c18c0f2f16cb8ba934e1fc667e83fe0c25cda5ed036c2998d5edaec\tBTteEoDtR8hW5B9dee9WLkRp7ra1Z1nyjH\t6864564901\t68.645649",
-            "9a0fee3d40ad4c6d665d3499c513df48b80bde7b3be998ffc134f5509f32e598\tBrV7y8JbASdMVdaeNdgnbaTeE9pGZW14PL\t733321560\t7.333216",
-            "9a458bb649983007649ff6cc259713caa7ef705c94c8ccb746ca82463df5d099\tBpydGsaRh2orc995CTzVdFftCDzrKTFFgU\t2300792731\t23.007927",
-            "9a48dd37510b21c78b738016daa5e8a7b264f0a648dc5c54e15641ffc8e3c372\tBhWss6wM6BetDdy5FQKKzXVQdPyUdp4pC9\t9999993532\t99.999935",
-            "9a538058673cedf0bcfabd4d5076ed20bc8306900461bf89d5a47dfdc70fa2f9\tBV96RGtwkx3mnjoyxi6hcrPxXyjft2Qsj4\t5724995242\t57.249952",
-            "9a59c0b0ac5b9e050e8d92e3698c6a640c4b62d29bf84b731e9beddb02da5015\tBowNEdfb3DP7gZBQ81L2gMvtJkMgP9S6uN\t7781021741\t77.810217",
-            "9a690ac69a80215b0cdf5aaeb085db218adf90c6ef28c58d1453fa248f8474b6\tBWNzoNSCx1JtKQB2zPSifobox9xhpr59dT\t594443226\t5.944432",
-            "9a690ac69a80215b0cdf5aaeb085db218adf90c6ef28c58d1453fa248f8474b6\tBYFUgDuwT7UGJTrdxegQKUcUtYuWmZXzmN\t594443226\t5.944432",
-            "9a690ac69a80215b0cdf5aaeb085db218adf90c6ef28c58d1453fa248f8474b6\tBZ9ZZ5pqFLQj8ptzVM2DYjoWQsDD1nGjwa\t594443226\t5.944432",
-            "9a690ac69a80215b0cdf5aaeb085db218adf90c6ef28c58d1453fa248f8474b6\tBbXkZT2hBsg7BWXCYGUP7anFcREy85qNjj\t999999999\t10.000000",
-            "9a690ac69a80215b0cdf5aaeb085db218adf90c6ef28c58d1453fa248f8474b6\tBco4VFitZR3ifQrW1oXo8YYuawQwDTp6tc\t594443226\t5.944432",
-            "9a690ac69a80215b0cdf5aaeb085db218adf90c6ef28c58d1453fa248f8474b6\tBdaUbPC7snTSUhQv1rApxrtyzgUPepk8dz\t594443226\t5.944432",
-            "9a690ac69a80215b0cdf5aaeb085db218adf90c6ef28c58d1453fa248f8474b6\tBgnVPfD6gwadURtUQdWw2SPe65iNxb9MZL\t524438972\t5.244390",
-            "9a690ac69a80215b0cdf5aaeb085db218adf90c6ef28c58d1453fa248f8474b6\tBh4NwBfDGjTRSKn4Eegv8mu1mLibddHR8r\t594443226\t5.944432",
-            "9a690ac69a80215b0cdf5aaeb085db218adf90c6ef28c58d1453fa248f8474b6\tBoP9UDctQBY7LaugFvzXV3rVuonStN49Q9\t594443226\t5.944432",
-            "9a690ac69a80215b0cdf5aaeb085db218adf90c6ef28c58d1453fa248f8474b6\tBoZBcoNXU4CxbMRq8eDyqDU9iAQMYMpTrA\t594443226\t5.944432",
-            "9a812282648c43cb48b97f12c0acfa1fdaf9746b2d3a0e7f0fae2d2dfa632255\tBq2Xstpz68SHvPKkNXeuHXqC8CtCBGeSHi\t6829560082\t68.295601",
-            "9aa0d8d8695d68f77ce174fed55786bccbd70d017c8c85ab55c903b219663219\tBdxSTwp9ZrLK4dnZGMrc4hgWJbcequPcYM\t9712781977\t97.127820",
-            "9ae618f3cd63fb0201ee4e463729e6b09143995cd0cafca36eff2d3ec4b33d35\tBaMobf5tj1cmmu359N5gNTTaSJ8MLppvtJ\t5066377223\t50.663772",
-            "9b29f19f71db0031916c936d11b262b05e087bc3b2c6f9cedd6e29aa1acb7930\tBbPkXYXSqo6NpT77ABM4PLTa5SP5pwzBRQ\t694542325\t6.945423",
-            "9b58e648d99c6c3d3b3f749450ed3e4f1f0938381437946940e7a3837fa5668b\tBWEit2N4mYNMHzuft5HDofRwp7aaJLEYw8\t939027122\t9.390271",
-            "9b58e648d99c6c3d3b3f749450ed3e4f1f0938381437946940e7a3837fa5668b\tBXYNZbWrx5pUZ4GhMPoMBFoKLVugxVGJSF\t939027122\t9.390271",
-            "9b58e648d99c6c3d3b3f749450ed3e4f1f0938381437946940e7a3837fa5668b\tBZpSyyLr1GhFFh9uSmxkhJ6wthMXTLrJXs\t869022112\t8.690221",
-            "9b58e648d99c6c3d3b3f749450ed3e4f1f0938381437946940e7a3837fa5668b\tBc2Wko5mUwNDDZmfR3YZzUKWvqb3GSkEGN\t939027122\t9.390271",
-            "9b58e648d99c6c3d3b3f749450ed3e4f1f0938381437946940e7a3837fa5668b\tBcp92DB1Lqm37qJLJ7DfCP8UJLBMAgfA7B\t939027122\t9.390271",
-            "9b58e648d99c6c3d3b3f749450ed3e4f1f0938381437946940e7a3837fa5668b\tBi7oHhmyL4GqQKkod3sTL3GSBRNXn2C1F5\t1000000000\t10.000000",
-            "9b58e648d99c6c3d3b3f749450ed3e4f1f0938381437946940e7a3837fa5668b\tBipTYTtSJ4VRad5Dd1NQd3kR6LhKLSPb2E\t939027122\t9.390271",
-            "9b58e648d99c6c3d3b3f749450ed3e4f1f0938381437946940e7a3837fa5668b\tBjwjhpqBRJd2iaNLTJb1Bu3opVDUnDdrd9\t939027122\t9.390271",
-            "9b58e648d99c6c3d3b3f749450ed3e4f1f0938381437946940e7a3837fa5668b\tBkACG67nKi9Cqv7SAiut5psoWSNW3jrWeS\t939027122\t9.390271",
-            "9b58e648d99c6c3d3b3f749450ed3e4f1f0938381437946940e7a3837fa5668b\tBkrvqCwXRdZUiGYEieEM5dNh1YkhRJ3nme\t939027122\t9.390271",
-            "9b804c918a1004431537df6b986f520762ccbc0437b0249c43a5113a16aad0ff\tBc36m3RMty6V3sVUZcaFMYEGeoW7aWPSog\t7781020985\t77.810210",
-            "9b8fed758abdd1a3510d10392177c91ed93ac4aebbdc4c1836655247053f44c5\tBr6t2z925Png4gYE8TcdG3M7hQoMaUQDPG\t594969087\t5.949691",
-            "9bb09d077ddb0faddee956a90965a7ab723e4487a768a3e6e4b00e0b2febd22d\tBer1Z1UyUUBNpzNAA8exP237NxaJPqJVdB\t772291657\t7.722917",
-            "9bbfd820f38870cfe3bc4ad5c59c59a20a8c85148a8b91923a192015ce2df060\tBUV1N8X3EGcZ5NS2E2uvdf433sG2QtokBr\t8480683568\t84.806836",
-            "9bf51aa2d4151193411722ab1dc06b0621f5671cf94f13674820a0d437278712\tBaTZfuPYyHPGhi5dYUUqynoG9CZynM6Ndh\t6249993924\t62.499939",
-            "9c0ec46a95e0224a65b563d805cfd9500f92cdcf305a4d194296824d660b2d32\tBg4nhfv7bNgQXPZb66CEv2w8ud1oF9Nai7\t6935808234\t69.358082",
-            "9c1111fd937a4221fa113033f5af07dbf4a7d9caeaa31337ac7b4b2f24f19ef9\tBn7AsWJ99HhH9AfbudKUwDwbqudxSkFfkq\t979195313\t9.791953",
-            "9c147ccce8c208f6ef02b38156f4b8d746567113b754a2332c51d2a23156bc60\tBVyypPzGJAs9ouS3y2vzSRuWo4eCbpXpNa\t1100397475\t11.003975",
-            "9c147ccce8c208f6ef02b38156f4b8d746567113b754a2332c51d2a23156bc60\tBZzqfrRFo1r5fxmfhsrYENgYGTAPamdNN6\t1100397475\t11.003975",
-            "9c147ccce8c208f6ef02b38156f4b8d746567113b754a2332c51d2a23156bc60\tBcJZnyyfWSc1uY8XhBxYrnzCnmeqSgfXBR\t1100397475\t11.003975",
-            "9c147ccce8c208f6ef02b38156f4b8d746567113b754a2332c51d2a23156bc60\tBchvEPncG8DHXjVydzucFP3QBwQeRTzcBu\t1100397475\t11.003975",
-            "9c147ccce8c208f6ef02b38156f4b8d746567113b754a2332c51d2a23156bc60\tBdi92jRwQvsaURZt5Psmvj7broNaBbEbsu\t1100397475\t11.003975",
-            "9c147ccce8c208f6ef02b38156f4b8d746567113b754a2332c51d2a23156bc60\tBgxKKJnhKh3yfwtHyfiTRae3RfHihoMi15\t1100397475\t11.003975",
-            "9c147ccce8c208f6ef02b38156f4b8d746567113b754a2332c51d2a23156bc60\tBjHsUJyTTYkis1kzxQ6eNYBHQTAR3EuNN1\t1030393218\t10.303932",
-            "9c147ccce8c208f6ef02b38156f4b8d746567113b754a2332c51d2a23156bc60\tBm595wjFcRnnKoQGrDrkodeCZJisDP5tMb\t1100397475\t11.003975",
-            "9c147ccce8c208f6ef02b38156f4b8d746567113b754a2332c51d2a23156bc60\tBmKPiwzFeGwZjAMKQYSiENwPrhTExK8gCL\t1100397475\t11.003975",
-            "9c147ccce8c208f6ef02b38156f4b8d746567113b754a2332c51d2a23156bc60\tBouferrM2gXZk46JspCNXoErMQ5yakw3Ey\t1000000000\t10.000000",
-            "9c17a828951f4cd49139dcaf1f2526e19d8b29bb8c38a9d33ab4875c19b6a7b7\tBdc8QGFvMBzQfRQ2a5sXhcTbDCWra7HUE9\t5401784569\t54.017846",
-            "9c17a828951f4cd49139dcaf1f2526e19d8b29bb8c38a9d33ab4875c19b6a7b7\tBm358o4gDerxW77hXEAFL8XdgGxVDGvvij\t5401787832\t54.017878",
-            "9c856a85452e099abeaacf41faa9634a97e4d73b5daf55bf929312557c397753\tBZw5FdgMtBuxPRS2ESajWYiqvjFRLaCkHe\t9351239640\t93.512396",
-            "9c9c6c63c66823b9f13345f331e704b2effca60fa38a251183f9d8ad364fa34b\tBfFYLGsHQqN2YBDdcXHAmtxYqSXXpQu9Q6\t611549427\t6.115494",
-            "9cbd733cd7f067c0ed08d6bd26eeacf552ef9aac7bc26fab3fbd5fe155658967\tBgXJsV7SeBfAQifWsywp17NsvhTzSZaVfJ\t6864559326\t68.645593",
-            "9cc008edaa55866ad5a100f26a827b87338a1265cfbeca47b765b6e65763546a\tBdR6nALH3QvBjncnV6fZ66AtwtkKsuqzHj\t939024827\t9.390248",
-            "9cd5e678c6bb74aeb4585d66b2fc79b3a374bbebea13eebd2631e584f68c57b7\tBn5rAdqAe2r9wBVabwWoNztEWVAiPih99c\t5721530524\t57.215305",
-            "9cd9c4457f88168d6d9daf6b61c31b278407cb1c13e4684c45fe12413b651912\tBbtpCvwj2EnkiKK7r9spEsiMNHu17y4X6H\t3259249428\t32.592494",
-            "9cfe0459c112ae0f6ef4b8ea4d64545da31a811c321ef85e75f48950a64c46d6\tBhV2PytbZjW5YUoyYwtmFf2qzFFD7trh7n\t9620940842\t96.209408",
-            "9d1f618c5e8057ba8896e8859810917c1c68b602b2b426c943ada15cab5ddc3b\tBmi3Dt5XohxLgSQ1n4TvGk5zEcGndgdgn5\t999986827\t9.999868",
-            "9d75e7bb3f8c70f3cd74ac2f472381ae21fe8ed87c120cbaa9f998878c33a24a\tBpVETmZRH5hQn4Vz6LzFJmHumezWrKfJky\t6027136295\t60.271363",
-            "9dc6e6a12e8dd3c7a8731b752831c7b8107deaea1212f5d31b633968616ad064\tBUQJM59QHqgeGKVoR9k1SrmwsmmeDBsiN9\t842294216\t8.422942",
-            "9dcd708030f03be337f0fb934ea3ed738eea9ef593982c89c7abcb497faf54cf\tBkZVHr9VFTZaZAQGWZJkjT8DtabKFykHxU\t5401782931\t54.017829",
-            "9e00efd7a90af2ab4500cee917a494ee07f809572cfd0ca98ddae7c319cde639\tBjyL1hMwCVEiD1LfEGqM6rqDMRABXFETTa\t976770025\t9.767700",
-            "9e1592447a5b24d4201eb1f74fe6aaeb24526748b3ffbe4efd742011be0e68e0\tBp4EMs8AU3TKHVzLaAuxos2dk18xxEyaDZ\t6864567928\t68.645679",
-            "9e1f81ae04bde19120c998fa0cf4234c17fc01d12e4101e63738be64c8ecd6c8\tBrJPvAy5yU8LbxyoKz3girHKPvapa9zz7m\t976770025\t9.767700",
-            "9e2bc038d6ad793efc00e5da726f37900008f16759ef22dc9bb201e4b0416c2f\tBr2igPfsPGvpCbfJ9QGM35vPdnSS7CnE9i\t918468237\t9.184682",
-            "9e3fa787213c0042b02bba70101ce891e1f1df0822c8b73e3a89b16ea5e88892\tBgfmg7YjnycayKVLwc1WH1wS858ksiV5Jt\t5066380463\t50.663805",
-            "9e5b0b0e62e1ca92075060873098e6a500ceac4a6d2d698530c70806b14876a6\tBk6gCZq7SHVTEZjVKufTF9czMU7sTKzDRw\t1485407106\t14.854071",
-            "9e85029857d552c1ce0e8c6450c7715db75391ea0b62cbbcd469a5392e4bb1b2\tBY6TAr62pztCR4H6Pe61iPwShnmd6KQw5T\t749506740\t7.495067",
-            "9e9bcdf6c721ee84e1ce6cbf6ba54f589587f88e1ff46bdd245aaee1594d5c09\tBe231sjQ5bzkMurR7EsB2zi6Tn1xSAfaj9\t9351247102\t93.512471",
-            "9eb355d7d735807404b210cd5b4f9bece559f40e884e584cbcda44eff5be44d1\tBg5Py4TQPjwNL3arZDBPppqsTLndtne3Ed\t999989660\t9.999897",
-            "9ecbd709a1bf3046bfd108b95d69fd60798a135a58b83f2cea0a65f477fcdd75\tBfKkKjqZYMHfEZUbT768VQ96WpC87ubiEc\t4056098670\t40.560987",
-            "9eeca1ae5cd375450127025046eb027c05aff0482836a32fd20ed84d127e5677\tBcURm9cQVcMmkUjH6XShsazfx4Kuv3Sdg1\t594441574\t5.944416",
-            "9ef37a49ae65b3a8e84afcd9c73d9dbc903f0e7be8d8afe80e1ddc1e9963f08f\tBoxxd6AZs9ysiwbLUmygaDaCvsH1KTkN91\t764550398\t7.645504",
-            "9f3a78b91d45ebc345ebe06ba674437e1ad0d993280693fbc81d680f887283ec\tBrxVxUubsYGQebcG9wTXT2szzp7jtKSHrm\t918468605\t9.184686",
-            "9f751272dff02fd71eff6f68628d4ad5f62bf6489203e65fbd0f7bf5c5cd5654\tBfdBX6s3iavDdMaMQPEfuP8dfpBxtgVj5h\t9351244100\t93.512441",
-            "9f751272dff02fd71eff6f68628d4ad5f62bf6489203e65fbd0f7bf5c5cd5654\tBpkuTkoywPsHXoeMAJEcHBkpLS6oeQQ1sE\t9351247102\t93.512471",
-            "9f77870b59365e03f84ebe8116b27a0c7a633120e4a2a7aea473de907fc544f7\tBpF6znRzZ2F6fDaa2myN5XTiW5zWisz1TX\t563574331\t5.635743",
-            "9fcbd4622401040b8873d36f8644d859fd58a3e1fc795b02440860edb7dc35df\tBfuiKSea36pSD58cc8GDfqcT462iAWwer1\t2230788194\t22.307882",
-            "a012a30936dc143fbe9246a6c4807c6a0cc7a8c6494a7d375a6fb3d0139e2652\tBU1SAbSTQhbCRpPmevvYqMSUaGz5Mzo59C\t1100397339\t11.003973",
-            "a012a30936dc143fbe9246a6c4807c6a0cc7a8c6494a7d375a6fb3d0139e2652\tBUi3MES9CDfhijuHPCahqK4deDSNK1Nh9p\t1100397339\t11.003973",
-            "a012a30936dc143fbe9246a6c4807c6a0cc7a8c6494a7d375a6fb3d0139e2652\tBWCyRapenvaWQLzUH1H4EUCstjFXD853kB\t1100397339\t11.003973",
-            "a012a30936dc143fbe9246a6c4807c6a0cc7a8c6494a7d375a6fb3d0139e2652\tBXdVZUjdEzhVGHRvGm6p1hFDXjeJsaN6PC\t1100397339\t11.003973",
-            "a012a30936dc143fbe9246a6c4807c6a0cc7a8c6494a7d375a6fb3d0139e2652\tBZGVhaZi6hnYLxLoCPAMqprEUZJSjWq76n\t1100397339\t11.003973",
-            "a012a30936dc143fbe9246a6c4807c6a0cc7a8c6494a7d375a6fb3d0139e2652\tBi6pU91mgVGQExAbebGigfeZuKzBGhBAq1\t1030393087\t10.303931",
-            "a012a30936dc143fbe9246a6c4807c6a0cc7a8c6494a7d375a6fb3d0139e2652\tBou1Sw2YopLR8uNDVsAUZ8iooQ5vA5Gsag\t1100397339\t11.003973",
-            "a012a30936dc143fbe9246a6c4807c6a0cc7a8c6494a7d375a6fb3d0139e2652\tBq66mRyKffqwD4Yc2DRBLDa82RSYx6H9za\t1100397339\t11.003973",
-            "a012a30936dc143fbe9246a6c4807c6a0cc7a8c6494a7d375a6fb3d0139e2652\tBrFJoYTx3RSQouZ3QfXdidUDmPqgCyeyQu\t1000000000\t10.000000",
-            "a012a30936dc143fbe9246a6c4807c6a0cc7a8c6494a7d375a6fb3d0139e2652\tBreqwAYon5ExGwueJNExkh7xp39qXFqm3T\t1100397339\t11.003973",
-            "a0662fe5efd2c723bad18261d62cc040e2b143f3fd50e35f86a8ecbab4c05084\tBguqT1fFYRZa2LnqJBoX9PKJoNh3AmAiH6\t70000000\t0.700000",
-            "a073f9857312812560a9caa1d84d27efa3e7afcefc69a66ae18986576e4a57b4\tBeCFQZiWg44KCb8KgAjf59LrGgpLhQFYap\t529885331\t5.298853",
-            "a093bdb92005cf9b5e7463e43843c6e61a4bcfa385066205d7c59f5c5c815bf4\tBVT7VZDefrst49MGa6e1FGTRozkh5VtKX5\t577803986\t5.778040",
-            "a093bdb92005cf9b5e7463e43843c6e61a4bcfa385066205d7c59f5c5c815bf4\tBXfHGFrarQGHFwmCXgWBBxs5dtFk8xSEmS\t577803986\t5.778040",
-            "a093bdb92005cf9b5e7463e43843c6e61a4bcfa385066205d7c59f5c5c815bf4\tBbqgwkHiuhkCT9t8oqA7cTABWdWT7jUax5\t577803986\t5.778040",
-            "a093bdb92005cf9b5e7463e43843c6e61a4bcfa385066205d7c59f5c5c815bf4\tBcnh7TZk2DT9FEGnbytKuiRFZEaH3e1ARs\t577803986\t5.778040",
-            "a093bdb92005cf9b5e7463e43843c6e61a4bcfa385066205d7c59f5c5c815bf4\tBdsFVBtHgscUaEuexVmTRHobNS3JPV1xuc\t507799278\t5.077993",
-            "a093bdb92005cf9b5e7463e43843c6e61a4bcfa385066205d7c59f5c5c815bf4\tBfkwfE4DLTTPwmDkr18L22ApWK2UaDKsra\t577803986\t5.778040",
-            "a093bdb92005cf9b5e7463e43843c6e61a4bcfa385066205d7c59f5c5c815bf4\tBhTbBXHwZVoEGLdfQT73asGUvMJ3HEZFiD\t577803986\t5.778040",
-            "a093bdb92005cf9b5e7463e43843c6e61a4bcfa385066205d7c59f5c5c815bf4\tBhuHoLXPxgnbV5sbExvgH37aEV2sAgjwMn\t577803986\t5.778040",
-            "a093bdb92005cf9b5e7463e43843c6e61a4bcfa385066205d7c59f5c5c815bf4\tBpBDHgYZDQ2BsSnBqYLpUwNEJA2nurU8J8\t577803986\t5.778040",
-            "a093bdb92005cf9b5e7463e43843c6e61a4bcfa385066205d7c59f5c5c815bf4\tBrkCanBPgqVSmcDebdtPVY8wVJr57mv6jV\t999999999\t10.000000",
-            "a0face4ffa1c5794d3aaa801d1e541af94c13f3003f15528dd39c52e33989a61\tBqt4y6oNMsCjVrjsoPXXC8jXSkXXAjdQvj\t999995315\t9.999953",
-            "a140e0357b075b6d6ba713ac33e7fe337bf393b2611c327bf8161f1ad2c0c15a\tBXVfoqpmQj9JNZMirApApZ5dbYVs5fJZpn\t299995908\t2.999959",
-            "a149b1375145283e22c3b41136a046c7fe590f3372c8728cd71fff84b4fc88cd\tBZm45M9VWoFRV61M4xE2Ltwdm9MJy83uyk\t976767567\t9.767676",
-            "a19d0be501bd412f9b8fbacce0e4325250b4e29ce1cdf8ec248a12e68b50616c\tBZqcHUVhTjtsTbiitJsnzPuAYrJS6hJnCc\t7132214626\t71.322146",
-            "a19d0be501bd412f9b8fbacce0e4325250b4e29ce1cdf8ec248a12e68b50616c\tBnK4vTqRGf2yLRkLBqskAWpcJZZevKffkn\t7132217888\t71.322179",
-            "a1c38362e95a8f764d10827e311f2ca6241a110a26153b83adb4b0538cb23b36\tBdUJJmPtTfjM3NdjNFBdnA4Hj1DGYeoGgg\t6799977111\t67.999771",
-            "a1e6ea3f8f91626145bd1eb2718a1d2f435571e459cad7743f16339ae0ab8697\tBiY9hGkUwVKCq5FpeuG3VPZ9r1DzVGzytK\t979192866\t9.791929",
-            "a20f9199d10fa6a314022d16e415dc6e057a77cca0b995ba0141b302711d5a5b\tBZDdTv65ucddDjhuVatEErNYjPJxGz3WJW\t6249991711\t62.499917",
-            "a21598aaf0384cd90865f67a61e028e40c37df858caebabb481c687355ac1b3e\tBaWcya2VC6a7TJCXnSvqjwTTSddR4urqDZ\t563576766\t5.635768",
-            "a216478bd952c0c80879b436eb13ea0f23a2cddf6ace1af37bbaa7124f6102d9\tBYSoXCQsiMWMt583zqPmWnmxxiFeGxC6ah\t6027136295\t60.271363",
-            "a21b84dbd64cbe9b502adafe3d620af9715759d8995b6078256ea74ddcb014fc\tBf7s4ETXMgwFZZfEioxH8U6nwySd1MpAHi\t680287369\t6.802874",
-            "a21fc55e8ce4abdd7d5a7337b347aa36bb50af447e112c99a09b62968eed89ca\tBYgMpPwbhc1ktMRz945QPyRddkbefUf8DL\t6137488846\t61.374888",
-            "a225c993dc6086da11f3deb526fb4658a21c4199e71e26f12d5c26bf56baf135\tBg2tFoGPNJsReu7iScCY7F1QrLXy3nzcb4\t5169790948\t51.697909",
-            "a26e65ff4a5c8dd90af9d4c40d477faeac8782e0b13bc436502365c3d6c74d2d\tBZQMt2PCRDzAnBtKz9VzvxaGkqWPrAschV\t9399367945\t93.993679",
-            "a2984eb91e60f787f9831475f56e4ccb83f53375d754ec54d48d2fb79d628c27\tBoJndQK3TMsZq4FwbRePWkLSAgEXHamYJc\t848460411\t8.484604",
-            "a2afc6690a2dec48d029378ab1d49f01ffdf7f83323712fd2fbb12602cc39479\tBdwHSJ6knPWavtc5Qa18cZDrdENQFpMXXf\t462928410\t4.629284",
-            "a2beb2577db5a881069aef36feb4a32b86ce5ee13b9580196627e38e597fe22d\tBqhftGBLUSrrr4o8iL5jbHz1KmnrK8awUW\t6799980737\t67.999807",
-            "a2d1d798dc4a44ee0ade08431c789efec508d62bf50ad7d859ac4fe6530879fb\tBhPQdM2gSusKGzSzzj8SDZegB2ABUDzQWp\t918470816\t9.184708",
-            "a2d55ebd776739ecad12b168ea13d97f1a824be3902ef9a2649b5e08506fbdb8\tBh6A9Q28XoPj1N8pEXCSk79oP4ubBmLHgU\t976770014\t9.767700",
-            "a2ff02fb9f041cdf6f3c6607d00655e4504a93ce00494ce99f2571c7cf22f8cc\tBVYQkyAj6F3tAga9eDiCkwQTmNh7WpJwk7\t339997650\t3.399977",
-            "a327fd28182e2995e052dabd6b971e352000eed4067ddd72e4e18558fd222f66\tBnxspGDbRYTvLydBTGJ3D2YCEtcJ21VbQ8\t5719429642\t57.194296",
-            "a34aa1fe3f981139d219e0ed3b69f84387e6de968f07c50a246cf8af012ef00b\tBnXdAtT3f9WL8eT1axWJV7cHhuWTJTWxcs\t762216207\t7.622162",
-            "a352df6842b32b27ed5ef0761775cde7e010cdf86ae9fc4e763341686dd83568\tBUDHFRzXrGjBi57ixfgYMwPN4JJ15XctsJ\t9358619358\t93.586194",
-            "a3763d4a03f463a32be78f352d0b63a3fdcea2b3145e3dd1aa61a085bb44997f\tBbJ44QomboWStbHarEB3MpHqf3tFPUrrav\t6588238414\t65.882384",
-            "a388f153f6b3c8c3c2de031637ea95ca01ea47941705a0819782862141d88124\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "a3a0fad56ab4a3e61766de2c16e85607febf06b9396b60b738b0e568659044cb\tBmSiqsfHNKsWe9Mh5Kaf3H26SF9JAUfdLL\t979193306\t9.791933",
-            "a3e5c11cf63e19bf0d54c23bab891aaf7646178f2edaf9b25cfffd7b310db2d2\tBqPaTPrXNF9tdcPpXoZpiubocoKuv37XUZ\t1100394770\t11.003948",
-            "a3fc809a01aca209b07e960d0e154512edb73c1127dafa9da90d51102accdd8f\tBjKCKRyBUTvbjqSe9x5ZVsbcq2CdJDKsqY\t599449179\t5.994492",
-            "a3fd0573bed1eb711ce4927a1becb1c9ed57792882a8cbd44e9892cff93e9cc0\tBoQcB5Vj9BykfjcJ5xszMBSBHFL2cyLRDp\t7645579184\t76.455792",
-            "a46cdc7dc2d3feb380244a64237baa0c0978798689344dfb0fc216e3704044ba\tBUJeHghMVFqjQZugfsnnhYjm6pdJKgg9jp\t999986840\t9.999868",
-            "a46ef3a911023782197ea772eafa041e8b1d567725665b20110f3ccbcb3f0377\tBnHssuehtMg7kxWPmvWLcCXUEGyppxejPP\t979195302\t9.791953",
-            "a498ddb99d2d245bf95d606eafd85124b945dbc3e2929fe2b5c9fa901d779069\tBbas9uZ75VSGKy9gPMmEUd7RkmDW6QfXGz\t5066377199\t50.663772",
-            "a49a5de25668f1fe45c0b147a8a3017e9c092febe33fd98ce6966594404dd8c0\tBat9Dt1VxwZm9gbq8pK5fnK7yeiHj8iGmi\t5169792724\t51.697927",
-            "a4f657edccacafbff82c64c2b2200abd80aa98b19b0f32f001649ed3ce60edb6\tBqmLq8wUWXdjXTxqAzZCozRRQ1BsEwMMv9\t1364049747\t13.640497",
-            "a5383c099828b977529b1fa22260e009206c8750ee326cd96f6d0ddcf526947f\tBWA5qj23SFs4R5KrJ2nBKuynikibNmSezx\t999992492\t9.999925",
-            "a5595f7884b46f911fe9a0c9c82e800a9ba5b94f04eda1174acaeafbd1caf1ee\tBqoEsUUfMoTgySxX9tyDbuehfZNsainizc\t9999992699\t99.999927",
-            "a5670b54b875b8d80bfcc433f7bf43a5007bd8599d4e38149046e3ceedbabec5\tBfyFMCsK6FYrDPtdrB4Hav9a5F2B7twFyV\t569679597\t5.696796",
-            "a57ffb0922f14d6bca44a1968055f62ef694a42511bd8d9a050878fa785c8fc3\tBbHawdKMru3K581bEPwNrRXAgoDq4WD4Gj\t7652676311\t76.526763",
-            "a58b251d3f88f3d25b694f511f1a42ed90a601b7b934e76c87d8ae35abd91394\tBmTzzKGsaRKq1bUEyix6bEYvRJwT3QTUZ4\t1364047301\t13.640473",
-            "a5d5c36463f6300e1fe36190c67a4c01d88d77a712494d88a086a591aab2045c\tBfzxxV1PtU1iGsS7k2SzAodaK7V82MPjun\t6638876346\t66.388763",
-            "a5e90c55edd4c4b2005f4efd67673854c76a15423b36d18571c1b526675f39ff\tBr9X1e1TdabbcF7ZRH1rkW7ENrbmJ89C8d\t692701858\t6.927019",
-            "a601716fa895dd276128576a55a84588aac569ea0b5767cada6c7efa68516333\tBbR5ZHyE6TDBdYCKpkp7Zm6FuYjkSamYnn\t739814251\t7.398143",
-            "a601716fa895dd276128576a55a84588aac569ea0b5767cada6c7efa68516333\tBbgVn5t8CrJ6B8tCmkWqvKE1snepr3tMvn\t739814251\t7.398143",
-            "a601716fa895dd276128576a55a84588aac569ea0b5767cada6c7efa68516333\tBc96vj5av8oknsyMsVpzwtigzHzer3bhRP\t739814251\t7.398143",
-            "a601716fa895dd276128576a55a84588aac569ea0b5767cada6c7efa68516333\tBeAmHuXYwgBSVJgyWucKc923gDy8AyC8BS\t739814251\t7.398143",
-            "a601716fa895dd276128576a55a84588aac569ea0b5767cada6c7efa68516333\tBoRzhbgsuA4X5578ZTVXWjGh4DtN9CFEZZ\t739814251\t7.398143",
-            "a601716fa895dd276128576a55a84588aac569ea0b5767cada6c7efa68516333\tBpLHdFu7x7Jorv5EwJqAv621sW6zK63L5u\t739814251\t7.398143",
-            "a601716fa895dd276128576a55a84588aac569ea0b5767cada6c7efa68516333\tBpVprvsazz1DTfNpzgG1VDZ8zd8V6SvDfR\t1000000000\t10.000000",
-            "a601716fa895dd276128576a55a84588aac569ea0b5767cada6c7efa68516333\tBqANSDnw3psXHR7yw3Zq4d7HcRgbETBp2x\t669809994\t6.698100",
-            "a601716fa895dd276128576a55a84588aac569ea0b5767cada6c7efa68516333\tBqFEeaHtRnz8hETZHuYUqcLJ4MWWfV1So4\t739814251\t7.398143",
-            "a601716fa895dd276128576a55a84588aac569ea0b5767cada6c7efa68516333\tBrATh9sbHSSMNnvmeoyXLSxbSvhRgEQZqk\t739814251\t7.398143",
-            "a60590af9dabc373507afba2002fb5ff848883dea39c294cc1008a6032787585\tBemKtVyxbHnX6GsBUkzkPfjKUYK88ePhL5\t5066373157\t50.663732",
-            "a60c2068305cf140f301fdee46d8f37432f5538f343a6574994a5c0a363ede6c\tBrysfrGVZsFVEPuBNK7oUN9jNo8PMjrfHX\t594969075\t5.949691",
-            "a6372edb18d9ff80c075d19d6323c4f855e0466e0ecf075e8a70d2e6fdd9e656\tBj7u1DdhDXumRYReXgrnbajj6g4SKTxPmm\t764556254\t7.645563",
-            "a644cbdd8d031caff740496fbc537e5c3b6458773dbc5bd8ff3fa9847923775f\tBoYcXS7ocwTZarpDNaE1Ry1n42xEMh3oDL\t599449247\t5.994492",
-            "a64b2dddbf713a0c0a960fe45dcb2d3ef79d71d1d0b2d20376bbc641fd75eb51\tBfEvztLCv2GCDuyzQvmo3knX8w2rHJWW4n\t882552330\t8.825523",
-            "a662b000a3ce624e0d9483843858b4536308b378fbd97da3eb92b7cecda292a0\tBVfNNeNpeTYFHeggN5j31YEeW68ua6gjfA\t6386131096\t63.861311",
-            "a6911673368bbc707fb3ce8ae8366f762ba943605f3e83db7014d1590feb5b76\tBiMZBEAEACiVH8j9TLYht6i2Wt5XwSqGjC\t999994916\t9.999949",
-            "a6fc8bd9571de3550faaaf94ab5f3b285db8ffa0880ba95fedd30e9ab441a7c7\tBYJj2oodiPNRGfAR1hkmVWJjgUCZR2Xi4S\t3259252354\t32.592524",
-            "a7343b289bfb69b47a393c8a0c9a1386df18b70bfee6bec68dffd65a52f4c631\tBWPWt1AzBXR4gxo2zRhiwgPSFt3MCUVNCa\t939027128\t9.390271",
-            "a7343b289bfb69b47a393c8a0c9a1386df18b70bfee6bec68dffd65a52f4c631\tBWysP9ySU8cDZG1V9qqyCfYUuTSUrJ79zP\t939027128\t9.390271",
-            "a7343b289bfb69b47a393c8a0c9a1386df18b70bfee6bec68dffd65a52f4c631\tBZqBEw8TFfyA7JsKbMTnXYpPfbYsf5Ck8F\t869022119\t8.690221",
-            "a7343b289bfb69b47a393c8a0c9a1386df18b70bfee6bec68dffd65a52f4c631\tBaPBBSVrarVk94oVYm4c1iqXGQrEgsdsTN\t939027128\t9.390271",
-            "a7343b289bfb69b47a393c8a0c9a1386df18b70bfee6bec68dffd65a52f4c631\tBcqPPm7KrUbFf2TtDMsvbxb7xuw2xRaDHb\t939027128\t9.390271",
-            "a7343b289bfb69b47a393c8a0c9a1386df18b70bfee6bec68dffd65a52f4c631\tBdx2EfqThNf3cm1XerGFi8eBg2E7F2WsVP\t939027128\t9.390271",
-            "a7343b289bfb69b47a393c8a0c9a1386df18b70bfee6bec68dffd65a52f4c631\tBeaZSw5cPdTKJvTdnb4sgDemHsqZy8wXjv\t1000000000\t10.000000",
-            "a7343b289bfb69b47a393c8a0c9a1386df18b70bfee6bec68dffd65a52f4c631\tBkh2tGSLJYxg5mKMm8NFcyYCgxPdrUVNDs\t939027127\t9.390271",
-            "a7343b289bfb69b47a393c8a0c9a1386df18b70bfee6bec68dffd65a52f4c631\tBo2423yMiLkkqDyVw29JMvUuQZ5HNQE2oB\t939027128\t9.390271",
-            "a7343b289bfb69b47a393c8a0c9a1386df18b70bfee6bec68dffd65a52f4c631\tBpSEVSG3cnK4V4RR2ZEvUzgtx4XB5tEd1U\t939027128\t9.390271",
-            "a74491ce93f97fe36417179d43500e9512c9417ef67c21b0931cdb2baa69e99d\tBkxF4SxP1oA4FehZMuxPVLZRFHfjEmsjeF\t7134340144\t71.343401",
-            "a75a24cb92fc83970b417e9f83a2ff976d47797f5913cc28753c131fda6af98e\tBo8UUFMpxrrqjD7rubuaZnGNWYVdS7feTu\t9690951135\t96.909511",
-            "a76037d5c4bd01a87e350e517d328b6f789e226091fc1a8c046e788fe09245e0\tBWE3vDTkqBkQqWxQm2iB4nnh3iu3o1xSoU\t599448847\t5.994488",
-            "a7678d98b522265d0e78913db2d4b3bdc80963276fb87e9b2133f1ee2a9eba1e\tBYjzafK4yUcpxUW4uhurPBKEqiPMQR2zUn\t2300792408\t23.007924",
-            "a78e7e1ae681c1dfa12da3f74a7199a82a163c1244f9c69edc593f9f2348af88\tBncgN8CJaek8ANJKbPKxLop66ukauaUuiE\t1383778457\t13.837785",
-            "a7916235cb26baf15bcbbf61bd09b77398ac643ab2cf90b8ea4c3fef079c0441\tBiLJWm6XVys6gnD2hvRwrdHVw43suxnFRm\t692701649\t6.927016",
-            "a799851230bcb9676ace65ed5c66e91a0f952332a0733a3e89d37a3694d94788\tBVv1tTZ3AzyXPDmXVarhQ5UdxAVRcQL27U\t2300789973\t23.007900",
-            "a79c687f7b9f4dda61e2d92fe1c260b46a61b26692b955251e34ef66f9dc1c4f\tBeEBPjh3MKesJBLFnVvW489v175xwUCWZ9\t9351242486\t93.512425",
-            "a79c687f7b9f4dda61e2d92fe1c260b46a61b26692b955251e34ef66f9dc1c4f\tBhuDsoChvX2Q2AkneHgZEyhjic16MTLqgA\t9351245477\t93.512455",
-            "a7d80c85662c537df33063ca547865de72a6af66e9ca096468d5d058775fd3fb\tBghzVUQT61q8pQVcaFaZz2yL4VhtCBmkAj\t7781014094\t77.810141",
-            "a7ec8a0563fd49e91f28b6ceb5d6238a1533f62177e08d6610163fc384ef44a1\tBdEEdadkf154mPQTPQMAcL8u7qt6JvpWfc\t99997914\t0.999979",
-            "a8092109407a85efacc4c5a863e4945840325b8a051d946609b3978712cc2383\tBXNepJdaDshAnUyEnuTFChziHoKhtNw72k\t6874990649\t68.749906",
-            "a80d52c82240d655bed5dda440684c2e8423faa4b1cc806578ce3a6968a28660\tBcdby9YUj7jqUjkyp5g2M2DKHHGNwbr6d8\t5837493260\t58.374933",
-            "a842e4fa1ef46774b96998876f7a52d2e8c21bfb63d4daac16986b0b44b87960\tBg8hGByXHnBp147yAsqoUhJoeEAWG5MCzG\t918468582\t9.184686",
-            "a873c3e2164bca7b6ad572ac997a1c396907f14e440cacc7e80f9a3d77a935ce\tBipQtVfYgk2uQatTfQNhcwU9bje57AvzhN\t750289934\t7.502899",
-            "a8a557631dda3cdfeafc2d4cfa4ed91340f7f0fdfbd126d6ec7da41e3e611733\tBkk6Gwa3qCN9QbsdbHEXHJaRu5dbXhTfiQ\t9358623992\t93.586240",
-            "a8bb76aa66cb95ee78be38f9f8f9d76f2746900cb44fb39c317a21b59f639f66\tBeJ9ZKSpfv2TuYHVt18wQZXyqShxbKvsfm\t1220424455\t12.204245",
-            "a90ed0bfb73d3361d108b86698fb4635b0c327663f1f3633f86b85fb2804321f\tBVpQFFxJywckWHLBDjFnYJecfimvbxkuCF\t7558333522\t75.583335",
-            "a91bc2823cd67f2fefdca5bb3b35daaea88dbd05d40c6bd64f694f18250ec846\tBgh4BdW1oTyqjMFZYEeExHQKwsKNRy5FnY\t6289741089\t62.897411",
-            "a945b93fbd2b1c9c7527cab0f136ccb3baf77f3daed5100d3786b77925821401\tBWq8Va5PmN34NEYNQECHfWYPXpFuxwL3Co\t999994916\t9.999949",
-            "a976306ec6e3b2c19f0c1198bf1549fd09687da4962679c75871acae0014c2fa\tBiZs4tpLfc3MSKe2pcTeeikWxxqWPKsaP2\t5169791168\t51.697912",
-            "a99650e2e956c33d5f15ee9b12d0663d6c93896156ff0992a7e55f8cedf4c93a\tBfsbwL1HvvXXDqAKMpGNT58hkjeQUx2YhU\t9401985599\t94.019856",
-            "a9dbc0632fafea3b4d64abc12c6c58205d6bcc7cfe767731f7f2b58c2c201418\tBYXVNAacBycuv1LndkCXBr9ojJrjr6LiJX\t762216196\t7.622162",
-            "a9e56adfe3b1d7a7433f94bc97378293f5519c5d113b83f2b6ad7e7ab7762fae\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "aa2a5ea240f71ea6693f56ebb8a2b046dc3b27372a6328f09c0f50cbd8c6925e\tBgobjRWhiLuzo6xKCSMmFfN1XJhH3w8x2X\t999997981\t9.999980",
-            "aa496c02087a105bf4ae7035b0723f2748f83ed1eab060e70f07f2750ab13017\tBhdWGt5B1HKVRjV6uky4xhi4PM1PtV4a84\t5401784087\t54.017841",
-            "aa5144048863aad4408d06e64b6991a0e460344eb4421c844ef1426e152574a6\tBWBcoKaMq4sR6kR85DBRH7j4QmgPBwap2q\t535725471\t5.357255",
-            "aa5144048863aad4408d06e64b6991a0e460344eb4421c844ef1426e152574a6\tBacjEEMzmKiGsTACtqdheMgcyj8FLUZEKu\t535725471\t5.357255",
-            "aa5144048863aad4408d06e64b6991a0e460344eb4421c844ef1426e152574a6\tBc4aT1nWfyjxgwC7JyvTJErhWgwXsLxLLc\t535725470\t5.357255",
-            "aa5144048863aad4408d06e64b6991a0e460344eb4421c844ef1426e152574a6\tBdXiYYdBvkohozvaTrUh9C75TTW3nXMJQ2\t999999999\t10.000000",
-            "aa5144048863aad4408d06e64b6991a0e460344eb4421c844ef1426e152574a6\tBdwqWxv7yCmX3E2t1Jkt6bqQAeyPUfPzAu\t535725471\t5.357255",
-            "aa5144048863aad4408d06e64b6991a0e460344eb4421c844ef1426e152574a6\tBejSgqfgbhaNqcL4fBaCxuokc8whbdG9ni\t535725471\t5.357255",
-            "aa5144048863aad4408d06e64b6991a0e460344eb4421c844ef1426e152574a6\tBgHeHDprMb4MzHdFVRQpe9hS9gYJ8y2tKT\t535725471\t5.357255",
-            "aa5144048863aad4408d06e64b6991a0e460344eb4421c844ef1426e152574a6\tBiQtxKHT813DbV4cfR5h9A1JMN2XoepBHt\t465721214\t4.657212",
-            "aa5144048863aad4408d06e64b6991a0e460344eb4421c844ef1426e152574a6\tBqN9YAkzr68DxMbhAQMdszYRQAjmj1aZMw\t535725471\t5.357255",
-            "aa5144048863aad4408d06e64b6991a0e460344eb4421c844ef1426e152574a6\tBrtf1sD96EHLH1PYSDc31YVv4M3e1uWbgC\t535725470\t5.357255",
-            "aa6871d41c2ffc2b660f1460f191eb4a29c4e8d0bff8f3b6f634fbc802cd4836\tBmE7fuW9yQb6bem44XqmZZQ4f6TMKtoWAp\t733321572\t7.333216",
-            "aa8f3b662d00d04079fdc852dce79fcedc8216981b6ebd1ee91c7aea5539a1f9\tBjQJCpTqW2v333H3CoErtjBZc8usN1hcjx\t5941919107\t59.419191",
-            "aac262617c9e0072da04a696b36442156899fa1893526b07ef2335250ebf5c0b\tBdQ6tPoHmDivGDAvpG5vu6hjPGBvGj7VGL\t611549136\t6.115491",
-            "aad64147163a397ab2b6f18cb53fd9ceb59b97dfbe1859495557c67a05f72e2d\tBp2rJ1zwZPuAw3D6eP9S4pm5uV3yRPL42n\t6588245593\t65.882456",
-            "aaee97e03aab1dcc05732cc1db99d8ae20aa76644fcdff0e20ad41501298ee39\tBWjEduLA5mfUxPQTbXvvRF4s8oNeAeoN7f\t577801083\t5.778011",
-            "ab2a231f9121657ab06c0c748d775ffb9a7f824ddd86bcc62fab1c8226606c43\tBYjVaooGAEMi8LTjZF2w726fL22SEsrDRv\t7781018548\t77.810185",
-            "ab48ed22eb8d9795ed86d0a4081dcf18cfc3bb55229f6ad4ef064d38f41d0d74\tBan7D15qbfC9qjWNw4vZ3kMypJm6rAF4Je\t4056099080\t40.560991",
-            "ab9b06455b5c9d7fd440da35856edfb1f71a29b90587aeb92a7b3619bc7f63c9\tBcda7xDZU9kKnxw9J2eY71mPsUpq2HQfA1\t999997981\t9.999980",
-            "abae26d80dd363c589f8b9581fb5c7d252b182035aeb739c448ea13427f668cc\tBkGF8Svh6X7CS6F8nBxxBB5MeKdQ14sfGW\t3259246686\t32.592467",
-            "abc1a737241583d10ecc17635bf86b5d9aa89133981b97a16b06af94929be27b\tBbHV93h4RhPRAaHZfiUrWk5erSK81sT4cB\t500100745831\t5001.007458",
-            "abe5f38e2c5e7e1006bf7bd4793df3e6c68e3efc039e190a8dbd3f8253933458\tBfiWshnUWghfuMfiAmcewr7nd4vot54GHe\t5972219016\t59.722190",
-            "abf345ae522790ce01b41b19cf6c26d91c5486cb5871f13da2d031bdf540eef2\tBjaJBzoVGYVNgUSQzXv5NyrGK1BgAThHb7\t6249995132\t62.499951",
-            "ac10dbaa3d3a727be667d234b5bc33422d85e83b9ea9e26398de10acf366843a\tBbd82Lw5W6gN6tFDonL3QErmXyX5MUMdeu\t6864562220\t68.645622",
-            "ac21ca4b4414961bac3325d07ac0dc140da87747e58a2c97788fcbfeb84bd123\tBjYErm11HWjLJLDcP7KvnZnPPcguJzjUQH\t750295092\t7.502951",
-            "ac3cf85cf8d1a1b8f804ef6944b828546e7f5983032a4966a92a3b060ac3530f\tBq7bZhqxDa7myNCrkraZYM2SXCuMUxE79g\t8135479399\t81.354794",
-            "ac87021ec27cc4b5f03e427eb84cdd177b63f491f8f17454ad848431951016b2\tBkEe4Zdrt1AjmiRSeSniGSGqBJsRZvi9m6\t534162898\t5.341629",
-            "aca976741459a0a45319916a201b7d253d448623e07d211840aba88e9f5f51cf\tBnDbsCbwtH8htBnwYCgdom3FdZg2fGb9Jg\t599892847\t5.998928",
-            "acbde5bb36ea62ada13259166aad0cdefa65decfde5179d7cdac864178c6a8a6\tBgoNBsMnpwNsmvDpjVqwojBhzEmUR32Yea\t594441919\t5.944419",
-            "acfecc03c5f545b342cea4286956c961c9bcf720fcfe51c0dd1ea0e588679c69\tBd2MDrKK1UMpvtCeZEsxLUtZ9hHG25RSJJ\t6027136453\t60.271365",
-            "ad05d38f270e35a64d8f22926d155da264f4b789511c39aed6fcf9aac3f9721a\tBrMVf4gQgVVvH6Ec2Zpv3KfLCtJED4jU5v\t599890423\t5.998904",
-            "ad116e735c9717fbcb4cbb724907622ce6e2edfe40850af14ac546792a363be4\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "ad25f7beac89c9474ec69342363f93a7b028e833f878ef39421ff8bd9a84148b\tBs37cWJkRBafcE9yNjdpHX6Sthhhr1KCVL\t6864567870\t68.645679",
-            "ad5bf93c64d6e4b9150a754c0f995978bce2af22e30b9b93ef6c27b74c53b260\tBcj7xcqz7GXdzBwoUrgFWSeZRkWTTjYWqX\t611549427\t6.115494",
-            "adde3178dad0b7f91df4f00bf7281de69aee13d85d4490a8107b68ca97bdb595\tBV9SrUZRxr4xNkZm78TUUm1eeoQ8GWDQR9\t6027136453\t60.271365",
-            "ae1f5658f161a66e00703347f3bea09b076ca791601c36d009b0abe1e740fc43\tBaEQpHR2XAFDgnHVEBLANxFdGeCLRegZW2\t5401786182\t54.017862",
-            "ae1f5658f161a66e00703347f3bea09b076ca791601c36d009b0abe1e740fc43\tBfxB1goFu7QeYn9vdXKkF2XPbwGzDtyzAh\t5401789032\t54.017890",
-            "ae2c061a83057540d6f7466c2b2f94f8b5600781365d0564168bb71756639597\tBnnhkWUBEwbe9JogDjTKjJxeaxQTHGrTWr\t5401788142\t54.017881",
-            "ae2c061a83057540d6f7466c2b2f94f8b5600781365d0564168bb71756639597\tBqchYgWzAJozQM2irsgf5gACnnU5JbMWmL\t5401785292\t54.017853",
-            "ae2c336bda984605791280e3a57df05fd1f41b7c6b8c7afea8124e651b03e6de\tBfoVA5Jn87GZkEUPPZpafWGfhSa8Ac5cFs\t672205627\t6.722056",
-            "ae2e76397e5bd0a8d39fdaa95554538bec0f9887cac7845511bf9e3618334fa0\tBgzE1odL2Euxxi5WGmeAzcGNJixA1327jt\t7780678346\t77.806783",
-            "ae3e30c3c00809ee94ac2d3e0df42247a661936359dedf57cb07c64845b14ef8\tBs86zRyCHSYCQkYTuJFsqrvRCJP6ejLrMV\t749997740\t7.499977",
-            "aed55c199e659069a135a6bec8a9f579090d4fa1529a8fb8865f7a2a5265a549\tBX6SoA6jhn2jkMUzQBs2a7ZrHr9xbCfDoS\t569679597\t5.696796",
-            "af06596e4ec10aafbd1111aa649f1507151d0b8e34a78077d4588d2380904254\tBhRZ9TuxRa5HePGzKuk9pivJW8hEC8jKhd\t6249994411\t62.499944",
-            "af193d8adb017f5847de7a6861b87c5d619f90068a60ccc4df0aca6ddc32191e\tBiherJprvN9RChb5FP31EpT8gApmFy4UVn\t5012491259\t50.124913",
-            "af4c592a193b25a075507a8034f3184e03a5d6a398d9d12c6c907a0a5b49a4f9\tBUe4bxQgJEjoirxQGEXGWmHpcMQLgoq1uv\t599456379\t5.994564",
-            "af4c592a193b25a075507a8034f3184e03a5d6a398d9d12c6c907a0a5b49a4f9\tBUsatzwj1kukzBPVWmwqQoWC5SGonFQBvY\t599456379\t5.994564",
-            "af4c592a193b25a075507a8034f3184e03a5d6a398d9d12c6c907a0a5b49a4f9\tBXJg6JBwjhyKJgyTmjSuqySWHBAd9H8mD5\t599456379\t5.994564",
-            "af4c592a193b25a075507a8034f3184e03a5d6a398d9d12c6c907a0a5b49a4f9\tBXRDCP6CA1ogEP8uP9J7QCkpZHdaVP71yf\t529452120\t5.294521",
-            "af4c592a193b25a075507a8034f3184e03a5d6a398d9d12c6c907a0a5b49a4f9\tBaU7sddpVE3CRjKE1kKCxiffws15pM3RNK\t599456379\t5.994564",
-            "af4c592a193b25a075507a8034f3184e03a5d6a398d9d12c6c907a0a5b49a4f9\tBeDinaCPUhkHxwVwNzhAsxpSZzuHH83BzR\t599456379\t5.994564",
-            "af4c592a193b25a075507a8034f3184e03a5d6a398d9d12c6c907a0a5b49a4f9\tBkazgP1m423bTSqgzkfjQPyiLrgrPfPzi4\t599456379\t5.994564",
-            "af4c592a193b25a075507a8034f3184e03a5d6a398d9d12c6c907a0a5b49a4f9\tBkbfTfLt2RqsTWCpiNnqUUw17Hy8cnmnfw\t599456379\t5.994564",
-            "af4c592a193b25a075507a8034f3184e03a5d6a398d9d12c6c907a0a5b49a4f9\tBojg6DQZyUfEqPyQqLRQo18pznbkQeTvuk\t599456379\t5.994564",
-            "af4c592a193b25a075507a8034f3184e03a5d6a398d9d12c6c907a0a5b49a4f9\tBonUNf2CNayVtHXouFPX8gvkJTSsHSSFRS\t999999999\t10.000000",
-            "af6033aecf895c3690192d3499767f89f931d4bd38ac7f4425707a785de9f5ca\tBhGCP9cSn2z1BNYdKeNKbWWcFv2wpPWE8d\t999997981\t9.999980",
-            "af85ddae4f5175fa06ac74f47a1d6da585afaf0eefb542064b6d84657bb132f7\tBVTfJ1hFjCG9DKfMcYj61Cr3y5Qae1iGjM\t6299050528\t62.990505",
-            "afe08ed0293e2e205880136e4fa5c422b9380436db8c29e203261a9221ca2545\tBkjKWVqczWoZ2UFkAHAP6vcskBrCCNp6vx\t4796305723\t47.963057",
-            "b0bb9bb4cc8ac6ffff5597bc8b8e61bc28eafbcf832cbccef0357efdcbbc8cfe\tBnnfCWb6W5LahQdzsVUQKBWCnAnYZfkfmM\t577801071\t5.778011",
-            "b0e7f3af0e8ebbcede0ab015ff6404c982d155f6bcbc31e9e86336a028e5a8e2\tBcUPjf2x38X9N2WtcVNkAYwUX8ASWTtcaN\t6864556369\t68.645564",
-            "b139bf89dabfd396167cf63eb3edf069b97d175125c8469a87cd20561bbd7eb9\tBfvkGpDnu4kUDpmGTDQBA5Gs2AsQP2rxmE\t5957131706\t59.571317",
-            "b1560237b7b5994336b7bc1bbb7069cee0b1536c70cbd34a2377a15fbde9d817\tBfG9u4rJfjriwVQiJiBKndV67n2Py3Reaf\t7759967654\t77.599677",
-            "b17264544129bc712476cfc19b0d1cff0925243273db46c5197523dd3787640e\tBXEBEnpfAyvQPg4xNDAyrScDmuiBD3pVBG\t764550422\t7.645504",
-            "b1a82fb0b9d727002afc4a8507faa574d575c228b67e2d88396da23238ab7e23\tBd99QbcYzr8JgPYRpKNMNcxYymbZ4Ynt2R\t6249993353\t62.499934",
-            "b1b3e84c79b2e7df4d2bf6cc7c266ae6c99e469e9daae949e97bbe2ac4db9d14\tBgcqiEWGgdvTfQtP3fG9PV4LAVkTTD64W5\t8088663449\t80.886634",
-            "b1b410fb0daa69afe4b4bcddfba5fb9d5673b26f4826e7649c3484587a522ee9\tBWrVrZDd6PG4pbjhtQKwZSg1KRosJxWczC\t6249988279\t62.499883",
-            "b1d85e091396aae8464e2faca992b608690129968486ea5e7385abef6ca2eaa8\tBeGizxzPdZfF7Uf2sdJgkdiJnU1qAd5NAV\t3280400330\t32.804003",
-            "b213e1274a65bed7d5b6f2ff0c318c4275affa00ac1049e09ebcd032bde634e0\tBkB2aaaobWEG9aGzfKLejn4yqZLSajV8QH\t6027135963\t60.271360",
-            "b22b831db1eb1dcfd15448419246582c4ccb32c3235596cb1b46df5872937109\tBWLAqyjYSVf3UaoSTR1es53GNtjQn2E1nm\t5401789327\t54.017893",
-            "b22b831db1eb1dcfd15448419246582c4ccb32c3235596cb1b46df5872937109\tBaLSaxmQKgVvNmuLdfKiSDRXTu8ztBrqz8\t5401786064\t54.017861",
-            "b23e33fc50a1f566306638397d256a8a5c95e6f91d63a62bf7fc87149e53ee58\tBWHaMzhuZFiyMxqzkU8nWzZ5Y1itfUqLu8\t599451718\t5.994517",
-            "b24493c0434d19606498a110ba436ef40351820c97f690e1672b0c04338aa492\tBjX4Ye76KGR34vuYHXnNigsvDUMiqJKtvf\t563574331\t5.635743",
-            "b25004fb55ae8438f3005bd6de07a3f593b329d8d2481b5c8775db9dc9602487\tBndBHyzsqX1X9P8NJfSNxP2G8n7rHuc61e\t5911737824\t59.117378",
-            "b2592906e4d2f5c999942ea58ba518b5720700d14fa3ce99f6b6709a8a6bedf3\tBWxfQfhQ7GbAD2xBFTDNcVpkCSf8X28gLF\t7781026940\t77.810269",
-            "b2592906e4d2f5c999942ea58ba518b5720700d14fa3ce99f6b6709a8a6bedf3\tBfB4bXgm48UeA7HrTYNayfYssRxyJS1cXM\t7781029942\t77.810299",
-            "b26cb973d8350c60885ffe8d3129fc5d01b6233e768bece6a5b4bebe088a864b\tBqovcuRVCQvRaBPgdKP1QcqPME7cs98wPq\t979195313\t9.791953",
-            "b270e6bf10115d4fd8a818a0f799478c6b3c771e13d0846d4e98281f35818097\tBfb498XaDJHzgYs4sfLkye41Y8ZY3zAwcc\t5169793752\t51.697938",
-            "b272dae702e28a065b93811c1e3f17bc2a52837179e0624e93a4f73733fd558a\tBV2kahqgMyKzNMLhqCDPEW9pHdGKRzyxAC\t1030392904\t10.303929",
-            "b272dae702e28a065b93811c1e3f17bc2a52837179e0624e93a4f73733fd558a\tBWGq97gCKWVJ8tiHg4StU9WSAomTLUMy6r\t1100397158\t11.003972",
-            "b272dae702e28a065b93811c1e3f17bc2a52837179e0624e93a4f73733fd558a\tBWvDiErkV5vqmpGTLzzNnJNhQJn9yxUVSW\t1100397158\t11.003972",
-            "b272dae702e28a065b93811c1e3f17bc2a52837179e0624e93a4f73733fd558a\tBZCnEvmJW5F2eH3a81c2hw7GQembAJsDVX\t1100397158\t11.003972",
-            "b272dae702e28a065b93811c1e3f17bc2a52837179e0624e93a4f73733fd558a\tBchnvwXz9o3yT27ZPZyxoqzYWr5edAjjqh\t1100397158\t11.003972",
-            "b272dae702e28a065b93811c1e3f17bc2a52837179e0624e93a4f73733fd558a\tBeKw35wD3kKjhKLDfi2pbv3ccjpFAmVDC2\t1100397158\t11.003972",
-            "b272dae702e28a065b93811c1e3f17bc2a52837179e0624e93a4f73733fd558a\tBgcoJW6zhmz7miKbCyreEDMdLQay9szxMa\t1000000000\t10.000000",
-            "b272dae702e28a065b93811c1e3f17bc2a52837179e0624e93a4f73733fd558a\tBhytfMV7SEZPLbN5Do9V8etWFPGFni5RrP\t1100397158\t11.003972",
-            "b272dae702e28a065b93811c1e3f17bc2a52837179e0624e93a4f73733fd558a\tBkUsieyvDS3zEJ7MtkGNPrduDEfuPQaQao\t1100397158\t11.003972",
-            "b272dae702e28a065b93811c1e3f17bc2a52837179e0624e93a4f73733fd558a\tBqhtoCo2AiL5P5tfaFhzPTr1o3RsBeGuo2\t1100397158\t11.003972",
-            "b28709219c1a7f59349c7eb50e92e9d9cac8bceaa14580a0153218366a3c3c00\tBZFrs2ftUbXseEZizBu1ZEu4Lfg6qjtnqC\t2058642480\t20.586425",
-            "b2973234b2cf87346c6983d7dc44da8b2e237a35568c26f339a8ec4b9fae7b45\tBcBomLa16sp93JTpFASD4VrtqAMQd2Wq4j\t139077876\t1.390779",
-            "b2ac23c35111cce3ec3a970581d98caa51cb1f4284916b9a5c6ccf544cf806f9\tBU5UdFkxhnLU4JZTp4cNyiovwMWmhtC316\t4159988350\t41.599883",
-            "b2e9ad3ee5f5faeb1cb5f947db0188d86d257479cacb5382d2691d94c54c1634\tBWMV8QscGn3UAFdSXjqfbkGNAhJYyRokMv\t575923835\t5.759238",
-            "b2fc6d5eb34abd65545a882087613b9ba6f1d2abef5c3419a29568cc525fd2d9\tBjhKKqqe2EzBdL2ULm5gRiX675Cvhw7Jde\t3358227984\t33.582280",
-            "b2fe647d269da70c38d3653bde4975e40dba2d6862a9578e5a50766fb775aeb9\tBWti5A9GsTfmJa9UwnUKTQ5mNfTyhXMtZM\t800000000\t8.000000",
-            "b342585dfe5e01e432136268fca8d2f3f5e0104161b9d6a2e288ea93fd14309c\tBrA3kpJTbEvVMhgZfbxB2ooLeS2RzS4mi4\t474418517\t4.744185",
-            "b3cd47345edd33f37189ee0c64afa5fb8691dd3379a00920ebcd1d14d7949733\tBhxFd9jyanvkrErXDt6y5VGwRc3RJVvr2e\t750292656\t7.502927",
-            "b3d1ba4c4df7aa23cfaf88ad3fa26d657a686ff37cdb0c7d5033adf37707b41e\tBbeKeEkoXsU4Yc5FBdW5e7ojF89RXSqHrD\t6027135963\t60.271360",
-            "b3dd676941defea5f36903730b9c033b0b8eae9951dfa77d7f24b9656e0e020e\tBnzHTTa9oJtEwFtXS5dUBqwGuSyBU3SRna\t6119987917\t61.199879",
-            "b3e49159e7cc363e638d43a624dbbb13f44ba50f153f2bcd3a52ab9199a9c579\tBrYbNAS9u5yLdh5DtXBfgvQzUQgimNmZWH\t918470827\t9.184708",
-            "b3e744931e0005031b6c6c787ff48cabe40581d1f34c42cc2cf23a7b4d1e5dd1\tBUktEwxcvVDkDbAm6PJZxSweR8wfRTECd1\t1000000000\t10.000000",
-            "b3e744931e0005031b6c6c787ff48cabe40581d1f34c42cc2cf23a7b4d1e5dd1\tBYS9pjCmG7GdgA1BT7gE2d3THL42nrPVGA\t528856180\t5.288562",
-            "b3e744931e0005031b6c6c787ff48cabe40581d1f34c42cc2cf23a7b4d1e5dd1\tBZiGqWXi1iA72QiEA6uBRLCCYNcembB8AG\t598860437\t5.988604",
-            "b3e744931e0005031b6c6c787ff48cabe40581d1f34c42cc2cf23a7b4d1e5dd1\tBbHa4qyXmZLiEBkutg9qgM7Y1CukijEayF\t598860437\t5.988604",
-            "b3e744931e0005031b6c6c787ff48cabe40581d1f34c42cc2cf23a7b4d1e5dd1\tBfwwdq1BPAGPcSsvwMTecDeN8iaLxaqysQ\t598860437\t5.988604",
-            "b3e744931e0005031b6c6c787ff48cabe40581d1f34c42cc2cf23a7b4d1e5dd1\tBhx99HDSPLLtKuDKDLXrVGAAVg2EU3XUWX\t598860437\t5.988604",
-            "b3e744931e0005031b6c6c787ff48cabe40581d1f34c42cc2cf23a7b4d1e5dd1\tBiQx9xQvugEztzqhuCKxGrgZzwHwqNuqg4\t598860437\t5.988604",
-            "b3e744931e0005031b6c6c787ff48cabe40581d1f34c42cc2cf23a7b4d1e5dd1\tBjoPfi5GBFadSu7wveW82ppeJiYSDviXKT\t598860437\t5.988604",
-            "b3e744931e0005031b6c6c787ff48cabe40581d1f34c42cc2cf23a7b4d1e5dd1\tBk8wfqEPYJyEXxtm3rAdiThpUfHMFsiGMN\t598860437\t5.988604",
-            "b3e744931e0005031b6c6c787ff48cabe40581d1f34c42cc2cf23a7b4d1e5dd1\tBr5M2P4HGADFr5u16yQMcEqMRoTsSQxgz6\t598860437\t5.988604",
-            "b432b05085a0bee7402dc6e44311ff82c282280290e42d2efef3d909609f3f7d\tBjoGJXBKh2i8WREGq6Q44DXep1tvpxemLx\t5607808190\t56.078082",
-            "b45c5f77d645dd96b006e2c1003b033f020f6c43a6792a0bf5874364202e77ba\tBhxgio51Y6dLyuAVBbFZVnXu6HwY9QSYgk\t9712779153\t97.127792",
-            "b4759e0da009e0a1883fe614c0faeae0563d94903e2ea8f7b7ebc9e46302528c\tBWKDt4WwWvR8rD5iprBQbwnLgzFavXUcP9\t594969075\t5.949691",
-            "b478a94e7c697cb17c9733acedf1408cb4ae1f522b2cdb8653877b3559ec5d76\tBii1TuShfhuRJ1VEdZBUuuypFzsGHmXpHM\t6295104188\t62.951042",
-            "b4a8eaf9dbabd8b99641def2b63be8a52103eea4f4c31be5b3548a7618fb7fd9\tBbyaCt6nTu2Z96J1EAUHHXywdJL7e3auWF\t7645579999\t76.455800",
-            "b4a8eaf9dbabd8b99641def2b63be8a52103eea4f4c31be5b3548a7618fb7fd9\tBrSe5WA6teLrnxBgYtFBoU1sXMJfFx8RWC\t7645582990\t76.455830",
-            "b4af708eac8d9a5144eb7c2688d6e7b5aacde4be26b671f7eff8874af8762f8b\tBnfDrSxgHCcduXuxPGNvSyPLRnMGG9aY67\t939024827\t9.390248",
-            "b4ba54b61d0d35e459a211327253209e93ec95ef01badd367b4431b76c91b0b5\tBeaoKR7jrEUixqPbx6C8RP4wdFSKUd3W5b\t999992481\t9.999925",
-            "b4becbaa3228703b7259b86f5949e26907d22bdb8aea466c16081014a0f7c63f\tBff6VQCaM8Rdz5aKsxt7RfMVh6FKGLzU3U\t4796300646\t47.963006",
-            "b4df86a6a75cc3ae6b8a167cebf9da030327080aabc732d8e9db4e6a2ae1caae\tBnqMWQKrXREoZrk3hHgAXkEPcoSE5XZa33\t7652674693\t76.526747",
-            "b50bc54cb0ac14e7a03bb49e0f4b0d8e05991320e0585810fdbfb39f3aa812cf\tBozpYbMAMnKTqGaj6dZRtMN4yChkqrw5X7\t3259252416\t32.592524",
-            "b5437ba5648b2122cc28c5748a13fcf782569f5f9dfc8d666fa0f91c036c8e51\tBs1u8RJQF2BgemYgVtUmPFGM5xAyb75cj6\t474418529\t4.744185",
-            "b5956f2ca518cba286d3f39ac668a46bfeaf34544365ba5a0837aefc85281700\tBaSNe7dWyFAbeRZcuG1KGbMni7XUduyiGu\t15207490999\t152.074910",
-            "b5956f2ca518cba286d3f39ac668a46bfeaf34544365ba5a0837aefc85281700\tBatv31mQtZFH1c27YduNdw7FhSskbhr1GL\t15207493849\t152.074938",
-            "b5d20a60a44dd57823938590eb8682273497315deb8f9f9851c5019a6a300e48\tBa47MneMSGrdn5stAJQninVLkXw9cYoL5H\t3299984703\t32.999847",
-            "b5d8ca7e52a744639c6be20963f9fc7ee83717b9e2a014a2ab42b058b827f0f7\tBdUgbCBYWvNKKUX9pBuJKpwGAg6tue73QT\t4796303082\t47.963031",
-            "b5e7df0e86333464e8380722f79d687d86a3b254b6393eec293f3b42c870b40b\tBgY1ijb16SUhZMqK42wttYQMKWwTKQAV5n\t6100230594\t61.002306",
-            "b6034fc74868a72e3fda597fad4191e3f78a46ba43f0dc3f67560479c11646b0\tBc5NvEkVyeVVBm1r3v7FSmm3A9sMkqVEvw\t7781014410\t77.810144",
-            "b631bdd492c7efe7cc8c0273b684c65afb547bf7b7e989dad0846d86a5ba7e44\tBgEHdaz83bB28kwftum2VGMUdGj2wmyMTQ\t999995327\t9.999953",
-            "b6582fce1524b062a2fa2dd2291aaa71c97c05b6c356febb9a544bc741b87f6b\tBmdTjCkL5ZkPo5aevFP7ucbxmEoGH1qnZa\t577801400\t5.778014",
-            "b66dd195efe39557c926cc34c0d1ee62edd71635de458f2d0133d234de5e2b70\tBUngLArUvrpqk6AndhknZvqFtYsLwDKvkC\t6299053375\t62.990534",
-            "b6852b649b9c8c185c4bc325578678bd5f0a8cda48f25f1ab7ce0a92e64ab495\tBeihcGn3frGsuhoTcS6dzhBWZBjfjdvvvu\t6638873107\t66.388731",
-            "b6ad43a9badd0513522ce377626f6840099262de02220aae33242099f6368bc4\tBqE4vQrpqJJb9v8htBMqRmLS3mbgd4pE42\t8842990446\t88.429904",
-            "b6b2c8d54df1027e644000695eb1c4088fa55e80d5ff6c3469a9acc5c6b3fbca\tBgYRSGmQdjsUfSBxN5kPtWUGMBA2qRPfh7\t6874993476\t68.749935",
-            "b6c942d486a25b644cdd99a7c6f028c79d3fb44586c7c32d38d795b3436d1072\tBYjcbQRBvAc1L1AuThmt51uxS3QaXuzNQd\t5911739728\t59.117397",
-            "b6e4788416eb0b81ac47e54f1b3f6ed3ce032d17c4a0d22771003306aaacad6f\tBdxk4C7JoTTKsV8TYdaaJfbAPnQSTRALBp\t6403967188\t64.039672",
-            "b6f4e402077f3d2f82f56f0099f51323d6046e7861145c74ca2ef3275a08c13d\tBWn6dHx1bDi8vob2JRwD5KMYvhnT7kxvF1\t500108773486\t5001.087735",
-            "b7164ec6f6753c0bed5e828d42dcf1dc016f53f3a0bdcfe428923fdd50bd1caa\tBXgv8MoTckMT2akKNa8TXsfVuSaMqAGw2L\t594441586\t5.944416",
-            "b71ef41b165bff40c83dd9d9db838d2ea30e71ea68a3776a3f80d584a2d4a0c2\tBW5Q1svMBV9NPRH3axu5jHit5oRQWLBSND\t7269242218\t72.692422",
-            "b720f718612ad1f6dc1be846305df38cd6f01d753cd6d8c4df7eb300b3be8b3e\tBXt26kpdw4ZHs5gUTJ5umtg9pi8HQj986X\t4056096234\t40.560962",
-            "b7367ca71dda4207ff609a3303798caf202e89657aa1323d06a0534eca3d6daa\tBeevt8CeCDcPHB8vhjgBMmyhjbgyBoGqPm\t5911741373\t59.117414",
-            "b74111ffdf531fe9bfce89737541b2bfaf8fb6707cf8dc28432ae25ecf7ff540\tBoZLeP4ktcUZEdn3adNAnJ41R4kF3nrYfb\t6874983319\t68.749833",
-            "b7560d578e961822df3e363ad98d55342d29e2603d74c95ec06ff7e1dae23ecf\tBfLDdmmngu8FibFBcwEaDLQFfb1BUCQxw4\t9166279432\t91.662794",
-            "b75a5e99a35cd04ba42e53d840f5f70ae94da1e949a2c6a0262e5b3d64afe1cf\tBdwTT6e1X1Y5w4BDgkNFnnkK7tvQuSAhsD\t9749996949\t97.499969",
-            "b76272c6f19d6fcee02f827e32598e0fb54dfc8948a02505b66838c1cd0f65b6\tBpNFLAXD6ssBxTMvJdMm1JtLUjJTDzuZF6\t8835487962\t88.354880",
-            "b7649b726e6f5f11c8991ea375eef332b79f778ae72a13b4b4eee57faebdafd4\tBnrgJZyexL4xWmk46mXjCWCLXxLXBHmRhG\t472623255\t4.726233",
-            "b7715a34c60f8af58e8af47e8742f1de402e647eb9ae1f2511b4b6f26a0bf1a0\tBXWtdTfiGEGBTpuphby3jAuYjHJnsEsHeH\t692701870\t6.927019",
-            "b783cabb9abc866906e79944cc2ed403c97bce2ba48fd380a3f0199c54ecfac4\tBhnwa3xUkcqWXiXLUN8QQVF8aT4haRkuJp\t598858339\t5.988583",
-            "b79552facfb12958cfafa196a9a0728610d240932e63d5e08c8587acbcf2a355\tBbDiDA1HXVcYPkvWXe8yM4VrFE1w1W3oxb\t1220426879\t12.204269",
-            "b7c7d252471607422fb4991dc51544f1d01457f365ea12266d41fadafa15ce62\tBhhbaESLAYeHyjcU3p388iscArtAdGVRsz\t474418529\t4.744185",
-            "b7cdcb865a7d5316a5a30beaeba34554e356eae02f5f487248bf3548d345ea72\tBbmC4zANrcNYjEKytzYFTuxNFdcMsy9LJ3\t692701870\t6.927019",
-            "b7f44dae1c603970636fd891c6473d977f089c5ebf8820931d28c90d0dad232b\tBeCnW1ovsuqeZ9PjzccBybqL9wUS12buzd\t594969075\t5.949691",
-            "b7fbf6c8f9d2fc5cb478d05e67cac6d9b22500f768ed7e67268ae5ebe19ed7e4\tBfYucN8x3ruoNdYv81SAe3AZ1g4SbFr8Vj\t7641208810\t76.412088",
-            "b7fbf6c8f9d2fc5cb478d05e67cac6d9b22500f768ed7e67268ae5ebe19ed7e4\tBjapevk3GHhT9MFQ5QexhGa9GzbDX1fSHu\t7641205548\t76.412055",
-            "b8d284ef680605a88197acd090bd9ee0ab94c6a51e48fdad13c1ab5f206a99e0\tBVYQkyAj6F3tAga9eDiCkwQTmNh7WpJwk7\t169998956\t1.699990",
-            "b8d6f7a4483870722e2bb6bc978d9057586f8c5ab604ede940766c7d6e3cb061\tBcUA9AV3nwYbNFzu3ZkiZkFnmsrQM3LZkK\t8749987548\t87.499875",
-            "b8e8580ae9b4bd0a7f90a68e34b737aaddb71b3b05218fe50c17c5147ef305cf\tBkASPDZwhrZeegk7uyB5TDnN1qATjJMXxo\t6082733407\t60.827334",
-            "b90099d5b95784ed0fad277b8add21817b8f59d76263d5cd2d1445a1b455aa95\tBkwVYqrQRbFuLDo5kwaVZHytHx6jwiNThE\t3358227996\t33.582280",
-            "b911fb0c6745c4c99e0ddafaf44cf071a4691e5a995ed91b6bc723480fff5b89\tBhCoUrqMr5Ke2nCAKnmrE4EoxxMbY8AM6S\t976769501\t9.767695",
-            "b9324465e09aebab0bb0731197d598dc0514b7f3fb327af9c8f472a52eaadac9\tBiSD4R19NeGw6BguAv1anHq1TnWjxcTZtx\t999994916\t9.999949",
-            "b93d1e1b6a3cada276d086316e083f6d00740a17b90de99abbdc14d7f91005c5\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "b9650b6c4eeafbf947115fd3153d5019ce6991afc9e9335e30505a5f63cf900f\tBaGmo4mS9mgPhena19ehGRe4oqgBwTknPR\t4796297798\t47.962978",
-            "b97eb0f637126e77f24c8e2a31533de910018ade696d83a1a1688f41565650b3\tBfszpekvAd39jBAc67DWBdDPDrvHHG2MHS\t3280400330\t32.804003",
-            "b9a87b8dfb574a6b7dd3bac130a949e0308ad8c030999c050b4ef3685f63cf5b\tBWg3aMFskBCjH4pCQEKWKqd9SBbSm7Ypfo\t2300792419\t23.007924",
-            "b9aa58cfa519aea471d3dd6eb32a27c0bf8712fc50416c38774d399e3e5bda1c\tBnHB6TF9UftobNXScFXnwhZXj1nzmrrrqx\t692701649\t6.927016",
-            "ba76a29ccb492367c231a36ed6254b9acb60c0b4cbf10acf959ca2eb4e6a0fef\tBaKFnCqq1fygJhiw9eHZD3Wr42AZXp9g5W\t5941931406\t59.419314",
-            "ba76a29ccb492367c231a36ed6254b9acb60c0b4cbf10acf959ca2eb4e6a0fef\tBcD73S9acaEQUAVpDWTvztkouphDSnZ9aK\t5941934397\t59.419344",
-            "baa58cb61f46815c90b96f9553fabfee3c676c631c38d75c8c9702f74d054500\tBs41KZJwS5uSufk7FFvSTmidhu5Cy93oHg\t6249993104\t62.499931",
-            "bab4a95b9704682abbbfb3b324e7cfcdc3b69e2649e76a1e542f6e5a2d576c97\tBWMvyCHrnUbJTMqusEo4FHZ6JF6V3i15Bv\t15207491437\t152.074914",
-            "bab4a95b9704682abbbfb3b324e7cfcdc3b69e2649e76a1e542f6e5a2d576c97\tBgApgTCrutxKgxF9p1RaDexq2FLbupjzvD\t15207494300\t152.074943",
-            "bae5340bc14b13e54f143bdb74578b4cad087a6df6e579bda285b387820a3250\tBUWFxfJCbDxusS7TZckfK4M4DoiqbCrzGw\t2151717609\t21.517176",
-            "bae66ec5989bf254a18e47671d4acbdc90e39e6a094ca1b3b96c3f5c0ddc3ec9\tBTyQVVrESZKWCQrRpxxFVXmKtsX4z4st5f\t594969075\t5.949691",
-            "baf0256702529c552dde7255fdc871a2b5e225c6857f25d7e7666fc1880b0e27\tBdJjSGqdupnX1hgRjo7CPWMej2tEScTpRh\t999997751\t9.999978",
-            "bafcd055ef3b1dacbb36a46a1992ed4d4c8d8e4b4a919781ee43579b5b225b51\tBU4oCDamsiBctpc9SxL1PJVm3Xg2v75dVV\t7641206244\t76.412062",
-            "bb1100db424e64d08230d4dfab147864c7116aec472b271ddbf556119c8b1369\tBe1aJTKEdBc1pmR1JwerF61sPFeE3oCtV6\t6100230044\t61.002300",
-            "bb296fe52ca3397954b2a550249e311270d371da2586c0872489bd9856872e10\tBcHyGgKz2d4Zwf2DkJUpwQ8s9MPRyGHYVM\t9712775867\t97.127759",
-            "bb29c1c947a5cabd691c2530a5d62490f9636b1e6d219c4f759300bf6a336f60\tBcGyJLMNLQ5aQgtMFAWCFz4XBqJMEP1z3W\t6588240641\t65.882406",
-            "bb8992146b020256a5b0eecfaaa8cb110a9ba085b922bfae145a0f526fbbab0f\tBrFpRrWJiFNWhYs9fMry2fcwatUfSHMXJH\t5169792732\t51.697927",
-            "bb985b16de9cf851975954ff322421f80340978c10c8af72ce893101f923e6b9\tBr1pBFNW6hkdGpDPLsxUZpzxPvvgnEL9gP\t8842992699\t88.429927",
-            "bbc7bb2e5c60585a984a4072b2c9c6523f582470bb5699c5286184b7cb2ad3e6\tBqUHNTKAi8XsfMC1Q9aJEAEoy77jYB9JJz\t999997751\t9.999978",
-            "bbd7623ef94a883074d2a36e22fae748bdda179157e57dea44970bb8434a788a\tBieGu5q5bbcKBEJog3oA7kukcsvqQE7wiX\t594441919\t5.944419",
-            "bc2cd7160d174efd1bd0d8311701b1d5e6d47383709bb7b210c68a22ed9860d0\tBojc7ew3N3f46usF8N5bebrSujLS9b5pB8\t1100394789\t11.003948",
-            "bc2fdf1e8ff0a187662021b61227fcd30b62ff09fadb9ea9bd60f162e4e8d249\tBqQYVtgfYf7TmcvuM47YtJDJuoHzzhEvSt\t3189247364\t31.892474",
-            "bc4d137defa507e81fb0077a27b711dd57e04f4d6d3f658d8f1aa89f5ea0517a\tBXMhki2BPEG1EDvDj4tWucwcxQ5SPRAXEs\t1364049736\t13.640497",
-            "bc6cb9aa335a6beac555ad56adc18db4f68ebc3f932943545c006ad9ba73c24e\tBmaZWmGPqsuQgjm5a1V1CvfsqtfmRVjuBC\t999983979\t9.999840",
-            "bcbeae16871682489613b1087437239f51e9b1043739f2284f1f9eed100816d1\tBVnynVr6N7V3fgwftQ67ME8sDHAuvczYmQ\t9399369062\t93.993691",
-            "bcdd32361348905dfe1047516fb34fb439a84e4af6d7e90cfe3bf69096cfbd68\tBf9odNmbPSveJonkSrv8BjcfADWwronJuR\t976770025\t9.767700",
-            "bd3359903fd70f0469c31d51f4a8b44e6a68a6ff020edc4cb342a80056596beb\tBjPqroWpS4nLGwJqDXQMYJN46tj2u59Hzm\t6403972846\t64.039728",
-            "bd8397601f5ee04575b204a1fd05679549f60c9822de6060385160781adc23a1\tBbGzqHmekNLK5anVKxHsG3GGmvFaXhvkzv\t7059961436\t70.599614",
-            "bdc3503287110a0546702c84b6f5e8529a5c779422bd43ed0697439e793ada33\tBh4n6h92rpChEybJQK2j6rUmPJDP2VtxYP\t842296652\t8.422967",
-            "bdfa4d2c44299d3b327275ba5af8fa385dcb3649f19573fccb4d04238d0158bb\tBoVE8UHeyozwdCscDWBmsv5ugRg865Ytxa\t699991623\t6.999916",
-            "be26677f17f6984ca901f4d840ae416b6b1f89d68035c84051be0712716e8044\tBbMVBX7iN5HbAynWkQBMKWQgcbXdvMwh2o\t7780677493\t77.806775",
-            "be2a76f8d0a6e5b817a1b18e7b819511356b06a3a25105fde02817056ba83a0e\tBdjF87Xq7S2PDWBEP184j4RNCmC1fokAt4\t999997981\t9.999980",
-            "be3ef1fd46e5b1393a0904484a8d1516729673a0a79b149b02796d14b8169dad\tBkvpxLjBk4b6t465QSr1aL6GkrTqM4Wouy\t6249989059\t62.499891",
-            "be618c5b1a102c57e5766e512a4f16d37962a7171538a6e391967ef8c685957a\tBip5qkUv7SjjTPRViBx78PPn9tMZBvHyBM\t3358225147\t33.582251",
-            "be7262431d663790b1fdc903bc18a4ba3c1f79be7c362d22d1c730020fa29e8c\tBoeZrfcVeBSBqkj8UMAeQoxbuA4ktG1kgh\t7781010808\t77.810108",
-            "be862db58bcdc616a0b4f2b66f21519d83a668e5092c141e38e4b5366b9ebfd9\tBhtuhciU8K7NEMETJTeN4B4Fw4F7VAgnjr\t6638884197\t66.388842",
-            "be94549c32c8181565d764f12a8f6996addf02583e02dd1a72c157184f559e5f\tBUEopm4PUUtDCTBr4C1PhX8H1ZApabyJd5\t3358225137\t33.582251",
-            "bead28f8f218f863ee358932aae1ce34b79f2086c1746c5f3cb0c54177a6f82c\tBc6QsHSmrDTDJiKRfuNatM3Zfad6uLsvh8\t6949866419\t69.498664",
-            "beba618abb750ba7a413be44f4e1d1a8d3f01ec6e5e975fca6acfeb62e76c326\tBiEY8y4qnQxjbHrGSvjsd1Z3zBDgnFfi8k\t6874996599\t68.749966",
-            "beba618abb750ba7a413be44f4e1d1a8d3f01ec6e5e975fca6acfeb62e76c326\tBkVkuE9FnoqGWUqqLa1mYH5eyVFevEHL9n\t6874999535\t68.749995",
-            "bee67b048598bb113e456707a5645c44398e471d55fb57ef0b630b1d763b527e\tBfQjCJe4icBTezqEFqU9VNcn3UTGZjztQS\t694545400\t6.945454",
-            "befe93f90fed8ca7a6dafe87bc98dfc2e71f327f6a9b1db3fade2049f12d3dd7\tBj84Vji1126yo7Ut5pSmU46S3wJonuEQKY\t999989285\t9.999893",
-            "bf2ca42db398ef421518f712d802aedea5020095da5e5283ab1e6567e4c9c8f5\tBpxHXQB4wFcXeCm9nYRXyBKcDag3VBP3Fr\t1485407106\t14.854071",
-            "bf573cb553b93bafefb93e7a5bbda5b3419918912cfcb3769ddc08c60d66f683\tBbGL4K31HFWDoQJL7r92mpNnFq85tg2yKn\t4796302853\t47.963029",
-            "bfe674559ab36922fd61a531ef41a68dbe70b9a4d15d59cb130a1dbf4c7309a0\tBi6QEdvsQwE1Yt76m8ahHEkHL4RM6zSgc8\t999992531\t9.999925",
-            "bffbe04b05264a805ee09836fc1ecc1eb5a52fab1bd7f1cfa8174fc5f56e7052\tBUMKJTwcHgMa424E82d7v4Bt94eoBeuadt\t9401980839\t94.019808",
-            "c0268cb153d2bd12adcdbca18592335f273d2756743cdcb1efdb922c374ffaf5\tBYUHAjkHe8VGF4qnMKQwzfLfZsqund5EDM\t976767590\t9.767676",
-            "c04f7f7ffe36a6e7c3b7a4ddaf43c570d20097a8f865df496cbf476c2ef90d73\tBkxVzGKXCjLvAnn1wfGVZPghRvcKeHJTqP\t641887167\t6.418872",
-            "c068923952555942a6f6392def42a77c825d58893603982f58e70018def572c2\tBfbBkJCTpSw6zB62eq9wKBo4bfZdC3bEeg\t5401787133\t54.017871",
-            "c068923952555942a6f6392def42a77c825d58893603982f58e70018def572c2\tBmk55Jf49YeAUqrq32JjKKMfrMQpQXdQrV\t5401783883\t54.017839",
-            "c078e528ee4d001993af527380885760647db5eb953e46ae21c489733106b0d8\tBnoi2YZLWDXDjWjc6VM1aAcsJVaVjHuBJ7\t999992109\t9.999921",
-            "c08110a8015c699d3ead87a10429db0e5f6434ef42a3f78daee157adb47c2e67\tBcrv2c46HjukLnu6UfyKv8TMY9Yqy3ZhTi\t6949869556\t69.498696",
-            "c08523f6a45ab33b23a5d5c0597a8bac7f0f19493c710510da6a6a57c05ed701\tBjt8kkZaYB1Z9VhiF4gwNVDMews9y2zPBj\t5957132189\t59.571322",
-            "c09dc26cf723c2b390e913e2935d19f6ce7b2e0ee5c0482c471de76b0b2c7b77\tBmjoQ2QBcJnQSzYoYwixHrVEUeZacN8vKt\t6137490067\t61.374901",
-            "c0a642d49061e7042815b299f57e130b8d172060fb90a13411b396a174dab3e5\tBk4tfdyZkSeRynEPKHqF8K9egUZQ5LQv6D\t999997981\t9.999980",
-            "c0a6d5a57afdcd77223bcda3ea461f04c4e91a8de6ec7e93f3a99a4a04f7cafb\tBUZJwYGDGfuqLAanAmQD97xc7CoSDmWnKL\t6119413653\t61.194137",
-            "c0c7bdf5a27090061512ba0d574867b9d40b64cd50ba6e30a04a12369ca53d72\tBkaZjEMEkCW2Y3MWxJNGMMMmNHadys67Mc\t27572123510\t275.721235",
-            "c0c7bdf5a27090061512ba0d574867b9d40b64cd50ba6e30a04a12369ca53d72\tBmvxML2QjQGJ7mTNqGfU3zxWeHZwjSorT7\t27572120261\t275.721203",
-            "c0e72a9fc4c063c57f87d6749ebb8d3845994a312aab2059a9bba84496167fab\tBTzWCBA6zrbhfrfAf27MpGgJtd31dPhbGC\t3280402365\t32.804024",
-            "c0e72a9fc4c063c57f87d6749ebb8d3845994a312aab2059a9bba84496167fab\tBZmi5WYWmWXWau3unnz6rbpyyLxfLybZsU\t3280402365\t32.804024",
-            "c0e72a9fc4c063c57f87d6749ebb8d3845994a312aab2059a9bba84496167fab\tBce6Jt5VfTQA6hhCuXM2ycEYLGsdyBFfuR\t3280402365\t32.804024",
-            "c0e72a9fc4c063c57f87d6749ebb8d3845994a312aab2059a9bba84496167fab\tBe1MCoeKrpTQsWtXGmyowrwhi9Uajd87ZR\t1000000000\t10.000000",
-            "c0e72a9fc4c063c57f87d6749ebb8d3845994a312aab2059a9bba84496167fab\tBeyHV4YKQy5uVAwQ36fznySZi9UPkB5G3A\t3280402365\t32.804024",
-            "c0e72a9fc4c063c57f87d6749ebb8d3845994a312aab2059a9bba84496167fab\tBfkbUxa49EiUbPb9VPGXV2nAhvX8aw2mu8\t3280402365\t32.804024",
-            "c0e72a9fc4c063c57f87d6749ebb8d3845994a312aab2059a9bba84496167fab\tBmSQpHFWkaFrJSbixp4MAiBZbnL4cjZ6LR\t3280402365\t32.804024",
-            "c0e72a9fc4c063c57f87d6749ebb8d3845994a312aab2059a9bba84496167fab\tBnKzhDMVXWT2Um8xk1unGTDMK26nFCkYw7\t3280402365\t32.804024",
-            "c0e72a9fc4c063c57f87d6749ebb8d3845994a312aab2059a9bba84496167fab\tBpaHfiXKy7q327PKMLgP6G5WKAH8prq4yG\t3280402365\t32.804024",
-            "c0e72a9fc4c063c57f87d6749ebb8d3845994a312aab2059a9bba84496167fab\tBppzMbeLK7AwniCNSFkym3BX28kBqwZ8uo\t3210398106\t32.103981",
-            "c11106c3ce72871a53e0b3efd1327a4b46e99342536e55f5d04459e921582f47\tBZ3eYHrSooHND9yAmyt7jMXSgW4No6wp9X\t594441851\t5.944419",
-            "c1401011e3aeb748e657da51e1481b6d81f0758d9211b441a1016797db487fb4\tBcWaR6gndqURGTkkfy2XEUzt4Nc1SdRDPo\t199996116\t1.999961",
-            "c14536e40247af748e6d098ccabe3a7f3028a8f534ced0d068c489e6eeb9b415\tBXa3zzvgSQYxyrbFc5QpwMauzpGFqTrrYm\t5169792390\t51.697924",
-            "c14536e40247af748e6d098ccabe3a7f3028a8f534ced0d068c489e6eeb9b415\tBpvLkMrpHwQMu4s7WjRQDM7JfPcQ9xjgig\t5169795381\t51.697954",
-            "c1846463536c6dc619b73fe994554f8c3a4c194c47991bea6ba786d20d0a4b6d\tBrGx1TNGxbfbwEWR9cLkxdga8Zk7idsRng\t4796305723\t47.963057",
-            "c1b0b39bc4350c71d1d1af8168ce9ce8c6438346eba15cf4a3c255e55fe2f5eb\tBccH92aj4YhDiicdAQBq83KXBCDeAciQWH\t6864565047\t68.645650",
-            "c1b6949786aa5ecfb0dff54367b014de60a6101477e4f8f83a59d5978d838f16\tBmmFfcxre9niQXNNivsXpC58DLPvkBXNJm\t7645585436\t76.455854",
-            "c1b6949786aa5ecfb0dff54367b014de60a6101477e4f8f83a59d5978d838f16\tBptpLBkcKkmoYgQw2z3A2K1qMttZLWheED\t7645582445\t76.455824",
-            "c1be781bc09904a94ed1314025e56fe4ea131bf883c9b68a53fda1a1a5fa8f49\tBkwQA9mSgAaRyTzVJd3ppXt3GWDQnLMbGE\t764544907\t7.645449",
-            "c1bfd578c68723c50cebfc018d05e0a44079da4e7b39df83d23d17dcd0226e20\tBkPQ6N3kENB69M5aGqu6vAr75TS4vz3rp5\t5455541344\t54.555413",
-            "c1df478e05e60c48d6445e08c2d8f82504f8ceadcf44203ef444d2bc6c9678ac\tBVgpBcrFMPVw1KcTvj4J9reEf9SDTpqCeQ\t8088670762\t80.886708",
-            "c1ffcc81aa93ae2c4ea9ef6b4137d986d7917bbb5108a5a911d1141f6db961cb\tBfQBiDA5sKHmRxTG3TipBdmy6UguP8gM4U\t9399365509\t93.993655",
-            "c21cbd01acc414039bcc1594627c5b4f72223ec573953b550e19418c1f153840\tBkWMDiyLo9Ps18rdSmttzCM3cVYHnXv9xx\t7132213019\t71.322130",
-            "c22ba474eed3f7a4530b950394c8cc6391d569e7199c9c534bb71bbcc4c0c68a\tBagEeN56wJ49R6eWmvjAK4c6RDKL8kMYxY\t812544875\t8.125449",
-            "c2304de1c932a08ec113fe82cf1656d10adf4feec82dd727a8efe00de7d840bf\tBs1k8drcKQ1vy47yRRSJ4xnHkmet5AUMsn\t512036170\t5.120362",
-            "c2595d0f21b489e6c476ae55f0791013a4724e193b2d430454fa0a3764805e7d\tBmKoXQwQH9PjssuGcGLs1QPhFCmz7SB8xL\t749506092\t7.495061",
-            "c26a58b35b0de3023d1e68ddf3b8ab68d35475fcce7f48da4365441acd9c14fa\tBauUzcSHa5yS6mAQen37x5Z89SGB9bUh5e\t5401785458\t54.017855",
-            "c2796cf08d79873fa6748837d834b9188fc912e712813215a0f1d2c551f3bdbf\tBYoj3AzHjjq2aU7E2QgkQDpRTjyiBcCKYA\t6100235060\t61.002351",
-            "c2a4908745a62433e43568cc4be65a4ab2f044e52d26c6ed934f023d8a8c4808\tBjqKbCNWYiRtfQkEp5U8ZFxhPCCh1qd5gt\t750292380\t7.502924",
-            "c2c09c8d333fc668b7b3740e431a0e226b842c52441e234f273f14c0ccbdc6a0\tBftJ517KGxo4es2cA5P5u1KEfKjEThmj3y\t5169789119\t51.697891",
-            "c2e95ec9070ab383c1c5f25a90f3053f50b7487b9cb8b877659fe884217c9a34\tBZ1ti9SUqfktzuGn6DgyWLwLvEiHhDWBm4\t5941923160\t59.419232",
-            "c2ec383216f614d54638b802770aeaa6c1eb6912293f017d5ce40d8593b51b87\tBmHuWk9DGwZQ3Ew5Dec1A9PJRWnTW5uegz\t6299053399\t62.990534",
-            "c2fff1b8bd969e37326607154b912b02116f4527b7bceefd0bf71fd9a9384b41\tBaNaRmiszrgDTUv3PXgzj5TM4TxALhCPEx\t6874992783\t68.749928",
-            "c34ce8ffdf98748453beaf520553ce82d568a9c41b610732f18e9888ccec255c\tBkcLGRrMYodoG8sAMrgMerrWQpwtgyXbz6\t918473864\t9.184739",
-            "c3887fa70347b0ebc49b4a67c4b6206239623b3d541a7d0ecb17ba0a9dbbaf51\tBbH2a2o4Ev57iAaSib7KykCJqaWz64Si4G\t534160451\t5.341605",
-            "c3bbef0ce1de77d9958e1083f1d7a2af5d7f3f3a5794b69c728546bc0340f2e8\tBcmWgfSnGQEsTgG4koqS5iSjWWKKcg8Vvm\t30423619672\t304.236197",
-            "c3bbef0ce1de77d9958e1083f1d7a2af5d7f3f3a5794b69c728546bc0340f2e8\tBiWwRVCbPDRuoJMEaaCN7UNeNJCBbJeYLy\t30423622663\t304.236227",
-            "c3e36c347f46f61e3e3299a8396e0c2cdd8278ab1aabdd062900756397ed5d53\tBaHxuFKwnzrvhev3oCmGWho5WRmwHL9Byr\t1936946946\t19.369469",
-            "c400399e6119c1b023dfb24c8a86d883992d5590a0c33f1c84336d35fd319634\tBnPGHKSh53M6fwH3oF2Ee7ycq4vhNLVJ1P\t6027135963\t60.271360",
-            "c4145470eee3ed2e21e6516f4538b8102ab90ab3051ca70bb28cf36f2f3d6810\tBp2HGG1eoQBNRD2GigAdAtBJTx2YDaGK5f\t5169788925\t51.697889",
-            "c41e68dd93e5c38239913cb4f4d090c3cde618b3ee7cf926f69d781350b003ae\tBkqytHX5pbcswDGzwc61AzHkdtZZyFNZNN\t611546689\t6.115467",
-            "c460a590fcdecc8a5dccde46abe6685c12fe1baa4cf3c48ff04d89b8923a689d\tBX6KKKaMhCXyqDiU5SAVrnoyuvQvm1dDpg\t869020572\t8.690206",
-            "c48375dbdc433f93c4ed511c87afc420e45cd833c7ea2d45b22bef437e1332f3\tBrv1F28iZdcy3MnJaAEjJHWagYq1WYepth\t577801388\t5.778014",
-            "c4c1dcd06f0a597387c73d87c8b8d13d5dd7e3e740b81efe5949a2e48181c910\tBjpNt2ZXfa9KWW74rMBWXcXcEKZctH5GDD\t2058644953\t20.586450",
-            "c4f2a96a7f480f4d4608d5351ab482e7ecce1adc4bb875fda44f7315a7ea9b75\tBWSGMNNUfVwCtkujQ3NZbCkdVwsAfTKxkw\t472620832\t4.726208",
-            "c51bf0fa299a24c93be70928df34b8cff3ea9c8434e643e1ea2cb0616d64b3f1\tBk57d12qRXgAAf7pHj8G8pHMSv8jzNBcZg\t750292392\t7.502924",
-            "c5517c2f77d83293582dda1eaaecaf0a2573cf19a3426f44910ae533acf17827\tBcPSJgj1WRyiUpEJf3zFLiBhhHeoZtgvFP\t2151720033\t21.517200",
-            "c5622230acc42fdc21e53120da64109e154c7f3481dcad8d8dcfc8ba9a02a493\tBd4LnwqYRWDX8viHMC9pKsKpvEPuPx3Ewn\t7269240083\t72.692401",
-            "c5625d6b8838432d4b8e1607b13a61219808a56497329bcfc83a6ce6a111d4fe\tBpEgwfauAyBcQ1s6unpJYPcBaU5HLjRnDX\t534162886\t5.341629",
-            "c56a523bb1e068db7ea38578d52ad2a647d56c299dc461e444e5d518b31a2bb7\tBVEG8y3TofvWBxk7S7SXANAVpfr15WcK5U\t750292381\t7.502924",
-            "c592f6780c636d607ab03cfa0d2f14065537a417348b5572b74ba4e18251ec64\tBVSuFNqxuxACSdERtoT3pJTZzo5964zcJv\t6100227603\t61.002276",
-            "c5a608461b28dbee3764513243d030c32dc24d414edebab997c3c919620f1d7c\tBi3Unf4MHMw7wELJboUangUU4VVfgCNgJb\t7269245469\t72.692455",
-            "c5a706b443e31de2a88c4ea0058c42047af02fdc634c733156624d4d371631c3\tBmDFrDSUHfJPSJVki1hgjWdQw5XNUo5ygF\t594441851\t5.944419",
-            "c5db157fba3b75c9256b8b9c9e3d0d516ab0a32a2cc4d4ef0f3f1ec8ca406836\tBYV82vLmV4MjPoxsReJzhTyB29Ga8ZGrYJ\t5455546952\t54.555470",
-            "c5e84504235f2d25dbfc614285474097157e7831196c4bbc808a983cdb4ffb2f\tBbUSQH9uhJtZCSvAMjXFP4TeUxUeJVQTZq\t7134338278\t71.343383",
-            "c61080822d129babbbe659b8bf363047a52b56d16522cda23c6248ced60e38dd\tBjyrvR2j8Wi7jE4TEmL783wBJ1jxDDp8s9\t7645582582\t76.455826",
-            "c611cb2693308f0348e9b492b0f26ef4a4cd523a55ef5a8db3725cce60e11905\tBoYP7ktPyBuNgfyvfyQhei9Znnk2ju5JUz\t1100394801\t11.003948",
-            "c6152d8caf69de05bd3d37894413eff2b204916b8d8e9f5732d04037848d070f\tBYtRXAHVrfX1uub3Jo3717xM4swM7oJ8dZ\t632021524\t6.320215",
-            "c62466e74cc9ae267721f7f53dc34dddb1743fe431a3695c29322ebb9ec6f85a\tBqhGMv2kRDo5zmTNG5rodYwNFY1hDr46ex\t10803580280\t108.035803",
-            "c62dfba5cf30f8fe50f7fc2e708df22a7d58ccea4fab8efdbea81e21d742921f\tBYoY6ocVS53SUrm9HaEWMzcUSgdVHNEaVJ\t6295104299\t62.951043",
-            "c65875cdefdad6eccee9427c0462381383712c8280a25f6c05ea84d625e9473e\tBWe5eDPtzwDiG5XhCVC9cKtfvfgno2z33F\t9401989656\t94.019897",
-            "c66d2e3e88626ca17fffe3cc367834b23af243c65551d14f338006641c088ba1\tBWBxkDpK4tymBab7NMMZfoXLnoiLYJ3X3d\t5508349078\t55.083491",
-            "c66d2e3e88626ca17fffe3cc367834b23af243c65551d14f338006641c088ba1\tBo1gcbg4Qrt7rYYNCHFoJgbzb9VZgYkD7Q\t5508346142\t55.083461",
-            "c66f1754bd2c584782b6f69ef9936cf801c00fa021aef54842dbdd88b0011ee6\tBoUZp56JQ64PTfwV9kF29aBDsNcPRvPMMU\t7558327029\t75.583270",
-            "c685ebe3ab6dc76eeb442c6071bdec59e3651dd3eb06143a7ae9b6692d942415\tBqyXqqY3QGjrzsKbJkUrcZMjq24KiP86dy\t6799986851\t67.999869",
-            "c697c7ba89f9cb4cf319c1a3b004617d054889b5f25216c8dbeee05780137e76\tBdUbcNF3C6N5VCW9TroSW8vdAVHceD2U8X\t8842991261\t88.429913",
-            "c69cb9c9bde19a24419e6159f5224104b1bfd6296113bc482d1e89e0949e5e0e\tBdq8uw8tVG5W7b5SRW38UKfiUxPHcqexpp\t9351244100\t93.512441",
-            "c69cb9c9bde19a24419e6159f5224104b1bfd6296113bc482d1e89e0949e5e0e\tBoYwSSrQFfGX7WL4uMLJdWc4kK8GsTUbiw\t9351247102\t93.512471",
-            "c706b3f34a75fd22fe96766cda0b495cb01efd6959f1fae0dc97d8b5f41a643f\tBU7uJJe4ewC9SNvyAQgf6nhJdMtBf7j9sg\t594441907\t5.944419",
-            "c715cd67b3a88028eb93359c083845d2b68f70fcdb0c0f9e07495ea2098a6099\tBZ9GaKrE4T9CyhuXSGSdKpSF71rZca67Jr\t5508347850\t55.083478",
-            "c7214ace208c514c27ee8ea5cdf569d4c533721ba877ca1c3d7c040e235b7ae3\tBTuKSMYHobq7WjA7ncyhU9HvC5dEX4Xtdn\t1364046866\t13.640469",
-            "c7285608cd227489e674d9770f0b04da3afb508ff7b638a9131d9c8427ccf351\tBm2AnEZvVj7agNPHdCRYdVwh8jUGKwdB9U\t1713958014\t17.139580",
-            "c72e7e734c5303b32911ecb1c716430d309d6a710054d687cf3fbefdb26ccfe9\tBkT8qHzxyZ3pYBYz8RigivDUtdG76KTuU4\t2151720057\t21.517201",
-            "c7764b78aa4fbb5cbd830c0585fda5a17a1cefdc074c3fd4ecb90bd6700e6758\tBTyAjPnLKU3348cXrmbRKC1B3rfoptqYQ9\t6249993993\t62.499940",
-            "c7b3104e0c62363dd4e02a4b61fd168c792ccf2390b4304624b4b45853987608\tBr1o6ZkKoxFL4ExaFcNgb6EYzVJ2Qdgu3m\t9827690069\t98.276901",
-            "c7c4b635b73a433e474ace6854be9f796e1329db90d07cd7a3b528b98373ba72\tBYQr1kZJw8ucmJBWseph6gQDdihq8Bi3Xk\t4796305710\t47.963057",
-            "c8043b4454b9f3c7a2865e5e22ecccf03657643f211d51c71b2492e8ac0515b2\tBewpddNLyZHqcRsMdM7grTomhdwZq8Qqv8\t999994954\t9.999950",
-            "c81d7525e70304741e130fb6e88cf2c76a20c14221dc3bdb236fabf624d8339c\tBTzH7MSL52jKi2i1ngXRQj6eKxnnjed25o\t6249995367\t62.499954",
-            "c81d7525e70304741e130fb6e88cf2c76a20c14221dc3bdb236fabf624d8339c\tBWK4UzDbuftxXDeaep8dNDPfnwd2Ye7esr\t6249998369\t62.499984",
-            "c8303baa9b385300a253d4b1b484f163c5749ad0a8ad9df2b75680af8e646a44\tBkUsK69pDWHMiCigzPcg3vvz78SECJf3nJ\t7781016845\t77.810168",
-            "c85342e4d5a4d0c0f9fd068c9c20bbe5651e5d7693b7628dd253c931873351d6\tBoDUnmdauMmfFwXFZYs6pTh1viEsNz3xMs\t6864564631\t68.645646",
-            "c85fe89a071e20478aac76c7428b079ab43f787cd1cf16622aee649353c464a1\tBr4ZSCAePr4V92EZpUFoLnLw7xDPGoXU7j\t474419386\t4.744194",
-            "c8d90087453b2ed186814ebcc3874f8b1854f8b46b9d0df97940ae6d3a3702e2\tBbupeBL5bstBcTFEmdzofvVBoba2uzRjCJ\t882549872\t8.825499",
-            "c8e45f50681f0b947af0b3270633a2d10dbcbf950b30bf92b397fd065514f56c\tBTvKpH4Riiq4DmxbQ3J4wSYM1BSXnSkE23\t6289747175\t62.897472",
-            "c916b2da69046a25c1df85633408cc8ab3a88d9c089c81bd383971d80b1ab629\tBoJeXqY9vLnkyDnzGcAAFCc7TrBmdWZVBX\t5837496949\t58.374969",
-            "c9255d1df9837cc1c11eac5c2301671ef5cb0adaadf7be18b6f4ac65a0df8d21\tBhJYnbX1LitCYG8tTu2kJ29n1fPvTcr93H\t3280400342\t32.804003",
-            "c932145881cfd85d9b851eacc1c3219429e8792f809ade80495d6b6acf70b11e\tBhwQrn9YRt7by2yhnFLtREBnBrbCRd7ubU\t594441586\t5.944416",
-            "c9433b0fb226a2f90af35d74a2a10cc150882791a41a43abd69a626340e6eaed\tBqwpwDezEzjrtC5qLcrqubcGrJvgMUWhvy\t6299051355\t62.990514",
-            "c96f31a66ce1881f6b336f71a531fa0bcfca1ce28fe68f7729782622ba0fbff2\tBhdZd61t1w9DG2ascmrH9uW6jKtU2pRfXH\t622697408\t6.226974",
-            "c98412b5beb2125b644b24823bc41059a45dd8aac1d6961a34d8dd94fcec93d5\tBXTwvAhoVPreZqMVcBmmhTwpxBZyHi1Q2M\t6040059993\t60.400600",
-            "c9949554c7d13c07691ec72a15bb8e6b0ac5aa14253d0b861c2487b08f827ff3\tBd5NpefRp8tzUxCrcFXy4u7zSVm7Hu6UBE\t6027135951\t60.271360",
-            "c995c796833b470b8d691d0d64679a9aa7faf9e06af706634484114a73a841ac\tBYNtw93rVYPTtY2bLasNLdvQ32svVzsos2\t999989298\t9.999893",
-            "c9bfb94dba1c119dc7bee5fed5bddfd1d21a8365da7c5186c8d896fa7cfbff75\tBb62qmLooiYY2Zbg3Tpi7QnVLoiSCAnVCb\t5012485564\t50.124856",
-            "c9d1d112b0f52cf2832e138700fc6c9185d1ad0577e1cc8a7dadc919da2a75cf\tBp25coXh3tiLc7RfS21iMAP2yRdcf7UpyG\t139077876\t1.390779",
-            "c9dd1144386a9a3640883b2a9a5e9ee8186ef55b560193112f8a8491276a813d\tBXD5tK3C1UZrnSctxW7XTwt745QjcXGbzU\t7781022388\t77.810224",
-            "c9dfd8e820c5c352ced7b835195ed717a90c875f5bfd6514469032bca83cd7bf\tBZCMp6nC54uJmoKwEvv29rwYKaEmPHXBcL\t749023277\t7.490233",
-            "c9dfd8e820c5c352ced7b835195ed717a90c875f5bfd6514469032bca83cd7bf\tBZc7rhXu58cakooJKXX25ibU1ddNFE8s1g\t749023277\t7.490233",
-            "c9dfd8e820c5c352ced7b835195ed717a90c875f5bfd6514469032bca83cd7bf\tBZutLHd7U74zTAvKTJaiqGSAt2xL7vYePL\t749023277\t7.490233",
-            "c9dfd8e820c5c352ced7b835195ed717a90c875f5bfd6514469032bca83cd7bf\tBePNoCir9bnSEqE4pVp9uq9s45Jkp9ecoQ\t749023277\t7.490233",
-            "c9dfd8e820c5c352ced7b835195ed717a90c875f5bfd6514469032bca83cd7bf\tBfUdetR22Uy8KF7XiKFfYyUUWEY84HxUKp\t749023277\t7.490233",
-            "c9dfd8e820c5c352ced7b835195ed717a90c875f5bfd6514469032bca83cd7bf\tBimUtSQ9YdNwNPmw9uLrwUeynAWa9dHiWm\t749023277\t7.490233",
-            "c9dfd8e820c5c352ced7b835195ed717a90c875f5bfd6514469032bca83cd7bf\tBkYvWJ9Stq8bT7KbPm9PoGR54UVqis8SAP\t749023277\t7.490233",
-            "c9dfd8e820c5c352ced7b835195ed717a90c875f5bfd6514469032bca83cd7bf\tBmP15TW7Bv2UcoCQdUevJQ9BQ4mG7Dccx3\t749023277\t7.490233",
-            "c9dfd8e820c5c352ced7b835195ed717a90c875f5bfd6514469032bca83cd7bf\tBpx63bdQT38RX96P7QvCxVZvbXqfMkET19\t679018265\t6.790183",
-            "c9dfd8e820c5c352ced7b835195ed717a90c875f5bfd6514469032bca83cd7bf\tBqZ75eWPhVwZuiLz6KgMfz6qi7MjP9iTYJ\t1000000000\t10.000000",
-            "c9f5c9e9e4bb09ceb63284d873f6a967b083f5824ee0ace19029af80c7cd8a3b\tBekp8i9voeocuoaAjC1PCpJWDZAfNMWsBj\t575923846\t5.759238",
-            "ca102dd796c16607a235257a3f000e37e0a2e345a151f8031f8e5f13834d816e\tBUKocFux3EKGL7yosov9FYVFYXAxMcMxLe\t7645579592\t76.455796",
-            "ca15b2dd9aba7301350dbf9d505879d110b2d37543448ecb4916b8467b3da8d7\tBpBWEGJjF8wM9FnTE7Lh11GiSrnp4w9CbG\t750292380\t7.502924",
-            "ca459c313ca6e419f3a3a7c72c30e47dcd40a7e8aadf787d06290012531e0abf\tBXdHqYP213L9hNnhrm4AboFYc5zQPgKnzQ\t1936947023\t19.369470",
-            "ca5773d3a75c13d6e9fc0e4bda5278084669a8820e09939a20d4f7b50961c5ee\tBoETpsGFgS4pXVkAXLqFuXuQBPM1tELKt3\t6299050526\t62.990505",
-            "ca5ff004f8f5c116235c65f4a5934800c08b229bb56a9e64db05c3d6f68f2294\tBg43A9WbnYspfn2xuuHZouHMVriu8nBQ5f\t918471029\t9.184710",
-            "ca775a2d49707f375713ff44c2b448a5ee441711f0aa8a16e8bd4159bc68c2b5\tBdmzjxWJ5zXmtCx4Ujq4sBqFhEN4mwYP14\t1288877771\t12.888778",
-            "ca8bc18af05076ce5b931e8e75f1f00107d861c9f98ad5adbbc660f57b1e1dfd\tBgmnt2toxh6tXJUMENTtjiCZrGmewjRe7G\t149375299\t1.493753",
-            "ca9e31a6bfe695c7e925af7c2a05c21a3fcbda16756d10991bb10a23abc6a993\tBWtFJU6kU4tebyf1sCCTUu5KEQwyJbGwji\t764556254\t7.645563",
-            "cab253f18185214f1ce73f5dd7fce582e8d30ba8021d19c08b3a02acce14f9b4\tBqQ22Kn5tgLVGCkjVDoghKnVtmHgLNb3Ze\t6588240959\t65.882410",
-            "cac8dac45478478a150079243b2a9b729187ed44b2e3f9551c840d22a89c0895\tBWAN5FAMoQ5f3LajehsAsFMXmmYbZ5bNBY\t976769501\t9.767695",
-            "cace22b7bf5a4b94244fc622155b2d47680efa7229830c14a52bd08391d492db\tBTwQMidj3BmP16PSFzp5CDZaq7svStWN72\t733321573\t7.333216",
-            "cae0ca81a5c8933c3160e8e6b70b5057a534a7a0e5a548267c5badf465166a27\tBm3bcmtAMDWvBRphppmKvQZNq9i1X7ApoM\t7147062480\t71.470625",
-            "cae5b4a6801a8b71bb6ad0316f1868caa53f641fcdfdf8673b1287397b807f14\tBpWr8S81fU4LjYB9Lw7NqjCFFPxFinuEYQ\t6082730417\t60.827304",
-            "cb343cb7c4c8054f0a651b747580aafeddf77f1782ba7a62a0d9bb2ac4d9ae75\tBkWLmN5XG5tgfyEMj8WXNxM41ssvBm9MQB\t8749983511\t87.499835",
-            "cb3891a2cda91308958dcbeccd61df13961273bd9d4498591076cdbdf86ab3df\tBki3eGgqTsUmf9y5ShdCaex1FQw9Tfjiqv\t7499991691\t74.999917",
-            "cb3dffde683a87126f08ef9630a76cd098583571e8950c9305b3f142d8064b6a\tBgF54DtLifyFymA17Xek8DKUPXTspGv6hC\t6864567800\t68.645678",
-            "cb4c55d0bcd064b746a63adccf6a8a178d55fca31bb82d6df1ccb6f5fabfdffc\tBU9GgK7VuQGBHG2tGnGFGSXNoHjVnoFv15\t764547575\t7.645476",
-            "cb6e87d808341b48e9b60631774c4d1dfe25515859db4cc85b780eacd806c6ce\tBhzqk3JFoeN6SmiWiPXkmf4C33xqY6BX5x\t4056095859\t40.560959",
-            "cb9668df72ecbdfbaeba1bf91950809c4e066f32080002241bb05c6ac5c995e2\tBcehio11GioaXcGEcLNLFx1p7GJXMJb9gJ\t999995316\t9.999953",
-            "cbb7a9b28c1b3b7f95566c5cb0adc94ceb48fb90f7761643a7dd25cb817866f6\tBaCDeBMzn9ffsiQ9e4YkVqUmXeyWiyJq1W\t5066380874\t50.663809",
-            "cbe8f94de24e034b3535e41748103be7281eefe22e0da1165a2f6c7746d1ecee\tBcLfhAPvUXy8yjxMiFK6AP4gfjrq5s1KT7\t799999999\t8.000000",
-            "cbe9434967da60626251b5e32900e3544ad1d9bc7e3ef57611d0afb9bf09c288\tBVVRSfpdkaTxVZ8QBYqp1sPpjTguUyq2Go\t7652675883\t76.526759",
-            "cc09d6544c34682a48678873a227c8b655de532ad672096c6e5dca39b9f83aa6\tBY5e1fx7UFPRZr9fZyn9P3CRVJwCtaFqMn\t999986426\t9.999864",
-            "cc190190f0e742c65cf6344fbef592849354e8de2fb664327d4119a0239adaf6\tBoJqzkR29c9c5FDqatw5bbYvqJtweddHcw\t6638880935\t66.388809",
-            "cc1a812e700b04451da88f16b3f7cf7232b7f028ef626dd59428e7d3f131196a\tBZPJRKnQSWCZiwNVfWvyCrqLect3F4s6tt\t7781024331\t77.810243",
-            "cc1c50fb66febd54c8a309243c944ba8666b89985d73b1a2cb0dac5ea69392fb\tBbxHpRwBg2aRChTsUobz6nDgB8KotzQxA8\t842296652\t8.422967",
-            "cc7c7e723b8742e01736deb2330a10e03087161bbf626b7c32bbc1692122f876\tBjg2mJMwMGBNzEGQ2yaqsMXo7gCFb5BPGG\t6295105935\t62.951059",
-            "cc90609090e39af73892473c37c5196e3a2114e6783c82ca3a20f251b04215bf\tBkH1AKq7LyKL1FyrxHBmrzPDab1HSddhue\t842296663\t8.422967",
-            "cd10f60701a07b987baf8c9133d3b57d144f7b66436088b2601ebd8657018f67\tBeMp7D1SKvEURBtEtzmzjYNU3QHZt67rLj\t999977923\t9.999779",
-            "cd11a2b648da593b761bcd3c763379ac34cc1211b5db45bce9b4906c3c0ed939\tBaiAHLLR551x88rtW8rBY93PMo5eXwwHDr\t2300792731\t23.007927",
-            "cd24a88881c6eab675a6fe74bfcbf4d765c5e13bf0a620d72dc15aab2ff588d1\tBXfS2DCr1kyJUwcS8sUk3TndAJ1QQfaRX5\t1100394801\t11.003948",
-            "cd28de1b67c7253baa306511e025d594982c320190813e7e0d530d2904ed51ec\tBiq7WFqerJeZ9kE6tJaYexyddcNTQoJt7e\t5607808455\t56.078085",
-            "cd28de1b67c7253baa306511e025d594982c320190813e7e0d530d2904ed51ec\tBovcg3U2g8P5pQTL8KHY8UeCtbN5UhiKYq\t5607811446\t56.078114",
-            "cd55eb9f334f16ab66036a1ef67d25e1ed81afdf004bfa704c349f0d3733355a\tBruGweC1Z6uQ8yddK3rTt5L31MaTZwhe8h\t6299051353\t62.990514",
-            "cd8b2d332d015b10fd0f42964badd470643913948ca6df5488d7bade58aa11a0\tBqjrRR4wEM6iiP36wKqbDoL8fB7Y9VWbML\t1566658370\t15.666584",
-            "cd9df0406ba5613d4b3d83dff1fbf45852558ad17a5f670d776170e79ff511b0\tBdaRqztp8UAHJfTw8wvam6WWbm8Cb5kAha\t999995122\t9.999951",
-            "ce01f72a2f753ba22ec0c8478d3f791efe0288452aea1bcf146d6018ab486e73\tBnCjHuxRme1BoSYZFHsiHg8UAXAqWTgS12\t9827693714\t98.276937",
-            "ce1485b87fa584196bf661022fe7d20c3e4e7cb4e2cc5edfc3bc55aa81ef0059\tBUw8mkUST88ADkNhGsQjNUJ7Lb7Y1p3eV4\t6289738631\t62.897386",
-            "ce42d851863c0106da0cafd28dfc67484f955b9c21b6a2de29697ec1fe656b51\tBd7UpaLDFGyaxfdpfpjDJVQHnScB1P1ba1\t3280400330\t32.804003",
-            "ce6da7b49c88cf429143f478df48e0317208cde9177d9f03ba49afae9e83ec25\tBojqUCn7n8D2HvcMKm7nRcNhkmUE8ZN9YR\t474419374\t4.744194",
-            "ceb0645b7d010e40a52f51a5760170b68e26c408ffb280b4dfefe402308f6013\tBVF6zadZNe4PzumNKUTytb4iB9txfLpvEJ\t9432762241\t94.327622",
-            "ceb0843cb32496b2882b6f57bd9bd6c06a80508c302f74f14401acb4e31f581b\tBfKtnvQAG8zHXRWpRwmrrQeDK5JKDfJfhC\t2058644972\t20.586450",
-            "cee219afafde584f7563632dc4bb9469f7509b27de7e3f8ad372f5152ba2b8ef\tBWiv2won5PxaZDTVFgVxcNioMVVbvTyHZ9\t9749998708\t97.499987",
-            "cee219afafde584f7563632dc4bb9469f7509b27de7e3f8ad372f5152ba2b8ef\tBgjPA9kigiZSTe5rzJx6DGG58N1oD2nmqv\t9749995728\t97.499957",
-            "cf2389e19825c9723a157096cf2022aeca305ad2e00650bdc945b74478f78464\tBWYiEoCUfmfguT9gDgTUffDQGBcNx9D9DB\t5977022355\t59.770224",
-            "cf35e5e1d34e8a9737e3bec609ced9f1d4ddf25f0cd38c09c9b6675397d41ac6\tBYSjJ9JGEbiKT1kAFaXqfsCcPD3Dtkib6Q\t1000000000\t10.000000",
-            "cf35e5e1d34e8a9737e3bec609ced9f1d4ddf25f0cd38c09c9b6675397d41ac6\tBajrpNVJhgDs8XmHyhfoFRjdrsVB6MCtYE\t7104722222\t71.047222",
-            "cf35e5e1d34e8a9737e3bec609ced9f1d4ddf25f0cd38c09c9b6675397d41ac6\tBaoXaBXnxWkw9GhoYoqwHpnjDT6BgZZscX\t7104722222\t71.047222",
-            "cf35e5e1d34e8a9737e3bec609ced9f1d4ddf25f0cd38c09c9b6675397d41ac6\tBbDaeAVrCDnWHhmx2LefiEYLsB8HDUkcR4\t7104722222\t71.047222",
-            "cf35e5e1d34e8a9737e3bec609ced9f1d4ddf25f0cd38c09c9b6675397d41ac6\tBeKfXmkyrAYRjG8SaBYEwrfQS2oKCuVon2\t7104722222\t71.047222",
-            "cf35e5e1d34e8a9737e3bec609ced9f1d4ddf25f0cd38c09c9b6675397d41ac6\tBewwN2FcxiHYCszcde1eMHzrxriwYHEBeg\t7034717236\t70.347172",
-            "cf35e5e1d34e8a9737e3bec609ced9f1d4ddf25f0cd38c09c9b6675397d41ac6\tBiE44XR6WvKCcaWtZLXZzhsJQFmt38VgmX\t7104722222\t71.047222",
-            "cf35e5e1d34e8a9737e3bec609ced9f1d4ddf25f0cd38c09c9b6675397d41ac6\tBofaxDJKfuBqajzEdGb2JESDrLscu62hQj\t7104722222\t71.047222",
-            "cf35e5e1d34e8a9737e3bec609ced9f1d4ddf25f0cd38c09c9b6675397d41ac6\tBqkaXsSoo69v7kSErmBWmkMxU9D4oApE3z\t7104722221\t71.047222",
-            "cf370a85b5e0e4db970058523048c70462ecc366496dc6b7edf9d09ac191fd0a\tBduVr2q9o92FZwm1kpZ9N4GPvx2WQAvcSz\t6100237507\t61.002375",
-            "cf370a85b5e0e4db970058523048c70462ecc366496dc6b7edf9d09ac191fd0a\tBnGJ2V8scxtuoRCheQUWrCBXnZrzSijTvY\t6100234505\t61.002345",
-            "cfadb8d9c401103010fe09ec0b6be2d83f4cb1abebc186c2b9ee52ea61b8c2e5\tBUdpqDa2n3woRVZi3Qn7UWQ8RodKpv1mGC\t5607807230\t56.078072",
-            "cfadb8d9c401103010fe09ec0b6be2d83f4cb1abebc186c2b9ee52ea61b8c2e5\tBkkSAZtA142tEwZTEFB6uxVPiQ1LxdiQ2x\t5607810221\t56.078102",
-            "cfc68ca476d8f822adac05acfe57105329d2bb1e9e5beb2c050066a6e494c981\tBasE7DSqKsEzhHEzTYNTwpp1xwXUXGbhte\t5837494631\t58.374946",
-            "cfd2c3c9a84966675bbd8c9e5230d32ed91aa8503ec494b7c9a8157549086129\tBcDptEQ4T62fZb9Y1A12JrtFajSvnaDyVa\t523089554\t5.230896",
-            "cfd2c3c9a84966675bbd8c9e5230d32ed91aa8503ec494b7c9a8157549086129\tBfq6amnFC1couMDKzyS4BTsrMnKNDZmavJ\t523089555\t5.230896",
-            "cfd2c3c9a84966675bbd8c9e5230d32ed91aa8503ec494b7c9a8157549086129\tBjWQVsddELEB7bQ7rLG17tmd4BqRvvKNzM\t523089555\t5.230896",
-            "cfd2c3c9a84966675bbd8c9e5230d32ed91aa8503ec494b7c9a8157549086129\tBm1UuipF9L4pSdzzcUQrev4E2HRBFqXGHs\t523089555\t5.230896",
-            "cfd2c3c9a84966675bbd8c9e5230d32ed91aa8503ec494b7c9a8157549086129\tBmpVo3TPZhe28useEwYS2efrZpFWjLPb36\t1000000000\t10.000000",
-            "cfd2c3c9a84966675bbd8c9e5230d32ed91aa8503ec494b7c9a8157549086129\tBmrnZXCtZC3DCTbweZpmjjGiJ4BCMPjemR\t523089554\t5.230896",
-            "cfd2c3c9a84966675bbd8c9e5230d32ed91aa8503ec494b7c9a8157549086129\tBnJ31wJyH4rFQW9tHWAeUrGr394gwR3zyV\t523089555\t5.230896",
-            "cfd2c3c9a84966675bbd8c9e5230d32ed91aa8503ec494b7c9a8157549086129\tBoDsG6WwH8uNE7oyMUf7PhQtvbKm1Vw4SM\t453085303\t4.530853",
-            "cfd2c3c9a84966675bbd8c9e5230d32ed91aa8503ec494b7c9a8157549086129\tBpAYkHXNXx7h596W1md4JFkLmXMiopbG6W\t523089555\t5.230896",
-            "cfd2c3c9a84966675bbd8c9e5230d32ed91aa8503ec494b7c9a8157549086129\tBq2f1sWMxSp5mKutwVLQBPZPAmPN5mvJ7s\t523089554\t5.230896",
-            "cfe8f8c09a6529a7755a19ef576a823dfeeb8bcacdb90d8fbeb26eabd16d5284\tBaaL8UHtyxYzwNxK8yQxMZS3PqVroEPmgv\t2300792408\t23.007924",
-            "cffaf9d893646cc8752380bc750b7feae8fa3a84bdc1652d753e7c47d5ae1372\tBpdT5CWtULhjrMjJKemq3pXzaE5P37UTNS\t6040062984\t60.400630",
-            "d027cf1010ddb5e9a79d0769fd7e2d3ce2f9c784bd2117152a8bb5eff0b8d97e\tBoDmZBpHsTnw6v62Cd5gMQAQYaDXRA8Ltv\t692701870\t6.927019",
-            "d05dbf0eb6d69a89103eada075dba618695becb408664f2fabfee9d9fb4f6385\tBXvMM5g5ZntKhqym1Qf1BzRK6pPM74jFyX\t7781020508\t77.810205",
-            "d065c1846764c91d057bea23fec240f2954947201564691c26d68a8a9de1f242\tBbx1tVhNsaMzoKwn3gE56G4cZLGZQMfMW8\t762213772\t7.622138",
-            "d07e64d7c3573740e0958310046c0db75c709c50927af8cadc1b6c480c8fb910\tBmr8YXx7SKbxxpbcfy9oVtT1Q9Z5qcKuGv\t5455541670\t54.555417",
-            "d0a634adfbb206e587ef99b22a9cc0d94a88140efce808412de9d7d0bfa97f01\tBdRbCTvgbnHAkQzxdAzF5ZnG3usBNyFb4A\t6829553466\t68.295535",
-            "d0c9b95a95cb1dfbc9d8efc0aec0e6f16cd5497f62b161ef068c79f3c87fa79b\tBWGPo9qTEniuqRQETYrpf93nnzuA43PTC8\t7134335176\t71.343352",
-            "d114b22a735f5f2b7e44552bc1e55ccab5e425e4937b9a7d3efdcde7ef217fb5\tBXkznBmCbJ8S7Jk9Guyj8uqqoXWDyRifEM\t432920118\t4.329201",
-            "d12c1ce2d180e56f96963bd52e0cde00cab5d9cee1b8cbd7976753760760f022\tBacbicUC2jW1KtoA3RMfppmfFgbQZbFF2r\t7605901590\t76.059016",
-            "d12c1ce2d180e56f96963bd52e0cde00cab5d9cee1b8cbd7976753760760f022\tBjm4HdaaNz4sNvT5Jr9WEo6nUi6sbkJkU5\t7605904440\t76.059044",
-            "d1641ac787406f1d2423c75565036f9ee025b9d3ac46036123d6fa7f2b3b3a8b\tBZb3rZ6vKS2RsdmbPQm1egSVdg2VZD6V6u\t749506740\t7.495067",
-            "d17f9941df0c112f8973bb85090c6edef745855bbb8dfa0742b90c8a1f68846f\tBarcPQ6iguQPAs7rH3Huo53aiL4hosZFBo\t14294134535\t142.941345",
-            "d1b6c358169d6b7195e2aaa75c4334e8d0658e4e8748d21ab3ae0ff05263fe40\tBjnmCqQgCkKJThUCiruMR491CBD2AwkzVe\t30414986981\t304.149870",
-            "d1bdaa4a168b7b7e6dce61554001d1123ae607256bc6cb9eda881222393ff9c8\tBZ8FiYqhhy8cdxumHMef3ffDwo7KCkc8aK\t599890336\t5.998903",
-            "d1e7b15207b25190e2c05535d0ac714efde4715a80ec4627942a562db49f7d2b\tBqFQ2SHPZhfMob7BpW9Lu3DgkdTLvqvxBJ\t918470673\t9.184707",
-            "d1fb7cd184afdde5b7f0df70d513d7e34735b74bcd7ca10cee8e99a9c01dde14\tBoAY9wYHw83jHAArbPGEyczCv3sWpcytie\t505918828\t5.059188",
-            "d20cc99154ac3b52f26eb097bd46ff3c5c24b53143b2deee5e5ee691cf624e70\tBUy3DFLCnVTQ7LyDHSq1kQ7BECrfFwi1fF\t5169789741\t51.697897",
-            "d22159da000364351cf496b4135d7514e20a15724795b706140ef1db2369c3c1\tBhB2WV7TphvtW5JYJwZuKtDiv4a4Ka8Sdu\t5169791712\t51.697917",
-            "d270c122055193131c6f7e0f9bdce48a4e2a1624f24e055a87891568a41e4e3d\tBYsZGfnNzDxfLRfBed8CrSTn2X31sXDDnb\t6100235882\t61.002359",
-            "d270c122055193131c6f7e0f9bdce48a4e2a1624f24e055a87891568a41e4e3d\tBrdM6wzG26TEPT5MZcNjdzsCfLnpzKy72j\t6100232880\t61.002329",
-            "d293543ba5281250114bd7fafff8096e1a843255782d564b8559f01dda6891e7\tBZzKouHwaQ2CxovR8bjthRWG7nyAkxhimz\t5508342159\t55.083422",
-            "d2a76d1d94e7a01d7fd011609dbc336e983f898d0cebe5f53b575c7cd973474c\tBpG38CkgyvWLCkUqMAXxdEMJLE7Lbqa1D6\t979192855\t9.791929",
-            "d2af6cc1dc37ecf7b520b77e1f6ae861d657544dad8b9ffc73228ec8444f4663\tBZ2zSjH3Zad6eH9LEDQMMeFZPhsWpq67uj\t939024839\t9.390248",
-            "d336a9893f0bfce5ffc2f931760297a2b802f615abe40cf60138e6e9b5b80cec\tBcPBwh3xnyuM6gQ2jjBKh9c2ogaaSDCHHL\t848466030\t8.484660",
-            "d34c60cb1e2b7eef7a9f46f1ec6d82b994f8869b29cb9b5f8563fdfd3934fd80\tBZfxFYrUFt4BsQEvayvujknMYfFtdf7hAk\t764550409\t7.645504",
-            "d3547e20f49bd3b548b5c72a96bcd25e9e9057c502f6936e695f69a33b3dd221\tBfXDbiZGGp4xW1Jmz9nQtvi9HUwCgZ4dvj\t5169788324\t51.697883",
-            "d3a339d641d4d00367cf5039f80b0a8b4ffa054091bc9a9e16dfa20c5daad2a5\tBXCAK9LwewVbDXrsge7qsvBFqtsFKJwQim\t7558328646\t75.583286",
-            "d45d7cd13ae80f0a83555cf9242beec3032cdd52affee13e88684c8477d97293\tBqUECWgB7SguPYaCzXkdRRoJG8MccJCaaD\t6249992301\t62.499923",
-            "d46e86327368628766c5698838e2732a46a9638ee69d814e3adac0a6c61869a7\tBqd3ZPnMLVkYRoM6dz3knA2YSVki14piw1\t3280400330\t32.804003",
-            "d47a542090ffa430f5ba66ee424af64bc4508c49ab382ea38800a228c200f285\tBYaLVZ8UYjbFganJ1xaHyd5Bp4JsVXCtrE\t533954804912\t5339.548049",
-            "d487a7ddaa5c4825d09cfa8ad632b9f85b05b6c5857934787230b337619a8e37\tBmrZ4TGdTyERVSsXUZzy62XpbVubUHQ4vm\t6083334218\t60.833342",
-            "d49b946a1f4571263f6517b221111cf14357eef6e16b51ce2147d377f6b86864\tBez55FGZydWA2GzMJjwBoCA6G3e2xFn3Bd\t999992444\t9.999924",
-            "d4afc6ff6ae5a98ba1c06276276a32ecfd6502537fee789e36896f67c27e0fea\tBfwNJfy7JLKjYLdLZ3sLz7kyoyT5yX4Tds\t632024376\t6.320244",
-            "d4c93dbde61afb808a12ed13002d710fad1b3ed41e59cd32c8865e38cce9d1c0\tBairNWLzZ6y29Dsou1x395pEQuQH32TP6J\t1566658383\t15.666584",
-            "d4f118d584fbc918ffe6c6ebc5a0e0988d97ab268417663387fa7dcadd256adb\tBg2pSFX3V8E21dJ8kBoDphhTpyiLCTbHhS\t70000000\t0.700000",
-            "d51b963b8e2dc9d0a9f9795c431eb24c29ed878c877a17d8b3cebbccc6c48405\tBdPDSRSt3e7VMNDJAYW5PHcrWAJGFuKTT6\t30423621998\t304.236220",
-            "d52ae64e1fff354cb2f15702430745bf1b015dc0b4873d3b76429625c81dc8f0\tBWpg3BR4yNbxYV8sjygkFZhW9cgVYVT3K6\t979198154\t9.791982",
-            "d52ae64e1fff354cb2f15702430745bf1b015dc0b4873d3b76429625c81dc8f0\tBa77ZrV4hWHuP2eyYRKdmnVR3ZfX1KobXN\t979198154\t9.791982",
-            "d52ae64e1fff354cb2f15702430745bf1b015dc0b4873d3b76429625c81dc8f0\tBd92iSkBWfjGbXybhTpTEf5PJ2nBRpiazi\t979198153\t9.791982",
-            "d52ae64e1fff354cb2f15702430745bf1b015dc0b4873d3b76429625c81dc8f0\tBdmr7an7YAL5BNUQjTfadtFKssmQyqSpht\t979198154\t9.791982",
-            "d52ae64e1fff354cb2f15702430745bf1b015dc0b4873d3b76429625c81dc8f0\tBinAXBxSsG3ghDf3EtXZQQVE3f1KBfK77r\t909193615\t9.091936",
-            "d52ae64e1fff354cb2f15702430745bf1b015dc0b4873d3b76429625c81dc8f0\tBnnMfWqwZsAqZzHEJ7q6oNimFtCGPDtsHE\t979198153\t9.791982",
-            "d52ae64e1fff354cb2f15702430745bf1b015dc0b4873d3b76429625c81dc8f0\tBpWowgkwBcUUxa663NjbV8HpFmHTHAKUnk\t1000000000\t10.000000",
-            "d52ae64e1fff354cb2f15702430745bf1b015dc0b4873d3b76429625c81dc8f0\tBqGrJQtxx9uYJUHYeMGoPALnFWpx5DmaxJ\t979198154\t9.791982",
-            "d52ae64e1fff354cb2f15702430745bf1b015dc0b4873d3b76429625c81dc8f0\tBrLa2rgz82jXUyqDEtGQFHvADJsmUYBnfu\t979198154\t9.791982",
-            "d52ae64e1fff354cb2f15702430745bf1b015dc0b4873d3b76429625c81dc8f0\tBrMipyXyHQPwSkWAd5dB8TnaXxXbxqzz5K\t979198153\t9.791982",
-            "d5a2345f13eb3494fdc7033ba50acd331b2ff6a33dea1a05371f300d6e0af06b\tBoE8uKKvVcvv5VBsnhr17RRiEf2yby4J9n\t1485407106\t14.854071",
-            "d5e654a6b0e902d89fdb6bd5ba76126f967908ee9e9ccb08c63e9f6eb0d65d9b\tBnU4x86AcLAiE1C6SQPgLazqsWFAaR3SSp\t9827693013\t98.276930",
-            "d5fbde014fac128635596a4627e8dd48537dd0e96658bdf698a525b8bf5fbb9c\tBjL2LHLXhDKk3tt8Py4yTDks6Nth7RrHRG\t694551996\t6.945520",
-            "d5fd084c3b1f01af74b00748a8dd84917d6df769d7d81005886bb086398c77f7\tBiPY4EvxnC72zAvLdsGQE2a3jDY1vdaDC6\t733321877\t7.333219",
-            "d615bee8f9f42d8ad15390243605396ea09a899b0a518e9f4bf91d9c34fef02f\tBjhYVEpqvqd4xmMQ6qHbbtbzexeG4bA879\t7134338570\t71.343386",
-            "d615bee8f9f42d8ad15390243605396ea09a899b0a518e9f4bf91d9c34fef02f\tBkuMvcbVvcPm3wi7gKdVKWrjnHGpGpLu9x\t7134341433\t71.343414",
-            "d63f75cb790ab32131f0f975fe88c1be7004ed059b4aee589a006b2793d58d95\tBU1w2wCmL1cvJHUMyXKbuSvuKCFT8dNuea\t594441851\t5.944419",
-            "d6720d93936347aedc7600e64003099b225c5e551f5d52ef028b76b8a924a51c\tBX8csLhvjAyiZCop6XxWJDcnwYSU8S6qQf\t999994954\t9.999950",
-            "d684361c9fad34312035a5faaf25f112cdce0d4357d4460d530befd426d4b71e\tBXTtq5F5kHKrKvUKCBp4k3TqxJLQe69jMv\t14309444129\t143.094441",
-            "d684361c9fad34312035a5faaf25f112cdce0d4357d4460d530befd426d4b71e\tBaFFnSLsMEdY2xtg8kgGJUNH27XBo55bce\t14239439594\t142.394396",
-            "d684361c9fad34312035a5faaf25f112cdce0d4357d4460d530befd426d4b71e\tBb9GAjFYDroZ5oep1sVDSJ9ayb1WfzzWKN\t1000000000\t10.000000",
-            "d684361c9fad34312035a5faaf25f112cdce0d4357d4460d530befd426d4b71e\tBbdTsaYQJ4Br5FMeZDQ9vBWV7Y8ow3SjcH\t14309444128\t143.094441",
-            "d684361c9fad34312035a5faaf25f112cdce0d4357d4460d530befd426d4b71e\tBeBPPGYExbapHT4AEKqUuXgzsufp8QGnH5\t14309444129\t143.094441",
-            "d684361c9fad34312035a5faaf25f112cdce0d4357d4460d530befd426d4b71e\tBeJpfAT142VR85MopZSN4ShCWtD9FwFTff\t14309444129\t143.094441",
-            "d684361c9fad34312035a5faaf25f112cdce0d4357d4460d530befd426d4b71e\tBeviuTTCi1UuwmS6a2Mqmkkf6kJwpMCvou\t14309444129\t143.094441",
-            "d684361c9fad34312035a5faaf25f112cdce0d4357d4460d530befd426d4b71e\tBfr5rMpz2nRg6RodPyiWKY73amT4A4eyaD\t14309444129\t143.094441",
-            "d684361c9fad34312035a5faaf25f112cdce0d4357d4460d530befd426d4b71e\tBinF5VGFGrs7vYfJmyp9dknfW7yLKbSo5a\t14309444129\t143.094441",
-            "d684361c9fad34312035a5faaf25f112cdce0d4357d4460d530befd426d4b71e\tBmhP73EdshPrAynG7N5hFw9rtLbBxB78r2\t14309444129\t143.094441",
-            "d6b436f8840200756a96f558ab4c58803d255b8cc4b67bb300e100e9a4ee3d15\tBWryhVZKi9J19w74CumCayvrNW7egDDaN7\t7134339282\t71.343393",
-            "d6b436f8840200756a96f558ab4c58803d255b8cc4b67bb300e100e9a4ee3d15\tBqr1jAt9WvjEbYYBzCFnWDrDZw9cBC5y8M\t7134342531\t71.343425",
-            "d6b44ac6fc99fd025604869031107ae59826e556f828d80a2edae15219f545c6\tBkshCLKrKndD17drnkjuhzzyA2KuffhnhZ\t5977030048\t59.770300",
-            "d6b85cb008ceb6287fb499b08db412c3a87ba65f2a0c6ba028b89f669d623bce\tBWzhsaf2Mt4feuQcagHjzyE6D9C6hYGHzt\t5607805199\t56.078052",
-            "d6bab3c93310d3ac93c6b47e1eaee1eac5cc187ad8726faafd74a0a848485f90\tBfqFprz7ZzJfnESJxNTn11YgKfv27KzRNs\t7558323791\t75.583238",
-            "d6ccdb588a7e63b222067c7f7b65265eab18636522e359d05ba542cb6cd599e8\tBgGQZ3gsAjgu3HDYFKcsPEa7WrQajaCvTT\t577801071\t5.778011",
-            "d6f7f7d9bcd63dede97ef5abc1693d23d475b5e5e7a97ef8dad49bba78911786\tBZqrCdFESduG8iDpk853CpN2DQcKzZgv53\t6040063655\t60.400637",
-            "d6f7f7d9bcd63dede97ef5abc1693d23d475b5e5e7a97ef8dad49bba78911786\tBcL8gevFhcfADmecaKGLVw1ig2xVyMogZx\t6040066646\t60.400666",
-            "d6f9e48898d3bf035bbfd4e2ddc3b98d7fcf7751332df00d4dd19f00877a8517\tBpisZgkt6hU6fLaa7jSsg1kwDFC7qsDSbG\t6083336478\t60.833365",
-            "d703d0661e46e868f6cacdab6c3ee4fa5c86a3173c04229fa8ac63a0179dada2\tBXH1ZhK5Jyi9rcQzJP9KhQtBqvomcTBMKN\t658837483\t6.588375",
-            "d722bb9671cb6a857d818d60ea3cc2b2a505f89b48357c50ee3f0b74ef3e8c66\tBa8eWhJAGRuK1UPzqnBpR2qxF88yjKhsXH\t1100394789\t11.003948",
-            "d72b77d884eaf9c1a3e6a431c653e06b00e44e0515f06c5f7036ba79810930a4\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "d72d156ece12e9d513fea48b453c2669b7cf0c7bb2796e62b0e06a825d842f58\tBbLBrr3nevriVCWarkWM4ffkzBWajqezVE\t512036158\t5.120362",
-            "d73a45149b8724f96c58aea294920b55b80b01caa9c39db434779e06fdbe623d\tBUxNQ5hZP82oVeg4xqCQESyw4wTVnqXsJP\t5066381678\t50.663817",
-            "d752d6885a50da65b2721724c1d3a34ca4ae0910a53b68434eae948aea38e587\tBYCkLqNFivCQAUeXUHJgJ6F5VJ3B3TvSDk\t7134340887\t71.343409",
-            "d752d6885a50da65b2721724c1d3a34ca4ae0910a53b68434eae948aea38e587\tBcbuKhxaVbbzexVSisqNwHgBuVKKLBV8ok\t7134343750\t71.343437",
-            "d75755811f302bc7d2a584200fa1f31165ba3ad2c7dd6b6fd562c70bd53b7ad7\tBa8dyzcVRtK5jRd51whJHtXt8A4YZsEuPz\t563576766\t5.635768",
-            "d769b3acdcbf181461847394e980e92064529b2d07de436bedf0b29b63b1f4c9\tBf3RDWvWvfKEFT5ypH8BnpK3wYVzfCdENY\t6137487240\t61.374872",
-            "d788faaf6579e7a532b63a6d24483b9add2fe74c7dcd89ae41d1ffbd76300a24\tBUgLkERMMNrrWXWyNDHy7v3rUY4PF7cASM\t1488237503\t14.882375",
-            "d788faaf6579e7a532b63a6d24483b9add2fe74c7dcd89ae41d1ffbd76300a24\tBUnQAcWZ1ZZZu9jgrC316nxWCETxy3EMUi\t1488237504\t14.882375",
-            "d788faaf6579e7a532b63a6d24483b9add2fe74c7dcd89ae41d1ffbd76300a24\tBW3iQs2VM77o6VCMwRVNcHeQumYbEPnKTP\t1488237504\t14.882375",
-            "d788faaf6579e7a532b63a6d24483b9add2fe74c7dcd89ae41d1ffbd76300a24\tBXQ8eRo4DUv88PskQ57svgs5QqmWZ4UnCj\t1488237504\t14.882375",
-            "d788faaf6579e7a532b63a6d24483b9add2fe74c7dcd89ae41d1ffbd76300a24\tBhY39fZonQS4WR28Vw2fFPjQa9PWh94NJr\t1000000000\t10.000000",
-            "d788faaf6579e7a532b63a6d24483b9add2fe74c7dcd89ae41d1ffbd76300a24\tBjPKDJzpzqmsTZigtdQERwDnev23Y9Yyk9\t1488237504\t14.882375",
-            "d788faaf6579e7a532b63a6d24483b9add2fe74c7dcd89ae41d1ffbd76300a24\tBkJ4san3hmPKfutteFd5Yi8ifq8LqhiHvG\t1488237504\t14.882375",
-            "d788faaf6579e7a532b63a6d24483b9add2fe74c7dcd89ae41d1ffbd76300a24\tBokxjNeL2tVNU1KrdAEwkhZTkkC4qCKRr3\t1418233245\t14.182332",
-            "d788faaf6579e7a532b63a6d24483b9add2fe74c7dcd89ae41d1ffbd76300a24\tBpfBNmDizGD6vsMN785aehiBU65d3nSofg\t1488237504\t14.882375",
-            "d788faaf6579e7a532b63a6d24483b9add2fe74c7dcd89ae41d1ffbd76300a24\tBqQtmCHKnEUjqBmijHVGyRtAgU6btDfGMV\t1488237504\t14.882375",
-            "d793f87551d2398c3b3778aada1bc74ea9929832d017f3d104159ee9d1a69648\tBVTp2YU52VZojwanERksv8G6EA73C5Bts6\t5401782546\t54.017825",
-            "d7b0fc2bf4ebf52fdde923558a9da833e5b6c171fef080cc5191cfddb318e946\tBejLG3w7acs1R3mUt9UtjfUm5V1G1f451z\t1383773141\t13.837731",
-            "d7c3fd13805ae5abe4da28d4b856f887ec7bf6230f3a8b7382fc9e906b16830a\tBo89AKwdAyXksrQ73ygwTCtRof9nVr7BFR\t999997981\t9.999980",
-            "d7c85d71cde43272fc4a44e324ed4ee01b861155fb26653b5b8ade55107b59b2\tBkPe3vjdwVfEBynApP22jqjXPuzwQg2m6t\t1288880232\t12.888802",
-            "d7da6f35657828710c325d3698f3511407e7165984378c70a99055c2f2b2e123\tBWHoQKhghNq2wDvaixb1uSDMhFySbVGtBR\t10803578882\t108.035789",
-            "d7da6f35657828710c325d3698f3511407e7165984378c70a99055c2f2b2e123\tBiMchEvqgQhyvKhV8FbSicbZVp8Zm1FBvp\t10803575891\t108.035759",
-            "d81ec430690af5c6b80d77fca4fa1c3bcd4ce1cd35da6892449bc25e63ba896a\tBdkkdqre5Rhx8nu7uXkx3GsFmxNnQDRGW7\t577801083\t5.778011",
-            "d820ef165b6a286f90a0c9441f3098106f5d24d0768a1c302b6511e3b28f3a78\tBd1gJXWbPC3hoVEbCm6QJxkEx8nVL6PMm6\t7645578374\t76.455784",
-            "d828102de73295c54c45d7fdd382fa63e4eab8c047b69f3954d56db2c2be1cac\tBcwnAzPsi5A8vmXda9TNPUwumWw6CTihY9\t9584996512\t95.849965",
-            "d828102de73295c54c45d7fdd382fa63e4eab8c047b69f3954d56db2c2be1cac\tBeUHV6yguVunQ9aAzjM7Bmxzq2spmRttE2\t9584993521\t95.849935",
-            "d830236e99c7238d36f4c842c6e8b245ed8a83ccf3d034409ef4069783a4004c\tBUHAvEWMT5JKuLDciX4zRoXM5Z8JJgbBmM\t632025079\t6.320251",
-            "d8606a79d4cb52137a669de88361180452e6276e49175205280b50ac7e74e873\tBWx5dPgQrP4a8tnkfbQNdjPPVHXAtxm7vr\t909188325\t9.091883",
-            "d89381d5382d1db434af94c998d957c411bd8be941e6bb0a343b0d94a30ef4b2\tBeyav5NEXzFBwEYpxa4HYRdxQUw1Svbfr8\t500078955930\t5000.789559",
-            "d89a4f828208f2ae8d70b10c7794b9b163a9516ef1a0cb1217d33a76260db3ea\tBpeHkcreFe2iu6qM7w18FAL52ueAot8b8m\t1383775576\t13.837756",
-            "d8b526b14c16e70bf4beb2973ade7a309da3b9e1fad08d41be3cd6e34159faab\tBeCwrMkStN2YL18Xv5rpM1929evdJq84PV\t632019083\t6.320191",
-            "d8ebd2dece808ab9d7d6c8aac5eeb23efee8268b5ba4bdfb54c4c7d168187bd7\tBiSRUuBBJfunzzc89PD3pGM6FELudZJaQ4\t999997762\t9.999978",
-            "d90d2f4c7a9b2b65827074b91a72806b26abc7844cfed96b67a17f8cb0d78acf\tBYFRMpqrZbWd6snE9Tyi6utpmkMLwwXj2p\t500198970571\t5001.989706",
-            "d93cf68de001d7ae6f5331fa925dcd9a806599cf4aff3ef9bb37bd8f6f5c187c\tBTr24suEaiPX9nPp82ukso7eDUB9jziyyi\t2081717874\t20.817179",
-            "d94e86cdf1c473e0f2a9fae4900e4dafab70c96a3cbbf9f9add43ee8e7a1376a\tBjzBAFR8bLYhM7kQsM5i7MikaoCxNBE3Lh\t6677030669\t66.770307",
-            "d974889d89cb37750549535bd7f2a214cd327e5b79502baf6cbae289a0183aa5\tBZ7vbg94fA5zzh87jKcmacFmamwHtwQugX\t641887144\t6.418871",
-            "d980a6dede5e72d355ca787f5f73cd02507ea4646c7aac03504d14b243dfd2c5\tBWThpb2xPwYBi5tKk3cGhx5pWbhscjGchb\t2300792743\t23.007927",
-            "d9bfe0306f39324416be952df3c8fdb351d748e1e600ced1576d844ce24520d7\tBkzurSUWWANkSsTNvBpXuyzvCx6Eq7TMf7\t569679597\t5.696796",
-            "d9d3f8c35b734888dc112b80a285086bb0d5d50024f973955055d94e9f7bffdd\tBcgVbKYVy5r3E1Hkhfkdkxyys9NMAnvesZ\t5607810630\t56.078106",
-            "d9d3f8c35b734888dc112b80a285086bb0d5d50024f973955055d94e9f7bffdd\tBmMGt3JGpzcnJBJWZP1y3H9GrXFik8vPmP\t5607807628\t56.078076",
-            "d9fcef01d585abfbb8cc6f1aee5a4974f633ba2bd78c370ab4cf9c71fcad9626\tBah84XPkRchFx6Up8wYMfgBMxeEim3y6yB\t5837493958\t58.374940",
-            "da18ab95426d7c00be2712647b67c90d9e22e1febad9ab0c738703888a69f47f\tBeU77kgSRqRqDKA6kZ4JvDoZL5YTqdGcjs\t594966640\t5.949666",
-            "da207a7441945b4d765b6d7bf7717d4048a0db6870cd395c1a657ba1178fabd8\tBkkiGUn6GfTKbe9N1AGkiT8XECUvgvQLA6\t999994966\t9.999950",
-            "da33c8666badcbcd6a118549278bd83de59ea3b587e41b30ecff91e92c9f8a7c\tBpYDZAddSmWVR6LXbLvGrt6fArXgVomu27\t7134337728\t71.343377",
-            "da371cf7d3fd07b986c957cbcd1923b24effa148a78b15720172d6a7b7bbac0d\tBUnxmwmntgNgFJR71LbpWLDQmYHP8nRrxM\t563579796\t5.635798",
-            "da371cf7d3fd07b986c957cbcd1923b24effa148a78b15720172d6a7b7bbac0d\tBXeJkkgZ8SqzfQDGDYPUq6j3BeQs4LSHb2\t493574786\t4.935748",
-            "da371cf7d3fd07b986c957cbcd1923b24effa148a78b15720172d6a7b7bbac0d\tBZNdewferUq1Psd5ka1ins56Gjhjo7zBuE\t563579796\t5.635798",
-            "da371cf7d3fd07b986c957cbcd1923b24effa148a78b15720172d6a7b7bbac0d\tBiwbogrmY1sdQAJFzcwZbucranoYi4dWEw\t563579796\t5.635798",
-            "da371cf7d3fd07b986c957cbcd1923b24effa148a78b15720172d6a7b7bbac0d\tBjzxgvEWriZtMQWWFiFoFg7xXbMJEmMcTp\t563579796\t5.635798",
-            "da371cf7d3fd07b986c957cbcd1923b24effa148a78b15720172d6a7b7bbac0d\tBkRebzz9FpTXA2vKWaxTNXsfdBEHuT5tuR\t563579796\t5.635798",
-            "da371cf7d3fd07b986c957cbcd1923b24effa148a78b15720172d6a7b7bbac0d\tBneyrxZf5QCrL1HVrJNMbLskRbTnvdL9Da\t563579795\t5.635798",
-            "da371cf7d3fd07b986c957cbcd1923b24effa148a78b15720172d6a7b7bbac0d\tBqXxPrsrMVzp3fC5iHRqUg6ExzQk9YjVhB\t563579796\t5.635798",
-            "da371cf7d3fd07b986c957cbcd1923b24effa148a78b15720172d6a7b7bbac0d\tBqwsqQhUoe513kf7ttHe8qiHG3y1NG7jYv\t999999999\t10.000000",
-            "da371cf7d3fd07b986c957cbcd1923b24effa148a78b15720172d6a7b7bbac0d\tBs1611L7SnkEZGF6oPBnEp1KdcPpSFsuvo\t563579796\t5.635798",
-            "da5b33a7ea476f018ff4e7591776838d5f642c9e3cdab6ed68f3941e85fcd4c1\tBmD5Hu8Kddr5pKJKdAMhNUV2sCQ69BybrB\t5066377212\t50.663772",
-            "da630795db4c0bf827ff7b169a2d64e6a01d885f73b034faaccdc930f9ac61bc\tBUJW4c2vURn3L5BN7QtvEScDmhyH2w5ZUg\t9399367541\t93.993675",
-            "da67ce551a33e54b82718533dcbdefec5b5dc21b5ceee44c0e1435693a56cc6f\tBWRa4seqcPDzik9TStYdEbUb1RHDyD6gMH\t5169792784\t51.697928",
-            "da67ce551a33e54b82718533dcbdefec5b5dc21b5ceee44c0e1435693a56cc6f\tBoFnpCrH84fAhGsPc62dNpKhcxr491LkbV\t5169795786\t51.697958",
-            "da6aeade1048ce8ddf5c24a7cc5e1b9253aeeb79b0402b7298fc72c09f0a94da\tBmkRS7PsyFMuEjYq6hafYQzE9gUVYFm1Zx\t4726295217\t47.262952",
-            "da7db19c7ef2e1718d531bfd059f80d9458915bb21fb9059cd62d0a8c4de492d\tBjoNS49HVMErwojUCSR1oQEBMqi5R1UV4q\t562020556\t5.620206",
-            "da815ddf6a3d3f82243fe8f54511d60293be269a230a94938276705dc06de89c\tBptYNhXLSvsFG8ySBwsJ52Q9sTddKyH25s\t9166289059\t91.662891",
-            "dac2f4a317e25891c3ebc831d57bfab810f0906bbbf897a647f7c426c0eaf42c\tBkncXErHqKknZaeBkUiVk3xeTzgkUP3iKX\t882552330\t8.825523",
-            "dac31a0fc029d90ce1eab5ca9651fc1e56f756ba77c84e54a15768be8c664a2b\tBhNDZUxQDjSt5wnPwKw8sbyDpJeH8yFCns\t462928398\t4.629284",
-            "dafcf90b81fd84a6899c861454fbbcba3537c5698da3c0b59044c94b2088fe9e\tBYKS3Gb17W5GXRGwWzcaUHYQFNDdf8UAET\t4796302878\t47.963029",
-            "db0d5cf8f9c3a2ef5624b5a72755c06ec822a93966250e35359b733091735702\tBrD4XXudTDNcWbZQ13Ei94hDjmqWHL4YDJ\t7645582186\t76.455822",
-            "db35b95ec95c1a2f21a169a305cb552d240d644d49f1154b9532193fc1f12bff\tBaMKqDiEiuZEkkBg3oT5moJAdjXsGsDwwk\t918473662\t9.184737",
-            "db4712e25b9f3b8fea641a77d5db959f8a354e75c5c456f00ddb54e9923fa529\tBdLXBo3ftAUrbEPg7DoKAG5BQPHFQ2Hqd7\t6249996752\t62.499968",
-            "db4e3c8e0af04b620f009c15e325355af88472553012b8bf77031e767dbf8d0e\tBng2knonWoHowgjgSFqq2QkFNUN7J9vcn7\t534162886\t5.341629",
-            "db53ec0975bfd9c6afdb3c27df56c64b1803aa71d6b9ed0aa81b2adef9348a83\tBYG2EnkSLQ2aKzFhv2FXQkL398DXcu9wsJ\t139077876\t1.390779",
-            "db77aee550bd5a26fce54939d0fd7a3792b1deea1b8c1c489f86eed7eb2e9089\tBXWLLSmVjNNLspYkFuoHbgo7aYgjLt1MWH\t939847091\t9.398471",
-            "db77aee550bd5a26fce54939d0fd7a3792b1deea1b8c1c489f86eed7eb2e9089\tBaqTxPozbM6ks9xKKdp7ctWX7GGirtadeH\t939847091\t9.398471",
-            "db77aee550bd5a26fce54939d0fd7a3792b1deea1b8c1c489f86eed7eb2e9089\tBbLC6AnUKEDEzPz5Z7qJtj2gSQxhDAYqq3\t1000000000\t10.000000",
-            "db77aee550bd5a26fce54939d0fd7a3792b1deea1b8c1c489f86eed7eb2e9089\tBciuXDEeHzDmqTHKYhNzMErVqu6npJDNLP\t939847091\t9.398471",
-            "db77aee550bd5a26fce54939d0fd7a3792b1deea1b8c1c489f86eed7eb2e9089\tBdXcQrhcCVdk3mgt9wn4rqiHQ98mMUWVRB\t939847091\t9.398471",
-            "db77aee550bd5a26fce54939d0fd7a3792b1deea1b8c1c489f86eed7eb2e9089\tBftxhqjQgh75pitbJ6MYJ21vQukxZfuSqS\t939847091\t9.398471",
-            "db77aee550bd5a26fce54939d0fd7a3792b1deea1b8c1c489f86eed7eb2e9089\tBi7VcWKMAUnBev6CCErixh8sZjVC8KYUNb\t869842557\t8.698426",
-            "db77aee550bd5a26fce54939d0fd7a3792b1deea1b8c1c489f86eed7eb2e9089\tBkajGyyZBVPyBLRv63FszwHop2gAyKpG7F\t939847091\t9.398471",
-            "db77aee550bd5a26fce54939d0fd7a3792b1deea1b8c1c489f86eed7eb2e9089\tBrU9eCoVFAfsuqmGr9o9d3ocVYTua3bZcZ\t939847091\t9.398471",
-            "db77aee550bd5a26fce54939d0fd7a3792b1deea1b8c1c489f86eed7eb2e9089\tBrXHH6L95cLaYEYb5JCDCKFgKDKsE141Ur\t939847091\t9.398471",
-            "db82ddbc30771d230666c817c26018c22d5b6c9cf5c696adad433a5424ef365a\tBajQhddLHC4mAvZbdNzJjSQUkEE9Pmw9cw\t2300789896\t23.007899",
-            "db83ae11182b76a512a0574da9c7462b45d6fef494c02017c781e77924001164\tBqmEUBGWHpvXeAVP5iQapK3uqgz6vf6Vhv\t3986091213\t39.860912",
-            "db85f5b244e7d2182b4a55c3b75a019ccc20f6f9dd8527ad67a226c29ee8979b\tBfXhFf7mGR3M4buYjEQDCCNpswT5r5AgEs\t2058644938\t20.586449",
-            "db890918eee786a150d319393dab3865f25c4096948ee194efc4c3099e5208f6\tBa5RrDLz9yvNufipB9b1M1QoQ9vX3YAs3A\t500160757765\t5001.607578",
-            "db8e846c2bccac6dc0b43596abc4453987685f9613931fa3179799ecef18b89e\tBrzC8c7YB4XZCrRdaHxWW2moHQGUc1nTRW\t632024376\t6.320244",
-            "db9293c4310a9908878253249a90c28d788571e8113d34582eeb3b3fd47f27a6\tBbUn3ePxJu6ADrKSGGAzzsuWifhHvWLLuk\t1220424432\t12.204244",
-            "dc0cf7d25a02cd5db6daa2af3b6c974bcb5b7327ea559f602e14473b77c805a4\tBn6aJdkZ2DgVt7D4qAFJoHhJdibJ6MLcSv\t999997969\t9.999980",
-            "dc21d30db13cad21b940eb7c9a3a792cb90498c8dd615d41a8b4adc2b4526078\tBmDWzKo9tpsoidTbnKMbtjqCq9iD6WssBk\t5401789732\t54.017897",
-            "dc21d30db13cad21b940eb7c9a3a792cb90498c8dd615d41a8b4adc2b4526078\tBoLo9317opRWZj9hzsSBMndzrZtKzxqL2i\t5401786482\t54.017865",
-            "dc76d8c510afba3bf3c8da372c3cfb2757b16243e695352d2e4e434f51c25672\tBdAAVXMpCSQTibXqQvE37wGvXFHXUTXzCV\t8749994819\t87.499948",
-            "dc76d8c510afba3bf3c8da372c3cfb2757b16243e695352d2e4e434f51c25672\tBnZpQWXhsyFoRbr7GSye8gyubTYxntsDtD\t8749997766\t87.499978",
-            "dc82f2aae73cc10957cbffcd84016f40140ffee79a5ecf9df7b41209d5c85aef\tBexqai592a7TYEfRQDnctD9X2Mmcp1jaCX\t5721528885\t57.215289",
-            "dca1921ad8d7f95e5d7518a6f58bc9378aa14f21d8bf3ac939260190f5b20566\tBmcp1bFCebQ8YoNmjzXjsFHGNUVyVA4mvz\t6403968368\t64.039684",
-            "dca507c6fd39332e5f5e97b8ece6431768ab9ce1577f76a44db6a124fa921d20\tBZGAnotD1x8nifYvJ48zNUXVB3DuziFSB5\t5972216964\t59.722170",
-            "dcc028ad52bca627595efe87b80a11d73b933c2f2ff21283463994778c897716\tBWUgGYSBCv2HE1HbNdEHzTo2oc56a4ePev\t3280400342\t32.804003",
-            "dcc24916a57c4d4977257cdf4d3eea83eca59b8299ccaf3fe6cd726b5d2f8933\tBWi8rFoXs5oS1E3iaE8DQtoBkLhYYSqKzb\t9749997077\t97.499971",
-            "dcc24916a57c4d4977257cdf4d3eea83eca59b8299ccaf3fe6cd726b5d2f8933\tBamQaiCuvjZRrRVZw8d5cUrKjU488vEKvB\t9749994086\t97.499941",
-            "dd0fe535c299f921fcbddd58f673f132facd07f30cffad790f08ab9f72f3c8f5\tBTz1Q8BhQv5Kyj42H82cQEju5cQn9rncNQ\t6295101062\t62.951011",
-            "dd52c41b58f688b41fe998dd3fd854f9926664b8361f46b46c135b638b28320d\tBfq24VDphmWkycbRKmUuzm6MGou7MM8fF5\t6100232225\t61.002322",
-            "de1855b15b0ce71a086b47b6c77ee6b009947a73175730a6445927fd2600d22b\tBmBtAsU4jZpvMdNtWuVPD6HadMzVpNdkdo\t641887144\t6.418871",
-            "de1ca5cb3d88b22aca04560f8a20411ff4d4aa31d2a7befb2c3ed3eb501e217e\tBp9Tj6yd9eyes65QzfPALfHs7MuXT2e2A1\t6289747175\t62.897472",
-            "de42dee7fc5ecf24aab54831b2f64c0a1168c8028e03eeb2db154336480cbedc\tBicU8GdSTCPVXjFxksE5am2GBJtcJowrXq\t5888226039\t58.882260",
-            "de5fcaaa0f01373390f3bd106f3083f309902ce26b00b3c34813219dde84450a\tBkydmRPDgPRe1B29NarpJJdQurZKZTxJfE\t9827691399\t98.276914",
-            "de7e84f72a7e3741eeaa8d27c67cb43e1afbe7f6f5dcd8384d0764905185a600\tBjzx9KB6EJdCP9GbWhgS1ZhYRwNLPJboJK\t594441586\t5.944416",
-            "deb2e6aa9958185d6a46964e52bda624f43530f1c36cfdebdd1dd5fd75ec2a3c\tBokGt4HdzcB1rM1No5EP5zLKzUpz5vV1jV\t658837483\t6.588375",
-            "deb36e87e8f1ce646e66eae278a9dbe7af8a62f880e8dfb572b86d50308dd703\tBUxvgidxKbBkvoqgWaeiWXFk5V2jYP4JnM\t7104721888\t71.047219",
-            "deb36e87e8f1ce646e66eae278a9dbe7af8a62f880e8dfb572b86d50308dd703\tBY6SeCbtpWLUqSStKUcMUtKHVxYCmAvNY6\t1000000000\t10.000000",
-            "deb36e87e8f1ce646e66eae278a9dbe7af8a62f880e8dfb572b86d50308dd703\tBfMwXF9GQApkoKnsrXXExTE8v83aMxXTNT\t7104721888\t71.047219",
-            "deb36e87e8f1ce646e66eae278a9dbe7af8a62f880e8dfb572b86d50308dd703\tBghCmXGnG35xuSH5H7mDGegpMj4CUF8DxZ\t7104721888\t71.047219",
-            "deb36e87e8f1ce646e66eae278a9dbe7af8a62f880e8dfb572b86d50308dd703\tBiD7voprgg9NR2Sn6TcNBVNfoxria3bEcu\t7104721888\t71.047219",
-            "deb36e87e8f1ce646e66eae278a9dbe7af8a62f880e8dfb572b86d50308dd703\tBiG5sMDScECKQqVtgAMrrjHmn5eqRsF4XA\t7104721888\t71.047219",
-            "deb36e87e8f1ce646e66eae278a9dbe7af8a62f880e8dfb572b86d50308dd703\tBnS9EqYuzusAACHQrSeyibpxaTbEwPANEP\t7034717192\t70.347172",
-            "deb36e87e8f1ce646e66eae278a9dbe7af8a62f880e8dfb572b86d50308dd703\tBnsQf7rdrJJ7xWsU6mvLubXoTiPRgcSxtB\t7104721888\t71.047219",
-            "deb36e87e8f1ce646e66eae278a9dbe7af8a62f880e8dfb572b86d50308dd703\tBnxJWFG9gz8uGfz2s28xX4VvpaMjqwtuMP\t7104721888\t71.047219",
-            "deb36e87e8f1ce646e66eae278a9dbe7af8a62f880e8dfb572b86d50308dd703\tBrxyk3NsXYSePsWfDrAhwnUdwWDjt22rg6\t7104721888\t71.047219",
-            "debca89cb1cc7438c6cc20b416e5e82325e7ad9460d60bb2e54ce2789f734cbd\tBpUNeER4rKkzDefgJgyaxHmCaLffGbJBHR\t1100394770\t11.003948",
-            "decc4eff48ea7141126a73afc1cdb4722e6eaad36713470daebe500634b03c4d\tBfnCiKWR241BCMw2c8pyERRUwqVUa9u3as\t999997762\t9.999978",
-            "dedb32367a8d8245187e75a41b78eb9d0d0aee3bcdf7b11175171f9ff4e0a58d\tBn7WbgKhcyDhUyzzHh6Kj2e3sc7RNwADAz\t7759961625\t77.599616",
-            "dee026b349a47c63e0f1abe2150ae4ebbcf8f9619b890f71292a6d504f71123c\tBiUNAna9tVBpwRNRpVC8acA71kZ2Ci4PSR\t8835487085\t88.354871",
-            "def35e43fa6880928e873a9c79407aa186166201e133fa6b4967bc5fe89b9fa4\tBcBVA4vgHz2ce5ZStXpughAbsuTqtzwvrt\t7781019304\t77.810193",
-            "df0d0547967917da6dd5ddfb3895228ca933271722e602cde182138f3e100211\tBqgM64ktTYSHCCmX2BkejmtwpWrLXPSjQN\t3280400330\t32.804003",
-            "df0d91d5bf41355c642a5230faeef0599c77b7f7151475e9a057bbcfda17c9f8\tBkyB5b4XgM7AWQ64XpoMbb5k4AGLUgPYYk\t4056101527\t40.561015",
-            "df1dce8c0b51f4db468b527ec02af4f5d96f47c8bb1f0a90c1b61dadfa450fdc\tBjKrJMdgUZ4e1xJRrxzjHHL1diansAcFxS\t5508341385\t55.083414",
-            "df206464b644b1464812d8104d7baa440b40cadfa2de88e1a26b44f1a374fec9\tBkSaWnabi1SGk9wsCrbyEF8LHdHmjuk6yq\t6083337293\t60.833373",
-            "df206464b644b1464812d8104d7baa440b40cadfa2de88e1a26b44f1a374fec9\tBmqsFb8Qdvu9uZJHthgHMJyZZnFP7TqRXK\t6083340284\t60.833403",
-            "df52fc81f0bdebc27f79b3599a13ca3d199340bbaea272e8fd02f2da589e679a\tBpDdbFB3PQBesRvVXp9tdo7mGMcD5jmQLV\t6949870243\t69.498702",
-            "df5d5a4bbabadaf20218b1f0922a01c26b7c16c07bcc8e4d7f49fa04459a155f\tBhEfL8YkkryQuMnFpDbSKRceTLFx7K4N5x\t611549124\t6.115491",
-            "df81c0e2b6789072a5c8c70e515a2dd3f7d98236eaecdde2f47d4896c31d0126\tBeyRsHo5gjfHwJAsnX67nAxJ43XVUWueXa\t9432756468\t94.327565",
-            "df86c826e4a1130d9b17708b8b1d8013792c2ce7fd4f6e96ea54cbea3211c85f\tBVwEipz7W8LfwfoQY8tKTF6t7tkt1TTHnj\t918468605\t9.184686",
-            "dfa829f8b2d06023397d20a371ae6dd3af980df6b1e6318484c1f8e89734d624\tBbPASVeYX1ASAWYtxdopjkZPn9pa6QwoRb\t1313767721\t13.137677",
-            "dfe00394d0e9f1328402c5e8c569dda765b977a07586b3f1faf1b7c34d1aec8e\tBUUaXxmAqoahtZj2z5w2Xrynr3DPxQkWRy\t8480691695\t84.806917",
-            "dfe7c6cfd74763437840726a3ee49898bddfd9f0a339e01009f16edf7050f007\tBiqgpjorRmmzHkFKMurW6pWF4U719VvS37\t7147066749\t71.470667",
-            "dfefb89f05977ac2c5ea1e2426b627e5ffedf063aef5c84d642e6b50db631fed\tBj4k3waZ1vwGKSN4VaRk9X9T16HthC6ptS\t1383770270\t13.837703",
-            "dff9893fe933d789350d2388e8258b40ad48f0078211df008058184def9aee6e\tBcpxC4FnAZiasnoSQFnVSp9bv84WgkFDx9\t733316302\t7.333163",
-            "e007b036c44d8f076b14fd087d92545be826916fa0702ba25fd56380516a4aff\tBZdrhUj6siQDdJcaqiVjwfCksMjgGd5Sic\t7781028483\t77.810285",
-            "e015a199cd8756c525ce756b34e4678c610deb36bc1245d704ec3b804f53c58f\tBnXXpezoaAei1qeBnd61y2nKbwR5dD18Cg\t7645575952\t76.455760",
-            "e02815d7d1cdcb64aa86fc302f516924ad01300c238543e8a84965b1071b8473\tBmuiTx6jJtBjBe71wLGrLsdUzXUMWptNfo\t750295103\t7.502951",
-            "e0327372b8768287d7c52b2a38fd8e6c724cff7d17814afdc3acd63c54385941\tBfFYujtpdsjKN898KH22pQC7AuEqf74yGG\t5508345180\t55.083452",
-            "e0327372b8768287d7c52b2a38fd8e6c724cff7d17814afdc3acd63c54385941\tBgRynA9iRnRvt7kMqMVcSv4iQuAEXz2voT\t5508348260\t55.083483",
-            "e049d29caaafa1ec725c504c393ea9959b1cfc6fb703033aea1f0762f04ea340\tBWG4TeVm7eRJeX2HmWVPvjXCiSivUk3MZ8\t764550411\t7.645504",
-            "e04dbb6ec56340dfb1f3c43fa4d68d31f4d55b506a98b9ecc7f6c5d12d4fd20c\tBhKDA4jhRr9PV1mWVxnbehjaPMVh9nzi11\t5169791770\t51.697918",
-            "e04dbb6ec56340dfb1f3c43fa4d68d31f4d55b506a98b9ecc7f6c5d12d4fd20c\tBnvyTScghEMzi3xaS5FET72GUsEhY7By3A\t5169794772\t51.697948",
-            "e06d180f8a25ff3e82566b270909ead2848b4220734fb94ef078f9bc851e8165\tBb6uoVJB9HkLcRaEwotTcQE5GkRbs9k3Ti\t500078923896\t5000.789239",
-            "e09fb56e43ecca6333366f26132f11f6206ff6bb8d0f9e23ed1c58e5b4dd049f\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "e0b201e19f575d9922a0dccd70b75b34893c6bacfbed5e356179f8f8d5725759\tBinBvq8nfFi3rEDjpgNCcww7w41oMTHD3t\t918470815\t9.184708",
-            "e0ba93206cc21b1f0e3bf64dc4a87234be1f8300bef9059ecb1adeaafaeac143\tBZvxWD32YaBPToMRdr9piniboMH4PwUFvn\t658837483\t6.588375",
-            "e110b898a6dd6e5872fe987a49dce332dc46d8262aaa82b5b878727382654756\tBWVAeAWsNqt4RFHmLLtr4n9ar82fmxPQHs\t9827689243\t98.276892",
-            "e11ef619af838196b3bde4613282b27a5ac0843563811801eb68cf3d1b192614\tBhJjMWhGHyuF5oGU29nVKSu9RmfmxdAx9U\t6864565035\t68.645650",
-            "e127a269c610667f18ad1d040061c2eef363705afa424e27f9268674ffe79944\tBrheoWBbp1tMd8hq2jybzXu5cFXiqgJL9A\t500040914433\t5000.409144",
-            "e1313ff4b417f2fc7c4461d21e055b400ed69dd0155312834e1184f47c8052a2\tBbBhnMVtXKWxpqpzpiWt5P9MqJCdpbHurB\t733321973\t7.333220",
-            "e13cd2a9cdc739e72aef05bb06fa073e6ef76710bf5a770dadd468765498bba3\tBbGv89gPzkLgGVzcP9PYHQ6meFgp7N9CCy\t1485407106\t14.854071",
-            "e1475e79f86d8a9394281a29a043d26d363a8b8c52dd238a10f00857ea69c342\tBi79mT4KD1bh7tb9WmR81i1ngXmnLgrS8o\t7499990068\t74.999901",
-            "e14d928c0d66d49163773e770394375b4d5e938815ac673d91f2bff3f2464670\tBTwWntGCugmQykvcEgimwEz49YnzSjzm1e\t7781014889\t77.810149",
-            "e14fa4318520d8cd9deaa3c042e2bcb81d0d31f1dad54d964651a9f19fe3456b\tBWFHo3mvbqnCzqwDHcZ17f9CB4KccANgKc\t598858327\t5.988583",
-            "e155e01706c888c07f33c77b3f39beed3abccc700e70b98a003dd6d12de651f0\tBjVhdGpHw563GyUxZ2gdLvVGpHGcuKGxY5\t5508340139\t55.083401",
-            "e1672dbe1754f3bdaa38cd482a74becde150e3468bbde5d5478771bb70e773bd\tBUyD6vQFr5wpxpVFG1dSLRnWtoRfrmVEyh\t1236937173\t12.369372",
-            "e1828640b0c550f9f25d4cf2623e53427a02dbb2f8f9d3104e8df8efdcc32a9c\tBcsSwiupfkdaRFP92932fgrkyuLKLguMN2\t764547552\t7.645476",
-            "e18742e6505fa396ed7d072f8579142bb3f6c70e5836173e0bbb323171de7f65\tBpeHypExkJiPtopuTbr8pLW9gywtKThNXA\t5508349891\t55.083499",
-            "e18742e6505fa396ed7d072f8579142bb3f6c70e5836173e0bbb323171de7f65\tBqo1VNCHmbFyfKawHKgL4dmmUVSjLUWLxe\t5508346811\t55.083468",
-            "e19b137aea5cc9666cd5718ea81795b563bb06a77aeb3c9f9ef45105dfcd76b4\tBjVSGcmTXo3HJBkB6SF7BEATPokoxWWiBQ\t6254741433\t62.547414",
-            "e1a998251eb0e7528a80e76f69c8565ef8691eb0656054464f3aced55162279c\tBcKE9DHfAKuzUT1V3qadjFEYE7PGPDupyo\t9827693828\t98.276938",
-            "e1b718edd7ce999e20ceaa39e61e2b8ca1a998cb3e4230c0174d3822c76e30c5\tBmVBaEcpxaGd9JByS5EoVDXiJ4eTsbW2GL\t6949869433\t69.498694",
-            "e1bebb126c3e99946d7be8897c06cc82ddf979b6b163a147f6e7ae6120ac136c\tBkZgWiB1TwkkwziPfZsyXzUKokEsS1QxSu\t5911746684\t59.117467",
-            "e1d1e4c4ced704f584396da3d0eb244de293e02c47de67aa2d18b19e265d2e37\tBdbMojiQGrw7RYUrj4Y8iezuTgzcnJyBbu\t3210396077\t32.103961",
-            "e2243cf40cb47f3e6dc2070d53520977d175293d6ade1eb9d82fbb22dfb3e8e3\tBUcfdvSKLwR6mSHgEWrh6Kp45fGCrQzhy4\t5911741802\t59.117418",
-            "e22700d10ccdd831784bd46ebdfc4302ed9ead4026d7ec5d15b0059c9033342e\tBVCcabR7seBrPzmGkCbKdCu7d3n1oQ7ELc\t577801208\t5.778012",
-            "e23e5cd63fe25c3a16898c1217f6b6a3d6c07d3893c27bedc40f92022c7c69a6\tBkfBPYK4jbxKKPZ1uNZRrXWvEn7JUWJy7P\t918473662\t9.184737",
-            "e24ba979bda4476fca586a4d7d730b3300a66cf54aadf807f0abeaaef08b4657\tBg35MPSnvx2o1nFJ7fTW6jRbxpYKjrhADT\t641889990\t6.418900",
-            "e265b721b28b4a41f5ad87dfc3a71ebd935fdfbfc9184b4f579c6ffa7f569954\tBq1As3U69u61g8kEcXF61QKWoSW1b8YGa3\t577801196\t5.778012",
-            "e26942bf838d98be2169e7c216dfa6adbdd3ef4bea6df1dfc1428bf05240acad\tBWfTsefRkegoErw5iwRZAZBuVUVzYUKqa9\t1100394770\t11.003948",
-            "e28585c30404b8e6e347573920f937856ec33693e93887de37554a306a54d304\tBjmK3rtsWtFWd7JZauSMiNZKmBUT2kQ1SE\t8088665987\t80.886660",
-            "e29f0f79c386dec63dc3bfc05c40cf16bef69266eac1282dc266309eb7b78ab3\tBWfBX4cjSVXm55pNe7B6bxR23sBWymez5Q\t4159988724\t41.599887",
-            "e2a068747eae1bc0c7c63ca677b1d3f3e718a786a0b5a4de2a43c075261945e1\tBgcEQr2pg6LSzb4uEer2Bm7sQpBHifBMDy\t5169791353\t51.697914",
-            "e2b75a2801cd80e6435e9810355d5b149c5c6c11f6c071f4f831572ab41df4ab\tBWr34ESQuehHfLZ1gvQTdjbzz79nFi7Fyj\t1220426890\t12.204269",
-            "e2ece3c20a0a346575cefa3904ab514c15a457eaa461e3cd525bc9abc7df9cef\tBe7QjKAQCnUYCAW8TFB8zCd9g8cfzneL6H\t534160439\t5.341604",
-            "e2f7d2315f522198ca36df5524d82bf73ed9af8f9f955020f20818d11b03382a\tBZVyphxec8T5MWeqQAGn9LttzyaW2jWwT2\t500168960257\t5001.689603",
-            "e319186da3ec8a9b61292095411e458d82ba661912d31420f7ac871608106b20\tBhcPiRzXAE5V2N8djPzQBF6scFwZRWM31G\t733316291\t7.333163",
-            "e3395e2c74dcfc6496043c3d3e97e90f05ae17c68f4469d041c5e3cb8d6d5149\tBh3R9gHQe5zp9SURGjNNCrNZSo79khh8ej\t6249996543\t62.499965",
-            "e33e8b38ab4121d88ecc2010d2dac38c7958e453464f6c7ab79ef3ed9d5a69a4\tBXz1xdBbLPVQR3ZLZWb3T7CJWoVK5mKWfL\t6864562173\t68.645622",
-            "e377b07040e6b3af09811ca8b35dfc4b004f07f9eaaf99b663b29b28511b0773\tBZaRcBixR1KCzvn4M5aRithUodCKcZWgdb\t1566658346\t15.666583",
-            "e3836d26e8056b7c5f8dec0d758c018fc28e270b79dd81c51f512c185dd1ec9f\tBqtkUHMdib1j5GfLKZYSSrUQwzwgECSMbJ\t999997969\t9.999980",
-            "e38953457794524236fc302a2e9ebea9b7bf8e7bdd82adb2db3b9d3421830c59\tBiBJ6xWH287jiU7h2Wu1h5fXYeqTm2b1JS\t534162898\t5.341629",
-            "e39d15e02d15eb3ff827d1b41b55273f9a5170ddf8104ebab36defd9e1564d65\tBf7bhJyDKegaHaR4qonzpqWubQsh8QHDEG\t14268683696\t142.686837",
-            "e39d15e02d15eb3ff827d1b41b55273f9a5170ddf8104ebab36defd9e1564d65\tBqZD8BfLkQ4bwBBgp1JEvMNEACWpTmCSxw\t14268686687\t142.686867",
-            "e3dccf3d4df38922c3d45a2802178f0cbacf0e4272b608ddd708a42ecc2a5d21\tBVhLJuQNavU7Cywh1baxA5gboun1DRL5XZ\t472623267\t4.726233",
-            "e4307ef2b80bb3f08080a60c826d45983f349431cd127a95e04ebee6f218ea8b\tBcK8xFCy8KWbVadeJ87zpWwARrZy63c7my\t1364052560\t13.640526",
-            "e4556d4dfcef6fa2e30a957a2167df2ddabef6d0abf7c85bf992b0853c8ca56d\tBWG4Tqmguno3du1QinqLGksAYiBmRSkead\t579999334\t5.799993",
-            "e4556d4dfcef6fa2e30a957a2167df2ddabef6d0abf7c85bf992b0853c8ca56d\tBWp2cuPVNojWGuMZgxKidhU9UjeCJkvGCa\t579999334\t5.799993",
-            "e4556d4dfcef6fa2e30a957a2167df2ddabef6d0abf7c85bf992b0853c8ca56d\tBaUw2Mo4eaNDd8sfk1Sf7UidVQqFDVhEU5\t1000000000\t10.000000",
-            "e4556d4dfcef6fa2e30a957a2167df2ddabef6d0abf7c85bf992b0853c8ca56d\tBeQWhJnEhccqKeaqeAWjahfWptT9jwaeMi\t509994626\t5.099946",
-            "e4556d4dfcef6fa2e30a957a2167df2ddabef6d0abf7c85bf992b0853c8ca56d\tBeYFjPT1FYXF9soLPsx6vX9huYFcSCuw2X\t579999334\t5.799993",
-            "e4556d4dfcef6fa2e30a957a2167df2ddabef6d0abf7c85bf992b0853c8ca56d\tBicWJwGgckJjoYRKy6n5xh54aLe7z3ch6Q\t579999334\t5.799993",
-            "e4556d4dfcef6fa2e30a957a2167df2ddabef6d0abf7c85bf992b0853c8ca56d\tBkUN9Mk1bCzD8bdVerMCqkTcKDWwW1mxCS\t579999333\t5.799993",
-            "e4556d4dfcef6fa2e30a957a2167df2ddabef6d0abf7c85bf992b0853c8ca56d\tBm1PMppUGZXU5KuuHZpvDy5iuvFc3cuhTp\t579999334\t5.799993",
-            "e4556d4dfcef6fa2e30a957a2167df2ddabef6d0abf7c85bf992b0853c8ca56d\tBrYyneFadXdRxipufPR1VhX6xFgZi2NCZE\t579999334\t5.799993",
-            "e4556d4dfcef6fa2e30a957a2167df2ddabef6d0abf7c85bf992b0853c8ca56d\tBrqHKPMo3QjarJvtkxHJQaQFumhy7pU799\t579999334\t5.799993",
-            "e457be3544cac5025b23e40d2a8339657a508470db39b301e372bf36e93b0d8e\tBXNDXuY6mFr39YFXYwKcJmrC94Ufr64F26\t692208749\t6.922087",
-            "e457d0e7e2c5c47006bac618af59d35312120b1c08bb8d4b8c45c86a29332d4c\tBc2ssfYkjqNJg2PcWMBwB9opFg6oZNLNKc\t9399371583\t93.993716",
-            "e45b64784157fc6b87b2d171c8e40a9ef840bf4c13f85a22685c441c6d35acf1\tBZrgvCvASCdKgsy2Qr3cHosKKsynEq2VpQ\t9351247102\t93.512471",
-            "e45b64784157fc6b87b2d171c8e40a9ef840bf4c13f85a22685c441c6d35acf1\tBhPz7U3BWjK7QyfaKW3XU8t7QRpJFjX6gK\t9351244111\t93.512441",
-            "e45d41a8fda9fb6736735f7d8f8413f36841453e0d55167c3d6d1cf4005ee138\tBrBesughkBu484aeKdkDopKYdZbPpaHSwL\t6027136453\t60.271365",
-            "e4643405be5e563b7362fc3ae05170acbaab6ecf2cb15e774effa2b731275160\tBr56QJnuPktiz7oa2j7i3btytimNGDHCDf\t939024827\t9.390248",
-            "e477362c38483e56c50010704cacc598c12955040448e4c0e4ef0b4cc7908083\tBgraVYGpzj6xs4RhfqbZA5AQrjjnZBrpKQ\t11014823452\t110.148235",
-            "e477362c38483e56c50010704cacc598c12955040448e4c0e4ef0b4cc7908083\tBouEsBpGzsrm9qJZVyxVZ8PiG3c5Vjero2\t11014820602\t110.148206",
-            "e481d9d7107e572e01009d391cd81257801ef7726a63132b11e6bcab2d27752f\tBUh8yWMLcC38WzbvPCpQbnQyGnaaT2m4iQ\t9827696965\t98.276970",
-            "e4868c4a8f15f146d194c0a5982e5e13811eaeca7bb45ecd155051f12debffc2\tBYiPQCGmydzRPWkXtuiCr6xai1WsZWAPHG\t1566658406\t15.666584",
-            "e488ef830380131c28e3d36901fa11e25c9e867b7e2f14b848b36a6b9146843e\tBURsoiDRTTdwkQtba4Y4d9i7FJpWkmAjrp\t9712779530\t97.127795",
-            "e4949baefaf6a274db21d2b76cc82ee9285e53510454d6e33a2c8bec47cbf5e9\tBfWHNpZBcT3B5LmMEY63tH4RufUQQetvb8\t6638882561\t66.388826",
-            "e4acf1409e205f1d84b88c36b24fbc89204d01cde82b036d32f5e478432764b8\tBW4wMoRcxEB1178L4CEuovw1LMcDMUNrzb\t6250000000\t62.500000",
-            "e4acf1409e205f1d84b88c36b24fbc89204d01cde82b036d32f5e478432764b8\tBY4Dhr5mxj8bNwDDp5pUQwa7nB9t1kQCMY\t6249997053\t62.499971",
-            "e4b5e9fea7c687aa2d2d7d42c6e5319135feacfe3330d2b27c9b4edbc342e2cc\tBW8avZxDSfyctpvZRGX9yFDhPyRbB8MJ2z\t7147062391\t71.470624",
-            "e4fcaec983b2f8126bb71e817cad7be09cd93781570781ddd9128af3e5b6944a\tBrDBEVPYy7aGrU5CoiigR66euJ2GQTK8uZ\t6174975924\t61.749759",
-            "e503e287155214a845e6d4aec95c06f73c75177f579d3b2a6b2e2013c5f32174\tBWdVLc21GwWTLuLqAf43EX81YdbpMHgikB\t672207473\t6.722075",
-            "e503e287155214a845e6d4aec95c06f73c75177f579d3b2a6b2e2013c5f32174\tBbnUSw7gTM1xNFkVUDhU4RKUPgC6vUKMsA\t672207473\t6.722075",
-            "e503e287155214a845e6d4aec95c06f73c75177f579d3b2a6b2e2013c5f32174\tBczSV65pX67YcaEhpXBC3Ee4XscGFpwtBT\t672207473\t6.722075",
-            "e503e287155214a845e6d4aec95c06f73c75177f579d3b2a6b2e2013c5f32174\tBdGTxqFttFzP3XxnUQmGohdbiAbMm3JjYU\t672207473\t6.722075",
-            "e503e287155214a845e6d4aec95c06f73c75177f579d3b2a6b2e2013c5f32174\tBeWnNhjC95dChbeCWiu7cATKv8f3sUqkcw\t1000000000\t10.000000",
-            "e503e287155214a845e6d4aec95c06f73c75177f579d3b2a6b2e2013c5f32174\tBfAUCJ5CcAnvZb8Pz1EAHx2nCNMnK8wDLb\t672207473\t6.722075",
-            "e503e287155214a845e6d4aec95c06f73c75177f579d3b2a6b2e2013c5f32174\tBfSutg1SQ8Mzu6huwQJoYTWNfxdd7hMhMV\t672207473\t6.722075",
-            "e503e287155214a845e6d4aec95c06f73c75177f579d3b2a6b2e2013c5f32174\tBghTwtnYiEh28RRqV8hiTaiSEkw3WxaExe\t672207473\t6.722075",
-            "e503e287155214a845e6d4aec95c06f73c75177f579d3b2a6b2e2013c5f32174\tBiQkQ8nFchkxC7sobGQ6xjEfUDurf3NEFk\t602202939\t6.022029",
-            "e503e287155214a845e6d4aec95c06f73c75177f579d3b2a6b2e2013c5f32174\tBpyerdNin5NDAyHkBf2wqvxxX7oBxDxsK1\t672207473\t6.722075",
-            "e51fcf0d23c1a3cc4a5245b1c4a7f62c8dd10e97fae3deb02fde5cdf12fa1135\tBgY3Y6cCuChFY9b3viZAkXfpGkL9hb4XWn\t6403971215\t64.039712",
-            "e52d0b9d6029957409c97a84d9a311e50314165f98c3a8f8a2acbc90067d7a52\tBUY9MbNLxVnkSQVyr7cKbixKKMNS8FehwM\t5607805605\t56.078056",
-            "e52d0b9d6029957409c97a84d9a311e50314165f98c3a8f8a2acbc90067d7a52\tBZr7Rci2ctx8XXmmp73ySyQ446XCYVzkdn\t5607808596\t56.078086",
-            "e541a8a0de1d46fa604ced6ca49936b08cd2d952dbfc3a1f5178577c699b0075\tBk5Hxs2VxQAq7BvywRqvHwEZEd8AKeWLNV\t5911748369\t59.117484",
-            "e541a8a0de1d46fa604ced6ca49936b08cd2d952dbfc3a1f5178577c699b0075\tBqZjeMonCuY3foU8QV2QZvZcndGHEKGgid\t5911745378\t59.117454",
-            "e5850cebd6bcda74d35b9beee699f2739e14ff1a8be8b42744fc493493604fb9\tBohAwUekDardzUDCwBrr1Pks2JzjpXDia9\t1288883078\t12.888831",
-            "e5df6769828d081e4e16c8f8d4c29521310230832ff0960c45840b7ce8bd5617\tBf9MGXzehamze66SKCg31tLqpUv6CLgX3h\t5941920366\t59.419204",
-            "e61a3744d2451e0dccc2cc82b9731a49b2a41bc0e795cc9b1d58b04164f49567\tBdp1twj3tQ7J5vSjYMQBDT8wqBGgoDpJpM\t5911743445\t59.117434",
-            "e63dbd7565419f0dc24ce3bb78a28c443d59efc244a0f1e0393c419795b6cb20\tBdH99nS5d23rh7uWkG85Be3BAM4FhPEmf6\t4796300554\t47.963006",
-            "e63fd0edd2eec250d6f3ea530afd78922107b533c2c727abff074003d232a6e0\tBUeF6aF4hpkUYFgnaPpvmUZNYEzJSmnAHU\t5272206427\t52.722064",
-            "e645fb166614373ccc2206aa1da5216960d93aa4b3c7d055ae3bef203624bc7f\tBrfEbm9cHagCXfMhRhJdmVnWRZwDLd9MYp\t6249994574\t62.499946",
-            "e67252b208cfcd2f98133aef37a42eda81555601a1d52617545a218a21ea03c9\tBiUUka3ZRxgFZhgokzAknMnB75fMtXPBmH\t7499983982\t74.999840",
-            "e6a004f7f5273d4c54d45dce9f9f24b007b174a45483a0ec716f1736e7d7afdd\tBkKSrCG2HXhsar3kFQpFa4o79ecSCTiU2q\t909190292\t9.091903",
-            "e6bbe40cfb4d43163be0ba3b89bdf8543b685de4286c9d5db26fe98aca158e98\tBWmmtnbx8VhDrgg7xQCAh2FYD6TSr7vgTV\t1100397275\t11.003973",
-            "e6bbe40cfb4d43163be0ba3b89bdf8543b685de4286c9d5db26fe98aca158e98\tBZRmSJgBsjAwqsu57dtL7ksvJ9y72ai5dF\t1100397275\t11.003973",
-            "e6bbe40cfb4d43163be0ba3b89bdf8543b685de4286c9d5db26fe98aca158e98\tBahKqamB1Pfp7W9QiE9cFh1iKt7q5N8g1N\t1100397275\t11.003973",
-            "e6bbe40cfb4d43163be0ba3b89bdf8543b685de4286c9d5db26fe98aca158e98\tBdKoW8YqHBCSZzmfiq5Xy6FTWKt9KXzHWk\t1100397275\t11.003973",
-            "e6bbe40cfb4d43163be0ba3b89bdf8543b685de4286c9d5db26fe98aca158e98\tBhFMqKDYBKdRD8Dczud4toQVp5FNqkYPcB\t1100397275\t11.003973",
-            "e6bbe40cfb4d43163be0ba3b89bdf8543b685de4286c9d5db26fe98aca158e98\tBnWcZ1mP26kSB8x99hPAq31C42fQSNiFGJ\t1100397275\t11.003973",
-            "e6bbe40cfb4d43163be0ba3b89bdf8543b685de4286c9d5db26fe98aca158e98\tBnhu6Uu5obsYZtfiWtDzgD95YUmfEYX12z\t1000000000\t10.000000",
-            "e6bbe40cfb4d43163be0ba3b89bdf8543b685de4286c9d5db26fe98aca158e98\tBpdDxNrckgJruKXYpyMpykLrRVtgnGpKbe\t1030392263\t10.303923",
-            "e6bbe40cfb4d43163be0ba3b89bdf8543b685de4286c9d5db26fe98aca158e98\tBqUMWiSFhhPFEvmgbCC5GYTditSFvYk2FS\t1100397275\t11.003973",
-            "e6bbe40cfb4d43163be0ba3b89bdf8543b685de4286c9d5db26fe98aca158e98\tBrVQuZiU183LJox9bxZgs3imjPAVkXyaMY\t1100397275\t11.003973",
-            "e6e56ddc1e7085dd113403bbe7a369544b891f603aff7e90dde150879a5a7bd1\tBrNCUe76u4KGSuMHZzvj1nXDD6xXghw3jr\t5066374752\t50.663748",
-            "e7185262e6f9855becb3bc0d79695d03b2548c0ca6c48e1c00a08b5d9475fbe3\tBanct6KpJVu4ByQ6Kx22xY4DbD1QW8ZjY8\t7134338549\t71.343385",
-            "e7185262e6f9855becb3bc0d79695d03b2548c0ca6c48e1c00a08b5d9475fbe3\tBfvUobppFxAahqZ7tHta43Gzy2LCkfJkZX\t7134341540\t71.343415",
-            "e7422c50e99860739986134f973e404da2902b04f98484b0ed14442d599db7b8\tBrt1X6c1SFmCtDpdCTH4BqtMvCcAMvWHhz\t9401984113\t94.019841",
-            "e7675faa007092280448b5f415f0dc4a438d1cefed20cd793f2d92fb1794047e\tBfisyKCHQ8a8c4noGUrkJwrnFoLEjYQ7pk\t842296663\t8.422967",
-            "e77570e4bb2da469c41b00905b0695965c01531d9dcdb14bbe37322975c1b730\tBhH4GVUYScfe9gVpaZciieSYmCfceNGt7Q\t9401979623\t94.019796",
-            "e77b74726b9b5442b81b3b868bca369de0648485268c2434a66039a3ddffe636\tBYxnt6Zw24nQiZhYFAz5nPm1Sh4tQueeGE\t750295103\t7.502951",
-            "e77c6960aa66cff4b6250ace968b51bec33b1a4cf2ec49222834dc23526e0808\tBrGaq4E5yGFbkTSzNC2QAWKU8XcZSPvacP\t6864567881\t68.645679",
-            "e789ea55e77ff03d996db962c7272313c7c76a7343582f9a89a10f8aa8b2601f\tBTwANtGxBg5J667cxsYobwre39brGxSRmy\t1936938507\t19.369385",
-            "e7b3d5992232acfbc9536d3eac4781ed07a2491ba1e1af86a0fa0a2f0a4823de\tBa5upoFg1v55tmnnrbHgXJbcMyCHc8PUFt\t5401782456\t54.017825",
-            "e7b61ead219bedbf3562607c15e214053351aca3b20f2ad0029b73fa407c2dd8\tBdRVPYSfi4DgomuXd2CpQgGAhzRn7VqTr3\t524705884619\t5247.058846",
-            "e7b682564a314931a0af1e2c00739bd51b8ca00daea0b015c76c68a7ddd08c30\tBWB61X6bxCR6oBfCRxJwicSC1F7Ad6oad1\t5401783209\t54.017832",
-            "e7fbef7a01743c2fd1139aa5657aeac3883c714f436e8b51acc2f24f3315c5c8\tBjzv4R23uJHfmrrYvBArcCTcKPGcXPEFST\t8749996950\t87.499970",
-            "e8081882b62ecc09e43a3340bb213517354932de79f419d85c4b1f4579cf0b87\tBbhA4z4FF3Yx12hJwi4qWQ6sQ5R6PLrxtK\t1383775578\t13.837756",
-            "e80eaf3b720f5995e1cace89da21f2265b204042ae53441e80a86d7f7a45704b\tBjJbCDHMVY626gJnGDW7QUJDExmsRLUPtH\t7499985620\t74.999856",
-            "e8d3b70daa7ecebb94106722484d30ceb3e202a29b005b212fe6026554f2347f\tBZcW64prUP9Ys3oiTwCSLu4eWYbNMaTzNk\t5455544131\t54.555441",
-            "e9206c697ea66d2873d1a1045e948f29fac1c5f6f49a2e8389544dea900aa0aa\tBrMfBpEM8dYwdR2VDuVHnYTREstrEGw6gq\t541544598\t5.415446",
-            "e924122c68178bdb45873eae1641d7df68a7f76d97673d7a122d99bca221c630\tBUHGqkQHVVgA9W3yjrP7ETZQkzTVP3Y3ZV\t764556266\t7.645563",
-            "e93795da39fc6030b772a7f8a35c24782fb081a32b59c6cdda40d0af5f3bf5b4\tBUg1EajeRaeeUAdqsDFkjVaJYkW95HTAUN\t598858339\t5.988583",
-            "e990fb183aacd9986fecbeacf69d26942d8fbf56d4d19d02d2e45b19a89227af\tBecYS5kgnF49d3LkPdX7GBoUQzTVv5z8qk\t6295110610\t62.951106",
-            "e9efda078c94b133a76d046ba3d78923ceaa2222d911aeeb0b96b67e70bb1686\tBgx5pQybyeKc4owLuhNnm3dSNJQ7iuyuUD\t632025091\t6.320251",
-            "ea220efddfb3be110fffba43a5e4a6e6ef1bace21c062e788fb111d088baa5d8\tBW7w3jYi6UXhbroC2n4UrtJ4bRz9ZXLq84\t999989261\t9.999893",
-            "ea304cf7903a15890d4281a1efef342dc43f8ace01e9d177818a7057874d80cf\tBgx1joFbgQarQXfqEu3BnCpUmUPPLXkArA\t6289747186\t62.897472",
-            "ea389c22932a00b2ce214d819afeebf64a0be19279d81ba4974e4f3840bf1b90\tBcgPJtmkoFeBAbTzx22Yx9js498oYm9qYw\t699991693\t6.999917",
-            "ea3ebd4aa8deea6c3cb3bb27c53e5d14db17f355eb18d28cd06c66e4881d92a9\tBYEHgN5AXL4xLSxR5Cp1GQ9a4PXbp4o7fi\t500100955914\t5001.009559",
-            "ea5569c4fa4f135127898f998c07bd1c58ea72f654ad20138fa7c7dd2cefcb78\tBdqxDE8pjrK832KS5aKuKxZ3cAzx5whLCQ\t500198880961\t5001.988810",
-            "ea9e6b20e856d0344bcd665033d08886a4eaa2e4d3f5dfefc814d48ce8f61ab7\tBWRY2g2yPMtmxgP7bC97zUoGfaRpXBRpra\t6249989075\t62.499891",
-            "eac74eb56427b02ec40c702db17d10fee3e356741d021041ea3507580764d4e3\tBjMewuUPV5FijH7D5dpPXDLtAAy1LRMXPP\t1220426879\t12.204269",
-            "eaceb1057902249afefe1f3a617696a2403f5567da956ddf256617d36bd6943b\tBbresFeG194D4B74MShq9M4riUUzr7YXMj\t764547742\t7.645477",
-            "eae1b3c52ee2ae5436b622b5ee7302d3ff580f35af9d44e1e7247623c63acb95\tBpPzdxp1VFJLB4rYdR9jwjN4JyLHoVHxjk\t462928410\t4.629284",
-            "eb011a0d8ddfdc3139065c7cc90c7531775f5b6a4bbe2ed36bf6b0b739f75931\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t99998884\t0.999989",
-            "eb0ae0150e0e027259f512509ab00dc9bc3ad0f0cd137636ec6c98321952f80f\tBmo1dZriv6nRDa8ji9c7bNBf8YPvuMX7LW\t6264054144\t62.640541",
-            "eb1dbf52868752d9a01e79cb9e75fbc2238e5e21808f93de379b7b36d9e2d248\tBYAVKhJ65Pydatj9rB62t7v7nxVdAmpiDA\t472620808\t4.726208",
-            "eb262c4a6ad88bf0f61180ab953772d075dcf3f5a1614905f3e0c19a81236f11\tBV5QGjNANsrfJYFrqUTiLUq3tc2AXAEoWg\t680293531\t6.802935",
-            "eb262c4a6ad88bf0f61180ab953772d075dcf3f5a1614905f3e0c19a81236f11\tBVJ655hafXwZaF1u98fxJ4NSjHBYB748Ji\t1000000000\t10.000000",
-            "eb262c4a6ad88bf0f61180ab953772d075dcf3f5a1614905f3e0c19a81236f11\tBezRjGmGcbRVg3FLk6YwfE9djbLghKScuA\t750297787\t7.502978",
-            "eb262c4a6ad88bf0f61180ab953772d075dcf3f5a1614905f3e0c19a81236f11\tBfy9D8gnPfiBuw4YWVAAEZJAV12QiHMwZi\t750297786\t7.502978",
-            "eb262c4a6ad88bf0f61180ab953772d075dcf3f5a1614905f3e0c19a81236f11\tBhjipHMWRvFdtd5MyyDVVVQTMp1BW1UPiV\t750297787\t7.502978",
-            "eb262c4a6ad88bf0f61180ab953772d075dcf3f5a1614905f3e0c19a81236f11\tBjmjkdkaq37i1xakF2oydoEqoXdf7ydCTc\t750297787\t7.502978",
-            "eb262c4a6ad88bf0f61180ab953772d075dcf3f5a1614905f3e0c19a81236f11\tBo2URGyEfw7buFyrvjcpGGjNxhyiXFEYwQ\t750297787\t7.502978",
-            "eb262c4a6ad88bf0f61180ab953772d075dcf3f5a1614905f3e0c19a81236f11\tBpoyRHzM5GdCeWJgGSXzr81kcHwRumeDfu\t750297787\t7.502978",
-            "eb262c4a6ad88bf0f61180ab953772d075dcf3f5a1614905f3e0c19a81236f11\tBq6YvHjqp494NhjoWN9iGJqKkqmDK8a3KM\t750297787\t7.502978",
-            "eb262c4a6ad88bf0f61180ab953772d075dcf3f5a1614905f3e0c19a81236f11\tBrqcS81KQmdzyBwD2cVKgywoviNpMUb93M\t750297787\t7.502978",
-            "eb3836c327e437ac2cedf879c0e774299c6de44a6fae7c1b67cbde803f53f51a\tBbPc8AHGizSHQC4D5tw1YzZ82kG5jSVGQd\t462928410\t4.629284",
-            "eb483c20f66a51532e2b6c9e7dea44ed5598e8daf3a9f9a158bf517a6035927c\tBUer1JXwZogKpmxEyjYxUjFiBnGqwnydWP\t6083337468\t60.833375",
-            "eb517ab708e9b723219931b46c2e61b236dacea3d5dc7683eca8a4412b2df6fb\tBo8o4TakpeE1EYLDZnFdzPoBHvVMQhBC2p\t2058644926\t20.586449",
-            "eb7027f713bdf9ab2180bff5b44889807560164245522b0ebc29ea0f888d1595\tBjYQfqMccfgLgkqHujsXGvx38YK7HtkWwp\t764547742\t7.645477",
-            "eb8fc5ff938fd67efdb9a58f78daf929792f972dd13408e130a45e619654dd7c\tBUJM82a9DDaHMXEsgYNUWzFKWQ7RCKuf1c\t9827689368\t98.276894",
-            "eba2c7c4800a83e238545e1c9a8fd6685620be864f366ba6245fbab0b27d687d\tBkFj9G4xfnuQayavMjvXs9KbJUcmXnvmPY\t6027136441\t60.271364",
-            "ebbfbeaf84a4e0fa76fa19338a5f39f5166a0acd89ebbfba74f1892888e55fd1\tBW3PUp5UED99CVJp3sJjaBz3ZPHK37bvyb\t529441402\t5.294414",
-            "ebcd62d10d77b874cef64fdffd1af6f9ced27d24d69a1f17dbec20984bda9f46\tBWM193LqNcwTHV6eufEbNAgYzn7Fj4Jcur\t882552330\t8.825523",
-            "ebf05ea86f725bbf5082468eb3ca8114dba7fbcd90c61b0e991248e9b0b824dd\tBewHiuXRDGJDu4MW7nHSWzS5dWH9w81i4Y\t474418529\t4.744185",
-            "ec08c1c9f41b6434ab5657e19543a2f00afb6d1fce62c11f6065f5acd8a6b692\tBqWFbqKmy1wqSNzcoEydGeWceG4bn4dbJb\t1294047565\t12.940476",
-            "ec1b0519c78d9857af2ec7b1e6919e048a49050bc5cf42113691b90f38b76886\tBj9YVsUypM2yyPXhPCRiTbQzDwAU5bfVf9\t575923835\t5.759238",
-            "ec24a674215a75ec8cc7befc436ff24c454db907b62128e8b5846407c5ca4397\tBWxiDFMw2TnBGsJKpq2Nm5T5zqxmgwysHi\t764542062\t7.645421",
-            "ec28d4229f654f7f9a7f127047758de57ce5a4ca627c52afe1b3d32008e17b18\tBiv7dQuwWY86vtDef2Ft7E8ZnCYJQtwMKi\t6119415671\t61.194157",
-            "ec3aa7d2762722f20a60c7d813c4a30be120c914985eb05aebe34e62444a29b1\tBYvc9yeP9PW3uZ2EUKMdv9z82hgkGpVkky\t999997981\t9.999980",
-            "ec438ac59fab6f6a83d9ddfc5f80b45177d6e726d7ab4860e61c8291b2107414\tBcWaR6gndqURGTkkfy2XEUzt4Nc1SdRDPo\t199996694\t1.999967",
-            "ec4bbb9721c80e8bab929972751c5ce81658ba88426b801ed33c905bc19e553d\tBrWFJ67TNY8qQXHexUpGW9q2Qv55qgJpEK\t562014096\t5.620141",
-            "ec59b91023ba799da7571ae1a9f53bb53de676d4ef2fbb866a55fdda38d6bf49\tBnVtKBjLimmqZUFkeRcAivKo9HefvdwWLR\t6864561626\t68.645616",
-            "ec695c87d0c05a94f09b1bb5c0a6c5f3084b47cff5fec1ac43e4adb005e22d71\tBXw3Mnudz4yhrr3yUtKYuyAd2M1jzYjomC\t5401789643\t54.017896",
-            "ec695c87d0c05a94f09b1bb5c0a6c5f3084b47cff5fec1ac43e4adb005e22d71\tBao4Cv7Msxgo9VofA1YFGSTnC7KEH2Ygxe\t5401786793\t54.017868",
-            "ec8ef1513d05bd55f52be0a0cf4a9e1ccfbe55d3005049caa7b89b23c447c788\tBnxZzxSbNLfVDsVsUsXhasVzEKowZPdfDP\t9999980746\t99.999807",
-            "ecd83058d0ed7d067b9fa0486c3f42f31ad624dd78b9662cfb1732c59d0ebb57\tBs3PdDGfjGKQZD5r1a8UQ9hm6x98H7RQwr\t9708311852\t97.083119",
-            "ecea79cce5cfcf3452a8fbe78f18ee0e8198ec20f4f262aed7ca9309bb0d7d1a\tBpzPFJaaKQVSvfiH7zXSUdPBrBnfx9v26V\t872400000\t8.724000",
-            "ecef24d9ff684a3842b3c6875f9b921d77a51fcff63859abd456056ba6b054a1\tBkFtsCgUoLePUEiajKx5zQnsZsqAQdtocV\t1100394801\t11.003948",
-            "ecff050a1c2df5bce5a1b99b0a4406e0d2e0feab14e059b03dd3656980320430\tBeaGq4LFXeqChGouS8yfh9t1NXw7HpnRcC\t5607806170\t56.078062",
-            "ed09c097ccc4fd9e6ddc232ae020ec57ee504ffe549a2f7769b0d5c498248524\tBdP2NdkYCdeJji2cmaF8XRYdGJCT2kj92A\t6119411607\t61.194116",
-            "ed0c13f03f4daa6deabc8615dabab44deba244c41f8b12f63992748c658a045a\tBgzhFFAt8Jg3B3kyJ66MqvsEfxM2ZKdfAx\t976770025\t9.767700",
-            "ed218da8f8ded13cd224d7ecfd3fe16f9de6c6a58653ff2490215a993fc51ecc\tBZgdhzrw5gkQAna2KF4yWfGWECHUr7YfJF\t848468655\t8.484687",
-            "ed2c3c9c06c64c7e8ba3373e896ddcc35cfa67d459a07f276074e09b9a2da798\tBi1iYXUkb8kN3uryUVQdNbaF8DUstN5vNs\t632025091\t6.320251",
-            "ed43045353d4a8d616b76d991f63d881f58acf6b3cf5056436eca1496cbb3b2b\tBfvDEJod5Vj1FzvQRGqkYTKUjypcXV6BCW\t1150419432\t11.504194",
-            "ed609d3282330a9f52ee5db5dead440d4756f6d2a013e138a1b2b7c9a9a666a9\tBm7wyKpzfAQxyPDW81E9JSCVjN98YsHFu3\t764544921\t7.645449",
-            "ed740a05a5bce5151f91fe65d8fb40169bc4431f66a509ad3aaaf1b050565c5b\tBUM2Qr3A6c5sih3buDSC7suFCHtp5ozW7F\t7132213945\t71.322139",
-            "ed8a4f349cf874249223da912f1d257cfd7a18304e0abbff3d86eda4ad0e26d4\tBXyBjrnzzjoQdrHdEbg2ed63wYMjUjy8Pa\t9712775076\t97.127751",
-            "eda6cacb351e3c68bf51266765176e47d90da2ce28946ba7d3be71f988f6879b\tBZAcsiiXcLbKdYoLZf1spQrKeFUokPms1A\t6100232069\t61.002321",
-            "edb57b9ac41891b1be2d58ffd3463296473c08cbbb21a048c3bf92b7ca7e71e1\tBUkqQBuBoXsKeYWbhfE8eTtr23qGgdBgpv\t9713951311\t97.139513",
-            "edd5c869d6370c8f0bd409465d59cd4b2ea471a8e517aa796511ea93edb1902f\tBkvesxywF7DMBwFrd48fsXovS1e6B2jXsS\t512036158\t5.120362",
-            "eddd754206951c02402317ded11ba3ef0a66695b243773455ebe735667147b2e\tBqCsTamCTQLZZQT1uj452HYn7gC8v8mDzE\t999997582\t9.999976",
-            "edea957b5bd07eb12d95519f5266f71062bb27cbcef3fdd5c4ab67db39e3cb17\tBUTpghQ51Q3nW2bKoeUtjBFxb7SgEjjRGp\t1566653064\t15.666531",
-            "ee029bbbd90e12ac8a98f320db404b05c6bfe1a464cf390e339708da482817c5\tBayej8mWrTmfHLPSFRzfeXUvNRc2U9fm5y\t500130890246\t5001.308902",
-            "ee12f1e52a9ccc510d8ed22cabec0234f7d6cc19c45a0a4b0bec99f595d389da\tBYFzfcuM2cZrP9iU3SaDmAA73xJzmUwBvs\t7759966099\t77.599661",
-            "ee171cd927833890b1e787ccb0e3fd2b8b881f8976e206edd1c463782fc3042e\tBnxmRQLjophSZb36wfKMg8azJU3aLskTpt\t632025079\t6.320251",
-            "ee292bb9b466eb45a042144d40023093ac7cdfae6fd6a5d7184e9a780f1ef77b\tBpSC2NPEgrPy5PiTbGFi6iXmHKYgNXVeEF\t5719429225\t57.194292",
-            "ee2a8433e623774ef5f8acabbe95f96bd4d476b3550c563b3892a0f0e8256eed\tBba5T9tZC41EjgHjWLV2dVXAfXyfZYfSd3\t689413580\t6.894136",
-            "ee2a8433e623774ef5f8acabbe95f96bd4d476b3550c563b3892a0f0e8256eed\tBcCtaBaJWa594GcrLnRY2ehGmZp6WqWqz8\t619408570\t6.194086",
-            "ee2a8433e623774ef5f8acabbe95f96bd4d476b3550c563b3892a0f0e8256eed\tBgfazB1d5cbGkLSoPhbgwEnqkhxyxtSW1F\t689413580\t6.894136",
-            "ee2a8433e623774ef5f8acabbe95f96bd4d476b3550c563b3892a0f0e8256eed\tBmF27t4ZJCRxw5jQhZLpN1zLRrJMZD7xoy\t1000000000\t10.000000",
-            "ee2a8433e623774ef5f8acabbe95f96bd4d476b3550c563b3892a0f0e8256eed\tBmhH6wNG6BYGwj555NYV5boGuw5K3vSP8F\t689413580\t6.894136",
-            "ee2a8433e623774ef5f8acabbe95f96bd4d476b3550c563b3892a0f0e8256eed\tBnVyehwpRy6mZLXTgcD3CQ4JzNB2Ene1YU\t689413580\t6.894136",
-            "ee2a8433e623774ef5f8acabbe95f96bd4d476b3550c563b3892a0f0e8256eed\tBnbZfDT3NTpQVU2X8ho5YPKWYu2DbxNyhc\t689413580\t6.894136",
-            "ee2a8433e623774ef5f8acabbe95f96bd4d476b3550c563b3892a0f0e8256eed\tBnhRB3rMYyPc1QCfxt7zUa7uFkGFgZcX3F\t689413580\t6.894136",
-            "ee2a8433e623774ef5f8acabbe95f96bd4d476b3550c563b3892a0f0e8256eed\tBpSaHUFnbaQ7tie16h9zB6mPjGH61Hd3wi\t689413580\t6.894136",
-            "ee2a8433e623774ef5f8acabbe95f96bd4d476b3550c563b3892a0f0e8256eed\tBphJS32ENASrcEBughqacf3rZBsVDw7Yzk\t689413580\t6.894136",
-            "ee2bc6a9c096867447641318c7396bd6c13d3526fe67f02d5f2d1c820671ad31\tBo9KWu1JE5V6eMWrEived1YvwFD6kL5Anz\t7641208353\t76.412084",
-            "ee2bc6a9c096867447641318c7396bd6c13d3526fe67f02d5f2d1c820671ad31\tBqfTucjutp8SiB6NtRBaPb2SANJiRhw7tH\t7641205490\t76.412055",
-            "ee4a20955c37f00f40cf8a7b636f51174bda7d3973c04541e5922b298b352d6e\tBdoe8414McGyQ8uUGqWymVHwVd5BScnzDX\t999997969\t9.999980",
-            "ee628288f6023e0f59ca66499862fca30e686923942d1c3847685c1959188d5b\tBfXUwceRC1tFRoT65oPQajCiwTpwWv1nTN\t762216207\t7.622162",
-            "ee6944ed3d8c591d57f136dfa5c513442586fc3dc0d8de0bb3e3b811baba8640\tBnTuPjrRn8VC5Y5uzwWc1CeNbKqwbMM5FA\t6249991106\t62.499911",
-            "ee73fa7bb6a7940fd78bf673cfe42e9706b008a809b0a16172b9841f8f36de4b\tBmCUgrV6vhEfi1Vp4DAiAEApoXkhzxchGK\t6100233447\t61.002334",
-            "ee79ca1755165f309b6fff165020e5becdc96f9fc8c324888d323bd414050118\tBVGsSkSK6mjMh2HgyxJsJZ68JhgHPsP315\t5401784654\t54.017847",
-            "ee8e77791c44d66d3f8122246c8eae7cc29b2a79665702374151a12a9e62d033\tBUS1zeHA7QvtoukvbpmsdPYjpfjutmQ9zb\t524805967373\t5248.059674",
-            "ee9cdbf1eb1afd22792fbe364592b3546cbebf6d9563e9e60731930fa550f287\tBojYyMPwqbLQXX1eADuVHToVGwrbBB2GZy\t6864562488\t68.645625",
-            "eeb446103d17555c9d0b0c072f13c83fc77928fffc961e2778d68739e0533fe2\tBbZfa33JdmypYZrGtbhvsFSNfW8DF5Zj3e\t6040062042\t60.400620",
-            "eebc534e5a61d977388f480291fa4e4edbe13533bea9b143d1aae5b9f80dc8d9\tBebqDskQH7BKjwxqJreqqkxVxay59FFMWg\t999992482\t9.999925",
-            "eedb3309acb5159eb76d0f2a51ac1dd419e9d6a635d53bf5276fe9b3fddec1a3\tBivBsgjp7jZdL3xgxgnbGMb9fCTfmftT4L\t99998636\t0.999986",
-            "eee5f3f541ff01bff0079427b2bbd7f7d3dc4f0cfaef67e60e4940ec7c20d2b6\tBpUckRZQkzYN5mmU7mczYuuyhW8dqRnK32\t9358619914\t93.586199",
-            "ef0b0bbf1f6d81a3e252f1bed25e70a19c60c7d6899bf0a3dd2174612ae783fa\tBWTP8bvizoy6yyT7qF6PtGc9B3iuvua8Vg\t6249996590\t62.499966",
-            "ef0b0bbf1f6d81a3e252f1bed25e70a19c60c7d6899bf0a3dd2174612ae783fa\tBaEVykkjtLWnwJxzASgGLcHVfocZwNaU3b\t6249999592\t62.499996",
-            "ef5759c5b45c0c6951cbd60f3213a3aa6bd6870c79c3738486f2c123fe866213\tBphV2yXucqMQZ6ubLdfEnU8Zy4GCxbSiNW\t9432759393\t94.327594",
-            "ef5b22cc68ec820a3fd28295691d6e0fba539f55596c633a7e00e48d0d151d0d\tBZ8irNfgQcMo1ycSb9B4YdNZa6kSmZTRrL\t5508345421\t55.083454",
-            "ef6e32f7f84405009400fea14af0c2115058e4db194407f606167e77ebad600f\tBhuBXEccXby2qSgnhzm71rVf958keNiToC\t500040952643\t5000.409526",
-            "ef7392c73e86d3121a947c145b99c5c29b5121cb6efbd293166f96c278f1c35e\tBWfdeqWNnbTYfnyU2KCNU6u1NF9vsZbGSK\t5508344611\t55.083446",
-            "ef813519eedacbee23de3b5f5e055cd57bd3619f4c7785105ec842f92e7f570a\tBXMd1t7VqS35N3oWeKK8NPXsTnuAzT22zi\t2058642492\t20.586425",
-            "efa05ae3acc374223cafc65630e6f0596d5754379895b569a8960a9985aebe4a\tBkFgXjH8Pc6MzV5rtcn54hrJpGHruwnikX\t500108942589\t5001.089426",
-            "efff9743872b5556e96a07fc8e679d7659f90c6dc9a42895a09547a7c89075f8\tBdsaQA7zw2hA945Af3iDDgu3UaGXPobkWk\t500070945588\t5000.709456",
-            "f00ba1f26b6ca9a261d6c0c3e1b982381ac1c33f25a554c08d76ed07d06f819b\tBUDLoFW4nfVH7ypyqobSETMGrJWKUoWVJo\t999997751\t9.999978",
-            "f01e6e4a3586c1fc2f22d85650c78498e2e123c9e8965e0f56af42080904d0a7\tBnNdqGDsKB6Le1sCgd15aGv18nPospBRY3\t575923835\t5.759238",
-            "f02aef021c49c0dda222b09911995cec06a76330f75e2b3f8cd025bf354b826d\tBUuT1ivWfWv6s5aF7vfp86iXKAUrTaTgHb\t4796303323\t47.963033",
-            "f03c582b64c364a386e20af4c8b8ab64515a3edcb1e7e789436aa8cfd036949e\tBU4gPfdM3q4WKdmBcnxG2SfVc8BoTzmDq4\t6082731627\t60.827316",
-            "f03c582b64c364a386e20af4c8b8ab64515a3edcb1e7e789436aa8cfd036949e\tBp3y8e9y9jCiJUKRDxNtaCwA3cxryx7hbb\t6082734629\t60.827346",
-            "f04c00724ad487787ca65a28b55d9a129fecb1fc25bfd5a137f8f14e23cbe543\tBdzG4ipZCcAeWBvikyCZCiG639TYytCKHt\t5169793565\t51.697936",
-            "f05630b2f6f93002e59ba30b9fbad105e99cc1bf07caa3effc502ad1f0b52d2b\tBkVzQGWKaKVV8pHz9ppLDwfCW7Sq5NLW5u\t750295092\t7.502951",
-            "f080047d324e5162212db88b083798ffd0d10507633920021c7379ac7002d423\tBY1Xp82zJciv4hdzmYV2JS1pdfzPnDJp4B\t979193318\t9.791933",
-            "f081b22e62a947fc91b56127c5a1274f0d344b0f0f5bcb08fd71ec528a9201d3\tBWAc9WAT7Te7kKxLCaoX624RtzPrQNDEEb\t6137491276\t61.374913",
-            "f09ce4d36f6cca4f7905d733e2b2a14e541f196ba236d224baca0d7a86d0f1a6\tBpBFryjnFVVc26yXVvoKNAT8CCkrWwvRVJ\t999994955\t9.999950",
-            "f0a0c1a96aa665006f228622c54c013f260a63098fcec24897bb497ae6afc3f5\tBcLMRhfAR4athHtDqxzGcdee1AaU9Ct5zX\t594441574\t5.944416",
-            "f0a94bf1648fe67f59dc09f1beb9a789d0a964d51fbfae25f83c102b51ede82c\tBpkfyEGAjmPu2Y5w6uPVb1afyqhWRGZkGe\t5012488955\t50.124890",
-            "f0b777ab3cb24cc62b27bce82c2356b0b8ecbf713640cd6e96124773fd70da70\tBWwWT665cnCk4bZBMpSgGPzYHyuhYRDYUd\t579999152\t5.799992",
-            "f0b777ab3cb24cc62b27bce82c2356b0b8ecbf713640cd6e96124773fd70da70\tBYnPm4D4GSxdeESHkJg2hKKV6h1Jz1ZwVd\t579999152\t5.799992",
-            "f0b777ab3cb24cc62b27bce82c2356b0b8ecbf713640cd6e96124773fd70da70\tBZCW4aR216vSSa4nEVXj7RTkgnMkc54ewu\t579999151\t5.799992",
-            "f0b777ab3cb24cc62b27bce82c2356b0b8ecbf713640cd6e96124773fd70da70\tBcKHHYe5jRY3moDQTGvU1mR2r4qcsWdY2P\t509994148\t5.099941",
-            "f0b777ab3cb24cc62b27bce82c2356b0b8ecbf713640cd6e96124773fd70da70\tBcvA2a8zgVgHLwEpDBwwkESLjs94RVUHoH\t579999152\t5.799992",
-            "f0b777ab3cb24cc62b27bce82c2356b0b8ecbf713640cd6e96124773fd70da70\tBekCC3GC4XgtBcni2Sr8gKYtgbyoyZo3kV\t579999152\t5.799992",
-            "f0b777ab3cb24cc62b27bce82c2356b0b8ecbf713640cd6e96124773fd70da70\tBfCjXFXhZhoRb1QK4uGcGJT9dnAMt9Swid\t579999152\t5.799992",
-            "f0b777ab3cb24cc62b27bce82c2356b0b8ecbf713640cd6e96124773fd70da70\tBibuV33gsaH4LN1ACMdFBX9J51ercphfYf\t579999152\t5.799992",
-            "f0b777ab3cb24cc62b27bce82c2356b0b8ecbf713640cd6e96124773fd70da70\tBmQWroFSxe2iSgoTGLgLgn3Y2WvqkTU5v5\t579999152\t5.799992",
-            "f0b777ab3cb24cc62b27bce82c2356b0b8ecbf713640cd6e96124773fd70da70\tBrk9ssCVcPhe92Y2XbiyyQYb7xj2qnU8au\t999999999\t10.000000",
-            "f0d1f956d313e2478f5cfbb11a08ec2aa84eb1360985601da5854e867b8fe77b\tBc7jHyNRbGrYq8djWR6bGqxJW95cNE38Ua\t8088657739\t80.886577",
-            "f143f22e33b438abdabedad4f235a0ea3ed4710fcc939bee10c3ef7b71c5ddd1\tBcZ4wXFnHmoq4w8wT9SfDWo9RUzXWtQbQW\t432920130\t4.329201",
-            "f1539a9a1bf5774a3799f6fdf0402512587da51e27989ad66b7b7b424de9f9c6\tBnuYjastmVqzsuzDAJjTM5r4K6jSkHo1Km\t6249993034\t62.499930",
-            "f1680356d41ef568fd8e0b8edc1c3eda9d1bbee0c3b16ccb248b5345543681ad\tBqgrzvuaeuB9fjTmpNfCGeZaU7jMzEVQHP\t999997969\t9.999980",
-            "f172b462446b07c6f867c4e51fce1b0b480ec5f98fa4a733272914fbafbf0bb9\tBo9qp8imE6ogFLh5pbaL1hBYC7B1B6aYze\t7147060444\t71.470604",
-            "f1c4fa7fbda304ff75b57bae85adbda07fd2778561ab12fda5bab15cbb440afa\tBouG1Zo2nzxdAaja7MveCFLNJYej24rmW2\t7269247053\t72.692471",
-            "f20764d17b46eeef2d10eb3c6c726b1e6a3b65aa4f20e5b017eef7ee5fb9c1fe\tBq313ThavRw7xGrhi84iDS2PXp6LNKbke3\t5066376400\t50.663764",
-            "f21df9394fef86f7b8fd4f36cf93454e232f1d04f9eb3f6392ba4af6ef8349ef\tBp5c1Buedu6Vik4MncTdtAiwxcjkmd9YFP\t999997981\t9.999980",
-            "f235f0bbe935108813feabe0c048ed4eecbca7ffe37b67e7461f0a4394cfeb52\tBnpoieNV1dGQASCXz1gcoDUbyNCafDPEVK\t979193317\t9.791933",
-            "f237f1df83e31c2a23eeb9aab61f9e3e99d26466a5799b2b194006705a4e23d3\tBVuqUTdydFGeyZbKpyeFdaFeFyMTeS8yec\t524437321\t5.244373",
-            "f27d24d4a2b44102e8239ef5ec86887029ca7b0a2d907015b4ae1d1ce42a7032\tBie7hSakewQe157Exgbr14C1TEPeoZkHDa\t999986826\t9.999868",
-            "f28ec37cbff2adbe17433f89f1cf933e33d1b4228a6d92139990334ee31838c9\tBif4ZRP8mBxwUJGHKcLB4fLv5NTwErcYqQ\t575923835\t5.759238",
-            "f292b72a4460dd315baf5227d001819dafcc70dc78f3678b3ba48081ae809f52\tBkG48cA1MH7CbBs6UhrHPaZr3Jbh7eYUUu\t3358224725\t33.582247",
-            "f2c621253f41c649a41750cb70b49dc11808be8b9041286f60971aa860ad4ce1\tBeEx2RomTjpqpBLdVFcpEZCCtHUiUii3tC\t6100230039\t61.002300",
-            "f2e088f8d9a3223e213055a258a10f16b1b9cd1f141ae3be45f1f37f564f602f\tBhUAxkYrDEZ3s1P6d31V37w557eE8kCnms\t4796297607\t47.962976",
-            "f30ac1d7fb3b0b79ce9a3ad4c86d0359dc5c1332cb34829c1bed8ff9b914a8e1\tBnyRigDRRNbJ8HL7gyqTBiiusHvvtRquCS\t1288880207\t12.888802",
-            "f323683f7eb3b3691978715d00d3dc8ec62e6826c771155fe34b6ba6a40c3131\tBmyp4NMgoT5XRMjrnQRhkAEFx8hPi284g7\t8480680096\t84.806801",
-            "f33cf52142735b551e45a2d0a8a15c3a047640db1a053b38267ae00d1df11e61\tBkfY8ZmU6rt1oPzuXauB3MbZZPptMuwiba\t918470697\t9.184707",
-            "f34d4a9d75a63b8083b7ace8c28a3b6bcbe36e7fff22b360536b79305f4b900a\tBfD1jfpchGB27bCZTjnWiyYeReDKikR5cZ\t6249979734\t62.499797",
-            "f34e61c16cc648de5a9db668b653324f6bb64bbb081c433019aeb923b39cf56b\tBXTGUBeVJassBs6y6BzpGcLEfPDVJMahJH\t462928398\t4.629284",
-            "f35801d229b31c0f97e44ac5c410f6a64bfd4243ce29466fc8a6147586148efc\tBVXknk7boVDGEmESzt5HzGJ4FwhgTT55Ws\t632019077\t6.320191",
-            "f3868b0fefa0383c8dd6e4f3a6e40208d8f8b0929202361f97bedfa5c32f6c35\tBgkXY7TDnh7oMuzDFLNuB6M9RwzBVyZRZi\t632021518\t6.320215",
-            "f389efdf615ac5e7c059b9cec11f0b0f777e36083bf2dc8bba040b35b2e5ebdc\tBcTrxvGr4Gowa9NDr4D4dNWpPRn5z8nGFM\t500138970614\t5001.389706",
-            "f399868fabc11a114c38dd0a61ca32714afeeec910895fa123a92208d6d88ef5\tBgrZAwvfDDmP7hD1P9Nj8iAaq6XpTeYwDG\t22029648524\t220.296485",
-            "f399868fabc11a114c38dd0a61ca32714afeeec910895fa123a92208d6d88ef5\tBpQVDGJyTEKXLrh8XDFPNJS4fYFrGztJnN\t22029651526\t220.296515",
-            "f3a486e8744a416cbbca76ff0d23f0bda97cac68623e6cc7320b92d38b50e56e\tBTqoNskA3AE83ECvZSFkPzdtbDMdNqaGfq\t5066381671\t50.663817",
-            "f3c415d0fb2d0298c631f361b176020a900ab48a8068e5cbd2b78e0ea09200e0\tBXHzjt1syAibqMy1aEdXVy8cML2U6SpsYW\t1866939191\t18.669392",
-            "f3c431166070f578e52ff9e413fbb6a26cc5635efcc5dca6b927a2f6f8731b4c\tBs8BuSc2WKsyPCdyvjYmM7xtiDDJH6Fqa3\t5707477625\t57.074776",
-            "f3e923ff22382804273c0c2ce669d90053280da9cf06e66ac3e99a83c51ccd82\tBbf1zu7MvxHJZLgEo7H1ASiBYtgdC9myRu\t8480686807\t84.806868",
-            "f3f1d56302b3b2b8c9e4c3c55a6f2f53cceddb1285d7c704ef077a6d28bebaa3\tBiw1riBAJ3cyQLRbtKgBhUq8u32nrtUGpU\t6289744328\t62.897443",
-            "f3fe8eac60a36b3804cfb7a15f5791f0eef6e3418409ba116d6cbeac7bcf972c\tBa4aLfnvVA4xEaNiGdhHtNokMXpXFBmbyQ\t524437648\t5.244376",
-            "f402f21f0421c65bcb03581b91dfaf1e1cba7d099747b8864345d2f5ba0aac53\tBjDYNWvmR7nYxub8MaCebjz1yTFFjad577\t5972217382\t59.722174",
-            "f422ad5a08e7f5035c1773e4d615ea19df970199c27cce850246230e7dcad71c\tBqTZFV8d6TRPZpoH2eBEkcobUVq8TGzBT6\t7134340730\t71.343407",
-            "f432121f11811a259de96e8ade9d11734b3408df79a3b7f7554f9bae112dad55\tBs7w91faoc6picFkza5cEWSDaPNvm41Pfe\t6027135963\t60.271360",
-            "f455858dc230a69a150f81f4195b79c2cd7bf8f77aa6b75dd0075b89fe18e21e\tBgpYFvvmEQ8Rwkw3zu3FuKFZvLSZSzHEWB\t500078970412\t5000.789704",
-            "f48857b0933493a690bf83804ad5322ba27074a690a3726861191c4351d03cea\tBnAHLHBkuzzVzbaLuxEL1gPqbVyu8Aawrf\t500198906552\t5001.989066",
-            "f48b0c388e6b8a9dd9de1c9e5a76b18497d705ee7475a5d29f2f68c9ba245157\tBgQHgTb915G7t2g3pk4o6uMjc5GoxfNJch\t9397754012\t93.977540",
-            "f497227f92055c4f1b3ed740764368061c8eace1b61c35d4ce421b6cb3bfe9a8\tBeyLeyrY6n9eXXPdZt3NLjVFM4exaBC6Lx\t6119419238\t61.194192",
-            "f49b8ad26ad612e9ec961f0372c4ffbd756d81104d236ede6821abb60162cb5e\tBYYUJ5nTtEXNXpLwhcXgNRYm5oxokdfgvU\t575923835\t5.759238",
-            "f4a7b0ea47d2dec5e2cde8e1b27b202db8e161cb9d8ebe8afa6cd9747568dd0e\tBTw4D11ZeMTzSYZu99XfY5Qo7wSLkyCHVH\t7147069990\t71.470700",
-            "f4a7b0ea47d2dec5e2cde8e1b27b202db8e161cb9d8ebe8afa6cd9747568dd0e\tBpJ1xyHB2NVkiSrk3hdCSmsEbc4m6tfw23\t7147066999\t71.470670",
-            "f504aa35837074149514da7b74d3539cfe8fd8e23fb5fbbfe36358a66e5c8068\tBUz1Z2m2zZ8N15Hp6u4KY4FSUn9friaFsK\t299982295\t2.999823",
-            "f50b5b27a9706c5c47e471bad948a4eec728d066444aa750ae4b24dfcbce5c1e\tBqwNdXcq9AUBd9CBLC87wzcE8415WiU4y5\t6864559619\t68.645596",
-            "f50cfa0e3500f02bb012333b4f1c9c964e918f9b2ce357422ad3f09da70165c9\tBahxJ1mz1rgQwNKCPTyWmoTHnYrewXqcKd\t6027135951\t60.271360",
-            "f536c655fa1aacb200911fa631d8df3e21f7e3e26d05d5b229c765c0f64c4862\tBeDKFdpmKXwM9CsUHF6gAuAQ6c6P1ztWLb\t14264431973\t142.644320",
-            "f536c655fa1aacb200911fa631d8df3e21f7e3e26d05d5b229c765c0f64c4862\tBgaBbp43B7JkJzPQBo3EQWwS7TPYNVjvKw\t14264434964\t142.644350",
-            "f539825f13dddd9af75db5d1f04d920e050283c0767d6ac16767a968cd3695a8\tBjnrkW3vA2rHdQuh2foZzxPCbSdsnqtfEy\t7781023504\t77.810235",
-            "f552678dafa68cf05e39dee366634ae9c52c9196b5466d3b13f6a261e34d993b\tBm1i3sgYfdrWUwTw1JdqSJ2AUtCUMoznSu\t6100237507\t61.002375",
-            "f569fdd8567d6e8827f803f1f0b0e3a4212bcdc302045517cdcb36275cacf4d5\tBiDKmnhDnGU1CaS2KLHFRkUKQjEr5YzCtr\t6935806598\t69.358066",
-            "f57d0908bf10deaca488d2786041ac7e2354e7525344388d04934f8fb95b8058\tBWuh5uGAqJ3K3fyFLnCQ7tGKF1gYQ399Sh\t683760470\t6.837605",
-            "f59615d0fe233d66062e6cb22696e601960524b0b3fd694d14beb7f45559c24e\tBehgoUwxASMQ13HgJjjKN1AmBt8kFZ7kBw\t9584998143\t95.849981",
-            "f59615d0fe233d66062e6cb22696e601960524b0b3fd694d14beb7f45559c24e\tBp6xNe2j9BD1eXcDPk6MSqmZDvyd5EV3cW\t9584995152\t95.849952",
-            "f59978a4c991fbeffd15e94882183cb6707daa736da1ef7bd4ef6add9cab3fab\tBeQYSM9z88sDNuwtpkk5Poy3tvJwLRkzeJ\t1288880631\t12.888806",
-            "f5a11d0899a9af3fcfffdb34479522e5364ceee68d25c190c5941bb5443d6d9d\tBeSZqKuNXQLqt3KHkgPoC7XSbJcwkLQVN9\t5455541272\t54.555413",
-            "f5cae57176b717e797bb5f97f8fec61f521c75e06c215af67f62f2f319a1b9b8\tBs582mQn3z62LPq3p8sTSbXpQVW6KcGrwz\t6100234673\t61.002347",
-            "f5de066d312d23eaaa0b2cce46c7d87a39786dfa60fbf7ea7201026dcfbe0813\tBqSWqzUaamZW9pEPkssFjQGg7j24MGEveN\t918468369\t9.184684",
-            "f5edb72ae5054dc5f672ac117da3740a60d7574b53d4953f04d511d687e1f0e9\tBZ2fsrywt86snU6ugpCtvLUt8fb5wCrEJU\t976767590\t9.767676",
-            "f5f576eab05bba0d77806aa3f2f578424a558f66f733e76274463e3b38eea56b\tBj7YTaFPcsMLVq8J3YhUQfdA8HcTLXaiMF\t979195764\t9.791958",
-            "f611831900517cfaacf02539abcef3463f3edc63ff8a6878f6381186ed0e7b29\tBeg1QYQSizJQCqPYXbsDfNtYeE9T7THyRG\t5724996826\t57.249968",
-            "f615b3f89e1108bb8f2bf30fc42d24febb2a290acb87aca1d423950a2a4949b9\tBpa7qcP3FqEf4ysXX6a9UiBEMXKyYQaSGy\t9401988859\t94.019889",
-            "f62f54405e8813444e65c8de326a85540932a6bbd69c55b2a25bfdf2ef0d5e92\tBrPs2z3D44dP7J81582dAuCL55yWqBffXD\t1499989259\t14.999893",
-            "f66ecd40b707327dbfe64836e34e8007926f030e53a504b2e9e3b90ea5e0f32d\tBVhqBzUbr7DQSKa1V9gvPfQj1DDRnSBtAB\t2230787414\t22.307874",
-            "f693a5708b4b373e61c92a7b0709bd269a0e81606e8583b46614294520d0d5ce\tBc8ABfG9nHq93z3EqaUVAweigyxBp5Huux\t577801208\t5.778012",
-            "f6b19e747137751672ee1a70844c42b57504490dd286a7de926626257e3b5834\tBVvXoPpsvLTreLd78rFxiVoue6zW9T5eSX\t404413507\t4.044135",
-            "f6bbd673ddefa1a5c77454bd1f0fb504ebfc37109f4dd6f69dbb152cad463016\tBhqjX6vW8wwcWUSnR72UXS799nxNHpqdgS\t6249997556\t62.499976",
-            "f6bbd673ddefa1a5c77454bd1f0fb504ebfc37109f4dd6f69dbb152cad463016\tBqU2C4C6qT9aoR4HzYkUPrCALHGN8fxbg2\t6249994554\t62.499946",
-            "f6fb29b0c55cea9b1df62e806e0ef0e916ff335788c3fc3d1e80fcfe4aba7a89\tBW5hiYfUYrZrz3VJh7JxNaLR5YN7tUn6JQ\t537379804588\t5373.798046",
-            "f729a623e1894253da9e42349728da93a4ebfc0736e1e691207c43185562a64d\tBjkbodENmAuSGdLqwD5s48zSsdUUJy4WCF\t9401991050\t94.019910",
-            "f7357d3e3140ffa472d28f59023c9c157127a58759322edab99790eb3173c8c6\tBUMNknwWmN2QADZDJGFxvKsEavXpRk4uKR\t750295092\t7.502951",
-            "f73f2a155bb41c4a1e2e8650f426940c233be43cfbc4314c1832864970d8ab5f\tBqNbZkUJUHy2GQmKQMbhqFGZsNstY8yRqc\t7759967586\t77.599676",
-            "f771292082c5972d0d6a3884c810531c278adabf5bad41ec8c4436a1f92144d7\tBXXqfbmmRhiknTE5tZKBPzuXP3jMjNcg1J\t7558332676\t75.583327",
-            "f771292082c5972d0d6a3884c810531c278adabf5bad41ec8c4436a1f92144d7\tBb4bQH8XW17M1Ridvx9Jq3S36ybq2MuoXN\t7558335678\t75.583357",
-            "f778c5258e46a3f1f9b432504991fc4229492e14c12ac1aa231faa393a9091cf\tBZut8a23nxCPP8VK2kKSKABaK31uSjfrDX\t5911742219\t59.117422",
-            "f7829f0b734d69d5f8425727ce65077b96e666ab5b029faf32656ce726689c40\tBYmELcAZod8woMzF5iTrHXCp8hND4nikx5\t1936944588\t19.369446",
-            "f7f9bf819148183d0141917d27fe48b38d032f13f8df0d0ea486108f949d9e4d\tBaYjFvsornDD42ojBMBHCxAu8GsyjTDRde\t500198921241\t5001.989212",
-            "f806a7d5e4b47a5fce190ce562a935400f4d3fc4139c67f000af396ea3271133\tBaNE1gCHuKGgtA7MqdZh1BaJeAwX1BuSKc\t9708304116\t97.083041",
-            "f80bf0ef3dfca7328e51a55405b97ca5485364a55da0b42d1ad030d417219493\tBnxJYxGG1ezUmzMeaZgdFhyvHW1FM1A9V1\t6289738620\t62.897386",
-            "f82dc24eba5c5dcbf91ad4020ec6b7ae41f1936b817208baa4c2d6851972249f\tBZHAs7WcDWENqRuoWfGUykVtnM4KQsNsqN\t9333741228\t93.337412",
-            "f82dc24eba5c5dcbf91ad4020ec6b7ae41f1936b817208baa4c2d6851972249f\tBeAYR87BSyeysCF4hDADsYuH7HZo5bbFmn\t9333744219\t93.337442",
-            "f83f778391231ae25c4556dc02c2069bf428ccd8f8bb231da5511b9620adddba\tBrTYpEouJQ8qxiKo8Pk3Hv7M9R3vdHxChf\t563576766\t5.635768",
-            "f8411c32bc981b1c1154918ef037a1c783e984676bb1821053228b92939717e9\tBouci81CbEwCshZxpyoDpmoSs4EFJjoJmB\t6100234673\t61.002347",
-            "f89f4571abb8c6e23763238dff220feae73c53490e7b5470dd6ad3b741e90ea6\tBaKQLLTsiFQasjXryMm5wZ3mmAN2ht9ch6\t499992820\t4.999928",
-            "f8a5307404c2d7400a16ed833b2b22f636ef03503d57b1ca555a17bc5769b276\tBUBZS1Uo5pu5aAFG7wE6tKjReZXXnD5AR2\t7652681313\t76.526813",
-            "f8b297bc75fcaaa5f5a7860531bd2a741ab8325e3630004c0b0be0c76133e670\tBoT76n9ToweEjEhoUbFm2xxMDrqyyjNPSU\t6299053800\t62.990538",
-            "f8be23cfd9773b46b54028002b75ccb61e27593c41df7010b970e18e1283eadb\tBkpSt4gavxAfsgjqacGpgpk19RS8d3bYue\t7781016030\t77.810160",
-            "f8c4e564a89163da8b1a9ac43ee9868458ff4dd4989d8e9050313396f40774c4\tBrqmckjwMN5V3emotfwhoxFrXyoM2fx8my\t9708313455\t97.083135",
-            "f8d51568256c23cd541ca8e634d9bf9c10cce928299a86a581be6aff2bc24d8b\tBi3kkyCP4rBVJdFWrsMZPvo8rkungXTUcm\t764547353\t7.645474",
-            "f8fd72f4744c750c480423cd39f51fbf20bd7a4b72b24de98d96bd8e5293a2c7\tBZmg2n4gkDtefYq7UsdXhzcYn6oVxFub4h\t15207492479\t152.074925",
-            "f8fd72f4744c750c480423cd39f51fbf20bd7a4b72b24de98d96bd8e5293a2c7\tBrMBchWVfs4zcXZcEjZZtMrQfRGCAjQHML\t15207495342\t152.074953",
-            "f9068ad80edccef9c0d6d78e74062c83be631f2faad25d92ceda818794d049eb\tBUpnnmfBko1k9T11CAFTPk9Y8hEA4ZfbnG\t999997762\t9.999978",
-            "f92593c2a4da69b2e33aec834bcafa59a7504f8f635d69d7fe7ed8281450143b\tBiqZvA4TAgBRyuwejHHW42nni7rZXu2Gqw\t7641205556\t76.412056",
-            "f93548f69f8711036387e41b3ebcef7c83f8e3445597ba7c56d801f7a6140b04\tBpwpc7Pj5bR2Rw9aKNtYPMfSRsrobzfPQn\t6864564901\t68.645649",
-            "f93abdf9a22e42e5338a582e3938475fc31e1f5e07e9bee4f6571938d61833f6\tBfgrXP6kUCEyXg4zuSeeBxWgUozUhbC9Kt\t3358228018\t33.582280",
-            "f95a6a054da8ece37f4a2dd7c8988a071813d8dc0d9c3ba8798a5930d276883a\tBfmKMBoxggj7QB8bDHdcHvcDiSZRYR9eBR\t6864561784\t68.645618",
-            "f971c490fbe20ce646f6f19173dd8412bdbf296267fa39f462fadd8c839d54ea\tBc4Rp1k4Tepb5nvghrd6EruYbzx8xERfEe\t979195753\t9.791958",
-            "f996d7407ba0b15b05038cc0cf89b14745fad7e00d01000cd69405e70a32b774\tBZw42E98x2RoVcXJogwJsmzkxVkBsAMn79\t6864561773\t68.645618",
-            "f9b14f07dd2d2cd5a9b45668e15a19d23e992a927003ca53da9abde51ccc4bff\tBqdCEF4hvFRYG1393Ku26Vjz3NQcBDw7Qg\t7269233267\t72.692333",
-            "f9b252680f92929c178c2774799d9b7682c945b9b0a58a5cc1e3511347d3da78\tBUdJMQUy9i1KpEEYWxqiyKbdKW18gRC8W9\t6040065976\t60.400660",
-            "f9b252680f92929c178c2774799d9b7682c945b9b0a58a5cc1e3511347d3da78\tBVF7QZkV4bph8j1zyKRQrUC1AGzJWhKyLN\t6040068967\t60.400690",
-            "f9e35293dc151e96abf029072e23ea3bb956f25002d2e43be096c9effe4e5b6d\tBfyxLhL3wD8b92tc9LWpXHZDJUm5D4WTe9\t632019094\t6.320191",
-            "fa03f1f77fb187bcfc740af9546772d88ad471337a1ff320f1d2f8faee097049\tBoc623mxwkgERXAAJEU49p9QzL8AHnCbdU\t6874991464\t68.749915",
-            "fa118e0702a6cc7d38756d3ec421c2ea76368b56afbb064628bf21a0be4daf12\tBXeMBDdEQqSYUkk5CN8ee5G655DYpB6UQY\t7147065357\t71.470654",
-            "fa118e0702a6cc7d38756d3ec421c2ea76368b56afbb064628bf21a0be4daf12\tBffL4KXrMD9T2KJ6VRuC4HrNp4SoK4YmTh\t7147068359\t71.470684",
-            "fa130be91ecd3842629576b47c9230d9715c5137d73e67c8c52df59cee04b6a5\tBb9wYVhp2vMbgHZBBhBJNVfF1c3H3BDJMd\t6403969596\t64.039696",
-            "fa2e5cabe0f60ef376df6914da4c3d71402db6fbc6121ac8c11db123f067e519\tBUJUWCuvo9TgFZp1wGcZZ3ePxL2BryNYiU\t499988844\t4.999888",
-            "fa358686d883c3e1d6f65aaf7f53cb11f844b0f597787c62c7ddf0faf7cb6b50\tBUCCzdocKey5rkhsxYeRmdHHJhRoThtVDS\t6249996036\t62.499960",
-            "fa515bc0434d7249581c992e7db4f724ef8f8af840e23c5e132d19cbe7ea5e3e\tBYg4ayKxuMYr5197PkbX7zRzYZB5G5KLpL\t692701661\t6.927017",
-            "fa6c0dbb0335b57aebb77268fdbca80052e09f4fc85212288f032007949a336f\tBWrsh9DyHNEcfaMjw6wZzWzKpUSrA23px7\t6249997185\t62.499972",
-            "fa8f5e9b4a97976c40cf37644ca2094321b3aa9672d2310981ea93e5929707d0\tBaHGpM8Uui5SPVJzRVxxx1sZoRt8J8goup\t500040929354\t5000.409294",
-            "fab628f886ef1b2674b7a8284be1fb707109bb05666c07be2f8b1240f9e89329\tBjG3ka2ZXNLGSRgiyCp8RXvYbtwh8kWZ9h\t918468570\t9.184686",
-            "fad6879a3f2ff7edc5b42187ce9aac84294eaf3d21e92ac39b14afbf120f1724\tBdAmjmWN5qRadhsTU4pvuo3jr7jWvXg2C9\t670643092\t6.706431",
-            "fadce1b84f976528fb3189c8ffb0c8ccf892072939429c8ffade60e8982c94b8\tBhUuR5pbeyyALPBtjsSdwcti3ioJJNzWtg\t598858327\t5.988583",
-            "fae431b1fdd6da9652e20175258a7e820e338d10093e9d6fad306a725d6da0c4\tBe6qKjxLGV3s3K5Gon1mMLyU5tQzASEABJ\t599448870\t5.994489",
-            "fb2c11e7b61387226ae1e6d7385cf57a351b8b627a5016d28b6f970719d508da\tBrwqucCcnB6WHEBRM8NEhKviHCKdkEnar4\t6588240143\t65.882401",
-            "fb5cfafc3a366a8d93aece41c1fd6c085da214dee748919cbf20820c845ec13d\tBYRzejtZLg6yGCtFMEw9tRHC5HgdXEh6Aq\t432920118\t4.329201",
-            "fb67eda3c0ab557f6fc600b11d6b6f25c5d2d2d81579e36b9752b0ae92944b22\tBbQwWPUW9bisbEjZ48fg6SQdyebZYwNDCA\t632019094\t6.320191",
-            "fb7bbc8bd398654b19b05f53a1baa45d364cf273d8f61fc53842ce293b1ab7d2\tBiWMoGW56tUsrbSjr2jcCCAvLYuWNZofjJ\t5837495318\t58.374953",
-            "fb7bc61f40bfa77f51bcea7fe6cbe7aa0293f04a32e0cf7f4ab96791b445b1ae\tBhKhVGFCVCjrxDb26JYBdYpXDjbvPf6mnd\t500100958801\t5001.009588",
-            "fb8fe6343b0dde4fabfacda3b6a2484cb8249cea14570d146fe13548408a24bd\tBZ6n6bQyPycu9cNnnkqNuYNGFHrq12RcNq\t1000000000\t10.000000",
-            "fb8fe6343b0dde4fabfacda3b6a2484cb8249cea14570d146fe13548408a24bd\tBZrmsfjY1wopjbKj5NroQbRgf3cJkvQMwn\t3279443330\t32.794433",
-            "fb8fe6343b0dde4fabfacda3b6a2484cb8249cea14570d146fe13548408a24bd\tBbcrEfixJfcEFhm7cfv3zV4UZwokZb43hg\t3279443330\t32.794433",
-            "fb8fe6343b0dde4fabfacda3b6a2484cb8249cea14570d146fe13548408a24bd\tBecpuVuWZVxKGUiLXUp6YsPWUbyEEirS7P\t3279443330\t32.794433",
-            "fb8fe6343b0dde4fabfacda3b6a2484cb8249cea14570d146fe13548408a24bd\tBh6qEFghqA5ZGFfWEMFrNiFR6hEREmETVy\t3209438320\t32.094383",
-            "fb8fe6343b0dde4fabfacda3b6a2484cb8249cea14570d146fe13548408a24bd\tBispeYpLjjMPj12HHaYHNbXrmzK1KAsv2V\t3279443330\t32.794433",
-            "fb8fe6343b0dde4fabfacda3b6a2484cb8249cea14570d146fe13548408a24bd\tBkbYr5eYTK7MBTnUfR8e72izFdn6tzvJy6\t3279443330\t32.794433",
-            "fb8fe6343b0dde4fabfacda3b6a2484cb8249cea14570d146fe13548408a24bd\tBoVk8MfL4nZxTJBgobQM1e7WTDD2k5A2W3\t3279443330\t32.794433",
-            "fb8fe6343b0dde4fabfacda3b6a2484cb8249cea14570d146fe13548408a24bd\tBqntiJdReWtoAPKqNMXLJoqVqptwzcfFsY\t3279443330\t32.794433",
-            "fb8fe6343b0dde4fabfacda3b6a2484cb8249cea14570d146fe13548408a24bd\tBrv1QDwwX5rEik9uVS5N7tFQbBrAdT5bJN\t3279443330\t32.794433",
-            "fbbda75223646c770af891418d94702cb12186fdc37e8deb7b951afaea638fad\tBZ4nhkncSVBcck9FRhVBsUGzsG51jGYBMY\t882549872\t8.825499",
-            "fbc26c3e2642fa528756274db94a019c0b6ec6b457fde3233264f7d698e92234\tBXYUTQsqQitZUcLzexdapTw2VEMmjYT6JL\t6677024558\t66.770246",
-            "fbdb695344873a0ab8c99314bf37de7ff6c6b4433bd253d2b1c6c5050cf5f54f\tBjrUmp6KkUT629JbzmAXobBVhmn8A4JbCr\t2058647761\t20.586478",
-            "fbeced7d1678277e628fea2ac2cf9c042cb6268b9c6cda5aa1e752202bec27ad\tBiDcJaLS2hwN7tDRrXesrsnNc6opbHnDs5\t641889990\t6.418900",
-            "fc28ca17cdde4ea06e92179d7cbf4a79198c38ec6ec11dd4c58846da179616fb\tBp4nva44Dzj64sTpm2K4ejcVUa4Gsbirt9\t1364047289\t13.640473",
-            "fc40c94d3ee85104a33b7a5c082adc1ea3a0bc5f46e04c4782e207e3cf753032\tBWxzydbBuvFT3wDjAz98TXTX3XUXSdNNtK\t500070953845\t5000.709538",
-            "fc43defd72927cfde888419ab157ad87fd309b5085b05cfaddbf3ec441cfca70\tBUd7V2jS438U79Y2h99ySEf8z7hcYuE6mS\t5455541657\t54.555417",
-            "fc83064a284fec4b9098ec2c591b058719fde080dea0bbda903abc8c6c91bc67\tBUZ2rLMzDQBaA5Xcg26wWfdoWAJvhQQjVu\t979328071\t9.793281",
-            "fc83064a284fec4b9098ec2c591b058719fde080dea0bbda903abc8c6c91bc67\tBVr6rLArGVWehNCdQavsa1P9UyLkupGrba\t979328071\t9.793281",
-            "fc83064a284fec4b9098ec2c591b058719fde080dea0bbda903abc8c6c91bc67\tBZJak4Y3n32kpzYBLvtXfwgdzYQDMdUMXZ\t909323060\t9.093231",
-            "fc83064a284fec4b9098ec2c591b058719fde080dea0bbda903abc8c6c91bc67\tBdFBJNQHkz2GMvR75S7tpZYmdWUgZU1uzB\t1000000000\t10.000000",
-            "fc83064a284fec4b9098ec2c591b058719fde080dea0bbda903abc8c6c91bc67\tBgM6wH1HDuo95MUWJ5b7SvMW34Gw95v6BU\t979328071\t9.793281",
-            "fc83064a284fec4b9098ec2c591b058719fde080dea0bbda903abc8c6c91bc67\tBgfUtyL2ffzU9TrQrd5RQG4e6ivxSqaPUu\t979328071\t9.793281",
-            "fc83064a284fec4b9098ec2c591b058719fde080dea0bbda903abc8c6c91bc67\tBhZMTeY4JL6p6JhZQQzHe9qEork4GqUynT\t979328071\t9.793281",
-            "fc83064a284fec4b9098ec2c591b058719fde080dea0bbda903abc8c6c91bc67\tBmAJXjAN3ng9WYFqe5XGPSxWRqwkakKfTf\t979328071\t9.793281",
-            "fc83064a284fec4b9098ec2c591b058719fde080dea0bbda903abc8c6c91bc67\tBmxtNoCEMggzhecm8L2kiuwWibdvh3xMXb\t979328071\t9.793281",
-            "fc83064a284fec4b9098ec2c591b058719fde080dea0bbda903abc8c6c91bc67\tBqV4CkHKNPPshuBmqzjPtZ113F8crwk1XS\t979328071\t9.793281",
-            "fc9640422f35d77757ddd50923a217cc7e0b6068d39c0d07bb9cfca3fb6247bf\tBgBiwm8aLH6X3iZ5nBPM6sNPfcZ5PGgpW8\t999997569\t9.999976",
-            "fc9a8a290936ec16ca7f47947a95df3f0273252a725b074e51e1103bc2421195\tBYVcytEB3eynrL8NutTijPVvKW7MHXKPs5\t9351242892\t93.512429",
-            "fca4588d4d0eb594bc35fee413e687cf73b91f25b68d34acf5f02d37d1bd6789\tBbz5VmN5BHHdsRtypN1qJuHjJCstFL6GPC\t672205627\t6.722056",
-            "fca4a9a4759834e14e92efb82d669708ef0d0d640e7a323b659421f012c99e84\tBk3yv2kxtWi9KowoehXQQ1TWsyYrv7HeRy\t6864559350\t68.645594",
-            "fce1dfc4e3c10e9644fdc0a241d9875f380a639e07bfa782c4311862383b1d30\tBgRJP59yTZ5enR1CMBEs8ZGZZw6mLEPh3g\t4685532484\t46.855325",
-            "fcf4a317dad24b974fd9dfc32ff7f13ed20b22a1ca50442cd9376391b448c6c3\tBdCntoKprAExztFA6SocYkdU9riivCHg4Q\t599892847\t5.998928",
-            "fcf711429f98d4c3f93b82beb06105455a3df198d5f714dfe035fa57cc08f508\tBbVoXa42nMwPsjzGQtStW1VGvJiKvRv8X9\t2097759084\t20.977591",
-            "fd3763dc7742aab61717ed7889efbc080e15ec45170602fe4e95f0df1b91a419\tBh7g2dUdNUuCxoDiJdbPqcbTHmzhCZL265\t918473662\t9.184737",
-            "fd3b881a2592060ec719cea7e2a79d32693a1a8552953bf5e19b5d2526ee35e9\tBnGSWAiEezFrrUiqRJw3KiZjDihSVwcvWL\t5066379224\t50.663792",
-            "fd67db35daf4d1851c2525c2013618021b1f8598267ccf51176e6db3f3055605\tBc21Yj5RFs7JmJSjaSSX48g1MjKm2493kC\t500070832262\t5000.708323",
-            "fd6fa63633fa493e59ae7e197b3425b859c76354e3384aa0cb9cedf05862b651\tBbHdP4b8AT1bCFXotgsx6PnSTacGHBQQpo\t658837483\t6.588375",
-            "fd99ef943f4f51f0b702efc58e532f9c4cefed87e56a95b20a514bda2fac1bae\tBX3PzLPQnYyp4PtEKWDvZfJtgBjY5QMQpg\t918468581\t9.184686",
-            "fd9b8a6ac523cac4a83b1539ecba22e7a2a4c1babdca1a99ec65d801a226dc2d\tBaNgZ1XHPjbuPJjcnM8Xmy8b5wyCjm3UqF\t483159819061\t4831.598191",
-            "fdc64c9c0aa25e69a198497609a65817c71f803e61a19adcf71727b2354d70f0\tBgjWELcJyrN2qcrhdBqCPFPMSGRZoD2Kbn\t6100229223\t61.002292",
-            "fde2dad32b7de217de138383717fe6be15f65ccd32dd92872e4d9b8d5ee0afdc\tBoKrFA2m84rcSVRwxKqaoDyqw2MiwyU2S2\t1218875227\t12.188752",
-            "fdee67fb8cdd28b737067203bcb2f2ec5530ee98e6be10e8bc4d6ee43bcde436\tBocd9hrAyaZRw7EcUAnq6V5fCZiWUDNYdY\t9690951133\t96.909511",
-            "fdee84195fd83e15adba14c7e06bc93bb9480b39fc6006be2a86a828597e86e7\tBmJnwpzYhSfe5S8aoTXyWmQK2sYqwjfESy\t6299050434\t62.990504",
-            "fe2c26f7e4b0c98d5468c42ec468252285cb0e73d4315f633a2dac7343cbb5f8\tBVDXtBhVHmtNhLV2u66sXqgw6Q7M3198Jy\t4159991184\t41.599912",
-            "fe2ff5719d3af2e40d021be7034aa0798b6eba07b9a8ce442471639cde7b4e10\tBZzMioNP5Cew1tB6n858Y3mQ5eCWS2E9ph\t5724993587\t57.249936",
-            "fe30ba26465a7324bece38c1ae695785c1c4acddac769471eff097e3ff8d05ed\tBU1RmUyxJ9gPrkoaTaL416oB63raxFc15D\t64825233305\t648.252333",
-            "fe4ced783ddfb462e53b6389f4c65a7d1e9bd4a830839eff5f67f4083e30ce30\tBczgKYMR8PhnQG4dFDB1qzk4UhwxXB7gpf\t750292392\t7.502924",
-            "fe65b4847c8b14b4741b9b7f054340427a8cd4bb1ff0e85cca946e76925295a1\tBVdgxoFypfF9PQitk3CvmzmQpgNBqC6DXM\t7102803373\t71.028034",
-            "fe65b4847c8b14b4741b9b7f054340427a8cd4bb1ff0e85cca946e76925295a1\tBW7udZUCWynGtLEuGj4ehruTfwdxPgWoFS\t7102803373\t71.028034",
-            "fe65b4847c8b14b4741b9b7f054340427a8cd4bb1ff0e85cca946e76925295a1\tBWkqVPKZA3mAEZw3NY3x9otnQ9Gw2vtwJN\t7102803373\t71.028034",
-            "fe65b4847c8b14b4741b9b7f054340427a8cd4bb1ff0e85cca946e76925295a1\tBX4gKG13pQqiopsa9DGfGvEb5whYSQA8Fi\t7102803373\t71.028034",
-            "fe65b4847c8b14b4741b9b7f054340427a8cd4bb1ff0e85cca946e76925295a1\tBZbinYF9Meb9iQEQPK2SDnHcmJSSYxXVgu\t7102803373\t71.028034",
-            "fe65b4847c8b14b4741b9b7f054340427a8cd4bb1ff0e85cca946e76925295a1\tBdqXhU5nfnas2oJ5fmfziMGYcHrYqYpwnD\t7032798363\t70.327984",
-            "fe65b4847c8b14b4741b9b7f054340427a8cd4bb1ff0e85cca946e76925295a1\tBmNG2wS6ppZjUW4NAZ5ca9gEN7nfesJtzj\t1000000000\t10.000000",
-            "fe65b4847c8b14b4741b9b7f054340427a8cd4bb1ff0e85cca946e76925295a1\tBmgyNq4e6DMqU6Fop4F7AvSyb2B55WJyJ6\t7102803373\t71.028034",
-            "fe65b4847c8b14b4741b9b7f054340427a8cd4bb1ff0e85cca946e76925295a1\tBqMQhRbPEFm26Up4UHmpXawhkUtV5mRrS4\t7102803373\t71.028034",
-            "fe65b4847c8b14b4741b9b7f054340427a8cd4bb1ff0e85cca946e76925295a1\tBqpyow9Z9prA5KgYGrJqtGdPpmBNfCypjW\t7102803373\t71.028034",
-            "fe6c5bcf329b76774234ee428d16549a09ab0657728bdf13d74e0cf77fe99e57\tBY6GXwVHrSdJTtQdEvfJHB7cYkL428ufME\t5837491640\t58.374916",
-            "fe880cb5857e71d0e524d0c89fa3232247a721999eaf744216ae021b8c6dc94d\tBgDVbCktmdmZViN3SKcvSjbv6XM8BvsrQ2\t599892858\t5.998929",
-            "fe89a96fe0658134e5f8f88952837663c37f6881ee81f3e4d738366d97842c43\tBmWw2tWaeRBZujTMU7ZQQueRLKaKt3vhmm\t641884719\t6.418847",
-            "fe8eb02862b18ab2dbc558cc4c8789ea8fe92499d8ef0096f1333500b5e3cc84\tBd7K8Q14Uqvz9XGPRx77GowAJJcbuGvBCM\t906762569\t9.067626",
-            "fe920996943bf0c171be075d96fe65950fe891d0466a2057bc2d29e49e36bc03\tBaxLiL7iJbPziS1op96AEws3iKkA3cXXxG\t4159991184\t41.599912",
-            "fead29155511b49f01a32c8aa4b6c1da566117be844aead587f75115ec10d06b\tBaPPX7M4G2JADmzSiFYsJKcMcEwsRGTctu\t7134332403\t71.343324",
-            "fed4e9d46462d1470284117ab102192d3e417ccd1bbb46c62e25e023a13e48f4\tBmyxzefPke7cvzpbN1Dcg1j38jQtF1kk8s\t979193317\t9.791933",
-            "fed5abcec823f3cf8494f319734d2656478543bda2cfd97dd0835320c099ece9\tBqt2FoNTr5u2azBjMrL2RtUF9iVpXJGrHG\t692701858\t6.927019",
-            "fee3e5d2b3ef0ebcf70230c2bfe1ab19fa7b6cb93a79d65489f8e349acb9ff57\tBZKoHrrAYQHW3J1sGCJUiVqYrqJo4idAcV\t11014822097\t110.148221",
-            "fee3e5d2b3ef0ebcf70230c2bfe1ab19fa7b6cb93a79d65489f8e349acb9ff57\tBpFfLXTvmG4pFG1vEAchDcG7pzm6LVpbtg\t11014824947\t110.148249",
-            "fefc6d4a5e3c523ae56d74b76665e1548cf12028c530102f6619253eb6310bba\tBUrkJ6GcwLvMvP11codhNC7vf5JHe5kNDQ\t6289744352\t62.897444",
-            "ff24da8499344dbbf5c57ec5911555a73e7f7d3d1e2b38b98090bd83c5ca2e55\tBadSWEdxJW7mvPpCQJGYvhL6gk3hUd3AnG\t599448860\t5.994489",
-            "ff2bc7fc5ef5a2c11c59d48daf972eafea2dc4176e4d2a445f173b28763b841a\tBqNpYqz1PPUTwdiTCYHSVYwfDUjKViEEg2\t70000000\t0.700000",
-            "ff353fe9086f0a0bb3e77edfa766eae81edd19752e6f38d77744d6bddfc32b21\tBc2nuRctreTScWS3X3UJ47oMR47hEqXFAx\t9708313859\t97.083139",
-            "ff51b22811068ff163d96ca4c4a3ecd37a49b6cfc258511d74a5c3402071eb29\tBTqfU9Gs7MDMGunZeBWXoGHAMFhmcLYTSv\t500138912245\t5001.389122",
-            "ff51b63f456ab4950641ae31498554a73a43e11753181ebc26fb5bb04bdb78eb\tBd1UpobQsPGtve8EiYD9SkGacHU1Q4S4dt\t6295099815\t62.950998",
-            "ff7baca23945ad0bf1032435750739e78655075e30fba5a1b855f6424886c132\tBhixzWxE1sB4STBc4cmM7Btv715MrsaSdB\t1030389793\t10.303898",
-            "ff8b1cebf89f97ed8ecc786ed5087f9e43270b7344908dca85cbb9465e317848\tBenPgiMZ8s5q9LmQwXa6aG2WdYXT1dgWYB\t2499986336\t24.999863",
-            "ff90d010a3233a4e28e0041df98151763139abe8d0c8972d64a6893e98f13c1c\tBczh2wkGgFr1PAnrq8gW4JKwTnTzFGYUUD\t6100235882\t61.002359",
-            "ffc70384af703e60c57bfa058f9bf5bb44c20cb448d7e0be8af470931aa8fd43\tBeGz9ksDRGRfmP4A3hwuUgc26Xv5avQ4U7\t762213761\t7.622138",
-            "ffd505f9cf51cef09fe4b1f973feaa933d4643ed38ffb5d6298214337551bb97\tBUznQ6X1hFE9choGhC8dH6MegMoqCWD37d\t500138827897\t5001.388279",
-            "ffdb62d87539e5a0287ec2cb243d199f34d1e417ef9ba7fc96ea21b53feb06c4\tBc8Kg2NLoiHJSLPsBL8ffrAuLxbvpRsR8v\t6874992357\t68.749924",
-            "ffe1bfae58b1bb273b974b8d2f7433b2926bb0c5990336a3f748eb7792fd42bd\tBbqLJHFw2T1H3yn9eDdU2HGXG7KLngwfSM\t762216196\t7.622162"
-    };
-    return r;
-}
\ No newline at end of file
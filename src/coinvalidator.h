@@ -7,12 +7,15 @@
 #define BLOCKDX_COINVALIDATOR_H
 
 #include <boost/thread/mutex.hpp>
-#include <boost/filesystem/path.hpp>
 #include <script/script.h>
+#include "primitives/transaction.h"
 #include "uint256.h"
 #include "amount.h"
 #include "base58.h"
 
+#include <memory>
+#include <vector>
+
 /**
  * Stores infraction data.
  */
@@ -27,15 +30,24 @@ struct InfractionData {
     std::string ToString() const;
 };
 
+/**
+ * Infraction compiled into the binary, see coinvalidatorinfractions.h.
+ */
+struct InfractionSpec {
+    uint8_t txid[32];    // uint256 byte order
+    uint8_t address[21]; // version byte and hash160
+    int64_t amount;
+};
+
 /**
  * Stores redeem data.
  */
 struct RedeemData {
-    std::string txid;
+    uint256 txid;
     CScript scriptPubKey;
     CAmount amount;
-    RedeemData(std::string t, CScript a, CAmount amt) {
-        txid = std::move(t); scriptPubKey = a; amount = amt;
+    RedeemData(const uint256 &t, const CScript &a, CAmount amt) {
+        txid = t; scriptPubKey = a; amount = amt;
     }
 };
 
@@ -48,9 +60,8 @@ public:
     bool IsCoinValid(const uint256 &txId) const;
     bool IsCoinValid(uint256 &txId) const;
     bool IsCoinValid(const std::string &txId) const;
-    bool RedeemAddressVerified(std::vector<RedeemData> &exploited,
-                               std::vector<RedeemData> &recipients);
-    bool Load(int loadHeight);
+    bool RedeemAddressVerified(const std::vector<RedeemData> &exploited,
+                               const std::vector<CTxOut> &recipients);
     bool LoadStatic();
     bool IsLoaded() const;
     void Clear();
@@ -61,15 +72,11 @@ public:
     static CoinValidator& instance();
 private:
     std::map<std::string, std::vector<InfractionData>> infMap; // Store infractions in memory
+    std::shared_ptr<const std::vector<uint256>> infTxIds; // Sorted infraction txids, read without lock
     bool infMapLoaded = false;
     int lastLoadH = 0;
-    bool downloadErr = false;
     mutable boost::mutex lock;
-    boost::filesystem::path getExplPath();
-    bool addLine(std::string &line, std::map<std::string, std::vector<InfractionData>> &map);
-    int getBlockHeight(std::string &line);
-    bool downloadList(std::list<std::string> &lst, std::string &err);
-    std::vector<string> getExplList();
+    void publishTxIds();
 };
 
 #endif //BLOCKDX_COINVALIDATOR_H
\ No newline at end of file
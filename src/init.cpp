@@ -34,6 +34,7 @@
 #include "utilmoneystr.h"
 #include "validationinterface.h"
 #include "xbridge/xbridgeapp.h"
+#include "xbridge/util/xseries.h"
 #include "coinvalidator.h"
 
 #ifdef ENABLE_WALLET
@@ -166,6 +167,7 @@ void PrepareShutdown()
 {
     xbridge::App::instance().cancelMyXBridgeTransactions();
     xbridge::App::instance().disconnectWallets();
+    xbridge::App::instance().getXSeriesCache().closeTradeIndex();
 
     fRequestShutdown = true;  // Needed when we shutdown the wallet
     fRestartRequested = true; // Needed when we restart the wallet
@@ -335,6 +337,9 @@ std::string HelpMessage(HelpMessageMode mode)
     strUsage += HelpMessageOpt("-dbcache=<n>", strprintf(_("Set database cache size in megabytes (%d to %d, default: %d)"), nMinDbCache, nMaxDbCache, nDefaultDbCache));
     strUsage += HelpMessageOpt("-loadblock=<file>", _("Imports blocks from external blk000??.dat file") + " " + _("on startup"));
     strUsage += HelpMessageOpt("-maxorphantx=<n>", strprintf(_("Keep at most <n> unconnectable transactions in memory (default: %u)"), DEFAULT_MAX_ORPHAN_TRANSACTIONS));
+#ifndef WIN32
+    strUsage += HelpMessageOpt("-mmapblockfiles=<n>", strprintf(_("Read blocks from up to <n> finalized blk?????.dat files through memory maps, 0 = read through stdio (default: %u)"), DEFAULT_MMAP_BLOCK_FILES));
+#endif
     strUsage += HelpMessageOpt("-par=<n>", strprintf(_("Set the number of script verification threads (%u to %d, 0 = auto, <0 = leave that many cores free, default: %d)"), -(int)boost::thread::hardware_concurrency(), MAX_SCRIPTCHECK_THREADS, DEFAULT_SCRIPTCHECK_THREADS));
 #ifndef WIN32
     strUsage += HelpMessageOpt("-pid=<file>", strprintf(_("Specify pid file (default: %s)"), "blocknetdxd.pid"));
@@ -447,7 +452,7 @@ std::string HelpMessage(HelpMessageMode mode)
     if (GetBoolArg("-help-debug", false)) {
         strUsage += HelpMessageOpt("-limitfreerelay=<n>", strprintf(_("Continuously rate-limit free transactions to <n>*1000 bytes per minute (default:%u)"), 15));
         strUsage += HelpMessageOpt("-relaypriority", strprintf(_("Require high priority for relaying free or low-fee transactions (default:%u)"), 1));
-        strUsage += HelpMessageOpt("-maxsigcachesize=<n>", strprintf(_("Limit size of signature cache to <n> entries (default: %u)"), 50000));
+        strUsage += HelpMessageOpt("-maxsigcachesize=<n>", strprintf(_("Limit size of signature cache to <n> MiB (default: %u)"), DEFAULT_MAX_SIG_CACHE_SIZE));
     }
     strUsage += HelpMessageOpt("-minrelaytxfee=<amt>", strprintf(_("Fees (in BLOCK/Kb) smaller than this are considered zero fee for relaying (default: %s)"), FormatMoney(::minRelayTxFee.GetFeePerK())));
     strUsage += HelpMessageOpt("-printtoconsole", strprintf(_("Send trace/debug info to console instead of debug.log file (default: %u)"), 0));
@@ -480,6 +485,9 @@ std::string HelpMessage(HelpMessageMode mode)
     strUsage += HelpMessageOpt("-servicenodeaddr=<n>", strprintf(_("Set external address:port to get to this servicenode (example: %s)"), "128.127.106.235:41412"));
     strUsage += HelpMessageOpt("-budgetvotemode=<mode>", _("Change automatic finalized budget voting behavior. mode=auto: Vote for only exact finalized budget match to my generated budget. (string, default: auto)"));
     strUsage += HelpMessageOpt("-enableexchange", _("Turn on exchange servicenode mode"));
+    strUsage += HelpMessageOpt("-xbridgetradeindex", strprintf(_("Maintain an index of blockchain trades for order history queries (default: %u)"), 1));
+    strUsage += HelpMessageOpt("-xbridgeingressthreads=<n>", strprintf(_("Number of threads relaying and processing xbridge packets received from peers (default: %u)"), 2));
+    strUsage += HelpMessageOpt("-xbridgeutxocachetime=<n>", strprintf(_("Seconds a wallet's unspent outputs are reused for xbridge orders while its chain tip and transactions are unchanged, 0 to disable (default: %u)"), 60));
 
     strUsage += HelpMessageGroup(_("Obfuscation options:"));
     strUsage += HelpMessageOpt("-enableobfuscation=<n>", strprintf(_("Enable use of automated obfuscation for funds stored in this wallet (0-1, default: %u)"), 0));
@@ -831,6 +839,9 @@ bool AppInit2(boost::thread_group& threadGroup)
     else if (nScriptCheckThreads > MAX_SCRIPTCHECK_THREADS)
         nScriptCheckThreads = MAX_SCRIPTCHECK_THREADS;
 
+    InitSignatureCache();
+    SetMappedBlockFiles(std::max((int64_t)0, GetArg("-mmapblockfiles", DEFAULT_MMAP_BLOCK_FILES)));
+
     fServer = GetBoolArg("-server", false);
     setvbuf(stdout, NULL, _IOLBF, 0); /// ***TODO*** do we still need this after -printtoconsole is gone?
 
@@ -1311,7 +1322,7 @@ bool AppInit2(boost::thread_group& threadGroup)
             fLoaded = true;
         } while (false);
 
-        if (!fLoaded) {
+        if (!fLoaded && !ShutdownRequested()) {
             // first suggest a reindex
             if (!fReset) {
                 bool fRet = uiInterface.ThreadSafeMessageBox(
@@ -1333,7 +1344,7 @@ bool AppInit2(boost::thread_group& threadGroup)
     // As LoadBlockIndex can take several minutes, it's possible the user
     // requested to kill the GUI during the last operation. If so, exit.
     // As the program has not fully started yet, Shutdown() is possibly overkill.
-    if (fRequestShutdown) {
+    if (ShutdownRequested()) {
         LogPrintf("Shutdown requested. Exiting.\n");
         return false;
     }
@@ -0,0 +1,91 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_LRUCACHE_H
+#define BITCOIN_LRUCACHE_H
+
+#include <list>
+#include <utility>
+
+#include <boost/functional/hash.hpp>
+#include <boost/unordered_map.hpp>
+
+/** Map container that only keeps the N most recently used elements, not thread safe. */
+template <typename K, typename V, typename Hash = boost::hash<K> >
+class lrucache
+{
+public:
+    typedef K key_type;
+    typedef V mapped_type;
+    typedef typename std::list<std::pair<K, V> >::size_type size_type;
+
+protected:
+    //! most recently used first
+    std::list<std::pair<K, V> > items;
+    typedef typename std::list<std::pair<K, V> >::iterator iterator;
+    boost::unordered_map<K, iterator, Hash> index;
+    size_type nMaxSize;
+
+public:
+    lrucache(size_type nMaxSizeIn = 0) { nMaxSize = nMaxSizeIn; }
+    size_type size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+
+    //! copy value of k to v and mark it most recently used
+    bool get(const key_type& k, mapped_type& v)
+    {
+        typename boost::unordered_map<K, iterator, Hash>::iterator it = index.find(k);
+        if (it == index.end())
+            return false;
+        items.splice(items.begin(), items, it->second);
+        v = it->second->second;
+        return true;
+    }
+
+    void insert(const key_type& k, const mapped_type& v)
+    {
+        typename boost::unordered_map<K, iterator, Hash>::iterator it = index.find(k);
+        if (it != index.end()) {
+            it->second->second = v;
+            items.splice(items.begin(), items, it->second);
+            return;
+        }
+        if (nMaxSize == 0)
+            return;
+        items.push_front(std::make_pair(k, v));
+        index[k] = items.begin();
+        while (items.size() > nMaxSize) {
+            index.erase(items.back().first);
+            items.pop_back();
+        }
+    }
+
+    void erase(const key_type& k)
+    {
+        typename boost::unordered_map<K, iterator, Hash>::iterator it = index.find(k);
+        if (it == index.end())
+            return;
+        items.erase(it->second);
+        index.erase(it);
+    }
+
+    void clear()
+    {
+        index.clear();
+        items.clear();
+    }
+
+    size_type max_size() const { return nMaxSize; }
+    size_type max_size(size_type s)
+    {
+        nMaxSize = s;
+        while (items.size() > nMaxSize) {
+            index.erase(items.back().first);
+            items.pop_back();
+        }
+        return nMaxSize;
+    }
+};
+
+#endif // BITCOIN_LRUCACHE_H
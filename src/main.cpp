@@ -30,9 +30,14 @@
 #include "ui_interface.h"
 #include "util.h"
 #include "utilmoneystr.h"
+#include "validationinterface.h"
 #include "xbridge/xbridgeapp.h"
 #include "coinvalidator.h"
+#include "lrucache.h"
+#include "mappedfile.h"
 
+#include <atomic>
+#include <list>
 #include <sstream>
 
 #include <boost/algorithm/string/replace.hpp>
@@ -967,7 +972,7 @@ bool GetCoinAge(const CTransaction& tx, const unsigned int nTxTime, uint64_t& nC
     return true;
 }
 
-bool CheckTransaction(const CTransaction& tx, CValidationState& state)
+bool CheckTransaction(const CTransaction& tx, CValidationState& state, bool fCheckRedeem)
 {
     // Basic checks that don't depend on any context
     if (tx.vin.empty())
@@ -981,9 +986,6 @@ bool CheckTransaction(const CTransaction& tx, CValidationState& state)
         return state.DoS(100, error("CheckTransaction() : size limits failed"),
             REJECT_INVALID, "bad-txns-oversize");
 
-    // Store all recipients
-    std::vector<RedeemData> recipients;
-
     // Check for negative or overflow output values
     CAmount nValueOut = 0;
     BOOST_FOREACH (const CTxOut& txout, tx.vout) {
@@ -1000,10 +1002,6 @@ bool CheckTransaction(const CTransaction& tx, CValidationState& state)
         if (!MoneyRange(nValueOut))
             return state.DoS(100, error("CheckTransaction() : txout total out of range"),
                 REJECT_INVALID, "bad-txns-txouttotal-toolarge");
-
-        // Track all valid recipients
-        if (!txout.IsEmpty())
-            recipients.emplace_back(tx.GetHash().ToString(), txout.scriptPubKey, txout.nValue);
     }
 
     // Bad stake inputs
@@ -1017,7 +1015,7 @@ bool CheckTransaction(const CTransaction& tx, CValidationState& state)
                 REJECT_INVALID, "bad-txns-inputs-duplicate");
 
         // Check for bad stake inputs
-        if (chainActive.Height() >= CoinValidator::CHAIN_HEIGHT) {
+        if (fCheckRedeem && chainActive.Height() >= CoinValidator::CHAIN_HEIGHT) {
             if (!coinValidator.IsCoinValid(txin.prevout.hash)) {
                 CTransaction prevtx; uint256 prevblock;
                 // If bad transaction or bad prev tx then reject tx
@@ -1026,16 +1024,16 @@ bool CheckTransaction(const CTransaction& tx, CValidationState& state)
                                      REJECT_INVALID, "bad-txns-inputs-stake");
                 }
                 // Track exploited coin
-                exploited.emplace_back(prevtx.GetHash().ToString(), prevtx.vout[txin.prevout.n].scriptPubKey, prevtx.vout[txin.prevout.n].nValue);
+                exploited.emplace_back(txin.prevout.hash, prevtx.vout[txin.prevout.n].scriptPubKey, prevtx.vout[txin.prevout.n].nValue);
             }
         }
 
         vInOutPoints.insert(txin.prevout);
     }
 
-    // Check bad stakes
+    // Check bad stakes, the non-empty outputs are the recipients
     if (!exploited.empty()) {
-        if (!coinValidator.RedeemAddressVerified(exploited, recipients)) {
+        if (!coinValidator.RedeemAddressVerified(exploited, tx.vout)) {
             return state.DoS(100, error("CheckTransaction() : bad inputs"),
                              REJECT_INVALID, "bad-txns-inputs-stake");
         }
@@ -1505,6 +1503,110 @@ bool AcceptableInputs(CTxMemPool& pool, CValidationState& state, const CTransact
     return true;
 }
 
+/** Finalized block files kept memory mapped, least recently used is unmapped first */
+static CCriticalSection cs_mappedblockfiles;
+static lrucache<int, std::shared_ptr<const CMappedFile> > mappedBlockFiles(DEFAULT_MMAP_BLOCK_FILES);
+
+void SetMappedBlockFiles(unsigned int nFiles)
+{
+    LOCK(cs_mappedblockfiles);
+    mappedBlockFiles.max_size(nFiles);
+}
+
+/** Find the block stored at pos in a mapped block file, false if it has to be read through stdio */
+static bool GetMappedBlock(const CDiskBlockPos& pos, std::shared_ptr<const CMappedFile>& file, const char*& pbegin, const char*& pend)
+{
+    if (pos.IsNull())
+        return false;
+    {
+        // the last file still grows and is truncated when it is finalized
+        LOCK(cs_LastBlockFile);
+        if (pos.nFile >= nLastBlockFile)
+            return false;
+    }
+    {
+        LOCK(cs_mappedblockfiles);
+        if (mappedBlockFiles.max_size() == 0)
+            return false;
+        if (!mappedBlockFiles.get(pos.nFile, file)) {
+            file = CMappedFile::Open(GetBlockPosFilename(pos, "blk"));
+            if (!file)
+                return false;
+            mappedBlockFiles.insert(pos.nFile, file);
+        }
+    }
+
+    // the block is preceded by the message start and its size
+    if (pos.nPos < 8 || pos.nPos > file->size())
+        return false;
+    const char* p = file->data() + pos.nPos;
+    if (memcmp(p - 8, Params().MessageStart(), MESSAGE_START_SIZE) != 0)
+        return false;
+    unsigned int nSize = 0;
+    CSpanReader(SER_DISK, CLIENT_VERSION, p - 4, p) >> nSize;
+    if (nSize > file->size() - pos.nPos)
+        return false;
+
+    file->WillNeed(pos.nPos, nSize);
+    pbegin = p;
+    pend = p + nSize;
+    return true;
+}
+
+/** Recently read blocks and confirmed transactions, shared with the callers */
+static CCriticalSection cs_readcache;
+static lrucache<uint256, std::shared_ptr<const CBlock>, BlockHasher> blockReadCache(DEFAULT_BLOCK_READ_CACHE);
+static lrucache<uint256, std::pair<std::shared_ptr<const CTransaction>, uint256>, BlockHasher> txReadCache(DEFAULT_TX_READ_CACHE);
+static CReadCacheStats readCacheStats = {0, 0, 0, 0};
+
+CReadCacheStats GetReadCacheStats()
+{
+    LOCK(cs_readcache);
+    return readCacheStats;
+}
+
+static void CacheTransaction(const CTransaction& tx, const uint256& hashBlock)
+{
+    std::shared_ptr<const CTransaction> ptx = std::make_shared<const CTransaction>(tx);
+    LOCK(cs_readcache);
+    txReadCache.insert(tx.GetHash(), std::make_pair(ptx, hashBlock));
+}
+
+/** Return a confirmed transaction read before, if the result of reading it again would be the same */
+static bool GetCachedTransaction(const uint256& hash, CTransaction& txOut, uint256& hashBlock, bool fAllowSlow)
+{
+    AssertLockHeld(cs_main);
+
+    std::pair<std::shared_ptr<const CTransaction>, uint256> item;
+    {
+        LOCK(cs_readcache);
+        if (!txReadCache.get(hash, item)) {
+            readCacheStats.nTxMisses++;
+            return false;
+        }
+    }
+
+    // the block must still be in the active chain
+    BlockMap::iterator mi = mapBlockIndex.find(item.second);
+    bool fValid = mi != mapBlockIndex.end() && chainActive.Contains(mi->second);
+    if (fValid && !fTxIndex) {
+        // without the index the transaction is only found while it has unspent outputs
+        const CCoins* coins = pcoinsTip->AccessCoins(hash);
+        fValid = fAllowSlow && coins && coins->nHeight == mi->second->nHeight;
+    }
+
+    LOCK(cs_readcache);
+    if (!fValid) {
+        txReadCache.erase(hash);
+        readCacheStats.nTxMisses++;
+        return false;
+    }
+    readCacheStats.nTxHits++;
+    txOut = *item.first;
+    hashBlock = item.second;
+    return true;
+}
+
 /** Return transaction in tx, and if it was found inside a block, its hash is placed in hashBlock */
 bool GetTransaction(const uint256& hash, CTransaction& txOut, uint256& hashBlock, bool fAllowSlow)
 {
@@ -1517,23 +1619,41 @@ bool GetTransaction(const uint256& hash, CTransaction& txOut, uint256& hashBlock
             }
         }
 
+        if ((fTxIndex || fAllowSlow) && GetCachedTransaction(hash, txOut, hashBlock, fAllowSlow))
+            return true;
+
         if (fTxIndex) {
             CDiskTxPos postx;
             if (pblocktree->ReadTxIndex(hash, postx)) {
-                CAutoFile file(OpenBlockFile(postx, true), SER_DISK, CLIENT_VERSION);
-                if (file.IsNull())
-                    return error("%s: OpenBlockFile failed", __func__);
                 CBlockHeader header;
-                try {
-                    file >> header;
-                    fseek(file.Get(), postx.nTxOffset, SEEK_CUR);
-                    file >> txOut;
-                } catch (std::exception& e) {
-                    return error("%s : Deserialize or I/O error - %s", __func__, e.what());
+                std::shared_ptr<const CMappedFile> mapped;
+                const char* pbegin = NULL;
+                const char* pend = NULL;
+                if (GetMappedBlock(postx, mapped, pbegin, pend)) {
+                    try {
+                        CSpanReader span(SER_DISK, CLIENT_VERSION, pbegin, pend);
+                        span >> header;
+                        span.ignore(postx.nTxOffset);
+                        span >> txOut;
+                    } catch (std::exception& e) {
+                        return error("%s : Deserialize error - %s", __func__, e.what());
+                    }
+                } else {
+                    CAutoFile file(OpenBlockFile(postx, true), SER_DISK, CLIENT_VERSION);
+                    if (file.IsNull())
+                        return error("%s: OpenBlockFile failed", __func__);
+                    try {
+                        file >> header;
+                        fseek(file.Get(), postx.nTxOffset, SEEK_CUR);
+                        file >> txOut;
+                    } catch (std::exception& e) {
+                        return error("%s : Deserialize or I/O error - %s", __func__, e.what());
+                    }
                 }
                 hashBlock = header.GetHash();
                 if (txOut.GetHash() != hash)
                     return error("%s : txid mismatch", __func__);
+                CacheTransaction(txOut, hashBlock);
                 return true;
             }
         }
@@ -1552,12 +1672,13 @@ bool GetTransaction(const uint256& hash, CTransaction& txOut, uint256& hashBlock
     }
 
     if (pindexSlow) {
-        CBlock block;
-        if (ReadBlockFromDisk(block, pindexSlow)) {
-            BOOST_FOREACH (const CTransaction& tx, block.vtx) {
+        std::shared_ptr<const CBlock> pblock;
+        if (ReadBlockFromDiskCached(pblock, pindexSlow)) {
+            BOOST_FOREACH (const CTransaction& tx, pblock->vtx) {
                 if (tx.GetHash() == hash) {
                     txOut = tx;
                     hashBlock = pindexSlow->GetBlockHash();
+                    CacheTransaction(txOut, hashBlock);
                     return true;
                 }
             }
@@ -1598,16 +1719,27 @@ bool ReadBlockFromDisk(CBlock& block, const CDiskBlockPos& pos)
 {
     block.SetNull();
 
-    // Open history file to read
-    CAutoFile filein(OpenBlockFile(pos, true), SER_DISK, CLIENT_VERSION);
-    if (filein.IsNull())
-        return error("ReadBlockFromDisk : OpenBlockFile failed");
+    std::shared_ptr<const CMappedFile> mapped;
+    const char* pbegin = NULL;
+    const char* pend = NULL;
+    if (GetMappedBlock(pos, mapped, pbegin, pend)) {
+        try {
+            CSpanReader(SER_DISK, CLIENT_VERSION, pbegin, pend) >> block;
+        } catch (std::exception& e) {
+            return error("%s : Deserialize error - %s", __func__, e.what());
+        }
+    } else {
+        // Open history file to read
+        CAutoFile filein(OpenBlockFile(pos, true), SER_DISK, CLIENT_VERSION);
+        if (filein.IsNull())
+            return error("ReadBlockFromDisk : OpenBlockFile failed");
 
-    // Read block
-    try {
-        filein >> block;
-    } catch (std::exception& e) {
-        return error("%s : Deserialize or I/O error - %s", __func__, e.what());
+        // Read block
+        try {
+            filein >> block;
+        } catch (std::exception& e) {
+            return error("%s : Deserialize or I/O error - %s", __func__, e.what());
+        }
     }
 
     // Check the header
@@ -1630,6 +1762,28 @@ bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex)
     return true;
 }
 
+bool ReadBlockFromDiskCached(std::shared_ptr<const CBlock>& block, const CBlockIndex* pindex)
+{
+    const uint256 hash = pindex->GetBlockHash();
+    {
+        LOCK(cs_readcache);
+        if (blockReadCache.get(hash, block)) {
+            readCacheStats.nBlockHits++;
+            return true;
+        }
+        readCacheStats.nBlockMisses++;
+    }
+
+    std::shared_ptr<CBlock> pblock = std::make_shared<CBlock>();
+    if (!ReadBlockFromDisk(*pblock, pindex))
+        return false;
+    block = pblock;
+
+    LOCK(cs_readcache);
+    blockReadCache.insert(hash, block);
+    return true;
+}
+
 
 double ConvertBitsToDouble(unsigned int nBits)
 {
@@ -2091,7 +2245,7 @@ void static FlushBlockFile(bool fFinalize = false)
 
 bool FindUndoPos(CValidationState& state, int nFile, CDiskBlockPos& pos, unsigned int nAddSize);
 
-static CCheckQueue<CScriptCheck> scriptcheckqueue(128);
+static CCheckQueue<CBlockCheck> scriptcheckqueue(128);
 
 void ThreadScriptCheck()
 {
@@ -2132,18 +2286,74 @@ void ThreadScriptCheck()
 //    return flags;
 //}
 
+static int64_t nTimeCheckBlock = 0;
 static int64_t nTimeVerify = 0;
 static int64_t nTimeConnect = 0;
+static int64_t nTimeBlockValue = 0;
+static std::atomic<int64_t> nTimeBlockChecks(0);
 static int64_t nTimeIndex = 0;
 static int64_t nTimeCallbacks = 0;
 static int64_t nTimeTotal = 0;
 
+/**
+ * Closure checking that exploited coins spent by a transaction go to the
+ * redeem address. The spent outputs are taken from the view, so unlike
+ * CheckTransaction it needs neither cs_main nor the transaction index.
+ */
+class CRedeemCheck
+{
+private:
+    const CTransaction* ptx;
+    std::vector<RedeemData> exploited;
+    std::atomic<bool>* pfFailed;
+
+public:
+    CRedeemCheck(const CTransaction& tx, const std::vector<RedeemData>& exploitedIn, std::atomic<bool>* pfFailedIn) : ptx(&tx), exploited(exploitedIn), pfFailed(pfFailedIn) {}
+
+    bool operator()()
+    {
+        int64_t nTimeStart = GetTimeMicros();
+        bool fOk = coinValidator.RedeemAddressVerified(exploited, ptx->vout);
+        if (!fOk)
+            *pfFailed = true;
+        nTimeBlockChecks += GetTimeMicros() - nTimeStart;
+        return fOk;
+    }
+};
+
+bool CheckRedeem(const CTransaction& tx, CValidationState& state, const CCoinsViewCache& inputs, std::vector<CBlockCheck>* pvChecks, std::atomic<bool>* pfFailed)
+{
+    std::vector<RedeemData> exploited;
+    BOOST_FOREACH (const CTxIn& txin, tx.vin) {
+        if (!coinValidator.IsCoinValid(txin.prevout.hash)) {
+            const CTxOut& prevout = inputs.AccessCoins(txin.prevout.hash)->vout[txin.prevout.n];
+            exploited.emplace_back(txin.prevout.hash, prevout.scriptPubKey, prevout.nValue);
+        }
+    }
+    if (exploited.empty())
+        return true;
+
+    std::atomic<bool> fFailed(false);
+    CRedeemCheck check(tx, exploited, pfFailed ? pfFailed : &fFailed);
+    if (pvChecks) {
+        pvChecks->push_back(CBlockCheck(check));
+        return true;
+    }
+    if (!check())
+        return state.DoS(100, error("CheckRedeem() : bad inputs"),
+            REJECT_INVALID, "bad-txns-inputs-stake");
+    return true;
+}
+
 bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pindex, CCoinsViewCache& view, bool fJustCheck)
 {
     AssertLockHeld(cs_main);
-    // Check it again in case a previous version let a bad block in
-    if (!CheckBlock(block, state, !fJustCheck, !fJustCheck))
+    int64_t nTimeCheckStart = GetTimeMicros();
+    // Check it again in case a previous version let a bad block in,
+    // redeem of exploited coins is checked below from the view
+    if (!CheckBlock(block, state, !fJustCheck, !fJustCheck, true, false))
         return false;
+    nTimeCheckBlock += GetTimeMicros() - nTimeCheckStart;
 
     // verify that the view's current state corresponds to the previous block
     uint256 hashPrevBlock = pindex->pprev == NULL ? uint256() : pindex->pprev->GetBlockHash();
@@ -2210,7 +2420,12 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
 
     CBlockUndo blockundo;
 
-    CCheckQueueControl<CScriptCheck> control(fScriptChecks && nScriptCheckThreads ? &scriptcheckqueue : NULL);
+    // set by block level jobs, declared before control which waits for them
+    std::atomic<bool> fRedeemFailed(false);
+    bool fCheckRedeem = chainActive.Height() >= CoinValidator::CHAIN_HEIGHT;
+
+    bool fParallel = fScriptChecks && nScriptCheckThreads;
+    CCheckQueueControl<CBlockCheck> control(fParallel ? &scriptcheckqueue : NULL);
 
     int64_t nTimeStart = GetTimeMicros();
     CAmount nFees = 0;
@@ -2252,7 +2467,15 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
             std::vector<CScriptCheck> vChecks;
             if (!CheckInputs(tx, state, view, fScriptChecks, flags, false, nScriptCheckThreads ? &vChecks : NULL))
                 return false;
-            control.Add(vChecks);
+
+            std::vector<CBlockCheck> vBlockChecks(vChecks.size());
+            for (unsigned int j = 0; j < vChecks.size(); j++)
+                vBlockChecks[j].swap(vChecks[j]);
+
+            // Check for bad stake inputs, the spent outputs are still in the view
+            if (fCheckRedeem && !CheckRedeem(tx, state, view, fParallel ? &vBlockChecks : NULL, &fRedeemFailed))
+                return false;
+            control.Add(vBlockChecks);
         }
         nValueOut += tx.GetValueOut();
 
@@ -2278,6 +2501,7 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
     nTimeConnect += nTime1 - nTimeStart;
     LogPrint("bench", "      - Connect %u transactions: %.2fms (%.3fms/tx, %.3fms/txin) [%.2fs]\n", (unsigned)block.vtx.size(), 0.001 * (nTime1 - nTimeStart), 0.001 * (nTime1 - nTimeStart) / block.vtx.size(), nInputs <= 1 ? 0 : 0.001 * (nTime1 - nTimeStart) / (nInputs - 1), nTimeConnect * 0.000001);
 
+    // block level checks needing cs_main run here, while the queued checks run
     //PoW phase redistributed fees to miner. PoS stage destroys fees.
     CAmount nExpectedMint = GetBlockValue(pindex->pprev->nHeight);
     if (block.IsProofOfWork())
@@ -2290,9 +2514,14 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
                                    FormatMoney(pindex->nMint), FormatMoney(nExpectedMint)),
                              REJECT_INVALID, "bad-cb-amount");
     }
+    nTimeBlockValue += GetTimeMicros() - nTime1;
 
-    if (!control.Wait())
+    if (!control.Wait()) {
+        if (fRedeemFailed)
+            return state.DoS(100, error("ConnectBlock() : bad inputs"),
+                REJECT_INVALID, "bad-txns-inputs-stake");
         return state.DoS(100, false);
+    }
     int64_t nTime2 = GetTimeMicros();
     nTimeVerify += nTime2 - nTimeStart;
     LogPrint("bench", "    - Verify %u txins: %.2fms (%.3fms/txin) [%.2fs]\n", nInputs - 1, 0.001 * (nTime2 - nTimeStart), nInputs <= 1 ? 0 : 0.001 * (nTime2 - nTimeStart) / (nInputs - 1), nTimeVerify * 0.000001);
@@ -2485,6 +2714,7 @@ bool static DisconnectTip(CValidationState& state)
     BOOST_FOREACH (const CTransaction& tx, block.vtx) {
         SyncWithWallets(tx, NULL);
     }
+    GetMainSignals().BlockDisconnected(block, pindexDelete);
     return true;
 }
 
@@ -2493,6 +2723,29 @@ static int64_t nTimeConnectTotal = 0;
 static int64_t nTimeFlush = 0;
 static int64_t nTimeChainState = 0;
 static int64_t nTimePostConnect = 0;
+static int64_t nBlocksConnected = 0;
+
+CBlockValidationStats GetBlockValidationStats()
+{
+    AssertLockHeld(cs_main);
+
+    CBlockValidationStats stats;
+    stats.nBlocks = nBlocksConnected;
+    stats.nTimeCheckBlock = nTimeCheckBlock;
+    stats.nTimeConnect = nTimeConnect;
+    stats.nTimeBlockValue = nTimeBlockValue;
+    stats.nTimeVerify = nTimeVerify;
+    stats.nTimeBlockChecks = nTimeBlockChecks;
+    stats.nTimeIndex = nTimeIndex;
+    stats.nTimeCallbacks = nTimeCallbacks;
+    stats.nTimeReadFromDisk = nTimeReadFromDisk;
+    stats.nTimeConnectTotal = nTimeConnectTotal;
+    stats.nTimeFlush = nTimeFlush;
+    stats.nTimeChainState = nTimeChainState;
+    stats.nTimePostConnect = nTimePostConnect;
+    stats.nTimeTotal = nTimeTotal;
+    return stats;
+}
 
 /**
  * Connect a new block to chainActive. pblock is either NULL or a pointer to a CBlock
@@ -2561,10 +2814,12 @@ bool static ConnectTip(CValidationState& state, CBlockIndex* pindexNew, CBlock*
     BOOST_FOREACH (const CTransaction& tx, pblock->vtx) {
         SyncWithWallets(tx, pblock);
     }
+    GetMainSignals().BlockConnected(*pblock, pindexNew);
 
     int64_t nTime6 = GetTimeMicros();
     nTimePostConnect += nTime6 - nTime5;
     nTimeTotal += nTime6 - nTime1;
+    nBlocksConnected++;
     LogPrint("bench", "  - Connect postprocess: %.2fms [%.2fs]\n", (nTime6 - nTime5) * 0.001, nTimePostConnect * 0.000001);
     LogPrint("bench", "- Connect block: %.2fms [%.2fs]\n", (nTime6 - nTime1) * 0.001, nTimeTotal * 0.000001);
     return true;
@@ -3128,7 +3383,7 @@ bool CheckBlockHeader(const CBlockHeader& block, CValidationState& state, bool f
     return true;
 }
 
-bool CheckBlock(const CBlock& block, CValidationState& state, bool /*fCheckPOW*/, bool fCheckMerkleRoot, bool /*fCheckSig*/)
+bool CheckBlock(const CBlock& block, CValidationState& state, bool /*fCheckPOW*/, bool fCheckMerkleRoot, bool /*fCheckSig*/, bool fCheckRedeem)
 {
     // These are checks that are independent of context.
 
@@ -3243,7 +3498,7 @@ bool CheckBlock(const CBlock& block, CValidationState& state, bool /*fCheckPOW*/
 
     // Check transactions
     BOOST_FOREACH (const CTransaction& tx, block.vtx)
-        if (!CheckTransaction(tx, state))
+        if (!CheckTransaction(tx, state, fCheckRedeem))
             return error("CheckBlock() : CheckTransaction failed");
 
     unsigned int nSigOps = 0;
@@ -3690,6 +3945,26 @@ boost::filesystem::path GetBlockPosFilename(const CDiskBlockPos& pos, const char
     return GetDataDir() / "blocks" / strprintf("%s%05u.dat", prefix, pos.nFile);
 }
 
+/** Block index entries loaded from the block tree database, each vector is one allocation */
+static std::list<std::vector<CBlockIndex> > listBlockIndexArenas;
+
+CBlockIndex* AddBlockIndexArena(std::vector<CBlockIndex>& vIndex)
+{
+    listBlockIndexArenas.push_back(std::vector<CBlockIndex>());
+    listBlockIndexArenas.back().swap(vIndex);
+    return listBlockIndexArenas.back().empty() ? NULL : &listBlockIndexArenas.back()[0];
+}
+
+static bool IsInBlockIndexArena(const CBlockIndex* pindex)
+{
+    std::less<const CBlockIndex*> less;
+    BOOST_FOREACH (const std::vector<CBlockIndex>& vIndex, listBlockIndexArenas) {
+        if (!vIndex.empty() && !less(pindex, &vIndex.front()) && !less(&vIndex.back(), pindex))
+            return true;
+    }
+    return false;
+}
+
 CBlockIndex* InsertBlockIndex(uint256 hash)
 {
     if (hash == 0)
@@ -3717,8 +3992,10 @@ CBlockIndex* InsertBlockIndex(uint256 hash)
 
 bool static LoadBlockIndexDB()
 {
+    int64_t nTimeStart = GetTimeMicros();
     if (!pblocktree->LoadBlockIndexGuts())
         return false;
+    int64_t nTimeGuts = GetTimeMicros();
 
     boost::this_thread::interruption_point();
 
@@ -3754,6 +4031,9 @@ bool static LoadBlockIndexDB()
         if (pindex->IsValid(BLOCK_VALID_TREE) && (pindexBestHeader == NULL || CBlockIndexWorkComparator()(pindexBestHeader, pindex)))
             pindexBestHeader = pindex;
     }
+    int64_t nTimeChainWork = GetTimeMicros();
+    LogPrintf("%s: loaded %u block index entries in %.2fms, chain work %.2fms\n", __func__,
+        mapBlockIndex.size(), 0.001 * (nTimeGuts - nTimeStart), 0.001 * (nTimeChainWork - nTimeGuts));
 
     // Load block file info
     pblocktree->ReadLastBlockFile(nLastBlockFile);
@@ -3787,6 +4067,7 @@ bool static LoadBlockIndexDB()
             return false;
         }
     }
+    LogPrintf("%s: block file info and presence checked in %.2fms\n", __func__, 0.001 * (GetTimeMicros() - nTimeChainWork));
 
     //Check if the shutdown procedure was followed on last client exit
     bool fLastShutdownWasPrepared = true;
@@ -5566,69 +5847,16 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
         vRecv >> raw;
 
         // Top-level validation checks
-        if (raw.size() < (20 + sizeof(time_t)))
+        if (raw.size() < (20 + sizeof(uint64_t)))
         {
             // bad packet, small penalty (don't relay)
             Misbehaving(pfrom->GetId(), 10);
         }
         else
         {
-            // packet's top-level hash
-            uint256 hash = Hash(raw.begin(), raw.end());
-            auto &app = xbridge::App::instance();
-
-            // If we haven't seen this packet before, proceed
-            if (!app.isKnownMessage(hash))
-            {
-                app.addToKnown(hash);
-
-                // Relay packets we haven't seen before
-                {
-                    LOCK(cs_vNodes);
-                    for  (CNode * pnode : vNodes)
-                        pnode->PushMessage("xbridge", raw);
-                }
-
-                // Only process the packet if we are an exchange capable node, a servicenode, or xrouter node
-                if (app.isEnabled() || GetBoolArg("-xrouter", false))
-                {
-                    CValidationState state;
-
-                    static std::vector<unsigned char> zero(20, 0);
-                    std::vector<unsigned char> addr(raw.begin(), raw.begin()+20);
-                    // remove addr from raw
-                    raw.erase(raw.begin(), raw.begin()+20);
-                    // remove timestamp from raw
-                    raw.erase(raw.begin(), raw.begin()+sizeof(uint64_t));
-
-                    if (addr != zero)
-                    {
-                        app.onMessageReceived(addr, raw, state);
-                    }
-                    else
-                    {
-                        app.onBroadcastReceived(raw, state);
-                    }
-
-                    int dos = 0;
-                    if (state.IsInvalid(dos))
-                    {
-                        LogPrint("xbridge", "invalid xbridge packet from peer=%d %s : %s\n",
-                            pfrom->id, pfrom->cleanSubVer,
-                            state.GetRejectReason());
-                        if (dos > 0)
-                        {
-                            Misbehaving(pfrom->GetId(), dos);
-                        }
-                    }
-                    else if (state.IsError())
-                    {
-                        LogPrint("xbridge", "xbridge packet from peer=%d %s processed with error: %s\n",
-                            pfrom->id, pfrom->cleanSubVer,
-                            state.GetRejectReason());
-                    }
-                }
-            }
+            // relay and processing run on the xbridge ingress threads,
+            // known packets and packets over the queue limits are dropped
+            xbridge::App::instance().enqueuePacket(pfrom->GetId(), std::move(raw));
         }
     }
 
@@ -6111,9 +6339,12 @@ public:
     {
         // block headers
         BlockMap::iterator it1 = mapBlockIndex.begin();
-        for (; it1 != mapBlockIndex.end(); it1++)
-            delete (*it1).second;
+        for (; it1 != mapBlockIndex.end(); it1++) {
+            if (!IsInBlockIndexArena((*it1).second))
+                delete (*it1).second;
+        }
         mapBlockIndex.clear();
+        listBlockIndexArenas.clear();
 
         // orphan transactions
         mapOrphanTransactions.clear();
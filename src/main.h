@@ -32,8 +32,11 @@
 #include "validationstate.h"
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
+#include <functional>
 #include <map>
+#include <memory>
 #include <set>
 #include <stdint.h>
 #include <string>
@@ -82,6 +85,12 @@ static const int COINBASE_MATURITY = 100;
 static const int MAX_SCRIPTCHECK_THREADS = 16;
 /** -par default (number of script-checking threads, 0 = auto) */
 static const int DEFAULT_SCRIPTCHECK_THREADS = 0;
+/** Number of recently read blocks kept deserialized */
+static const unsigned int DEFAULT_BLOCK_READ_CACHE = 16;
+/** Number of recently read confirmed transactions kept deserialized */
+static const unsigned int DEFAULT_TX_READ_CACHE = 5000;
+/** -mmapblockfiles default (number of finalized block files kept memory mapped, 0 = read through stdio) */
+static const unsigned int DEFAULT_MMAP_BLOCK_FILES = 0;
 /** Number of blocks that can be requested at any given time from a single peer. */
 static const int MAX_BLOCKS_IN_TRANSIT_PER_PEER = 16;
 /** Timeout in seconds during which a peer must stall block download progress before being disconnected. */
@@ -232,6 +241,9 @@ CAmount GetBlockValue(int nHeight);
 
 /** Create a new block index entry for a given block hash */
 CBlockIndex* InsertBlockIndex(uint256 hash);
+/** Take ownership of block index entries allocated in bulk, returns their final address.
+ *  They are freed together at shutdown and must not be deleted one by one. */
+CBlockIndex* AddBlockIndexArena(std::vector<CBlockIndex>& vIndex);
 /** Abort with a message */
 // bool AbortNode(const std::string& msg, const std::string& userMessage = "");
 /** Get statistics from node state */
@@ -337,7 +349,7 @@ bool CheckInputs(const CTransaction& tx, CValidationState& state, const CCoinsVi
 void UpdateCoins(const CTransaction& tx, CValidationState& state, CCoinsViewCache& inputs, CTxUndo& txundo, int nHeight);
 
 /** Context-independent validity checks */
-bool CheckTransaction(const CTransaction& tx, CValidationState& state);
+bool CheckTransaction(const CTransaction& tx, CValidationState& state, bool fCheckRedeem = true);
 
 /**
  * Check if transaction will be final in the next block to be created.
@@ -408,11 +420,82 @@ public:
     ScriptError GetScriptError() const { return error; }
 };
 
+/**
+ * Closure representing one block level verification, processed by the
+ * script check threads together with script checks. A job must not take
+ * cs_main, it is held by the thread waiting for the queue.
+ */
+class CBlockCheck
+{
+private:
+    CScriptCheck script;
+    std::function<bool()> job;
+
+public:
+    CBlockCheck() {}
+    explicit CBlockCheck(const std::function<bool()>& jobIn) : job(jobIn) {}
+
+    bool operator()()
+    {
+        return job ? job() : script();
+    }
+
+    void swap(CBlockCheck& check)
+    {
+        script.swap(check.script);
+        job.swap(check.job);
+    }
+
+    void swap(CScriptCheck& check)
+    {
+        script.swap(check);
+    }
+};
+
+/** Time spent in the stages of block validation since startup, in microseconds */
+struct CBlockValidationStats {
+    int64_t nBlocks;
+    //! CheckBlock, including servicenode and budget payee checks
+    int64_t nTimeCheckBlock;
+    //! Transactions applied to the view, script checks queued
+    int64_t nTimeConnect;
+    //! Block value and budget check, done while script checks run
+    int64_t nTimeBlockValue;
+    //! Until all queued checks finished, from start of Connect
+    int64_t nTimeVerify;
+    //! Sum of block level jobs run on the check threads
+    int64_t nTimeBlockChecks;
+    int64_t nTimeIndex;
+    int64_t nTimeCallbacks;
+    int64_t nTimeReadFromDisk;
+    int64_t nTimeConnectTotal;
+    int64_t nTimeFlush;
+    int64_t nTimeChainState;
+    int64_t nTimePostConnect;
+    int64_t nTimeTotal;
+};
+
+/** Totals of block validation stage timings, requires cs_main */
+CBlockValidationStats GetBlockValidationStats();
+
 
 /** Functions for disk access for blocks */
 bool WriteBlockToDisk(CBlock& block, CDiskBlockPos& pos);
 bool ReadBlockFromDisk(CBlock& block, const CDiskBlockPos& pos);
 bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex);
+/** Read block through the cache of recently read blocks, the block is shared and must not be changed */
+bool ReadBlockFromDiskCached(std::shared_ptr<const CBlock>& block, const CBlockIndex* pindex);
+/** Set how many finalized block files are read through memory maps, 0 disables them */
+void SetMappedBlockFiles(unsigned int nFiles);
+
+/** Hits and misses of the block and transaction read caches since startup */
+struct CReadCacheStats {
+    int64_t nBlockHits;
+    int64_t nBlockMisses;
+    int64_t nTxHits;
+    int64_t nTxMisses;
+};
+CReadCacheStats GetReadCacheStats();
 
 
 /** Functions for validating blocks and updating the block tree */
@@ -426,12 +509,19 @@ bool DisconnectBlock(CBlock& block, CValidationState& state, CBlockIndex* pindex
 /** Reprocess a number of blocks to try and get on the correct chain again **/
 bool DisconnectBlocksAndReprocess(int blocks);
 
+/**
+ * Check that exploited coins spent by tx go to the redeem address, the spent outputs are
+ * read from inputs. If pvChecks is not NULL the check is added to it and sets *pfFailed
+ * when it fails, otherwise it runs in place.
+ */
+bool CheckRedeem(const CTransaction& tx, CValidationState& state, const CCoinsViewCache& inputs, std::vector<CBlockCheck>* pvChecks = NULL, std::atomic<bool>* pfFailed = NULL);
+
 /** Apply the effects of this block (with given index) on the UTXO set represented by coins */
 bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pindex, CCoinsViewCache& coins, bool fJustCheck = false);
 
 /** Context-independent validity checks */
 bool CheckBlockHeader(const CBlockHeader& block, CValidationState& state, bool fCheckPOW = true);
-bool CheckBlock(const CBlock& block, CValidationState& state, bool fCheckPOW = true, bool fCheckMerkleRoot = true, bool fCheckSig = true);
+bool CheckBlock(const CBlock& block, CValidationState& state, bool fCheckPOW = true, bool fCheckMerkleRoot = true, bool fCheckSig = true, bool fCheckRedeem = true);
 bool CheckWork(const CBlock block, CBlockIndex* const pindexPrev);
 
 /** Context-dependent validity checks */
@@ -0,0 +1,74 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "mappedfile.h"
+
+#include "util.h"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h> // for sysconf
+#endif
+
+CMappedFile::CMappedFile(void* pDataIn, size_t nSizeIn) : pData(pDataIn), nSize(nSizeIn)
+{
+}
+
+CMappedFile::~CMappedFile()
+{
+#ifndef WIN32
+    munmap(pData, nSize);
+#endif
+}
+
+std::shared_ptr<const CMappedFile> CMappedFile::Open(const boost::filesystem::path& path)
+{
+#ifdef WIN32
+    return std::shared_ptr<const CMappedFile>();
+#else
+    int fd = open(path.string().c_str(), O_RDONLY);
+    if (fd == -1) {
+        LogPrintf("Unable to open file %s\n", path.string());
+        return std::shared_ptr<const CMappedFile>();
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return std::shared_ptr<const CMappedFile>();
+    }
+
+    void* p = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping keeps its own reference to the file
+    close(fd);
+    if (p == MAP_FAILED) {
+        LogPrintf("Unable to map file %s\n", path.string());
+        return std::shared_ptr<const CMappedFile>();
+    }
+
+#ifdef MADV_RANDOM
+    // blocks are read one at a time, read ahead of the whole file would be wasted
+    madvise(p, st.st_size, MADV_RANDOM);
+#endif
+
+    return std::shared_ptr<const CMappedFile>(new CMappedFile(p, st.st_size));
+#endif
+}
+
+void CMappedFile::WillNeed(size_t nOffset, size_t nLength) const
+{
+#if !defined(WIN32) && defined(MADV_WILLNEED)
+    if (nOffset >= nSize || nLength == 0)
+        return;
+    if (nLength > nSize - nOffset)
+        nLength = nSize - nOffset;
+
+    // madvise takes page aligned ranges
+    static const size_t nPageSize = sysconf(_SC_PAGESIZE);
+    size_t nBegin = nOffset - nOffset % nPageSize;
+    madvise(static_cast<char*>(pData) + nBegin, nOffset + nLength - nBegin, MADV_WILLNEED);
+#endif
+}
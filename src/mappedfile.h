@@ -0,0 +1,41 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_MAPPEDFILE_H
+#define BITCOIN_MAPPEDFILE_H
+
+#include <memory>
+#include <stddef.h>
+
+#include <boost/filesystem/path.hpp>
+
+/** Read only memory map of a whole file, unmapped when the last reference goes away.
+ *  The file must not be truncated while it is mapped.
+ */
+class CMappedFile
+{
+private:
+    // Disallow copies
+    CMappedFile(const CMappedFile&);
+    CMappedFile& operator=(const CMappedFile&);
+
+    CMappedFile(void* pDataIn, size_t nSizeIn);
+
+    void* pData;
+    size_t nSize;
+
+public:
+    ~CMappedFile();
+
+    /** Map the file at path, returns null if it can't be mapped or on platforms without mmap */
+    static std::shared_ptr<const CMappedFile> Open(const boost::filesystem::path& path);
+
+    const char* data() const { return static_cast<const char*>(pData); }
+    size_t size() const { return nSize; }
+
+    /** Hint that the range will be read soon */
+    void WillNeed(size_t nOffset, size_t nLength) const;
+};
+
+#endif // BITCOIN_MAPPEDFILE_H
@@ -193,8 +193,10 @@ std::string BlockToString(CBlockIndex* pBlock)
     if (!pBlock)
         return "";
 
-    CBlock block;
-    ReadBlockFromDisk(block, pBlock);
+    std::shared_ptr<const CBlock> pblock;
+    if (!ReadBlockFromDiskCached(pblock, pBlock))
+        return "";
+    const CBlock& block = *pblock;
 
     int64_t Fees = 0;
     int64_t OutVolume = 0;
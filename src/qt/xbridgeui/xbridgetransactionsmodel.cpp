@@ -317,6 +317,7 @@ void XBridgeTransactionsModel::onTimer()
                  td.total_seconds() > xbridge::Transaction::pendingTTL)
         {
             m_transactions[i]->state = xbridge::TransactionDescr::trExpired;
+            xbridge::App::instance().updateOrderBook(m_transactions[i]);
             emit dataChanged(index(i, FirstColumn), index(i, LastColumn));
         }
         else if ((m_transactions[i]->state == xbridge::TransactionDescr::trExpired ||
@@ -324,6 +325,7 @@ void XBridgeTransactionsModel::onTimer()
                  td.total_seconds() < xbridge::Transaction::pendingTTL)
         {
             m_transactions[i]->state = xbridge::TransactionDescr::trPending;
+            xbridge::App::instance().updateOrderBook(m_transactions[i]);
             emit dataChanged(index(i, FirstColumn), index(i, LastColumn));
         }
         else if ((m_transactions[i]->state == xbridge::TransactionDescr::trExpired ||
@@ -634,6 +634,76 @@ Value getmempoolinfo(const Array& params, bool fHelp)
     return ret;
 }
 
+Value getblockvalidationstats(const Array& params, bool fHelp)
+{
+    if (fHelp || params.size() != 0)
+        throw runtime_error(
+            "getblockvalidationstats\n"
+            "\nReturns time spent in the stages of connecting blocks since startup.\n"
+            "\nResult:\n"
+            "{\n"
+            "  \"blocks\": xxxxx            (numeric) Blocks connected\n"
+            "  \"stages\": {                (object) Total milliseconds by stage\n"
+            "    \"checkblock\": x.xxx      (numeric) CheckBlock, including servicenode and budget payee checks\n"
+            "    \"connect\": x.xxx         (numeric) Transactions applied and script checks queued\n"
+            "    \"blockvalue\": x.xxx      (numeric) Block value check, done while queued checks run\n"
+            "    \"verify\": x.xxx          (numeric) Until all queued checks finished, includes connect\n"
+            "    \"blockchecks\": x.xxx     (numeric) Sum of block level checks run on the check threads\n"
+            "    \"index\": x.xxx           (numeric) Undo and index writing\n"
+            "    \"callbacks\": x.xxx       (numeric) Callbacks\n"
+            "    \"readfromdisk\": x.xxx    (numeric) Loading blocks from disk\n"
+            "    \"connecttotal\": x.xxx    (numeric) ConnectBlock total\n"
+            "    \"flush\": x.xxx           (numeric) Flushing the view\n"
+            "    \"chainstate\": x.xxx      (numeric) Writing chainstate\n"
+            "    \"postconnect\": x.xxx     (numeric) Mempool, wallet and signals\n"
+            "    \"total\": x.xxx           (numeric) Connecting blocks total\n"
+            "  },\n"
+            "  \"readcache\": {             (object) Block and transaction read cache\n"
+            "    \"blockhits\": n           (numeric) Blocks served from the cache\n"
+            "    \"blockmisses\": n         (numeric) Blocks read from disk\n"
+            "    \"txhits\": n              (numeric) Transactions served from the cache\n"
+            "    \"txmisses\": n            (numeric) Transactions looked up elsewhere\n"
+            "  }\n"
+            "}\n"
+            "\nExamples:\n" +
+            HelpExampleCli("getblockvalidationstats", "") + HelpExampleRpc("getblockvalidationstats", ""));
+
+    CBlockValidationStats stats;
+    {
+        LOCK(cs_main);
+        stats = GetBlockValidationStats();
+    }
+
+    Object stages;
+    stages.push_back(Pair("checkblock", 0.001 * stats.nTimeCheckBlock));
+    stages.push_back(Pair("connect", 0.001 * stats.nTimeConnect));
+    stages.push_back(Pair("blockvalue", 0.001 * stats.nTimeBlockValue));
+    stages.push_back(Pair("verify", 0.001 * stats.nTimeVerify));
+    stages.push_back(Pair("blockchecks", 0.001 * stats.nTimeBlockChecks));
+    stages.push_back(Pair("index", 0.001 * stats.nTimeIndex));
+    stages.push_back(Pair("callbacks", 0.001 * stats.nTimeCallbacks));
+    stages.push_back(Pair("readfromdisk", 0.001 * stats.nTimeReadFromDisk));
+    stages.push_back(Pair("connecttotal", 0.001 * stats.nTimeConnectTotal));
+    stages.push_back(Pair("flush", 0.001 * stats.nTimeFlush));
+    stages.push_back(Pair("chainstate", 0.001 * stats.nTimeChainState));
+    stages.push_back(Pair("postconnect", 0.001 * stats.nTimePostConnect));
+    stages.push_back(Pair("total", 0.001 * stats.nTimeTotal));
+
+    CReadCacheStats cacheStats = GetReadCacheStats();
+    Object readcache;
+    readcache.push_back(Pair("blockhits", cacheStats.nBlockHits));
+    readcache.push_back(Pair("blockmisses", cacheStats.nBlockMisses));
+    readcache.push_back(Pair("txhits", cacheStats.nTxHits));
+    readcache.push_back(Pair("txmisses", cacheStats.nTxMisses));
+
+    Object ret;
+    ret.push_back(Pair("blocks", stats.nBlocks));
+    ret.push_back(Pair("stages", stages));
+    ret.push_back(Pair("readcache", readcache));
+
+    return ret;
+}
+
 Value invalidateblock(const Array& params, bool fHelp)
 {
     if (fHelp || params.size() != 1)
@@ -260,6 +260,7 @@ static const CRPCCommand vRPCCommands[] =
         {"blockchain", "getblock", &getblock, true, false, false},
         {"blockchain", "getblockhash", &getblockhash, true, false, false},
         {"blockchain", "getblockheader", &getblockheader, false, false, false},
+        {"blockchain", "getblockvalidationstats", &getblockvalidationstats, true, false, false},
         {"blockchain", "getchaintips", &getchaintips, true, false, false},
         {"blockchain", "getdifficulty", &getdifficulty, true, false, false},
         {"blockchain", "getmempoolinfo", &getmempoolinfo, true, true, false},
@@ -381,6 +382,8 @@ static const CRPCCommand vRPCCommands[] =
         {"xbridge", "dxGetMyOrders",                        &dxGetMyOrders,              false, true, true},
         {"xbridge", "dxGetLockedUtxos",                     &dxGetLockedUtxos,           false, true, true},
         {"xbridge", "dxFlushCancelledOrders",               &dxFlushCancelledOrders,     false, true, true},
+        {"xbridge", "dxGetConnectionPoolStats",             &dxGetConnectionPoolStats,   false, true, true},
+        {"xbridge", "dxGetMessageFilterStats",              &dxGetMessageFilterStats,    false, true, true},
         {"xbridge", "gettradingdata",                       &gettradingdata,             false, true, true},
     #endif // ENABLE_WALLET
 };
@@ -237,6 +237,7 @@ extern json_spirit::Value getrawmempool(const json_spirit::Array& params, bool f
 extern json_spirit::Value getblockhash(const json_spirit::Array& params, bool fHelp);
 extern json_spirit::Value getblock(const json_spirit::Array& params, bool fHelp);
 extern json_spirit::Value getblockheader(const json_spirit::Array& params, bool fHelp);
+extern json_spirit::Value getblockvalidationstats(const json_spirit::Array& params, bool fHelp);
 extern json_spirit::Value gettxoutsetinfo(const json_spirit::Array& params, bool fHelp);
 extern json_spirit::Value gettxout(const json_spirit::Array& params, bool fHelp);
 extern json_spirit::Value verifychain(const json_spirit::Array& params, bool fHelp);
@@ -643,6 +644,48 @@ extern json_spirit::Value  dxGetTokenBalances(const json_spirit::Array& params,
 extern json_spirit::Value dxFlushCancelledOrders(const json_spirit::Array& params, bool fHelp);
 /** @} */
 
+/**
+ * @brief Returns counters of the keep-alive rpc connection pool for each connected wallet
+ * @param params The list of input params, should be empty
+ * @param fHelp If is true then an exception with parameter description message will be thrown
+ * @return Pool counters by currency: hits - requests sent on a pooled connection,
+ * misses - requests that opened a new connection, reconnects - stale idle connection
+ * replaced before sending, evicted - idle connections dropped, idle - pooled connections now
+ * * Example:<br>
+ * \verbatim
+    dxGetConnectionPoolStats
+    {
+        "LTC" : {
+            "hits" : 182,
+            "misses" : 4,
+            "reconnects" : 1,
+            "evicted" : 2,
+            "idle" : 2
+        }
+    }
+ * \endverbatim
+ */
+extern json_spirit::Value dxGetConnectionPoolStats(const json_spirit::Array& params, bool fHelp);
+
+/**
+ * @brief Returns counters of the filter of processed xbridge messages
+ * @param params The list of input params, should be empty
+ * @param fHelp If is true then an exception with parameter description message will be thrown
+ * @return Filter counters
+ * * Example:<br>
+ * \verbatim
+    dxGetMessageFilterStats
+    {
+        "capacity" : 2000000,
+        "entries" : 48211,
+        "inserted" : 48211,
+        "hits" : 193410,
+        "memory" : 21564960
+    }
+ * \endverbatim
+ */
+extern json_spirit::Value dxGetMessageFilterStats(const json_spirit::Array& params, bool fHelp);
+
 /**
  * @brief gettradingdata
  * @param params
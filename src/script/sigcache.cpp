@@ -5,13 +5,16 @@
 
 #include "sigcache.h"
 
+#include "crypto/sha256.h"
+#include "cuckoocache.h"
 #include "pubkey.h"
 #include "random.h"
 #include "uint256.h"
 #include "util.h"
 
+#include <array>
+
 #include <boost/thread.hpp>
-#include <boost/tuple/tuple_comparison.hpp>
 
 namespace {
 
@@ -19,72 +22,125 @@ namespace {
  * Valid signature cache, to avoid doing expensive ECDSA signature checking
  * twice for every transaction (once when accepted into memory pool, and
  * again when accepted into the block chain)
+ *
+ * Entries are salted 32 byte digests in cuckoo tables. The cache is split
+ * in shards with own locks, so script check threads storing entries don't
+ * wait for each other, lookups only take a shared lock.
  */
 class CSignatureCache
 {
 private:
-     //! sigdata_type is (signature hash, signature, public key):
-    typedef boost::tuple<uint256, std::vector<unsigned char>, CPubKey> sigdata_type;
-    std::set< sigdata_type> setValid;
-    boost::shared_mutex cs_sigcache;
+    //! Entries are SHA256(nonce || signature hash || public key || signature):
+    uint256 nonce;
+
+    struct Shard
+    {
+        CuckooCache::cache<uint256, SignatureCacheHasher> setValid;
+        boost::shared_mutex cs_sigcache;
+    };
+
+    static const size_t nShards = 8;
+    std::array<Shard, nShards> shards;
+    //! Set once by Setup before script checks start
+    bool fEnabled;
+
+    Shard& GetShard(const uint256& entry)
+    {
+        // hashes of the table use whole words, the low bits of a byte select the shard
+        return shards[*entry.begin() % nShards];
+    }
 
 public:
+    CSignatureCache() : fEnabled(false)
+    {
+        GetRandBytes(nonce.begin(), 32);
+    }
+
+    void
+    ComputeEntry(uint256& entry, const uint256 &hash, const std::vector<unsigned char>& vchSig, const CPubKey& pubkey)
+    {
+        CSHA256().Write(nonce.begin(), 32).Write(hash.begin(), 32).Write(pubkey.begin(), pubkey.size()).Write(vchSig.data(), vchSig.size()).Finalize(entry.begin());
+    }
+
     bool
-    Get(const uint256 &hash, const std::vector<unsigned char>& vchSig, const CPubKey& pubKey)
+    Get(const uint256& entry, const bool erase)
     {
-        boost::shared_lock<boost::shared_mutex> lock(cs_sigcache);
+        if (!fEnabled)
+            return false;
 
-        sigdata_type k(hash, vchSig, pubKey);
-        std::set<sigdata_type>::iterator mi = setValid.find(k);
-        if (mi != setValid.end())
-            return true;
-        return false;
+        Shard& shard = GetShard(entry);
+        boost::shared_lock<boost::shared_mutex> lock(shard.cs_sigcache);
+        return shard.setValid.contains(entry, erase);
     }
 
-    void Set(const uint256 &hash, const std::vector<unsigned char>& vchSig, const CPubKey& pubKey)
+    void Set(const uint256& entry)
     {
-        // DoS prevention: limit cache size to less than 10MB
-        // (~200 bytes per cache entry times 50,000 entries)
-        // Since there are a maximum of 20,000 signature operations per block
-        // 50,000 is a reasonable default.
-        int64_t nMaxCacheSize = GetArg("-maxsigcachesize", 50000);
-        if (nMaxCacheSize <= 0) return;
-
-        boost::unique_lock<boost::shared_mutex> lock(cs_sigcache);
-
-        while (static_cast<int64_t>(setValid.size()) > nMaxCacheSize)
-        {
-            // Evict a random entry. Random because that helps
-            // foil would-be DoS attackers who might try to pre-generate
-            // and re-use a set of valid signatures just-slightly-greater
-            // than our cache size.
-            uint256 randomHash = GetRandHash();
-            std::vector<unsigned char> unused;
-            std::set<sigdata_type>::iterator it =
-                setValid.lower_bound(sigdata_type(randomHash, unused, CPubKey(unused)));
-            if (it == setValid.end())
-                it = setValid.begin();
-            setValid.erase(*it);
-        }
+        if (!fEnabled)
+            return;
+
+        Shard& shard = GetShard(entry);
+        boost::unique_lock<boost::shared_mutex> lock(shard.cs_sigcache);
+        shard.setValid.insert(entry);
+    }
 
-        sigdata_type k(hash, vchSig, pubKey);
-        setValid.insert(k);
+    uint32_t Setup(size_t nBytes)
+    {
+        uint32_t nElems = 0;
+        for (Shard& shard : shards) {
+            boost::unique_lock<boost::shared_mutex> lock(shard.cs_sigcache);
+            nElems += shard.setValid.setup_bytes(nBytes / nShards);
+        }
+        fEnabled = nBytes > 0;
+        return nElems;
     }
 };
 
+/* In previous versions of this code, signatureCache was a local static variable
+ * in CachingTransactionSignatureChecker::VerifySignature.  We initialize
+ * signatureCache outside of VerifySignature to avoid the atomic operation per
+ * call overhead associated with local static variables even though
+ * signatureCache could be made local to VerifySignature.
+*/
+static CSignatureCache signatureCache;
+}
+
+size_t GetSignatureCacheBytes(int64_t nMaxSigCacheSize, bool* pfLegacy)
+{
+    // -maxsigcachesize is in MiB, zero disables the cache
+    bool fLegacy = nMaxSigCacheSize > MAX_MAX_SIG_CACHE_SIZE;
+    if (pfLegacy)
+        *pfLegacy = fLegacy;
+    if (fLegacy)
+        return std::min((size_t)nMaxSigCacheSize, ((size_t)MAX_MAX_SIG_CACHE_SIZE << 20) / SIG_CACHE_LEGACY_ENTRY_SIZE) * SIG_CACHE_LEGACY_ENTRY_SIZE;
+    return (size_t)std::max((int64_t)0, nMaxSigCacheSize) << 20;
+}
+
+// To be called once in AppInit2/TestingSetup to initialize the signatureCache
+void InitSignatureCache()
+{
+    bool fLegacy = false;
+    size_t nMaxCacheSize = GetSignatureCacheBytes(GetArg("-maxsigcachesize", DEFAULT_MAX_SIG_CACHE_SIZE), &fLegacy);
+    if (fLegacy)
+        LogPrintf("Warning: -maxsigcachesize=%d is above %d MiB, read as a number of entries. The option is now in MiB.\n",
+                  GetArg("-maxsigcachesize", DEFAULT_MAX_SIG_CACHE_SIZE), MAX_MAX_SIG_CACHE_SIZE);
+    uint32_t nElems = signatureCache.Setup(nMaxCacheSize);
+    LogPrintf("Using %zu MiB out of %zu requested for signature cache, able to store %zu elements\n",
+              (nElems * sizeof(uint256)) >> 20, nMaxCacheSize >> 20, nElems);
 }
 
 bool CachingTransactionSignatureChecker::VerifySignature(const std::vector<unsigned char>& vchSig, const CPubKey& pubkey, const uint256& sighash) const
 {
-    static CSignatureCache signatureCache;
+    uint256 entry;
+    signatureCache.ComputeEntry(entry, sighash, vchSig, pubkey);
 
-    if (signatureCache.Get(sighash, vchSig, pubkey))
+    // entries checked when connecting a block are not needed again
+    if (signatureCache.Get(entry, !store))
         return true;
 
     if (!TransactionSignatureChecker::VerifySignature(vchSig, pubkey, sighash))
         return false;
 
     if (store)
-        signatureCache.Set(sighash, vchSig, pubkey);
+        signatureCache.Set(entry);
     return true;
 }
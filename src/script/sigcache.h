@@ -7,11 +7,44 @@
 #define BITCOIN_SCRIPT_SIGCACHE_H
 
 #include "script/interpreter.h"
+#include "uint256.h"
 
+#include <cstring>
 #include <vector>
 
+// DoS prevention: limit cache size to 32MB (over 1000000 entries on 64-bit
+// systems). Due to how we count cache size, actual memory usage is slightly
+// more (~32.25 MB)
+static const unsigned int DEFAULT_MAX_SIG_CACHE_SIZE = 32;
+// Maximum sig cache size allowed
+static const int64_t MAX_MAX_SIG_CACHE_SIZE = 16384;
+// Older versions took -maxsigcachesize as a number of entries (default 50000),
+// larger values are still read that way
+static const size_t SIG_CACHE_LEGACY_ENTRY_SIZE = sizeof(uint256);
+
 class CPubKey;
 
+/**
+ * We're hashing a nonce into the entries themselves, so we don't need extra
+ * blinding in the set hash computation.
+ *
+ * This may exhibit platform endian dependent behavior but because these are
+ * nonced hashes (random) and this state is only ever used locally it is safe.
+ * All that matters is local consistency.
+ */
+class SignatureCacheHasher
+{
+public:
+    template <uint8_t hash_select>
+    uint32_t operator()(const uint256& key) const
+    {
+        static_assert(hash_select < 8, "SignatureCacheHasher only has 8 hashes available.");
+        uint32_t u;
+        std::memcpy(&u, key.begin() + 4 * hash_select, 4);
+        return u;
+    }
+};
+
 class CachingTransactionSignatureChecker : public TransactionSignatureChecker
 {
 private:
@@ -23,4 +56,10 @@ public:
     bool VerifySignature(const std::vector<unsigned char>& vchSig, const CPubKey& vchPubKey, const uint256& sighash) const;
 };
 
+/** Bytes of signature cache for a -maxsigcachesize value, MiB or legacy number of entries */
+size_t GetSignatureCacheBytes(int64_t nMaxSigCacheSize, bool* pfLegacy = NULL);
+
+/** Size the signature cache from -maxsigcachesize (in MiB), call before script checks start */
+void InitSignatureCache();
+
 #endif // BITCOIN_SCRIPT_SIGCACHE_H
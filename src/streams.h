@@ -289,6 +289,60 @@ public:
 };
 
 
+/** Read only stream over a range of memory, such as a memory mapped file.
+ *
+ * Deserializes straight from the range without buffering, the memory must
+ * outlive the reader.
+ */
+class CSpanReader
+{
+private:
+    int nType;
+    int nVersion;
+
+    const char* pbegin;
+    const char* pend;
+
+public:
+    CSpanReader(int nTypeIn, int nVersionIn, const char* pbeginIn, const char* pendIn)
+        : nType(nTypeIn), nVersion(nVersionIn), pbegin(pbeginIn), pend(pendIn)
+    {
+    }
+
+    //
+    // Stream subset
+    //
+    int GetType() { return nType; }
+    int GetVersion() { return nVersion; }
+    size_t size() const { return pend - pbegin; }
+    bool empty() const { return pbegin == pend; }
+
+    CSpanReader& read(char* pch, size_t nSize)
+    {
+        if (nSize > size())
+            throw std::ios_base::failure("CSpanReader::read : end of data");
+        memcpy(pch, pbegin, nSize);
+        pbegin += nSize;
+        return (*this);
+    }
+
+    CSpanReader& ignore(size_t nSize)
+    {
+        if (nSize > size())
+            throw std::ios_base::failure("CSpanReader::ignore : end of data");
+        pbegin += nSize;
+        return (*this);
+    }
+
+    template <typename T>
+    CSpanReader& operator>>(T& obj)
+    {
+        // Unserialize from this stream
+        ::Unserialize(*this, obj, nType, nVersion);
+        return (*this);
+    }
+};
+
 /** Non-refcounted RAII wrapper for FILE*
  *
  * Will automatically close the file when it goes out of scope if not null.
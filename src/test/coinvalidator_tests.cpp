@@ -0,0 +1,202 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "coinvalidator.h"
+#include "coinvalidatorinfractions.h"
+#include "script/standard.h"
+#include "utiltime.h"
+
+#include <atomic>
+#include <cstring>
+#include <map>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/thread.hpp>
+
+namespace
+{
+uint256 txIdOf(const InfractionSpec &spec)
+{
+    uint256 txId;
+    std::memcpy(txId.begin(), spec.txid, sizeof(spec.txid));
+    return txId;
+}
+
+const int readerThreads = 4;
+const int lookupsPerThread = 50000;
+
+/**
+ * Runs the lookup on readerThreads threads, each checks every listed
+ * txid and as many clean ones. Returns lookups per second, counts
+ * wrong answers in errors.
+ */
+template <typename Lookup>
+int64_t lookupRate(const std::vector<uint256> &listed, const std::vector<uint256> &clean,
+                   Lookup isValid, std::atomic<int> &errors)
+{
+    const int64_t start = GetTimeMicros();
+    boost::thread_group threads;
+    for (int t = 0; t < readerThreads; ++t) {
+        threads.create_thread([&listed, &clean, &isValid, &errors, t]() {
+            for (int i = 0; i < lookupsPerThread; ++i) {
+                const size_t n = static_cast<size_t>(i + t);
+                if (isValid(listed[n % listed.size()]))
+                    ++errors;
+                if (!isValid(clean[n % clean.size()]))
+                    ++errors;
+            }
+        });
+    }
+    threads.join_all();
+    const int64_t elapsed = std::max<int64_t>(GetTimeMicros() - start, 1);
+    return int64_t(readerThreads) * lookupsPerThread * 2 * 1000000 / elapsed;
+}
+
+const int redeemOutputs = 1000;
+const int redeemRounds = 200;
+
+CScript scriptOf(const std::string &address)
+{
+    return GetScriptForDestination(CBitcoinAddress(address).Get());
+}
+
+/**
+ * Pays many outputs and redeemed to the redeem address.
+ */
+CMutableTransaction redeemTx(const CAmount redeemed)
+{
+    CMutableTransaction tx;
+    for (int i = 0; i < redeemOutputs; ++i) {
+        uint160 keyId;
+        *keyId.begin() = static_cast<unsigned char>(i);
+        *(keyId.begin() + 1) = static_cast<unsigned char>(i >> 8);
+        tx.vout.push_back(CTxOut(COIN, GetScriptForDestination(CKeyID(keyId))));
+    }
+    tx.vout.push_back(CTxOut(redeemed, scriptOf("BmL4hWa8T7Qi6ZZaL291jDai4Sv98opcSK")));
+    return tx;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(coinvalidator_tests)
+
+BOOST_AUTO_TEST_CASE(static_list)
+{
+    CoinValidator validator;
+    const InfractionSpec &spec = infractionsStatic[0];
+    const uint256 listed = txIdOf(spec);
+    const uint256 other = uint256S("1111111111111111111111111111111111111111111111111111111111111111");
+
+    // nothing is listed before the list is loaded
+    BOOST_CHECK(!validator.IsLoaded());
+    BOOST_CHECK(validator.IsCoinValid(listed));
+
+    BOOST_CHECK(validator.LoadStatic());
+    BOOST_CHECK(!validator.LoadStatic());
+    BOOST_CHECK(validator.IsLoaded());
+
+    BOOST_CHECK(!validator.IsCoinValid(listed));
+    BOOST_CHECK(!validator.IsCoinValid(listed.ToString()));
+    BOOST_CHECK(validator.IsCoinValid(other));
+
+    const std::vector<InfractionData> infs = validator.GetInfractions(listed);
+    BOOST_REQUIRE(!infs.empty());
+    const std::vector<unsigned char> address(spec.address, spec.address + sizeof(spec.address));
+    BOOST_CHECK_EQUAL(infs[0].address, EncodeBase58Check(address));
+    BOOST_CHECK(validator.GetInfractions(other).empty());
+
+    // all entries of the table are listed
+    for (const InfractionSpec &s : infractionsStatic)
+        BOOST_CHECK(!validator.IsCoinValid(txIdOf(s)));
+
+    validator.Clear();
+    BOOST_CHECK(!validator.IsLoaded());
+    BOOST_CHECK(validator.IsCoinValid(listed));
+}
+
+BOOST_AUTO_TEST_CASE(lookup_bench)
+{
+    CoinValidator validator;
+    BOOST_REQUIRE(validator.LoadStatic());
+
+    std::vector<uint256> listed;
+    std::vector<uint256> clean;
+    for (const InfractionSpec &s : infractionsStatic) {
+        listed.push_back(txIdOf(s));
+        uint256 other = txIdOf(s);
+        *other.begin() ^= 0x5a;
+        clean.push_back(other);
+    }
+
+    // the lookup before the sorted snapshot: a locked map keyed by the hex txid
+    std::map<std::string, std::vector<InfractionData>> infMap;
+    for (const uint256 &txId : listed)
+        infMap[txId.ToString()];
+    boost::mutex lock;
+    auto locked = [&infMap, &lock](const uint256 &txId) {
+        boost::mutex::scoped_lock l(lock);
+        return infMap.count(txId.ToString()) == 0;
+    };
+    auto snapshot = [&validator](const uint256 &txId) {
+        return validator.IsCoinValid(txId);
+    };
+
+    std::atomic<int> errors(0);
+    const int64_t lockedRate = lookupRate(listed, clean, locked, errors);
+    BOOST_CHECK_EQUAL(errors.load(), 0);
+    const int64_t snapshotRate = lookupRate(listed, clean, snapshot, errors);
+    BOOST_CHECK_EQUAL(errors.load(), 0);
+
+    BOOST_TEST_MESSAGE("IsCoinValid: " << listed.size() << " infractions, " << readerThreads
+                       << " threads, locked map " << lockedRate << "/s, sorted snapshot "
+                       << snapshotRate << "/s");
+}
+
+BOOST_AUTO_TEST_CASE(redeem_bench)
+{
+    CoinValidator validator;
+    BOOST_REQUIRE(validator.LoadStatic());
+
+    const uint256 txId = txIdOf(infractionsStatic[0]);
+    const std::vector<InfractionData> infs = validator.GetInfractions(txId);
+    BOOST_REQUIRE(!infs.empty());
+    CAmount exploitedAmount = 0;
+    for (const InfractionData &inf : infs)
+        if (inf.address == infs[0].address)
+            exploitedAmount += inf.amount;
+    const std::vector<RedeemData> exploited(1, RedeemData(txId, scriptOf(infs[0].address), exploitedAmount));
+
+    const CTransaction redeem(redeemTx(exploitedAmount));
+    const CTransaction shortRedeem(redeemTx(exploitedAmount - 1));
+    BOOST_CHECK(validator.RedeemAddressVerified(exploited, redeem.vout));
+    BOOST_CHECK(!validator.RedeemAddressVerified(exploited, shortRedeem.vout));
+    BOOST_CHECK(!validator.RedeemAddressVerified(exploited, std::vector<CTxOut>()));
+
+    // the copy CheckTransaction made of every transaction before the
+    // outputs were passed by reference
+    int64_t start = GetTimeMicros();
+    size_t copied = 0;
+    for (int i = 0; i < redeemRounds; ++i) {
+        std::vector<RedeemData> recipients;
+        for (const CTxOut &out : redeem.vout)
+            if (!out.IsEmpty())
+                recipients.push_back(RedeemData(redeem.GetHash(), out.scriptPubKey, out.nValue));
+        copied += recipients.size();
+    }
+    const int64_t copyTime = std::max<int64_t>(GetTimeMicros() - start, 1);
+    BOOST_CHECK_EQUAL(copied, size_t(redeemRounds) * redeem.vout.size());
+
+    // the check that is left, only run when an input is exploited
+    start = GetTimeMicros();
+    int verified = 0;
+    for (int i = 0; i < redeemRounds; ++i)
+        verified += validator.RedeemAddressVerified(exploited, redeem.vout) ? 1 : 0;
+    const int64_t verifyTime = std::max<int64_t>(GetTimeMicros() - start, 1);
+    BOOST_CHECK_EQUAL(verified, redeemRounds);
+
+    BOOST_TEST_MESSAGE("redeem check: " << redeem.vout.size() << " outputs, copy per tx "
+                       << copyTime / redeemRounds << "us, verify per exploited tx "
+                       << verifyTime / redeemRounds << "us");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,124 @@
+// Copyright (c) 2012-2016 The Bitcoin Core developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "cuckoocache.h"
+
+#include "random.h"
+#include "script/sigcache.h"
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+/** Test Suite for CuckooCache
+ *
+ *  1) All tests should have a deterministic result (using insecure rand
+ *  with deterministic seeds)
+ *  2) Some test methods are templated to allow for easier testing
+ *  against new versions / comparing
+ *  3) Results should be treated as a regression test, i.e., did the behavior
+ *  change significantly from what was expected. This can be OK, depending on
+ *  the nature of the change, but requires updating the tests to reflect the new
+ *  expected behavior. For example improving the hit rate may cause some tests
+ *  using BOOST_CHECK_CLOSE to fail.
+ *
+ */
+
+namespace
+{
+void insecure_GetRandHash(uint256& t)
+{
+    uint32_t* ptr = (uint32_t*)t.begin();
+    for (uint8_t j = 0; j < 8; ++j)
+        *(ptr++) = insecure_rand();
+}
+
+/** Fills a vector with random hashes */
+void make_hashes(std::vector<uint256>& hashes, size_t n)
+{
+    hashes.resize(n);
+    for (uint256& h : hashes)
+        insecure_GetRandHash(h);
+}
+
+typedef CuckooCache::cache<uint256, SignatureCacheHasher> sigcache_type;
+
+/** Returns the fraction of the last half of the inserted hashes still found */
+double hit_rate_after_fill(const size_t megabytes, const double load)
+{
+    seed_insecure_rand(true);
+    sigcache_type set;
+    const uint32_t n_insert = static_cast<uint32_t>(load * (set.setup_bytes(megabytes << 20)));
+
+    std::vector<uint256> hashes;
+    make_hashes(hashes, n_insert);
+    for (const uint256& h : hashes)
+        set.insert(h);
+
+    uint32_t count = 0;
+    for (uint32_t i = n_insert / 2; i < n_insert; ++i)
+        count += set.contains(hashes[i], false);
+    return static_cast<double>(count) / (n_insert - n_insert / 2);
+}
+}
+
+BOOST_AUTO_TEST_SUITE(cuckoocache_tests)
+
+// Test that no values not inserted into the cache are read out of it.
+BOOST_AUTO_TEST_CASE(cuckoocache_no_fakes)
+{
+    seed_insecure_rand(true);
+    sigcache_type set;
+    set.setup_bytes(32 << 10);
+
+    uint256 v;
+    for (int x = 0; x < 100000; ++x) {
+        insecure_GetRandHash(v);
+        set.insert(v);
+    }
+    for (int x = 0; x < 100000; ++x) {
+        insecure_GetRandHash(v);
+        BOOST_CHECK(!set.contains(v, false));
+    }
+}
+
+// Test that a cache at its nominal load keeps recent entries
+BOOST_AUTO_TEST_CASE(cuckoocache_hit_rate)
+{
+    BOOST_CHECK(hit_rate_after_fill(1, 0.90) > 0.99);
+    BOOST_CHECK(hit_rate_after_fill(1, 1.00) > 0.95);
+}
+
+// Test that entries found with erase are replaced first, the pattern of
+// signatures checked in the mempool and again when the block connects
+BOOST_AUTO_TEST_CASE(cuckoocache_erase)
+{
+    seed_insecure_rand(true);
+    sigcache_type set;
+    const uint32_t n = set.setup_bytes(1 << 20);
+
+    std::vector<uint256> hashes;
+    make_hashes(hashes, n);
+
+    // fill to 90%, then read the first half back as a block would
+    const uint32_t n_fill = (n * 9) / 10;
+    for (uint32_t i = 0; i < n_fill; ++i)
+        set.insert(hashes[i]);
+    for (uint32_t i = 0; i < n_fill / 2; ++i)
+        BOOST_CHECK(set.contains(hashes[i], true));
+
+    // erased entries are still readable until their slot is reused
+    BOOST_CHECK(set.contains(hashes[0], false));
+
+    // new entries take the erased slots, the rest stays
+    for (uint32_t i = n_fill; i < n; ++i)
+        set.insert(hashes[i]);
+
+    uint32_t count = 0;
+    for (uint32_t i = n_fill / 2; i < n; ++i)
+        count += set.contains(hashes[i], false);
+    BOOST_CHECK(static_cast<double>(count) / (n - n_fill / 2) > 0.99);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
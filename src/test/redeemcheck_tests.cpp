@@ -0,0 +1,105 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "base58.h"
+#include "checkqueue.h"
+#include "coinvalidator.h"
+#include "coinvalidatorinfractions.h"
+#include "main.h"
+
+#include <cstring>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/thread.hpp>
+
+namespace
+{
+/** View holding one output of an infraction of the static list */
+struct RedeemSetup {
+    CCoinsView base;
+    CCoinsViewCache view;
+    uint256 txidExploited;
+    CAmount nExploited;
+
+    RedeemSetup() : view(&base)
+    {
+        CoinValidator::instance().LoadStatic();
+
+        const InfractionSpec& spec = infractionsStatic[0];
+        std::memcpy(txidExploited.begin(), spec.txid, sizeof(spec.txid));
+        nExploited = spec.amount;
+
+        CCoinsModifier coins = view.ModifyCoins(txidExploited);
+        coins->vout.resize(1);
+        coins->vout[0].nValue = nExploited;
+        coins->vout[0].scriptPubKey = GetScriptForDestination(CKeyID(uint160(std::vector<unsigned char>(spec.address + 1, spec.address + 21))));
+    }
+
+    CTransaction Spend(const CScript& scriptPubKey)
+    {
+        CMutableTransaction tx;
+        tx.vin.resize(1);
+        tx.vin[0].prevout = COutPoint(txidExploited, 0);
+        tx.vout.resize(1);
+        tx.vout[0].nValue = nExploited;
+        tx.vout[0].scriptPubKey = scriptPubKey;
+        return tx;
+    }
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(redeemcheck_tests, RedeemSetup)
+
+BOOST_AUTO_TEST_CASE(bad_redeem_in_place)
+{
+    const CTransaction tx = Spend(GetScriptForDestination(CKeyID(uint160(std::vector<unsigned char>(20, 1)))));
+
+    CValidationState state;
+    int nDoS = 0;
+    BOOST_CHECK(!CheckRedeem(tx, state, view));
+    BOOST_CHECK(state.IsInvalid(nDoS));
+    BOOST_CHECK_EQUAL(nDoS, 100);
+    BOOST_CHECK_EQUAL(state.GetRejectReason(), "bad-txns-inputs-stake");
+}
+
+BOOST_AUTO_TEST_CASE(bad_redeem_through_check_queue)
+{
+    CCheckQueue<CBlockCheck> queue(128);
+    boost::thread_group threads;
+    for (int i = 0; i < 2; i++)
+        threads.create_thread(boost::bind(&CCheckQueue<CBlockCheck>::Thread, &queue));
+
+    // as in ConnectBlock, the check is queued and reported by the flag
+    {
+        const CTransaction tx = Spend(GetScriptForDestination(CKeyID(uint160(std::vector<unsigned char>(20, 1)))));
+        std::atomic<bool> fFailed(false);
+        CCheckQueueControl<CBlockCheck> control(&queue);
+        CValidationState state;
+        std::vector<CBlockCheck> vChecks;
+        BOOST_CHECK(CheckRedeem(tx, state, view, &vChecks, &fFailed));
+        BOOST_CHECK(state.IsValid());
+        BOOST_CHECK_EQUAL(vChecks.size(), 1U);
+        control.Add(vChecks);
+        BOOST_CHECK(!control.Wait());
+        BOOST_CHECK(fFailed);
+    }
+
+    // paid to the redeem address
+    {
+        const CTransaction tx = Spend(GetScriptForDestination(CBitcoinAddress("BmL4hWa8T7Qi6ZZaL291jDai4Sv98opcSK").Get()));
+        std::atomic<bool> fFailed(false);
+        CCheckQueueControl<CBlockCheck> control(&queue);
+        CValidationState state;
+        std::vector<CBlockCheck> vChecks;
+        BOOST_CHECK(CheckRedeem(tx, state, view, &vChecks, &fFailed));
+        control.Add(vChecks);
+        BOOST_CHECK(control.Wait());
+        BOOST_CHECK(!fFailed);
+    }
+
+    threads.interrupt_all();
+    threads.join_all();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "script/sigcache.h"
+
+#include "key.h"
+#include "primitives/transaction.h"
+#include "pubkey.h"
+#include "random.h"
+#include "utiltime.h"
+
+#include <atomic>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/thread.hpp>
+
+namespace
+{
+const int sigCount = 4000;
+const int readerThreads = 4;
+
+struct SignedHash
+{
+    uint256 hash;
+    std::vector<unsigned char> sig;
+};
+}
+
+BOOST_AUTO_TEST_SUITE(sigcache_tests)
+
+BOOST_AUTO_TEST_CASE(sigcache_size_units)
+{
+    bool fLegacy = true;
+    BOOST_CHECK_EQUAL(GetSignatureCacheBytes(DEFAULT_MAX_SIG_CACHE_SIZE, &fLegacy), (size_t)32 << 20);
+    BOOST_CHECK(!fLegacy);
+    BOOST_CHECK_EQUAL(GetSignatureCacheBytes(0), 0U);
+    BOOST_CHECK_EQUAL(GetSignatureCacheBytes(-1), 0U);
+    BOOST_CHECK_EQUAL(GetSignatureCacheBytes(MAX_MAX_SIG_CACHE_SIZE, &fLegacy), (size_t)MAX_MAX_SIG_CACHE_SIZE << 20);
+    BOOST_CHECK(!fLegacy);
+
+    // old default of 50000 entries
+    BOOST_CHECK_EQUAL(GetSignatureCacheBytes(50000, &fLegacy), 50000 * SIG_CACHE_LEGACY_ENTRY_SIZE);
+    BOOST_CHECK(fLegacy);
+
+    // legacy values are capped like MiB values
+    BOOST_CHECK_EQUAL(GetSignatureCacheBytes(std::numeric_limits<int64_t>::max()), (size_t)MAX_MAX_SIG_CACHE_SIZE << 20);
+}
+
+BOOST_AUTO_TEST_CASE(sigcache_bench)
+{
+    ECCVerifyHandle verifyHandle;
+    CKey key;
+    key.MakeNewKey(true);
+    const CPubKey pubkey = key.GetPubKey();
+
+    std::vector<SignedHash> sigs(sigCount);
+    for (SignedHash& s : sigs) {
+        s.hash = GetRandHash();
+        BOOST_REQUIRE(key.Sign(s.hash, s.sig));
+    }
+
+    const CTransaction tx;
+    const CachingTransactionSignatureChecker mempoolChecker(&tx, 0, true);
+
+    // ECDSA only
+    int64_t start = GetTimeMicros();
+    int valid = 0;
+    for (const SignedHash& s : sigs)
+        valid += pubkey.Verify(s.hash, s.sig) ? 1 : 0;
+    const int64_t verifyTime = std::max<int64_t>(GetTimeMicros() - start, 1);
+    BOOST_CHECK_EQUAL(valid, sigCount);
+
+    // mempool acceptance verifies and stores
+    start = GetTimeMicros();
+    valid = 0;
+    for (const SignedHash& s : sigs)
+        valid += mempoolChecker.VerifySignature(s.sig, pubkey, s.hash) ? 1 : 0;
+    const int64_t storeTime = std::max<int64_t>(GetTimeMicros() - start, 1);
+    BOOST_CHECK_EQUAL(valid, sigCount);
+
+    // a cached signature doesn't make another hash valid
+    BOOST_CHECK(!mempoolChecker.VerifySignature(sigs[0].sig, pubkey, sigs[1].hash));
+
+    // block connect reads them back from several script check threads
+    std::atomic<int> failed(0);
+    start = GetTimeMicros();
+    boost::thread_group threads;
+    for (int t = 0; t < readerThreads; ++t) {
+        threads.create_thread([&sigs, &pubkey, &tx, &failed, t]() {
+            const CachingTransactionSignatureChecker blockChecker(&tx, 0, false);
+            for (size_t i = t; i < sigs.size(); i += readerThreads)
+                if (!blockChecker.VerifySignature(sigs[i].sig, pubkey, sigs[i].hash))
+                    ++failed;
+        });
+    }
+    threads.join_all();
+    const int64_t lookupTime = std::max<int64_t>(GetTimeMicros() - start, 1);
+    BOOST_CHECK_EQUAL(failed.load(), 0);
+
+    BOOST_TEST_MESSAGE("signature cache: " << sigCount << " signatures, ECDSA "
+                       << sigCount * 1000000LL / verifyTime << "/s, verify and store "
+                       << sigCount * 1000000LL / storeTime << "/s, cached from "
+                       << readerThreads << " threads " << sigCount * 1000000LL / lookupTime << "/s");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
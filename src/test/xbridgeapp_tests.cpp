@@ -0,0 +1,130 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xbridge/xbridgeapp.h"
+#include "xbridge/xbridgetransactiondescr.h"
+
+#include "random.h"
+#include "utiltime.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/thread.hpp>
+
+using xbridge::App;
+using xbridge::TransactionDescr;
+using xbridge::TransactionDescrPtr;
+
+namespace
+{
+TransactionDescrPtr order()
+{
+    TransactionDescrPtr ptr(new TransactionDescr);
+    ptr->id           = GetRandHash();
+    ptr->fromCurrency = "BLOCK";
+    ptr->fromAmount   = 10 * TransactionDescr::COIN;
+    ptr->toCurrency   = "LTC";
+    ptr->toAmount     = TransactionDescr::COIN;
+    ptr->state        = TransactionDescr::trPending;
+    return ptr;
+}
+
+/**
+ * Runs readers on threads while orders are added,
+ * returns reads per second.
+ */
+double readRate(const std::function<size_t ()> & read, const std::function<void ()> & write)
+{
+    const int readers = 4;
+    const int reads   = 200;
+
+    std::atomic<bool> done(false);
+    boost::thread writer([&done, &write]()
+    {
+        while (!done)
+        {
+            write();
+            MilliSleep(5);
+        }
+    });
+
+    std::atomic<int> empty(0);
+    const int64_t start = GetTimeMicros();
+    boost::thread_group threads;
+    for (int i = 0; i < readers; ++i)
+    {
+        threads.create_thread([&read, &empty, reads]()
+        {
+            for (int j = 0; j < reads; ++j)
+                if (read() == 0)
+                    ++empty;
+        });
+    }
+    threads.join_all();
+    const int64_t elapsed = std::max<int64_t>(GetTimeMicros() - start, 1);
+
+    done = true;
+    writer.join();
+
+    BOOST_CHECK_EQUAL(empty.load(), 0);
+
+    return readers * reads * 1000000.0 / elapsed;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(xbridgeapp_tests)
+
+// run with --log_level=message to see the rates
+BOOST_AUTO_TEST_CASE(transactions_snapshot_bench)
+{
+    App & app = App::instance();
+
+    std::vector<uint256> ids;
+    for (int i = 0; i < 2000; ++i)
+    {
+        TransactionDescrPtr ptr = order();
+        ids.push_back(ptr->id);
+        app.appendTransaction(ptr);
+    }
+    BOOST_CHECK_EQUAL(app.transactions()->size(), ids.size());
+
+    // copy of the orders under a lock on each read, as before the snapshots
+    boost::mutex lock;
+    App::TransactionMap orders = *app.transactions();
+    const double copyRate = readRate([&lock, &orders]()
+    {
+        boost::mutex::scoped_lock l(lock);
+        const App::TransactionMap copy(orders);
+        return copy.size();
+    },
+    [&lock, &orders]()
+    {
+        boost::mutex::scoped_lock l(lock);
+        TransactionDescrPtr ptr = order();
+        orders[ptr->id] = ptr;
+    });
+
+    const double snapshotRate = readRate([&app]()
+    {
+        return app.transactions()->size();
+    },
+    [&app, &ids]()
+    {
+        TransactionDescrPtr ptr = order();
+        ids.push_back(ptr->id);
+        app.appendTransaction(ptr);
+    });
+
+    BOOST_TEST_MESSAGE("transactions(): " << copyRate << " reads/s copying under lock, "
+                       << snapshotRate << " reads/s from snapshots");
+
+    for (const uint256 & id : ids)
+        app.moveTransactionToHistory(id);
+    BOOST_CHECK(app.transactions()->empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,135 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xbridge/xbridgeexpiryindex.h"
+
+#include <set>
+
+#include <boost/test/unit_test.hpp>
+
+using xbridge::ExpiryIndex;
+using boost::posix_time::ptime;
+using boost::posix_time::seconds;
+
+namespace
+{
+const ptime t0(boost::gregorian::date(2018, 1, 1));
+}
+
+BOOST_AUTO_TEST_SUITE(xbridgeexpiryindex_tests)
+
+BOOST_AUTO_TEST_CASE(due_time)
+{
+    // checked again after recheckSeconds for expiry by block number
+    BOOST_CHECK(ExpiryIndex::dueTime(t0 + seconds(360), t0) == t0 + seconds(static_cast<long>(ExpiryIndex::recheckSeconds)));
+    BOOST_CHECK(ExpiryIndex::dueTime(t0 + seconds(30), t0) == t0 + seconds(30));
+
+    // not before the expiration time passed
+    BOOST_CHECK(ExpiryIndex::dueTime(t0 - seconds(30), t0) == t0 + seconds(1));
+    BOOST_CHECK(ExpiryIndex::dueTime(t0, t0) == t0 + seconds(1));
+}
+
+BOOST_AUTO_TEST_CASE(pop_in_time_order)
+{
+    ExpiryIndex index;
+    const uint256 a = uint256S("a1"), b = uint256S("b2");
+    uint256 id;
+
+    BOOST_CHECK(index.next() == ptime(boost::posix_time::pos_infin));
+    BOOST_CHECK(!index.pop(t0, id));
+
+    index.schedule(a, t0 + seconds(20));
+    index.schedule(b, t0 + seconds(10));
+    BOOST_CHECK(index.next() == t0 + seconds(10));
+
+    BOOST_CHECK(!index.pop(t0 + seconds(5), id));
+    BOOST_CHECK(index.pop(t0 + seconds(30), id));
+    BOOST_CHECK(id == b);
+    BOOST_CHECK(index.pop(t0 + seconds(30), id));
+    BOOST_CHECK(id == a);
+    BOOST_CHECK(!index.pop(t0 + seconds(30), id));
+    BOOST_CHECK_EQUAL(index.size(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(reschedule_replaces_check)
+{
+    ExpiryIndex index;
+    const uint256 a = uint256S("a1");
+    uint256 id;
+
+    // an expired order replaced by a new one with the same id
+    index.schedule(a, t0 + seconds(10));
+    index.schedule(a, t0 + seconds(60));
+    BOOST_CHECK_EQUAL(index.size(), 1U);
+    BOOST_CHECK(index.next() == t0 + seconds(60));
+
+    BOOST_CHECK(!index.pop(t0 + seconds(10), id));
+    BOOST_CHECK(index.pop(t0 + seconds(60), id));
+    BOOST_CHECK(id == a);
+    BOOST_CHECK_EQUAL(index.size(), 0U);
+
+    // moved to an earlier time
+    index.schedule(a, t0 + seconds(60));
+    index.schedule(a, t0 + seconds(10));
+    BOOST_CHECK_EQUAL(index.size(), 1U);
+    BOOST_CHECK(index.pop(t0 + seconds(10), id));
+}
+
+BOOST_AUTO_TEST_CASE(timestamp_refresh)
+{
+    ExpiryIndex index;
+    const uint256 a = uint256S("a1");
+    uint256 id;
+
+    // pending order expires 360s after its last packet
+    ptime last = t0;
+    index.schedule(a, ExpiryIndex::dueTime(last + seconds(360), t0));
+
+    // refreshed by a packet, nothing is due until the next check
+    last = t0 + seconds(50);
+    BOOST_CHECK(!index.pop(last, id));
+
+    // at the check the order is not expired, it is scheduled again
+    ptime now = t0 + seconds(static_cast<long>(ExpiryIndex::recheckSeconds));
+    BOOST_CHECK(index.pop(now, id));
+    BOOST_CHECK(id == a);
+    index.schedule(a, ExpiryIndex::dueTime(last + seconds(360), now));
+    BOOST_CHECK_EQUAL(index.size(), 1U);
+    BOOST_CHECK(index.next() == now + seconds(static_cast<long>(ExpiryIndex::recheckSeconds)));
+
+    // close to expiration the check is at expiration time
+    now = last + seconds(330);
+    index.schedule(a, ExpiryIndex::dueTime(last + seconds(360), now));
+    BOOST_CHECK(index.next() == last + seconds(360));
+}
+
+BOOST_AUTO_TEST_CASE(lazy_drop)
+{
+    ExpiryIndex index;
+    const uint256 a = uint256S("a1"), b = uint256S("b2");
+    uint256 id;
+
+    index.schedule(a, t0 + seconds(10));
+    index.schedule(b, t0 + seconds(10));
+
+    // b was removed from the orders, its check stays until due
+    const std::set<uint256> orders = {a};
+    BOOST_CHECK_EQUAL(index.size(), 2U);
+
+    std::set<uint256> checked;
+    while (index.pop(t0 + seconds(10), id))
+    {
+        checked.insert(id);
+        if (orders.count(id))
+        {
+            index.schedule(id, t0 + seconds(70));
+        }
+    }
+
+    BOOST_CHECK(checked == std::set<uint256>({a, b}));
+    BOOST_CHECK_EQUAL(index.size(), 1U);
+    BOOST_CHECK(index.next() == t0 + seconds(70));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
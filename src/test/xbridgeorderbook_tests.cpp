@@ -0,0 +1,86 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xbridge/xbridgeorderbook.h"
+#include "xbridge/xbridgetransactiondescr.h"
+
+#include <boost/test/unit_test.hpp>
+
+using xbridge::OrderBook;
+using xbridge::TransactionDescr;
+using xbridge::TransactionDescrPtr;
+
+namespace
+{
+TransactionDescrPtr order(const uint8_t id, const uint64_t fromAmount, const uint64_t toAmount,
+                          const TransactionDescr::State state = TransactionDescr::trPending)
+{
+    TransactionDescrPtr ptr(new TransactionDescr);
+    *ptr->id.begin()  = id;
+    ptr->fromCurrency = "BLOCK";
+    ptr->fromAmount   = fromAmount;
+    ptr->toCurrency   = "LTC";
+    ptr->toAmount     = toAmount;
+    ptr->state        = state;
+    return ptr;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(xbridgeorderbook_tests)
+
+BOOST_AUTO_TEST_CASE(level_totals)
+{
+    OrderBook book;
+    book.add(order(1, 100, 200));
+    book.add(order(2, 50, 100));
+    book.add(order(3, 100, 100));
+
+    std::vector<OrderBook::Level> levels = book.levels("BLOCK", "LTC", true, 10);
+    BOOST_REQUIRE_EQUAL(levels.size(), 2);
+    BOOST_CHECK_EQUAL(levels[0].orders.size(), 1);
+    BOOST_CHECK_EQUAL(levels[0].fromAmount, 100);
+    BOOST_CHECK_EQUAL(levels[1].orders.size(), 2);
+    BOOST_CHECK_EQUAL(levels[1].fromAmount, 150);
+    BOOST_CHECK_EQUAL(levels[1].toAmount, 300);
+
+    // orders of a level keep arrival order
+    BOOST_CHECK_EQUAL(*levels[1].orders[0]->id.begin(), 1);
+
+    // best price first in the given direction, limited count
+    levels = book.levels("BLOCK", "LTC", false, 1);
+    BOOST_REQUIRE_EQUAL(levels.size(), 1);
+    BOOST_CHECK_EQUAL(levels[0].orders.size(), 2);
+
+    BOOST_CHECK(book.levels("LTC", "BLOCK", true, 10).empty());
+}
+
+BOOST_AUTO_TEST_CASE(pending_only)
+{
+    OrderBook book;
+
+    // orders not in pending state are not added
+    TransactionDescrPtr created = order(1, 100, 200, TransactionDescr::trNew);
+    book.add(created);
+    book.add(order(2, 100, 200, TransactionDescr::trHold));
+    BOOST_CHECK(book.levels("BLOCK", "LTC", true, 10).empty());
+
+    created->state = TransactionDescr::trPending;
+    book.add(created);
+    book.add(order(3, 100, 200));
+    BOOST_CHECK_EQUAL(book.levels("BLOCK", "LTC", true, 10)[0].fromAmount, 200);
+
+    // order leaving pending state is removed with its amounts
+    book.remove(created->id);
+    std::vector<OrderBook::Level> levels = book.levels("BLOCK", "LTC", true, 10);
+    BOOST_REQUIRE_EQUAL(levels.size(), 1);
+    BOOST_CHECK_EQUAL(levels[0].orders.size(), 1);
+    BOOST_CHECK_EQUAL(levels[0].fromAmount, 100);
+    BOOST_CHECK_EQUAL(levels[0].toAmount, 200);
+
+    // empty level is dropped
+    book.remove(order(3, 0, 0)->id);
+    BOOST_CHECK(book.levels("BLOCK", "LTC", true, 10).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,115 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xbridge/xbridgepacket.h"
+
+#include "key.h"
+#include "pubkey.h"
+#include "utiltime.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+const int packetCount = 500;
+
+// offset of the signature in a raw packet
+const size_t signatureOffset = 53;
+
+typedef std::vector<unsigned char> Raw;
+
+Raw signedPacket(const CKey & key, const uint32_t n)
+{
+    CPubKey pub = key.GetPubKey();
+    std::vector<unsigned char> pubkey(pub.begin(), pub.end());
+    std::vector<unsigned char> privkey(key.begin(), key.end());
+
+    XBridgePacket packet(xbcPendingTransaction);
+    packet.append(n);
+    packet.append(static_cast<uint64_t>(n) * 1000);
+    if (!packet.sign(pubkey, privkey))
+        return Raw();
+    return packet.body();
+}
+
+// checks a packet as it's received from the network
+bool verifyReceived(const Raw & raw)
+{
+    XBridgePacket packet;
+    return packet.copyFrom(raw) && packet.verify();
+}
+}
+
+BOOST_AUTO_TEST_SUITE(xbridgepacket_tests)
+
+BOOST_AUTO_TEST_CASE(tampered_packet_fails)
+{
+    CKey key;
+    key.MakeNewKey(true);
+
+    const Raw raw = signedPacket(key, 1);
+    BOOST_REQUIRE(!raw.empty());
+
+    // signing has verified the packet, a copy is found in the cache
+    XBridgePacket copy;
+    BOOST_REQUIRE(copy.copyFrom(raw));
+    BOOST_CHECK(copy.verify());
+
+    // changed data doesn't match the cached signature
+    Raw changedData = raw;
+    changedData[XBridgePacket::headerSize] ^= 1;
+    BOOST_CHECK(!verifyReceived(changedData));
+
+    // nor does a changed signature
+    Raw changedSig = raw;
+    changedSig[signatureOffset + 10] ^= 1;
+    BOOST_CHECK(!verifyReceived(changedSig));
+
+    // other sender
+    CKey other;
+    other.MakeNewKey(true);
+    CPubKey otherPub = other.GetPubKey();
+    BOOST_CHECK(!copy.verify(std::vector<unsigned char>(otherPub.begin(), otherPub.end())));
+}
+
+BOOST_AUTO_TEST_CASE(cached_verify_bench)
+{
+    CKey key;
+    key.MakeNewKey(true);
+
+    // packets relayed to us again by other peers, signing has put
+    // them in the cache
+    std::vector<Raw> known;
+    for (int i = 0; i < packetCount; ++i)
+    {
+        known.push_back(signedPacket(key, 100 + i));
+        BOOST_REQUIRE(!known.back().empty());
+    }
+
+    // packets with changed data are never cached, each check runs
+    // the whole secp256k1 verification
+    std::vector<Raw> unknown = known;
+    for (Raw & raw : unknown)
+        raw[XBridgePacket::headerSize] ^= 0x80;
+
+    int64_t start = GetTimeMicros();
+    int valid = 0;
+    for (const Raw & raw : known)
+        valid += verifyReceived(raw) ? 1 : 0;
+    const int64_t cached = std::max<int64_t>(GetTimeMicros() - start, 1);
+    BOOST_CHECK_EQUAL(valid, packetCount);
+
+    start = GetTimeMicros();
+    int rejected = 0;
+    for (const Raw & raw : unknown)
+        rejected += verifyReceived(raw) ? 0 : 1;
+    const int64_t uncached = std::max<int64_t>(GetTimeMicros() - start, 1);
+    BOOST_CHECK_EQUAL(rejected, packetCount);
+
+    BOOST_TEST_MESSAGE("packet verify: " << packetCount << " packets, cached "
+                       << packetCount * 1000000LL / cached << "/s, secp256k1 "
+                       << packetCount * 1000000LL / uncached << "/s");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,217 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xbridge/xbridgeutxoreservations.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/thread.hpp>
+
+using xbridge::UtxoReservations;
+using xbridge::wallet::UtxoEntry;
+
+namespace
+{
+UtxoEntry utxo(const char txid, const uint32_t vout)
+{
+    UtxoEntry e;
+    e.txId   = std::string(64, txid);
+    e.vout   = vout;
+    e.amount = 1;
+    return e;
+}
+
+bool reserved(const UtxoReservations & r, const UtxoEntry & e)
+{
+    return r.isReserved(UtxoReservations::Outpoint(e));
+}
+}
+
+BOOST_AUTO_TEST_SUITE(xbridgeutxoreservations_tests)
+
+BOOST_AUTO_TEST_CASE(reserve_release)
+{
+    UtxoReservations r;
+    const uint256 a = uint256S("a1");
+    const UtxoEntry u1 = utxo('1', 0), u2 = utxo('1', 1), u3 = utxo('2', 0);
+
+    BOOST_CHECK(!r.reserve(a, {}));
+    BOOST_CHECK(!r.has(a));
+
+    BOOST_CHECK(r.reserve(a, {u1, u2}));
+    BOOST_CHECK(r.has(a));
+    BOOST_CHECK(reserved(r, u1));
+    BOOST_CHECK(reserved(r, u2));
+    // same txid, other output
+    BOOST_CHECK(!reserved(r, u3));
+
+    std::vector<UtxoEntry> items;
+    BOOST_CHECK(r.items(a, items));
+    BOOST_CHECK(items == std::vector<UtxoEntry>({u1, u2}));
+
+    BOOST_CHECK(r.release(a));
+    BOOST_CHECK(!r.has(a));
+    BOOST_CHECK(!reserved(r, u1));
+    BOOST_CHECK(!reserved(r, u2));
+    BOOST_CHECK(!r.release(a));
+
+    items.clear();
+    BOOST_CHECK(!r.items(a, items));
+    r.all(items);
+    BOOST_CHECK(items.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ownership)
+{
+    UtxoReservations r;
+    const uint256 a = uint256S("a1"), b = uint256S("b2");
+    const UtxoEntry u1 = utxo('1', 0), u2 = utxo('2', 0);
+
+    BOOST_CHECK(r.reserve(a, {u1}));
+    BOOST_CHECK(r.reserve(b, {u2}));
+
+    std::vector<UtxoEntry> items;
+    BOOST_CHECK(r.items(b, items));
+    BOOST_CHECK(items == std::vector<UtxoEntry>({u2}));
+
+    // releasing one order keeps the items of the other
+    BOOST_CHECK(r.release(a));
+    BOOST_CHECK(!reserved(r, u1));
+    BOOST_CHECK(reserved(r, u2));
+    BOOST_CHECK(r.has(b));
+}
+
+BOOST_AUTO_TEST_CASE(exclusive_outpoint)
+{
+    UtxoReservations r;
+    const uint256 a = uint256S("a1"), b = uint256S("b2");
+    const UtxoEntry shared = utxo('1', 0), own = utxo('2', 0);
+
+    BOOST_CHECK(r.reserve(a, {shared}));
+
+    // nothing is reserved if another order holds any item
+    BOOST_CHECK(!r.reserve(b, {own, shared}));
+    BOOST_CHECK(!r.has(b));
+    BOOST_CHECK(!reserved(r, own));
+
+    std::vector<UtxoEntry> all;
+    r.all(all);
+    BOOST_CHECK_EQUAL(all.size(), 1);
+
+    BOOST_CHECK(r.release(a));
+    BOOST_CHECK(r.reserve(b, {own, shared}));
+    BOOST_CHECK(reserved(r, shared));
+    BOOST_CHECK(reserved(r, own));
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_reserve)
+{
+    UtxoReservations r;
+    const UtxoEntry shared = utxo('1', 0);
+
+    // orders race for one utxo, only one gets it
+    std::vector<uint256> ids;
+    std::vector<UtxoEntry> own;
+    for (int i = 0; i < 8; ++i)
+    {
+        ids.push_back(uint256S(std::string(1, static_cast<char>('a' + i))));
+        own.push_back(utxo(static_cast<char>('2' + i), 0));
+    }
+
+    boost::thread_group threads;
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        threads.create_thread([&r, &ids, &own, &shared, i]()
+        {
+            r.reserve(ids[i], {own[i], shared});
+        });
+    }
+    threads.join_all();
+
+    int holders = 0;
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        if (r.has(ids[i]))
+        {
+            ++holders;
+            BOOST_CHECK(reserved(r, own[i]));
+        }
+        else
+        {
+            BOOST_CHECK(!reserved(r, own[i]));
+        }
+    }
+    BOOST_CHECK_EQUAL(holders, 1);
+}
+
+BOOST_AUTO_TEST_CASE(reserve_skips_held_items)
+{
+    UtxoReservations r;
+    const uint256 a = uint256S("a1");
+    const UtxoEntry u1 = utxo('1', 0), u2 = utxo('2', 0);
+
+    // items of both roles are reserved under one id
+    BOOST_CHECK(r.reserve(a, {u1}));
+    BOOST_CHECK(r.reserve(a, {u1, u2, u2}));
+
+    std::vector<UtxoEntry> items;
+    BOOST_CHECK(r.items(a, items));
+    BOOST_CHECK(items == std::vector<UtxoEntry>({u1, u2}));
+
+    // one release frees the items
+    BOOST_CHECK(r.release(a));
+    BOOST_CHECK(!reserved(r, u1));
+    BOOST_CHECK(!reserved(r, u2));
+}
+
+BOOST_AUTO_TEST_CASE(release_items)
+{
+    UtxoReservations r;
+    const uint256 a = uint256S("a1"), b = uint256S("b2");
+    const UtxoEntry u1 = utxo('1', 0), u2 = utxo('2', 0), u3 = utxo('3', 0);
+
+    // items added by the second call are released, the first stay
+    std::vector<UtxoEntry> added;
+    BOOST_CHECK(r.reserve(a, {u1}));
+    BOOST_CHECK(r.reserve(a, {u1, u2}, &added));
+    BOOST_CHECK(added == std::vector<UtxoEntry>({u2}));
+
+    BOOST_CHECK(r.release(a, added));
+    BOOST_CHECK(reserved(r, u1));
+    BOOST_CHECK(!reserved(r, u2));
+    BOOST_CHECK(r.has(a));
+
+    // items of another order are skipped
+    BOOST_CHECK(r.reserve(b, {u3}));
+    BOOST_CHECK(r.release(a, {u1, u3}));
+    BOOST_CHECK(!r.has(a));
+    BOOST_CHECK(reserved(r, u3));
+    BOOST_CHECK(!r.release(a, {u1}));
+}
+
+BOOST_AUTO_TEST_CASE(invalid_txid)
+{
+    UtxoReservations r;
+    const uint256 a = uint256S("a1");
+    const UtxoEntry good = utxo('1', 0);
+
+    UtxoEntry shortId = utxo('2', 0);
+    shortId.txId = "2";
+    UtxoEntry notHex = utxo('2', 0);
+    notHex.txId[10] = 'x';
+
+    BOOST_CHECK(UtxoReservations::isValid(good));
+    BOOST_CHECK(!UtxoReservations::isValid(shortId));
+    BOOST_CHECK(!UtxoReservations::isValid(notHex));
+
+    // nothing is reserved if any item is malformed
+    BOOST_CHECK(!r.reserve(a, {good, shortId}));
+    BOOST_CHECK(!r.reserve(a, {notHex}));
+    BOOST_CHECK(!r.has(a));
+    BOOST_CHECK(!reserved(r, good));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
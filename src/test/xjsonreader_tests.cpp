@@ -0,0 +1,357 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xbridge/util/xjsonreader.h"
+#include "xbridge/xbridgewalletconnectorbtc.h"
+
+#include "utiltime.h"
+
+#include "json/json_spirit_reader_template.h"
+#include "json/json_spirit_utils.h"
+
+#include <clocale>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace xbridge;
+
+namespace
+{
+// values of a document as text, one token per value
+class RecordingHandler : public JsonHandler
+{
+public:
+    std::vector<std::string> tokens;
+
+    void startObject() { tokens.push_back("{"); }
+    void endObject()   { tokens.push_back("}"); }
+    void startArray()  { tokens.push_back("["); }
+    void endArray()    { tokens.push_back("]"); }
+    void key(const std::string & name)     { tokens.push_back("k:" + name); }
+    void string(const std::string & value) { tokens.push_back("s:" + value); }
+    void number(const char * begin, const char * end) { tokens.push_back("n:" + std::string(begin, end)); }
+    void boolean(const bool value)         { tokens.push_back(value ? "true" : "false"); }
+    void null()                            { tokens.push_back("null"); }
+};
+
+bool readString(const std::string & json, std::string & value)
+{
+    RecordingHandler h;
+    if (!readJson(json, h) || h.tokens.size() != 1 || h.tokens[0].compare(0, 2, "s:") != 0)
+        return false;
+    value = h.tokens[0].substr(2);
+    return true;
+}
+
+// listunspent reply read as before, through a json_spirit value tree
+std::vector<wallet::UtxoEntry> spiritUnspent(const std::string & reply)
+{
+    using namespace json_spirit;
+
+    std::vector<wallet::UtxoEntry> entries;
+    Value v;
+    BOOST_REQUIRE(read_string(reply, v));
+    const Value & result = find_value(v.get_obj(), "result");
+    for (const Value & item : result.get_array())
+    {
+        if (item.type() != obj_type)
+            continue;
+
+        wallet::UtxoEntry u;
+        u.vout = 0;
+        u.amount = 0;
+        for (const Pair & p : item.get_obj())
+        {
+            if (p.name_ == "txid")
+                u.txId = p.value_.get_str();
+            else if (p.name_ == "vout")
+                u.vout = p.value_.get_int();
+            else if (p.name_ == "amount")
+                u.amount = p.value_.get_real();
+            else if (p.name_ == "scriptPubKey")
+                u.scriptPubKey = p.value_.get_str();
+        }
+        if (!u.txId.empty() && u.amount > 0)
+            entries.push_back(u);
+    }
+    return entries;
+}
+
+// listunspent reply of a wallet with count coins
+std::string unspentReply(const size_t count)
+{
+    std::string reply = "{\"result\":[";
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (i)
+            reply += ",";
+        char txid[65];
+        for (size_t j = 0; j < 64; ++j)
+            txid[j] = "0123456789abcdef"[(i * 7 + j * 13) % 16];
+        txid[64] = 0;
+        reply += "{\"txid\":\"" + std::string(txid) + "\",\"vout\":" + std::to_string(i % 5) +
+                 ",\"address\":\"y8R2vSMEiGvgW4mHbiHn4ngzEETTXuBZ7A\",\"account\":\"\","
+                 "\"scriptPubKey\":\"76a914c7f0d6b4a5e3b29e4c3f8e9a4d2c1b0a9f8e7d6c88ac\","
+                 "\"amount\":" + std::to_string(i % 1000) + ".12345678,"
+                 "\"confirmations\":" + std::to_string(i) + ",\"spendable\":true}";
+    }
+    reply += "],\"error\":null,\"id\":1}";
+    return reply;
+}
+
+// sets a locale with a comma decimal point while in scope, if one is installed
+class CommaLocale
+{
+public:
+    CommaLocale() : m_old(setlocale(LC_NUMERIC, nullptr)), m_set(false)
+    {
+        for (const char * name : {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR.utf8", "ru_RU.UTF-8"})
+        {
+            if (setlocale(LC_NUMERIC, name) && *localeconv()->decimal_point == ',')
+            {
+                m_set = true;
+                break;
+            }
+        }
+    }
+    ~CommaLocale() { setlocale(LC_NUMERIC, m_old.c_str()); }
+
+    bool isSet() const { return m_set; }
+
+private:
+    std::string m_old;
+    bool        m_set;
+};
+}
+
+BOOST_AUTO_TEST_SUITE(xjsonreader_tests)
+
+BOOST_AUTO_TEST_CASE(document_order)
+{
+    RecordingHandler h;
+    BOOST_CHECK(readJson(" {\"a\": [1, -2.5e3, true, false, null], \"b\": {}, \"c\": \"x\"} ", h));
+
+    const std::vector<std::string> expected = {
+        "{", "k:a", "[", "n:1", "n:-2.5e3", "true", "false", "null", "]",
+        "k:b", "{", "}", "k:c", "s:x", "}"
+    };
+    BOOST_CHECK(h.tokens == expected);
+}
+
+BOOST_AUTO_TEST_CASE(escapes)
+{
+    std::string s;
+    BOOST_CHECK(readString("\"a\\\"b\\\\c\\/d\\b\\f\\n\\r\\t\"", s));
+    BOOST_CHECK_EQUAL(s, "a\"b\\c/d\b\f\n\r\t");
+
+    BOOST_CHECK(readString("\"\\u0041\\u00e9\\u20ac\"", s));
+    BOOST_CHECK_EQUAL(s, "A\xc3\xa9\xe2\x82\xac");
+
+    BOOST_CHECK(!readString("\"\\x\"", s));
+    BOOST_CHECK(!readString("\"\\u12\"", s));
+    BOOST_CHECK(!readString("\"\\u12g4\"", s));
+}
+
+BOOST_AUTO_TEST_CASE(surrogates)
+{
+    std::string s;
+
+    // U+1F600 as a surrogate pair
+    BOOST_CHECK(readString("\"\\ud83d\\ude00\"", s));
+    BOOST_CHECK_EQUAL(s, "\xf0\x9f\x98\x80");
+
+    // unpaired high surrogate
+    BOOST_CHECK(!readString("\"\\ud83d\"", s));
+    BOOST_CHECK(!readString("\"\\ud83dx\"", s));
+    // high surrogate followed by a non surrogate
+    BOOST_CHECK(!readString("\"\\ud83d\\u0041\"", s));
+    // unpaired low surrogate
+    BOOST_CHECK(!readString("\"\\ude00\"", s));
+}
+
+BOOST_AUTO_TEST_CASE(truncated_and_invalid)
+{
+    const std::string doc = "{\"result\":[{\"txid\":\"ab\",\"amount\":1.5}],\"error\":null,\"id\":1}";
+    RecordingHandler full;
+    BOOST_CHECK(readJson(doc, full));
+
+    for (size_t len = 0; len < doc.size(); ++len)
+    {
+        RecordingHandler h;
+        BOOST_CHECK_MESSAGE(!readJson(doc.substr(0, len), h), "prefix of " << len << " bytes");
+    }
+
+    const char * invalid[] = {
+        "", "   ", "{", "[1,]", "{\"a\"}", "{\"a\":1,}", "{a:1}", "[1 2]",
+        "tru", "nul", "01x", "-", "1.", "1e", ".5", "\"abc", "[1]]", "{} {}"
+    };
+    for (const char * text : invalid)
+    {
+        RecordingHandler h;
+        BOOST_CHECK_MESSAGE(!readJson(text, h), text);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(depth_limit)
+{
+    RecordingHandler h;
+    BOOST_CHECK(readJson(std::string(256, '[') + std::string(256, ']'), h));
+    BOOST_CHECK(!readJson(std::string(257, '[') + std::string(257, ']'), h));
+    BOOST_CHECK(!readJson(std::string(100000, '['), h));
+
+    std::string objects;
+    for (int i = 0; i < 257; ++i)
+        objects += "{\"a\":";
+    objects += "1" + std::string(257, '}');
+    BOOST_CHECK(!readJson(objects, h));
+}
+
+BOOST_AUTO_TEST_CASE(numbers)
+{
+    const std::string text = "-12.375e-1";
+    double d = 0;
+    BOOST_CHECK(parseDouble(text.data(), text.data() + text.size(), d));
+    BOOST_CHECK_EQUAL(d, -1.2375);
+
+    int64_t i = 0;
+    const std::string big = "9223372036854775807";
+    BOOST_CHECK(parseInt(big.data(), big.data() + big.size(), i));
+    BOOST_CHECK_EQUAL(i, std::numeric_limits<int64_t>::max());
+    const std::string over = "9223372036854775808";
+    BOOST_CHECK(!parseInt(over.data(), over.data() + over.size(), i));
+    BOOST_CHECK(!parseInt(text.data(), text.data() + text.size(), i));
+}
+
+BOOST_AUTO_TEST_CASE(numbers_comma_locale)
+{
+    CommaLocale locale;
+    if (!locale.isSet())
+    {
+        BOOST_TEST_MESSAGE("no locale with a comma decimal point installed, skipped");
+        return;
+    }
+
+    const std::string text = "0.12345678";
+    double d = 0;
+    BOOST_CHECK(parseDouble(text.data(), text.data() + text.size(), d));
+    BOOST_CHECK_EQUAL(d, 0.12345678);
+
+    std::vector<wallet::UtxoEntry> entries;
+    BOOST_CHECK(rpc::parseUnspentReply("{\"result\":[{\"txid\":\"ab\",\"vout\":1,\"amount\":2.5}],\"error\":null}", entries));
+    BOOST_REQUIRE_EQUAL(entries.size(), 1);
+    BOOST_CHECK_EQUAL(entries[0].amount, 2.5);
+}
+
+BOOST_AUTO_TEST_CASE(rpc_replies)
+{
+    std::vector<wallet::UtxoEntry> entries;
+
+    // error reply, message of the error object
+    BOOST_CHECK(!rpc::parseUnspentReply(
+        "{\"result\":null,\"error\":{\"code\":-28,\"message\":\"Loading wallet...\"},\"id\":1}", entries));
+    BOOST_CHECK(entries.empty());
+
+    // result which is not an array
+    BOOST_CHECK(!rpc::parseUnspentReply("{\"result\":\"text\",\"error\":null,\"id\":1}", entries));
+    BOOST_CHECK(!rpc::parseUnspentReply("{\"result\":null,\"error\":null,\"id\":1}", entries));
+
+    // invalid json throws
+    BOOST_CHECK_THROW(rpc::parseUnspentReply("{\"result\":[", entries), std::runtime_error);
+
+    // empty result
+    BOOST_CHECK(rpc::parseUnspentReply("{\"result\":[],\"error\":null,\"id\":1}", entries));
+    BOOST_CHECK(entries.empty());
+}
+
+BOOST_AUTO_TEST_CASE(rpc_reply_handler)
+{
+    class Handler : public JsonRpcReplyHandler
+    {
+    public:
+        std::vector<std::string> tokens;
+
+    protected:
+        void resultStartObject(const size_t depth) { tokens.push_back("{" + std::to_string(depth)); }
+        void resultEndObject(const size_t depth)   { tokens.push_back("}" + std::to_string(depth)); }
+        void resultKey(const size_t depth, const std::string & name) { tokens.push_back(name + std::to_string(depth)); }
+        void resultNumber(const size_t depth, const char * begin, const char * end) { tokens.push_back(std::string(begin, end) + "@" + std::to_string(depth)); }
+    };
+
+    // members of the reply outside the result are not forwarded
+    Handler h;
+    BOOST_CHECK(readJson("{\"id\":{\"x\":1},\"result\":{\"a\":{\"b\":2}},\"error\":null}", h));
+    BOOST_CHECK(h.hasResult());
+    BOOST_CHECK(!h.hasError());
+    const std::vector<std::string> expected = {"{0", "a0", "{1", "b1", "2@2", "}1", "}0"};
+    BOOST_CHECK(h.tokens == expected);
+
+    Handler e;
+    BOOST_CHECK(readJson("{\"result\":null,\"error\":\"plain message\"}", e));
+    BOOST_CHECK(!e.hasResult());
+    BOOST_CHECK(e.hasError());
+    BOOST_CHECK_EQUAL(e.error(), "plain message");
+}
+
+BOOST_AUTO_TEST_CASE(listunspent_as_json_spirit)
+{
+    const std::string reply =
+        "{\"result\":["
+        "{\"txid\":\"6f2e0b\",\"vout\":0,\"address\":\"y1\",\"account\":\"\",\"scriptPubKey\":\"76a914\","
+        "\"amount\":12.5,\"confirmations\":3,\"spendable\":true},"
+        "{\"txid\":\"a1b2c3\",\"vout\":7,\"amount\":1,\"scriptPubKey\":\"a914\",\"extra\":{\"amount\":99,\"txid\":\"no\"}},"
+        "{\"txid\":\"d4e5\",\"vout\":2,\"amount\":0},"
+        "{\"vout\":3,\"amount\":4.0},"
+        "5,\"text\",[1,2],"
+        "{\"amount\":0.00000001,\"vout\":4294967295,\"txid\":\"ff\\u0041\"}"
+        "],\"error\":null,\"id\":1}";
+
+    std::vector<wallet::UtxoEntry> entries;
+    BOOST_CHECK(rpc::parseUnspentReply(reply, entries));
+
+    const std::vector<wallet::UtxoEntry> expected = spiritUnspent(reply);
+    BOOST_REQUIRE_EQUAL(entries.size(), expected.size());
+    BOOST_REQUIRE_EQUAL(entries.size(), 3);
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(entries[i].txId, expected[i].txId);
+        BOOST_CHECK_EQUAL(entries[i].vout, expected[i].vout);
+        BOOST_CHECK_EQUAL(entries[i].amount, expected[i].amount);
+        BOOST_CHECK_EQUAL(entries[i].scriptPubKey, expected[i].scriptPubKey);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(listunspent_bench)
+{
+    const size_t count = 10000;
+    const std::string reply = unspentReply(count);
+    const int rounds = 5;
+
+    std::vector<wallet::UtxoEntry> entries;
+    int64_t start = GetTimeMicros();
+    for (int i = 0; i < rounds; ++i)
+    {
+        entries.clear();
+        BOOST_CHECK(rpc::parseUnspentReply(reply, entries));
+    }
+    const int64_t reader = GetTimeMicros() - start;
+
+    std::vector<wallet::UtxoEntry> expected;
+    start = GetTimeMicros();
+    for (int i = 0; i < rounds; ++i)
+        expected = spiritUnspent(reply);
+    const int64_t spirit = GetTimeMicros() - start;
+
+    BOOST_CHECK_EQUAL(entries.size(), count);
+    BOOST_REQUIRE_EQUAL(entries.size(), expected.size());
+    BOOST_CHECK_EQUAL(entries.back().txId, expected.back().txId);
+    BOOST_CHECK_EQUAL(entries.back().amount, expected.back().amount);
+
+    BOOST_TEST_MESSAGE("listunspent: " << count << " coins, " << reply.size() / 1024 << " KiB, one pass reader "
+                       << reader / rounds / 1000 << "ms, json_spirit " << spirit / rounds / 1000 << "ms");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
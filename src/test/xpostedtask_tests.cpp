@@ -0,0 +1,71 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xbridge/util/xpostedtask.h"
+
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+using xbridge::PostedTask;
+
+namespace
+{
+const boost::posix_time::ptime now = boost::posix_time::from_iso_string("20180619T042505");
+const boost::posix_time::ptime past = now - boost::posix_time::seconds(1);
+}
+
+BOOST_AUTO_TEST_SUITE(xpostedtask_tests)
+
+BOOST_AUTO_TEST_CASE(ticks_before_job_runs)
+{
+    boost::asio::io_service io;
+    PostedTask task;
+    int runs = 0;
+    auto job = [&runs]() { ++runs; };
+
+    // two timer ticks while the service is busy
+    BOOST_CHECK(task.postIfDue(io, past, now, job));
+    BOOST_CHECK(!task.postIfDue(io, past, now, job));
+    BOOST_CHECK(task.inFlight());
+
+    BOOST_CHECK_EQUAL(io.poll(), 1);
+    BOOST_CHECK_EQUAL(runs, 1);
+    BOOST_CHECK(!task.inFlight());
+
+    // next due tick posts again
+    io.reset();
+    BOOST_CHECK(task.postIfDue(io, now, now, job));
+    BOOST_CHECK_EQUAL(io.poll(), 1);
+    BOOST_CHECK_EQUAL(runs, 2);
+}
+
+BOOST_AUTO_TEST_CASE(not_due)
+{
+    boost::asio::io_service io;
+    PostedTask task;
+    int runs = 0;
+
+    BOOST_CHECK(!task.postIfDue(io, now, past, [&runs]() { ++runs; }));
+    BOOST_CHECK(!task.postIfDue(io, boost::posix_time::pos_infin, now, [&runs]() { ++runs; }));
+    BOOST_CHECK(!task.inFlight());
+    BOOST_CHECK_EQUAL(io.poll(), 0);
+    BOOST_CHECK_EQUAL(runs, 0);
+}
+
+BOOST_AUTO_TEST_CASE(job_throws)
+{
+    boost::asio::io_service io;
+    PostedTask task;
+
+    BOOST_CHECK(task.postIfDue(io, past, now, []() { throw std::runtime_error("job"); }));
+    BOOST_CHECK_THROW(io.poll(), std::runtime_error);
+
+    // task is free again
+    BOOST_CHECK(!task.inFlight());
+    io.reset();
+    BOOST_CHECK(task.postIfDue(io, past, now, []() {}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,179 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xbridge/util/xutxoselector.h"
+
+#include "utiltime.h"
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+using xbridge::UtxoSelector;
+
+namespace
+{
+// fees of the funding tx for 0..4 inputs, fee of the payment tx, smallest change
+const std::vector<uint64_t> fees = {0, 10, 20, 30, 40};
+const uint64_t fee2 = 5;
+const uint64_t minChange = 100;
+const uint64_t required = 1000;
+
+/**
+ * Coin amounts of a wallet, the same for every run.
+ */
+std::vector<uint64_t> syntheticCoins(const size_t count, const uint64_t maxAmount)
+{
+    std::vector<uint64_t> amounts;
+    uint32_t state = 12345;
+    for (size_t i = 0; i < count; ++i)
+    {
+        state = state * 1103515245 + 12345;
+        amounts.push_back(1 + (state >> 8) % maxAmount);
+    }
+    return amounts;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(xutxoselector_tests)
+
+BOOST_AUTO_TEST_CASE(exact_match)
+{
+    UtxoSelector selector(fees, fee2, minChange);
+    std::vector<size_t> selected;
+    uint64_t total = 0, fee1 = 0;
+
+    // 1015 pays required, fee2 and the fee of one input without change
+    BOOST_CHECK(selector.select({5000, 1015, 2000}, required, selected, total, fee1));
+    BOOST_CHECK(selected == std::vector<size_t>({1}));
+    BOOST_CHECK_EQUAL(total, 1015);
+    BOOST_CHECK_EQUAL(fee1, 10);
+}
+
+BOOST_AUTO_TEST_CASE(dust_change)
+{
+    UtxoSelector selector(fees, fee2, minChange);
+    std::vector<size_t> selected;
+    uint64_t total = 0, fee1 = 0;
+
+    // change of 35 would be dust
+    BOOST_CHECK(!selector.select({1050}, required, selected, total, fee1));
+    BOOST_CHECK(selected.empty());
+
+    // the coin with dust change is skipped for coins leaving usable change
+    BOOST_CHECK(selector.select({1050, 600, 600}, required, selected, total, fee1));
+    BOOST_CHECK(selected == std::vector<size_t>({1, 2}));
+    BOOST_CHECK_EQUAL(total, 1200);
+    BOOST_CHECK_EQUAL(fee1, 20);
+}
+
+BOOST_AUTO_TEST_CASE(fewest_inputs)
+{
+    UtxoSelector selector(fees, fee2, minChange);
+    std::vector<size_t> selected;
+    uint64_t total = 0, fee1 = 0;
+
+    // three coins of 400 leave the least change, two inputs are preferred,
+    // of them 900 + 300 leaves less change than 900 + 400
+    BOOST_CHECK(selector.select({400, 400, 400, 900, 300}, required, selected, total, fee1));
+    BOOST_CHECK(selected == std::vector<size_t>({3, 4}));
+    BOOST_CHECK_EQUAL(total, 1200);
+    BOOST_CHECK_EQUAL(fee1, 20);
+
+    // fees limit the input count
+    UtxoSelector oneInput({0, 10}, fee2, minChange);
+    BOOST_CHECK(!oneInput.select({600, 600}, required, selected, total, fee1));
+}
+
+BOOST_AUTO_TEST_CASE(single_coin_over_twice)
+{
+    UtxoSelector selector(fees, fee2, minChange);
+    std::vector<size_t> selected;
+    uint64_t total = 0, fee1 = 0;
+
+    // single coin is over twice the combination, smaller coins are used
+    BOOST_CHECK(selector.select({3000, 600, 600}, required, selected, total, fee1));
+    BOOST_CHECK(selected == std::vector<size_t>({1, 2}));
+    BOOST_CHECK_EQUAL(total, 1200);
+
+    // exactly twice, the single coin wins
+    BOOST_CHECK(selector.select({2400, 600, 600}, required, selected, total, fee1));
+    BOOST_CHECK(selected == std::vector<size_t>({0}));
+    BOOST_CHECK_EQUAL(total, 2400);
+    BOOST_CHECK_EQUAL(fee1, 10);
+}
+
+BOOST_AUTO_TEST_CASE(duplicate_amounts)
+{
+    UtxoSelector selector(fees, fee2, minChange);
+    std::vector<size_t> selected;
+    uint64_t total = 0, fee1 = 0;
+
+    // equal coins are taken in index order
+    BOOST_CHECK(selector.select({500, 500, 500, 500}, required, selected, total, fee1));
+    BOOST_CHECK(selected == std::vector<size_t>({0, 1, 2}));
+    BOOST_CHECK_EQUAL(total, 1500);
+    BOOST_CHECK_EQUAL(fee1, 30);
+
+    // eleven equal coins leave dust change, a twelfth input is added
+    std::vector<uint64_t> amounts(60, 100);
+    UtxoSelector many(std::vector<uint64_t>(16, 0), 0, minChange, 100);
+    BOOST_CHECK(many.select(amounts, 1050, selected, total, fee1));
+    BOOST_CHECK_EQUAL(selected.size(), 12);
+    BOOST_CHECK_EQUAL(selected.back(), 11);
+    BOOST_CHECK_EQUAL(total, 1200);
+}
+
+BOOST_AUTO_TEST_CASE(max_tries)
+{
+    std::vector<size_t> selected;
+    uint64_t total = 0, fee1 = 0;
+
+    UtxoSelector selector(fees, fee2, minChange);
+    BOOST_CHECK(selector.select({600, 600}, required, selected, total, fee1));
+
+    // search stops before reaching a usable combination
+    UtxoSelector cutoff(fees, fee2, minChange, 1);
+    BOOST_CHECK(!cutoff.select({600, 600}, required, selected, total, fee1));
+    BOOST_CHECK(selected.empty());
+}
+
+BOOST_AUTO_TEST_CASE(select_bench)
+{
+    // 10 per input up to 50 inputs
+    std::vector<uint64_t> benchFees;
+    for (uint64_t i = 0; i <= 50; ++i)
+        benchFees.push_back(i * 10);
+    UtxoSelector selector(benchFees, fee2, minChange);
+
+    const uint64_t order = 100000;
+    for (const size_t count : {100, 1000, 5000})
+    {
+        // coins of up to a tenth of the order, several are combined
+        const std::vector<uint64_t> amounts = syntheticCoins(count, order / 10);
+
+        std::vector<size_t> selected;
+        uint64_t total = 0, fee1 = 0;
+        const int rounds = 20;
+        bool found = true;
+
+        const int64_t start = GetTimeMicros();
+        for (int i = 0; i < rounds; ++i)
+            found &= selector.select(amounts, order, selected, total, fee1);
+        const int64_t elapsed = GetTimeMicros() - start;
+
+        BOOST_CHECK(found);
+        BOOST_CHECK_EQUAL(fee1, benchFees[selected.size()]);
+        uint64_t sum = 0;
+        for (const size_t i : selected)
+            sum += amounts[i];
+        BOOST_CHECK_EQUAL(sum, total);
+        BOOST_CHECK(total == order + fee2 + fee1 || total >= order + fee2 + fee1 + minChange);
+
+        BOOST_TEST_MESSAGE("select: " << count << " coins, " << selected.size() << " inputs, "
+                           << elapsed / rounds << "us per selection");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,172 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xbridge/xbridgewalletconnector.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/thread.hpp>
+
+using xbridge::WalletConnector;
+
+namespace
+{
+/**
+ * Connector whose deposit check waits until released, the other
+ * wallet calls are not used.
+ */
+class TestConnector : public WalletConnector
+{
+public:
+    TestConnector() : released(false), calls(0) {}
+
+    void release()
+    {
+        boost::mutex::scoped_lock l(lock);
+        released = true;
+        cond.notify_all();
+    }
+
+    bool checkDepositTransaction(const std::string &, const std::string &, double & amount, bool & isGood)
+    {
+        boost::mutex::scoped_lock l(lock);
+        while (!released)
+            cond.wait(l);
+        ++calls;
+        amount = 1;
+        isGood = true;
+        return true;
+    }
+
+    bool init() { return true; }
+    std::string fromXAddr(const std::vector<unsigned char> &) const { return std::string(); }
+    std::vector<unsigned char> toXAddr(const std::string &) const { return std::vector<unsigned char>(); }
+    bool getNewAddress(std::string &) { return false; }
+    bool requestAddressBook(std::vector<xbridge::wallet::AddressBookEntry> &) { return false; }
+    bool getInfo(xbridge::rpc::WalletInfo &) const { return false; }
+    bool getUnspent(std::vector<xbridge::wallet::UtxoEntry> &, const bool) const { return false; }
+    bool getTxOut(xbridge::wallet::UtxoEntry &) { return false; }
+    bool sendRawTransaction(const std::string &, std::string &, int32_t &, std::string &) { return false; }
+    bool signMessage(const std::string &, const std::string &, std::string &) { return false; }
+    bool verifyMessage(const std::string &, const std::string &, const std::string &) { return false; }
+    bool hasValidAddressPrefix(const std::string &) const { return false; }
+    bool isDustAmount(const double &) const { return false; }
+    bool newKeyPair(std::vector<unsigned char> &, std::vector<unsigned char> &) { return false; }
+    std::vector<unsigned char> getKeyId(const std::vector<unsigned char> &) { return std::vector<unsigned char>(); }
+    std::vector<unsigned char> getScriptId(const std::vector<unsigned char> &) { return std::vector<unsigned char>(); }
+    std::string scriptIdToString(const std::vector<unsigned char> &) const { return std::string(); }
+    double minTxFee1(const uint32_t, const uint32_t) const { return 0; }
+    double minTxFee2(const uint32_t, const uint32_t) const { return 0; }
+    uint32_t lockTime(const char) const { return 0; }
+    bool createDepositUnlockScript(const std::vector<unsigned char> &, const std::vector<unsigned char> &,
+                                   const std::vector<unsigned char> &, const uint32_t,
+                                   std::vector<unsigned char> &) { return false; }
+    bool createDepositTransaction(const std::vector<xbridge::XTxIn> &,
+                                  const std::vector<std::pair<std::string, double> > &,
+                                  std::string &, std::string &) { return false; }
+    bool createRefundTransaction(const std::vector<xbridge::XTxIn> &,
+                                 const std::vector<std::pair<std::string, double> > &,
+                                 const std::vector<unsigned char> &, const std::vector<unsigned char> &,
+                                 const std::vector<unsigned char> &, const uint32_t,
+                                 std::string &, std::string &) { return false; }
+    bool createPaymentTransaction(const std::vector<xbridge::XTxIn> &,
+                                  const std::vector<std::pair<std::string, double> > &,
+                                  const std::vector<unsigned char> &, const std::vector<unsigned char> &,
+                                  const std::vector<unsigned char> &, const std::vector<unsigned char> &,
+                                  std::string &, std::string &) { return false; }
+
+    boost::mutex lock;
+    boost::condition_variable cond;
+    bool released;
+    int calls;
+};
+
+/**
+ * Counts handler runs, wait() returns when count runs are done.
+ */
+struct Done
+{
+    Done() : count(0) {}
+
+    void add()
+    {
+        boost::mutex::scoped_lock l(lock);
+        ++count;
+        cond.notify_all();
+    }
+
+    bool wait(const int expected)
+    {
+        boost::mutex::scoped_lock l(lock);
+        return cond.wait_for(l, boost::chrono::seconds(10), [this, expected]() { return count >= expected; });
+    }
+
+    boost::mutex lock;
+    boost::condition_variable cond;
+    int count;
+};
+}
+
+BOOST_AUTO_TEST_SUITE(xwalletconnector_tests)
+
+BOOST_AUTO_TEST_CASE(slow_wallet_blocks_only_its_connector)
+{
+    std::shared_ptr<TestConnector> slow(new TestConnector);
+    std::shared_ptr<TestConnector> fast(new TestConnector);
+    fast->release();
+
+    // neither call runs on the calling thread
+    Done slowDone, fastDone;
+    slow->checkDepositTransactionAsync("a", std::string(), 1, [&slowDone](const bool, const double, const bool) { slowDone.add(); });
+    fast->checkDepositTransactionAsync("b", std::string(), 1, [&fastDone](const bool result, const double, const bool isGood)
+    {
+        BOOST_CHECK(result && isGood);
+        fastDone.add();
+    });
+
+    BOOST_CHECK(fastDone.wait(1));
+    BOOST_CHECK_EQUAL(slow->calls, 0);
+
+    slow->release();
+    BOOST_CHECK(slowDone.wait(1));
+
+    slow->stopService();
+    fast->stopService();
+}
+
+BOOST_AUTO_TEST_CASE(calls_run_in_order)
+{
+    std::shared_ptr<TestConnector> conn(new TestConnector);
+
+    std::vector<int> order;
+    Done done;
+    for (int i = 0; i < 5; ++i)
+    {
+        conn->post([i, &order, &done]()
+        {
+            order.push_back(i);
+            done.add();
+        });
+    }
+    conn->release();
+
+    BOOST_CHECK(done.wait(5));
+    BOOST_CHECK(order == std::vector<int>({0, 1, 2, 3, 4}));
+
+    conn->stopService();
+}
+
+BOOST_AUTO_TEST_CASE(called_in_place_after_stop)
+{
+    std::shared_ptr<TestConnector> conn(new TestConnector);
+    conn->stopService();
+
+    boost::thread::id id;
+    conn->post([&id]() { id = boost::this_thread::get_id(); });
+    BOOST_CHECK(id == boost::this_thread::get_id());
+
+    // a call that throws doesn't escape
+    conn->post([]() { throw std::runtime_error("wallet"); });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -5,6 +5,7 @@
 
 #include "txdb.h"
 
+#include "init.h"
 #include "main.h"
 #include "pow.h"
 #include "uint256.h"
@@ -195,69 +196,135 @@ bool CBlockTreeDB::ReadFlag(const std::string& name, bool& fValue)
     return true;
 }
 
-bool CBlockTreeDB::LoadBlockIndexGuts()
-{
-    boost::scoped_ptr<leveldb::Iterator> pcursor(NewIterator());
+/** Block index entries of one key range, read and checked by a loader thread */
+struct CBlockIndexRange {
+    std::vector<CBlockIndex> vIndex;
+    //! hash, previous and next hash of each entry in vIndex
+    std::vector<uint256> vHashes;
+    std::string strError;
+    //! stopped early by shutdown or thread interruption
+    bool fInterrupted;
 
-    CDataStream ssKeySet(SER_DISK, CLIENT_VERSION);
-    ssKeySet << make_pair('b', uint256());
-    pcursor->Seek(ssKeySet.str());
+    CBlockIndexRange() : fInterrupted(false) {}
+};
+
+/** Read the block index entries whose serialized hash starts with a byte in [nBegin, nEnd) */
+void static ReadBlockIndexRange(CBlockTreeDB* pdb, unsigned int nBegin, unsigned int nEnd, CBlockIndexRange* range)
+{
+    try {
+        boost::scoped_ptr<leveldb::Iterator> pcursor(pdb->NewIterator());
+
+        uint256 hashStart;
+        *hashStart.begin() = nBegin;
+        CDataStream ssKeySet(SER_DISK, CLIENT_VERSION);
+        ssKeySet << make_pair('b', hashStart);
+
+        for (pcursor->Seek(ssKeySet.str()); pcursor->Valid(); pcursor->Next()) {
+            boost::this_thread::interruption_point();
+            if (ShutdownRequested()) {
+                range->fInterrupted = true;
+                return;
+            }
 
-    // Load mapBlockIndex
-    while (pcursor->Valid()) {
-        boost::this_thread::interruption_point();
-        try {
             leveldb::Slice slKey = pcursor->key();
-            CDataStream ssKey(slKey.data(), slKey.data() + slKey.size(), SER_DISK, CLIENT_VERSION);
-            char chType;
-            ssKey >> chType;
-            if (chType == 'b') {
-                leveldb::Slice slValue = pcursor->value();
-                CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
-                CDiskBlockIndex diskindex;
-                ssValue >> diskindex;
-
-                // Construct block index object
-                CBlockIndex* pindexNew = InsertBlockIndex(diskindex.GetBlockHash());
-                pindexNew->pprev = InsertBlockIndex(diskindex.hashPrev);
-                pindexNew->pnext = InsertBlockIndex(diskindex.hashNext);
-                pindexNew->nHeight = diskindex.nHeight;
-                pindexNew->nFile = diskindex.nFile;
-                pindexNew->nDataPos = diskindex.nDataPos;
-                pindexNew->nUndoPos = diskindex.nUndoPos;
-                pindexNew->nVersion = diskindex.nVersion;
-                pindexNew->hashMerkleRoot = diskindex.hashMerkleRoot;
-                pindexNew->nTime = diskindex.nTime;
-                pindexNew->nBits = diskindex.nBits;
-                pindexNew->nNonce = diskindex.nNonce;
-                pindexNew->nStatus = diskindex.nStatus;
-                pindexNew->nTx = diskindex.nTx;
-
-                //Proof Of Stake
-                pindexNew->nMint = diskindex.nMint;
-                pindexNew->nMoneySupply = diskindex.nMoneySupply;
-                pindexNew->nFlags = diskindex.nFlags;
-                pindexNew->nStakeModifier = diskindex.nStakeModifier;
-                pindexNew->prevoutStake = diskindex.prevoutStake;
-                pindexNew->nStakeTime = diskindex.nStakeTime;
-                pindexNew->hashProofOfStake = diskindex.hashProofOfStake;
-
-                if (pindexNew->nHeight <= Params().LAST_POW_BLOCK()) {
-                    if (!CheckProofOfWork(pindexNew->GetBlockHash(), pindexNew->nBits))
-                        return error("LoadBlockIndex() : CheckProofOfWork failed: %s", pindexNew->ToString());
+            if (slKey.size() < 2 || slKey[0] != 'b' || (unsigned char)slKey[1] >= nEnd)
+                break;
+
+            leveldb::Slice slValue = pcursor->value();
+            CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
+            CDiskBlockIndex diskindex;
+            ssValue >> diskindex;
+
+            // hashing the header is most of the work of loading an entry
+            uint256 hash = diskindex.GetBlockHash();
+            if (diskindex.nHeight <= Params().LAST_POW_BLOCK()) {
+                if (!CheckProofOfWork(hash, diskindex.nBits)) {
+                    range->strError = strprintf("CheckProofOfWork failed: %s", diskindex.ToString());
+                    return;
                 }
-                // ppcoin: build setStakeSeen
-                if (pindexNew->IsProofOfStake())
-                    setStakeSeen.insert(make_pair(pindexNew->prevoutStake, pindexNew->nStakeTime));
+            }
 
-                pcursor->Next();
-            } else {
-                break; // if shutdown requested or finished loading block index
+            // pointers are set once the entry has its final address
+            range->vIndex.push_back(diskindex);
+            range->vHashes.push_back(hash);
+            range->vHashes.push_back(diskindex.hashPrev);
+            range->vHashes.push_back(diskindex.hashNext);
+        }
+        range->vIndex.shrink_to_fit();
+    } catch (boost::thread_interrupted&) {
+        range->fInterrupted = true;
+    } catch (std::exception& e) {
+        range->strError = strprintf("Deserialize or I/O error - %s", e.what());
+    }
+}
+
+bool CBlockTreeDB::LoadBlockIndexGuts()
+{
+    int64_t nTimeStart = GetTimeMicros();
+
+    // Entries are keyed by block hash, so the key space splits evenly by its first byte
+    int nThreads = std::max(1, std::min((int)boost::thread::hardware_concurrency(), MAX_BLOCK_INDEX_LOAD_THREADS));
+    std::vector<CBlockIndexRange> vRanges(nThreads);
+    if (nThreads == 1) {
+        ReadBlockIndexRange(this, 0, 256, &vRanges[0]);
+    } else {
+        boost::thread_group threads;
+        for (int i = 0; i < nThreads; i++)
+            threads.create_thread(boost::bind(&ReadBlockIndexRange, this, 256 * i / nThreads, 256 * (i + 1) / nThreads, &vRanges[i]));
+        try {
+            threads.join_all();
+        } catch (boost::thread_interrupted&) {
+            // workers write to vRanges, stop them before it goes away
+            threads.interrupt_all();
+            threads.join_all();
+            throw;
+        }
+    }
+
+    size_t nEntries = 0;
+    BOOST_FOREACH (const CBlockIndexRange& range, vRanges) {
+        if (range.fInterrupted)
+            return error("%s : interrupted", __func__);
+        if (!range.strError.empty())
+            return error("%s : %s", __func__, range.strError);
+        nEntries += range.vIndex.size();
+    }
+    int64_t nTimeRead = GetTimeMicros();
+
+    boost::this_thread::interruption_point();
+
+    // Load mapBlockIndex, entries keep the address they got in the arena
+    mapBlockIndex.reserve(mapBlockIndex.size() + nEntries);
+    std::vector<std::pair<CBlockIndex*, const uint256*> > vLoaded;
+    vLoaded.reserve(nEntries);
+    BOOST_FOREACH (CBlockIndexRange& range, vRanges) {
+        size_t nCount = range.vIndex.size();
+        CBlockIndex* pindexArena = AddBlockIndexArena(range.vIndex);
+        for (size_t i = 0; i < nCount; i++) {
+            CBlockIndex* pindexNew = pindexArena + i;
+            std::pair<BlockMap::iterator, bool> ret = mapBlockIndex.insert(make_pair(range.vHashes[3 * i], pindexNew));
+            if (!ret.second) {
+                // already referenced before it was loaded
+                *ret.first->second = *pindexNew;
+                pindexNew = ret.first->second;
             }
-        } catch (std::exception& e) {
-            return error("%s : Deserialize or I/O error - %s", __func__, e.what());
+            pindexNew->phashBlock = &ret.first->first;
+            vLoaded.push_back(make_pair(pindexNew, &range.vHashes[3 * i]));
         }
     }
 
+    for (size_t i = 0; i < vLoaded.size(); i++) {
+        CBlockIndex* pindexNew = vLoaded[i].first;
+        pindexNew->pprev = InsertBlockIndex(vLoaded[i].second[1]);
+        pindexNew->pnext = InsertBlockIndex(vLoaded[i].second[2]);
+
+        // ppcoin: build setStakeSeen
+        if (pindexNew->IsProofOfStake())
+            setStakeSeen.insert(make_pair(pindexNew->prevoutStake, pindexNew->nStakeTime));
+    }
+
+    LogPrintf("%s: read %u entries in %.2fms (%d threads), indexed in %.2fms\n", __func__,
+        nEntries, 0.001 * (nTimeRead - nTimeStart), nThreads, 0.001 * (GetTimeMicros() - nTimeRead));
+
     return true;
 }
@@ -33,6 +33,8 @@ class CValidationInterface {
 protected:
     virtual void UpdatedBlockTip(const CBlockIndex *) {}
     virtual void SyncTransaction(const CTransaction &, const CBlock *) {}
+    virtual void BlockConnected(const CBlock &, const CBlockIndex *) {}
+    virtual void BlockDisconnected(const CBlock &, const CBlockIndex *) {}
     virtual void NotifyTransactionLock(const CTransaction &) {}
     virtual void SetBestChain(const CBlockLocator &) {}
     virtual bool UpdatedTransaction(const uint256 &) { return false;}
@@ -52,6 +54,10 @@ struct CMainSignals {
     boost::signals2::signal<void (const CBlockIndex *)> UpdatedBlockTip;
     /** Notifies listeners of updated transaction data (transaction, and optionally the block it is found in. */
     boost::signals2::signal<void (const CTransaction &, const CBlock *)> SyncTransaction;
+    /** Notifies listeners of a block connected to the active chain tip. */
+    boost::signals2::signal<void (const CBlock &, const CBlockIndex *)> BlockConnected;
+    /** Notifies listeners of a block disconnected from the active chain tip. */
+    boost::signals2::signal<void (const CBlock &, const CBlockIndex *)> BlockDisconnected;
     /** Notifies listeners of an updated transaction lock without new data. */
     boost::signals2::signal<void (const CTransaction &)> NotifyTransactionLock;
     /** Notifies listeners of an updated transaction without new data (for now: a coinbase potentially becoming visible). */
@@ -9,6 +9,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/asio/ssl.hpp>
 #include <stdio.h>
+#include <deque>
+#include <memory>
 
 #include "bitcoinrpcconnector.h"
 #include "util/xutil.h"
@@ -20,10 +22,12 @@
 #include "rpcserver.h"
 #include "rpcprotocol.h"
 #include "rpcclient.h"
+#include "clientversion.h"
 #include "wallet.h"
 #include "init.h"
 #include "key.h"
 #include "sync.h"
+#include "compat.h"
 
 #define HTTP_DEBUG
 
@@ -88,37 +92,285 @@ int readHTTP(std::basic_istream<char>& stream, map<string, string>& mapHeadersRe
 
 //******************************************************************************
 //******************************************************************************
-Object CallRPC(const std::string & rpcuser, const std::string & rpcpasswd,
-               const std::string & rpcip, const std::string & rpcport,
-               const std::string & strMethod, const Array & params)
+string httpPost(const string & strMsg,
+                const map<string, string> & mapRequestHeaders,
+                const bool keepAlive)
+{
+    ostringstream s;
+    s << "POST / HTTP/1.1\r\n"
+      << "User-Agent: blocknetdx-json-rpc/" << FormatFullVersion() << "\r\n"
+      << "Host: 127.0.0.1\r\n"
+      << "Content-Type: application/json\r\n"
+      << "Content-Length: " << strMsg.size() << "\r\n"
+      << "Connection: " << (keepAlive ? "keep-alive" : "close") << "\r\n"
+      << "Accept: application/json\r\n";
+    for (const std::pair<const std::string, std::string> & item : mapRequestHeaders)
+        s << item.first << ": " << item.second << "\r\n";
+    s << "\r\n"
+      << strMsg;
+
+    return s.str();
+}
+
+//******************************************************************************
+// true if idle keep-alive connection was not closed by server
+// and has no unread data, checked without blocking
+//******************************************************************************
+bool isIdleConnectionAlive(ip::tcp::iostream & stream)
+{
+#if BOOST_VERSION >= 106600
+    SOCKET socket = stream.socket().native_handle();
+#else
+    SOCKET socket = stream.rdbuf()->native_handle();
+#endif
+
+    fd_set fdset;
+    FD_ZERO(&fdset);
+    FD_SET(socket, &fdset);
+    struct timeval timeout = {0, 0};
+
+    // readable idle connection is closed by server or has stale data,
+    // in both cases it can't be used
+    return select(socket + 1, &fdset, NULL, NULL, &timeout) == 0;
+}
+
+//******************************************************************************
+// pool of keep-alive connections to one wallet rpc endpoint
+//******************************************************************************
+class ConnectionPool
 {
-    boost::asio::ip::tcp::iostream stream;
-    stream.expires_from_now(boost::posix_time::seconds(GetArg("-rpcxbridgetimeout", 15)));
-    stream.connect(rpcip, rpcport);
-    if (stream.error() != boost::system::errc::success) {
-        LogPrint("net", "Failed to make rpc connection to %s:%s error %d: %s", rpcip, rpcport, stream.error(), stream.error().message());
-        throw runtime_error(strprintf("no response from server %s:%s - %s", rpcip.c_str(), rpcport.c_str(),
-                                      stream.error().message().c_str()));
+public:
+    typedef std::shared_ptr<ip::tcp::iostream> StreamPtr;
+
+    ConnectionPool(const std::string & rpcip, const std::string & rpcport)
+        : m_ip(rpcip)
+        , m_port(rpcport)
+    {
+    }
+
+    /**
+     * @brief acquire - take idle connection from pool or open new
+     * @param reused - true if connection taken from pool
+     * @return connected stream
+     * @throw std::runtime_error if connection failed
+     */
+    StreamPtr acquire(bool & reused)
+    {
+        reused = false;
+
+        {
+            LOCK(m_lock);
+
+            evictIdle();
+
+            // most recently used connection is the most likely alive
+            if (!m_idle.empty())
+            {
+                StreamPtr stream = m_idle.back().stream;
+                m_idle.pop_back();
+
+                ++m_stats.hits;
+                reused = true;
+                return stream;
+            }
+
+            ++m_stats.misses;
+        }
+
+        StreamPtr stream(new ip::tcp::iostream);
+        stream->expires_from_now(boost::posix_time::seconds(GetArg("-rpcxbridgetimeout", 15)));
+        stream->connect(m_ip, m_port);
+        if (stream->error() != boost::system::errc::success)
+        {
+            LogPrint("net", "Failed to make rpc connection to %s:%s error %d: %s", m_ip, m_port, stream->error(), stream->error().message());
+            throw runtime_error(strprintf("no response from server %s:%s - %s", m_ip.c_str(), m_port.c_str(),
+                                          stream->error().message().c_str()));
+        }
+
+        return stream;
+    }
+
+    /**
+     * @brief release - return connection to pool for reuse
+     * @param stream - connection
+     */
+    void release(const StreamPtr & stream)
+    {
+        const size_t maxSize = static_cast<size_t>(std::max(GetArg("-rpcxbridgepoolsize", 4), static_cast<int64_t>(0)));
+
+        LOCK(m_lock);
+
+        m_idle.push_back(IdleConnection(stream, GetTime()));
+
+        while (m_idle.size() > maxSize)
+        {
+            // drop least recently used
+            m_idle.pop_front();
+            ++m_stats.evicted;
+        }
     }
 
+    void reconnected()
+    {
+        LOCK(m_lock);
+        ++m_stats.reconnects;
+    }
+
+    void clear()
+    {
+        LOCK(m_lock);
+        m_stats.evicted += m_idle.size();
+        m_idle.clear();
+    }
+
+    ConnectionPoolStats stats()
+    {
+        LOCK(m_lock);
+        evictIdle();
+
+        ConnectionPoolStats result = m_stats;
+        result.idle = m_idle.size();
+        return result;
+    }
+
+private:
+    struct IdleConnection
+    {
+        StreamPtr stream;
+        int64_t   lastUsed;
+
+        IdleConnection(const StreamPtr & _stream, const int64_t _lastUsed)
+            : stream(_stream)
+            , lastUsed(_lastUsed)
+        {
+        }
+    };
+
+    // not threadsafe, m_lock must be held
+    void evictIdle()
+    {
+        const int64_t expired = GetTime() - GetArg("-rpcxbridgepoolidle", 15);
+        while (!m_idle.empty() && m_idle.front().lastUsed < expired)
+        {
+            m_idle.pop_front();
+            ++m_stats.evicted;
+        }
+    }
+
+private:
+    const std::string           m_ip;
+    const std::string           m_port;
+
+    CCriticalSection            m_lock;
+    // ordered from least to most recently used
+    std::deque<IdleConnection>  m_idle;
+    ConnectionPoolStats         m_stats;
+};
+
+typedef std::shared_ptr<ConnectionPool> ConnectionPoolPtr;
+
+static CCriticalSection cs_connectionPools;
+static std::map<std::string, ConnectionPoolPtr> connectionPools;
+
+//******************************************************************************
+//******************************************************************************
+ConnectionPoolPtr connectionPool(const std::string & rpcip, const std::string & rpcport,
+                                 const bool create)
+{
+    const std::string key = rpcip + ":" + rpcport;
+
+    LOCK(cs_connectionPools);
+
+    std::map<std::string, ConnectionPoolPtr>::iterator i = connectionPools.find(key);
+    if (i != connectionPools.end())
+    {
+        return i->second;
+    }
+
+    if (!create)
+    {
+        return ConnectionPoolPtr();
+    }
+
+    ConnectionPoolPtr pool(new ConnectionPool(rpcip, rpcport));
+    connectionPools[key] = pool;
+    return pool;
+}
+
+//******************************************************************************
+//******************************************************************************
+bool connectionPoolStats(const std::string & rpcip,
+                         const std::string & rpcport,
+                         ConnectionPoolStats & stats)
+{
+    ConnectionPoolPtr pool = connectionPool(rpcip, rpcport, false);
+    if (!pool)
+    {
+        return false;
+    }
+
+    stats = pool->stats();
+    return true;
+}
+
+//******************************************************************************
+//******************************************************************************
+void clearConnectionPool(const std::string & rpcip,
+                         const std::string & rpcport)
+{
+    ConnectionPoolPtr pool = connectionPool(rpcip, rpcport, false);
+    if (pool)
+    {
+        pool->clear();
+    }
+}
+
+//******************************************************************************
+// send json request to wallet, return reply body
+//******************************************************************************
+string CallHTTP(const std::string & rpcuser, const std::string & rpcpasswd,
+                const std::string & rpcip, const std::string & rpcport,
+                const std::string & strMethod, const std::string & strRequest)
+{
+    ConnectionPoolPtr pool = connectionPool(rpcip, rpcport, true);
+    const bool usePool = GetArg("-rpcxbridgepoolsize", 4) > 0;
+
     // HTTP basic authentication
     string strUserPass64 = util::base64_encode(rpcuser + ":" + rpcpasswd);
     map<string, string> mapRequestHeaders;
     mapRequestHeaders["Authorization"] = string("Basic ") + strUserPass64;
 
-    // Send request
-    string strRequest = JSONRPCRequest(strMethod, params, 1);
-
     if(fDebug)
         LOG() << "HTTP: req  " << strMethod << " " << strRequest;
 
-    string strPost = HTTPPost(strRequest, mapRequestHeaders);
-    stream << strPost << std::flush;
+    string strPost = httpPost(strRequest, mapRequestHeaders, usePool);
 
-    // Receive reply
     map<string, string> mapHeaders;
     string strReply;
-    int nStatus = readHTTP(stream, mapHeaders, strReply);
+    int nStatus = 0;
+
+    bool reused = false;
+    ConnectionPool::StreamPtr stream = pool->acquire(reused);
+    while (reused && !isIdleConnectionAlive(*stream))
+    {
+        // server closed idle connection, nothing is sent yet,
+        // so the request can go on another one. calls are never
+        // resent after it was written, they can be not idempotent
+        // (sendrawtransaction)
+        pool->reconnected();
+        stream = pool->acquire(reused);
+    }
+    stream->expires_from_now(boost::posix_time::seconds(GetArg("-rpcxbridgetimeout", 15)));
+
+    *stream << strPost << std::flush;
+
+    // Receive reply
+    nStatus = readHTTP(*stream, mapHeaders, strReply);
+
+    if (usePool && stream->good() && mapHeaders["connection"] == "keep-alive")
+    {
+        pool->release(stream);
+    }
 
     if(fDebug)
         LOG() << "HTTP: resp " << nStatus << " " << strReply;
@@ -130,6 +382,30 @@ Object CallRPC(const std::string & rpcuser, const std::string & rpcpasswd,
     else if (strReply.empty())
         throw runtime_error("no response from server");
 
+    return strReply;
+}
+
+//******************************************************************************
+// send request, return reply text not parsed,
+// for large replies read in one pass (util/xjsonreader.h)
+//******************************************************************************
+string CallRPCText(const std::string & rpcuser, const std::string & rpcpasswd,
+                   const std::string & rpcip, const std::string & rpcport,
+                   const std::string & strMethod, const Array & params)
+{
+    string strRequest = JSONRPCRequest(strMethod, params, 1);
+    return CallHTTP(rpcuser, rpcpasswd, rpcip, rpcport, strMethod, strRequest);
+}
+
+//******************************************************************************
+//******************************************************************************
+Object CallRPC(const std::string & rpcuser, const std::string & rpcpasswd,
+               const std::string & rpcip, const std::string & rpcport,
+               const std::string & strMethod, const Array & params)
+{
+    // Send request
+    string strReply = CallRPCText(rpcuser, rpcpasswd, rpcip, rpcport, strMethod, params);
+
     // Parse reply
     Value valReply;
     if (!read_string(strReply, valReply))
@@ -141,6 +417,76 @@ Object CallRPC(const std::string & rpcuser, const std::string & rpcpasswd,
     return reply;
 }
 
+//******************************************************************************
+// send all calls as one json-rpc 2.0 batch request,
+// returns reply objects in order of calls
+//******************************************************************************
+Array CallRPCBatch(const std::string & rpcuser, const std::string & rpcpasswd,
+                   const std::string & rpcip, const std::string & rpcport,
+                   const std::vector<std::pair<std::string, Array> > & calls)
+{
+    if (calls.empty())
+    {
+        return Array();
+    }
+
+    Array batch;
+    for (size_t i = 0; i < calls.size(); ++i)
+    {
+        Object request;
+        request.push_back(Pair("jsonrpc", "2.0"));
+        request.push_back(Pair("method",  calls[i].first));
+        request.push_back(Pair("params",  calls[i].second));
+        request.push_back(Pair("id",      static_cast<int>(i)));
+        batch.push_back(request);
+    }
+
+    string strRequest = write_string(Value(batch), false) + "\n";
+    string strReply   = CallHTTP(rpcuser, rpcpasswd, rpcip, rpcport,
+                                 "batch " + calls.front().first, strRequest);
+
+    // Parse reply
+    Value valReply;
+    if (!read_string(strReply, valReply))
+        throw runtime_error("couldn't parse reply from server");
+    if (valReply.type() != array_type)
+    {
+        // whole batch rejected
+        if (valReply.type() == obj_type)
+        {
+            const Value & error = find_value(valReply.get_obj(), "error");
+            if (error.type() != null_type)
+                throw runtime_error("batch request error " + write_string(error, false));
+        }
+        throw runtime_error("expected reply to batch request to be an array");
+    }
+
+    // replies can be in any order, match by id
+    Object noReply;
+    noReply.push_back(Pair("result", Value::null));
+    noReply.push_back(Pair("error",  JSONRPCError(RPC_MISC_ERROR, "no reply in batch")));
+
+    Array replies(calls.size(), noReply);
+    for (const Value & v : valReply.get_array())
+    {
+        if (v.type() != obj_type)
+        {
+            continue;
+        }
+
+        const Value & id = find_value(v.get_obj(), "id");
+        if (id.type() != int_type || id.get_int() < 0 ||
+            static_cast<size_t>(id.get_int()) >= calls.size())
+        {
+            continue;
+        }
+
+        replies[id.get_int()] = v;
+    }
+
+    return replies;
+}
+
 //*****************************************************************************
 //*****************************************************************************
 bool storeDataIntoBlockchain(const std::vector<unsigned char> & dstScript,
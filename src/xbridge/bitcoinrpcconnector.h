@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <cstddef>
 
 //*****************************************************************************
 //*****************************************************************************
@@ -17,6 +18,52 @@ namespace xbridge
 //******************************************************************************
 namespace rpc
 {
+    /**
+     * @brief The ConnectionPoolStats struct - counters of the keep-alive
+     * connection pool used for wallet rpc calls to one endpoint
+     */
+    struct ConnectionPoolStats
+    {
+        // request served by an idle pooled connection
+        uint64_t hits;
+        // request required a new connection
+        uint64_t misses;
+        // stale idle connection replaced before sending
+        uint64_t reconnects;
+        // idle connections dropped by timeout or pool size limit
+        uint64_t evicted;
+        // idle connections in pool now
+        size_t   idle;
+
+        ConnectionPoolStats()
+            : hits(0)
+            , misses(0)
+            , reconnects(0)
+            , evicted(0)
+            , idle(0)
+        {
+        }
+    };
+
+    /**
+     * @brief connectionPoolStats - return counters of the connection pool
+     * @param rpcip - wallet rpc address
+     * @param rpcport - wallet rpc port
+     * @param stats - pool counters
+     * @return true, if pool for this endpoint exists
+     */
+    bool connectionPoolStats(const std::string & rpcip,
+                             const std::string & rpcport,
+                             ConnectionPoolStats & stats);
+
+    /**
+     * @brief clearConnectionPool - close all idle connections to endpoint
+     * @param rpcip - wallet rpc address
+     * @param rpcport - wallet rpc port
+     */
+    void clearConnectionPool(const std::string & rpcip,
+                             const std::string & rpcport);
+
     // helper fn-s
     /**
      * @brief storeDataIntoBlockchain
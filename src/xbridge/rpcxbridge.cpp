@@ -29,6 +29,7 @@
 #include "util/xseries.h"
 #include "util/xutil.h"
 #include "xbridgeapp.h"
+#include "bitcoinrpcconnector.h"
 #include "xbridgeexchange.h"
 #include "xbridgetransaction.h"
 #include "xbridgetransactiondescr.h"
@@ -41,7 +42,6 @@ using namespace std;
 using namespace boost;
 using namespace boost::asio;
 
-using TransactionMap    = std::map<uint256, xbridge::TransactionDescrPtr>;
 using TransactionPair   = std::pair<uint256, xbridge::TransactionDescrPtr>;
 using RealVector        = std::vector<double>;
 using TransactionVector = std::vector<xbridge::TransactionDescrPtr>;
@@ -148,10 +148,10 @@ Value dxGetOrders(const Array & params, bool fHelp)
     }
 
     auto &xapp = xbridge::App::instance();
-    TransactionMap trlist = xapp.transactions();
+    const auto trlist = xapp.transactions();
 
     Array result;
-    for (const auto& trEntry : trlist) {
+    for (const auto& trEntry : *trlist) {
 
         const auto &tr = trEntry.second;
 
@@ -212,13 +212,13 @@ Value dxGetOrderFills(const Array & params, bool fHelp)
 
 
 
-    TransactionMap history = xbridge::App::instance().history();
+    const auto history = xbridge::App::instance().history();
 
 
 
     TransactionVector result;
 
-    for (auto &item : history) {
+    for (auto &item : *history) {
         const xbridge::TransactionDescrPtr &ptr = item.second;
         if ((ptr->state == xbridge::TransactionDescr::trFinished) &&
             (combined ? ((ptr->fromCurrency == maker && ptr->toCurrency == taker) || (ptr->toCurrency == maker && ptr->fromCurrency == taker)) : (ptr->fromCurrency == maker && ptr->toCurrency == taker))) {
@@ -856,7 +856,6 @@ Value dxGetOrderBook(const json_spirit::Array& params, bool fHelp)
     }
 
     Object res;
-    TransactionMap trList = xbridge::App::instance().transactions();
     {
         /**
          * @brief detaiLevel - Get a list of open orders for a product.
@@ -892,186 +891,38 @@ Value dxGetOrderBook(const json_spirit::Array& params, bool fHelp)
          */
         Array asks;
 
-        if(trList.empty())
-        {
-            LOG() << "empty transactions list";
-            res.emplace_back(Pair("asks", asks));
-            res.emplace_back(Pair("bids", bids));
-            return res;
-        }
-
-        TransactionMap asksList;
-        TransactionMap bidsList;
-
-        //copy all transactions in currencies specified in the parameters
-
-        // ask orders are based in the first token in the trading pair
-        std::copy_if(trList.begin(), trList.end(), std::inserter(asksList, asksList.end()),
-                     [&toCurrency, &fromCurrency](const TransactionPair &transaction)
-        {
-            if(transaction.second == nullptr)
-                return false;
-            if (transaction.second->fromAmount <= 0 || transaction.second->toAmount <= 0)
-                return false;
-            if (transaction.second->state != xbridge::TransactionDescr::trPending)
-                return false;
-
-            return  ((transaction.second->toCurrency == toCurrency) &&
-                    (transaction.second->fromCurrency == fromCurrency));
-        });
-
-        // bid orders are based in the second token in the trading pair (inverse of asks)
-        std::copy_if(trList.begin(), trList.end(), std::inserter(bidsList, bidsList.end()),
-                     [&toCurrency, &fromCurrency](const TransactionPair &transaction)
-        {
-            if(transaction.second == nullptr)
-                return false;
-            if (transaction.second->fromAmount <= 0 || transaction.second->toAmount <= 0)
-                return false;
-            if (transaction.second->state != xbridge::TransactionDescr::trPending)
-                return false;
-
-            return  ((transaction.second->toCurrency == fromCurrency) &&
-                    (transaction.second->fromCurrency == toCurrency));
-        });
-
-        std::vector<xbridge::TransactionDescrPtr> asksVector;
-        std::vector<xbridge::TransactionDescrPtr> bidsVector;
-
-        for (const auto &trEntry : asksList)
-            asksVector.emplace_back(trEntry.second);
-
-        for (const auto &trEntry : bidsList)
-            bidsVector.emplace_back(trEntry.second);
-
-        // sort asks descending
-        std::sort(asksVector.begin(), asksVector.end(),
-                  [](const xbridge::TransactionDescrPtr &a, const xbridge::TransactionDescrPtr &b)
-        {
-            const auto priceA = util::price(a);
-            const auto priceB = util::price(b);
-            return priceA > priceB;
-        });
+        xbridge::App & xapp = xbridge::App::instance();
 
-        //sort bids descending
-        std::sort(bidsVector.begin(), bidsVector.end(),
-                  [](const xbridge::TransactionDescrPtr &a, const xbridge::TransactionDescrPtr &b)
-        {
-            const auto priceA = util::priceBid(a);
-            const auto priceB = util::priceBid(b);
-            return priceA > priceB;
-        });
-
-        // floating point comparisons
-        // see Knuth 4.2.2 Eq 36
-        auto floatCompare = [](const double a, const double b) -> bool
-        {
-            const auto epsilon = std::numeric_limits<double>::epsilon();
-            return (fabs(a - b) / fabs(a) <= epsilon) && (fabs(a - b) / fabs(b) <= epsilon);
-        };
+        // ask orders are based in the first token in the trading pair,
+        // bid orders are based in the second token (inverse of asks),
+        // bid price is inverse of order price, so best bid is lowest order price
+        const bool bestOnly = detailLevel == 1 || detailLevel == 4;
+        const std::vector<xbridge::OrderBook::Level> asksLevels =
+                xapp.orderBook(fromCurrency, toCurrency, bestOnly, bestOnly ? 1 : maxOrders);
+        const std::vector<xbridge::OrderBook::Level> bidsLevels =
+                xapp.orderBook(toCurrency, fromCurrency, true, bestOnly ? 1 : maxOrders);
 
         switch (detailLevel)
         {
         case 1:
         {
             //return only the best bid and ask
-            if (!bidsList.empty()) {
-                const auto bidsItem = std::max_element(bidsList.begin(), bidsList.end(),
-                                       [](const TransactionPair &a, const TransactionPair &b)
-                {
-                    //find transaction with best bids
-                    const auto &tr1 = a.second;
-                    const auto &tr2 = b.second;
-
-                    if(tr1 == nullptr)
-                        return true;
-
-                    if(tr2 == nullptr)
-                        return false;
-
-                    const auto priceA = util::priceBid(tr1);
-                    const auto priceB = util::priceBid(tr2);
-
-                    return priceA < priceB;
-                });
-
-                const auto bidsCount = std::count_if(bidsList.begin(), bidsList.end(),
-                                                     [bidsItem, floatCompare](const TransactionPair &a)
-                {
-                    const auto &tr = a.second;
-
-                    if(tr == nullptr)
-                        return false;
-
-                    const auto price = util::priceBid(tr);
-
-                    const auto &bestTr = bidsItem->second;
-                    if (bestTr != nullptr)
-                    {
-                        const auto bestBidPrice = util::priceBid(bestTr);
-                        return floatCompare(price, bestBidPrice);
-                    }
-
-                    return false;
-                });
-
-                const auto &tr = bidsItem->second;
-                if (tr != nullptr)
-                {
-                    const auto bidPrice = util::priceBid(tr);
-                    bids.emplace_back(Array{util::xBridgeStringValueFromPrice(bidPrice),
-                                            util::xBridgeStringValueFromAmount(tr->toAmount),
-                                            static_cast<int64_t>(bidsCount)});
-                }
+            if (!bidsLevels.empty())
+            {
+                const auto & level = bidsLevels.front();
+                const auto & tr    = level.orders.front();
+                bids.emplace_back(Array{util::xBridgeStringValueFromPrice(util::priceBid(tr)),
+                                        util::xBridgeStringValueFromAmount(tr->toAmount),
+                                        static_cast<int64_t>(level.orders.size())});
             }
 
-            if (!asksList.empty()) {
-                const auto asksItem = std::min_element(asksList.begin(), asksList.end(),
-                                                   [](const TransactionPair &a, const TransactionPair &b)
-                {
-                    //find transactions with best asks
-                    const auto &tr1 = a.second;
-                    const auto &tr2 = b.second;
-
-                    if(tr1 == nullptr)
-                        return true;
-
-                    if(tr2 == nullptr)
-                        return false;
-
-                    const auto priceA = util::price(tr1);
-                    const auto priceB = util::price(tr2);
-                    return priceA < priceB;
-                });
-
-                const auto asksCount = std::count_if(asksList.begin(), asksList.end(),
-                                                     [asksItem, floatCompare](const TransactionPair &a)
-                {
-                    const auto &tr = a.second;
-
-                    if(tr == nullptr)
-                        return false;
-
-                    const auto price = util::price(tr);
-
-                    const auto &bestTr = asksItem->second;
-                    if (bestTr != nullptr)
-                    {
-                        const auto bestAskPrice = util::price(bestTr);
-                        return floatCompare(price, bestAskPrice);
-                    }
-
-                    return false;
-                });
-
-                const auto &tr = asksItem->second;
-                if (tr != nullptr)
-                {
-                    const auto askPrice = util::price(tr);
-                    asks.emplace_back(Array{util::xBridgeStringValueFromPrice(askPrice),
-                                            util::xBridgeStringValueFromAmount(tr->fromAmount),
-                                            static_cast<int64_t>(asksCount)});
-                }
+            if (!asksLevels.empty())
+            {
+                const auto & level = asksLevels.front();
+                const auto & tr    = level.orders.front();
+                asks.emplace_back(Array{util::xBridgeStringValueFromPrice(util::price(tr)),
+                                        util::xBridgeStringValueFromAmount(tr->fromAmount),
+                                        static_cast<int64_t>(level.orders.size())});
             }
 
             res.emplace_back(Pair("asks", asks));
@@ -1081,76 +932,21 @@ Value dxGetOrderBook(const json_spirit::Array& params, bool fHelp)
         case 2:
         {
             //Top X bids and asks (aggregated)
-
-            /**
-             * @brief bound - calculate upper bound
-             */
-            auto bound = std::min(maxOrders, bidsVector.size());
-
-            for (size_t i = 0; i < bound; i++)
+            for (const auto & level : bidsLevels)
             {
-                if(bidsVector[i] == nullptr)
-                    continue;
-
                 Array bid;
-                //calculate bids and push to array
-                const auto bidAmount    = bidsVector[i]->toAmount;
-                const auto bidPrice     = util::priceBid(bidsVector[i]);
-                auto bidSize            = bidAmount;
-                const auto bidsCount    = std::count_if(bidsList.begin(), bidsList.end(),
-                                                     [bidPrice, floatCompare](const TransactionPair &a)
-                {
-                    const auto &tr = a.second;
-
-                    if(tr == nullptr)
-                        return false;
-
-                    const auto price = util::priceBid(tr);
-
-                    return floatCompare(price, bidPrice);
-                });
-                //array sorted by bid price, we can to skip the transactions with equals bid price
-                while((++i < bound) && floatCompare(util::priceBid(bidsVector[i]), bidPrice)) {
-                    bidSize += bidsVector[i]->toAmount;
-                }
-                bid.emplace_back(util::xBridgeStringValueFromPrice(bidPrice));
-                bid.emplace_back(util::xBridgeStringValueFromPrice(bidSize));
-                bid.emplace_back(static_cast<int64_t>(bidsCount));
+                bid.emplace_back(util::xBridgeStringValueFromPrice(util::priceBid(level.orders.front())));
+                bid.emplace_back(util::xBridgeStringValueFromPrice(level.toAmount));
+                bid.emplace_back(static_cast<int64_t>(level.orders.size()));
                 bids.emplace_back(bid);
             }
 
-            bound = std::min(maxOrders, asksVector.size());
-
-            for (size_t i = 0; i < bound; i++)
+            for (const auto & level : asksLevels)
             {
-                if(asksVector[i] == nullptr)
-                    continue;
-
                 Array ask;
-                //calculate asks and push to array
-                const auto askAmount    = asksVector[i]->fromAmount;
-                const auto askPrice     = util::price(asksVector[i]);
-                auto askSize            = askAmount;
-                const auto asksCount    = std::count_if(asksList.begin(), asksList.end(),
-                                                     [askPrice, floatCompare](const TransactionPair &a)
-                {
-                    const auto &tr = a.second;
-
-                    if(tr == nullptr)
-                        return false;
-
-                    const auto price = util::price(tr);
-
-                    return floatCompare(price, askPrice);
-                });
-
-                //array sorted by price, we can to skip the transactions with equals price
-                while((++i < bound) && floatCompare(util::price(asksVector[i]), askPrice)){
-                    askSize += asksVector[i]->fromAmount;
-                }
-                ask.emplace_back(util::xBridgeStringValueFromPrice(askPrice));
-                ask.emplace_back(util::xBridgeStringValueFromPrice(askSize));
-                ask.emplace_back(static_cast<int64_t>(asksCount));
+                ask.emplace_back(util::xBridgeStringValueFromPrice(util::price(level.orders.front())));
+                ask.emplace_back(util::xBridgeStringValueFromPrice(level.fromAmount));
+                ask.emplace_back(static_cast<int64_t>(level.orders.size()));
                 asks.emplace_back(ask);
             }
 
@@ -1161,38 +957,36 @@ Value dxGetOrderBook(const json_spirit::Array& params, bool fHelp)
         case 3:
         {
             //Full order book (non aggregated)
-            auto bound = std::min(maxOrders, bidsVector.size());
-
-            for (size_t i = 0; i < bound; i++)
+            for (const auto & level : bidsLevels)
             {
-                if(bidsVector[i] == nullptr)
-                    continue;
+                for (const auto & tr : level.orders)
+                {
+                    if (bids.size() >= maxOrders)
+                        break;
 
-                Array bid;
-                const auto bidAmount   = bidsVector[i]->toAmount;
-                const auto bidPrice    = util::priceBid(bidsVector[i]);
-                bid.emplace_back(util::xBridgeStringValueFromPrice(bidPrice));
-                bid.emplace_back(util::xBridgeStringValueFromAmount(bidAmount));
-                bid.emplace_back(bidsVector[i]->id.GetHex());
+                    Array bid;
+                    bid.emplace_back(util::xBridgeStringValueFromPrice(util::priceBid(tr)));
+                    bid.emplace_back(util::xBridgeStringValueFromAmount(tr->toAmount));
+                    bid.emplace_back(tr->id.GetHex());
 
-                bids.emplace_back(bid);
+                    bids.emplace_back(bid);
+                }
             }
 
-            bound = std::min(maxOrders, asksVector.size());
-
-            for (size_t i = 0; i < bound; i++)
+            for (const auto & level : asksLevels)
             {
-                if(asksVector[i] == nullptr)
-                    continue;
+                for (const auto & tr : level.orders)
+                {
+                    if (asks.size() >= maxOrders)
+                        break;
 
-                Array ask;
-                const auto bidAmount    = asksVector[i]->fromAmount;
-                const auto askPrice     = util::price(asksVector[i]);
-                ask.emplace_back(util::xBridgeStringValueFromPrice(askPrice));
-                ask.emplace_back(util::xBridgeStringValueFromAmount(bidAmount));
-                ask.emplace_back(asksVector[i]->id.GetHex());
+                    Array ask;
+                    ask.emplace_back(util::xBridgeStringValueFromPrice(util::price(tr)));
+                    ask.emplace_back(util::xBridgeStringValueFromAmount(tr->fromAmount));
+                    ask.emplace_back(tr->id.GetHex());
 
-                asks.emplace_back(ask);
+                    asks.emplace_back(ask);
+                }
             }
 
             res.emplace_back(Pair("asks", asks));
@@ -1202,107 +996,32 @@ Value dxGetOrderBook(const json_spirit::Array& params, bool fHelp)
         case 4:
         {
             //return Only the best bid and ask
-            if (!bidsList.empty()) {
-                const auto bidsItem = std::max_element(bidsList.begin(), bidsList.end(),
-                                           [](const TransactionPair &a, const TransactionPair &b)
-                {
-                    //find transaction with best bids
-                    const auto &tr1 = a.second;
-                    const auto &tr2 = b.second;
-
-                    if(tr1 == nullptr)
-                        return true;
-
-                    if(tr2 == nullptr)
-                        return false;
-
-                    const auto priceA = util::priceBid(tr1);
-                    const auto priceB = util::priceBid(tr2);
-
-                    return priceA < priceB;
-                });
-
-                const auto &tr = bidsItem->second;
-                if (tr != nullptr)
-                {
-                    const auto bidPrice = util::priceBid(tr);
-                    bids.emplace_back(util::xBridgeStringValueFromPrice(bidPrice));
-                    bids.emplace_back(util::xBridgeStringValueFromAmount(tr->toAmount));
-
-                    Array bidsIds;
-                    bidsIds.emplace_back(tr->id.GetHex());
-
-                    for(const TransactionPair &tp : bidsList)
-                    {
-                        const auto &otherTr = tp.second;
-
-                        if(otherTr == nullptr)
-                            continue;
-
-                        if(tr->id == otherTr->id)
-                            continue;
-
-                        const auto otherTrBidPrice = util::priceBid(otherTr);
-
-                        if(!floatCompare(bidPrice, otherTrBidPrice))
-                            continue;
+            if (!bidsLevels.empty())
+            {
+                const auto & level = bidsLevels.front();
+                const auto & tr    = level.orders.front();
+                bids.emplace_back(util::xBridgeStringValueFromPrice(util::priceBid(tr)));
+                bids.emplace_back(util::xBridgeStringValueFromAmount(tr->toAmount));
 
-                        bidsIds.emplace_back(otherTr->id.GetHex());
-                    }
+                Array bidsIds;
+                for (const auto & order : level.orders)
+                    bidsIds.emplace_back(order->id.GetHex());
 
-                    bids.emplace_back(bidsIds);
-                }
+                bids.emplace_back(bidsIds);
             }
 
-            if (!asksList.empty()) {
-                const auto asksItem = std::min_element(asksList.begin(), asksList.end(),
-                                                   [](const TransactionPair &a, const TransactionPair &b)
-                {
-                    //find transactions with best asks
-                    const auto &tr1 = a.second;
-                    const auto &tr2 = b.second;
-
-                    if(tr1 == nullptr)
-                        return true;
-
-                    if(tr2 == nullptr)
-                        return false;
-
-                    const auto priceA = util::price(tr1);
-                    const auto priceB = util::price(tr2);
-                    return priceA < priceB;
-                });
-
-                const auto &tr = asksItem->second;
-                if (tr != nullptr)
-                {
-                    const auto askPrice = util::price(tr);
-                    asks.emplace_back(util::xBridgeStringValueFromPrice(askPrice));
-                    asks.emplace_back(util::xBridgeStringValueFromAmount(tr->fromAmount));
-
-                    Array asksIds;
-                    asksIds.emplace_back(tr->id.GetHex());
-
-                    for(const TransactionPair &tp : asksList)
-                    {
-                        const auto &otherTr = tp.second;
-
-                        if(otherTr == nullptr)
-                            continue;
-
-                        if(tr->id == otherTr->id)
-                            continue;
-
-                        const auto otherTrAskPrice = util::price(otherTr);
-
-                        if(!floatCompare(askPrice, otherTrAskPrice))
-                            continue;
+            if (!asksLevels.empty())
+            {
+                const auto & level = asksLevels.front();
+                const auto & tr    = level.orders.front();
+                asks.emplace_back(util::xBridgeStringValueFromPrice(util::price(tr)));
+                asks.emplace_back(util::xBridgeStringValueFromAmount(tr->fromAmount));
 
-                        asksIds.emplace_back(otherTr->id.GetHex());
-                    }
+                Array asksIds;
+                for (const auto & order : level.orders)
+                    asksIds.emplace_back(order->id.GetHex());
 
-                    asks.emplace_back(asksIds);
-                }
+                asks.emplace_back(asksIds);
             }
 
             res.emplace_back(Pair("asks", asks));
@@ -1343,10 +1062,10 @@ json_spirit::Value dxGetMyOrders(const json_spirit::Array& params, bool fHelp)
     Array r;
     TransactionVector orders;
 
-    TransactionMap trList = xbridge::App::instance().transactions();
+    const auto trList = xbridge::App::instance().transactions();
 
     // Filter local orders
-    for (auto i : trList) {
+    for (const auto & i : *trList) {
         const xbridge::TransactionDescrPtr &t = i.second;
         if(!t->isLocal())
             continue;
@@ -1354,10 +1073,10 @@ json_spirit::Value dxGetMyOrders(const json_spirit::Array& params, bool fHelp)
     }
 
     // Add historical orders
-    TransactionMap history = xbridge::App::instance().history();
+    const auto history = xbridge::App::instance().history();
 
     // Filter local orders only
-    for (auto &item : history) {
+    for (const auto &item : *history) {
         const xbridge::TransactionDescrPtr &ptr = item.second;
         if (ptr->isLocal() &&
                 (ptr->state == xbridge::TransactionDescr::trFinished ||
@@ -1530,3 +1249,69 @@ Value dxGetLockedUtxos(const json_spirit::Array& params, bool fHelp)
 
     return obj;
 }
+
+//******************************************************************************
+//******************************************************************************
+Value dxGetConnectionPoolStats(const json_spirit::Array& params, bool fHelp)
+{
+    if (fHelp)
+    {
+        throw runtime_error("dxGetConnectionPoolStats\n"
+                            "Counters of the keep-alive rpc connection pool of connected wallets.\n"
+                            "reconnects - stale idle connection replaced before sending.");
+    }
+
+    if (params.size() > 0)
+    {
+        return util::makeError(xbridge::INVALID_PARAMETERS, __FUNCTION__,
+                               "This function does not accept any parameters");
+    }
+
+    Object res;
+
+    const auto &connectors = xbridge::App::instance().connectors();
+    for (const auto &connector : connectors)
+    {
+        xbridge::rpc::ConnectionPoolStats stats;
+        xbridge::rpc::connectionPoolStats(connector->m_ip, connector->m_port, stats);
+
+        Object o;
+        o.emplace_back(Pair("hits",       static_cast<uint64_t>(stats.hits)));
+        o.emplace_back(Pair("misses",     static_cast<uint64_t>(stats.misses)));
+        o.emplace_back(Pair("reconnects", static_cast<uint64_t>(stats.reconnects)));
+        o.emplace_back(Pair("evicted",    static_cast<uint64_t>(stats.evicted)));
+        o.emplace_back(Pair("idle",       static_cast<uint64_t>(stats.idle)));
+
+        res.emplace_back(connector->currency, o);
+    }
+
+    return res;
+}
+
+//******************************************************************************
+//******************************************************************************
+Value dxGetMessageFilterStats(const json_spirit::Array& params, bool fHelp)
+{
+    if (fHelp)
+    {
+        throw runtime_error("dxGetMessageFilterStats\n"
+                            "Counters of the filter of processed xbridge messages.");
+    }
+
+    if (params.size() > 0)
+    {
+        return util::makeError(xbridge::INVALID_PARAMETERS, __FUNCTION__,
+                               "This function does not accept any parameters");
+    }
+
+    const xbridge::App::MessageFilterStats stats = xbridge::App::instance().messageFilterStats();
+
+    Object res;
+    res.emplace_back(Pair("capacity", stats.capacity));
+    res.emplace_back(Pair("entries",  stats.entries));
+    res.emplace_back(Pair("inserted", stats.inserted));
+    res.emplace_back(Pair("hits",     stats.hits));
+    res.emplace_back(Pair("memory",   stats.memory));
+
+    return res;
+}
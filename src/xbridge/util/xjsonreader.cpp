@@ -0,0 +1,618 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xjsonreader.h"
+
+#include <clocale>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+//******************************************************************************
+//******************************************************************************
+namespace xbridge
+{
+
+//******************************************************************************
+//******************************************************************************
+namespace
+{
+
+// nesting limit, replies come from a wallet but are not trusted
+const size_t maxDepth = 256;
+
+//******************************************************************************
+//******************************************************************************
+class Reader
+{
+public:
+    Reader(const std::string & text, JsonHandler & handler)
+        : m_pos(text.data())
+        , m_end(text.data() + text.size())
+        , m_handler(handler)
+    {
+    }
+
+    bool read()
+    {
+        if (!value(0))
+        {
+            return false;
+        }
+        skipSpace();
+        return m_pos == m_end;
+    }
+
+private:
+    void skipSpace()
+    {
+        while (m_pos < m_end &&
+               (*m_pos == ' ' || *m_pos == '\t' || *m_pos == '\n' || *m_pos == '\r'))
+        {
+            ++m_pos;
+        }
+    }
+
+    bool literal(const char * word)
+    {
+        const size_t len = strlen(word);
+        if (static_cast<size_t>(m_end - m_pos) < len || memcmp(m_pos, word, len) != 0)
+        {
+            return false;
+        }
+        m_pos += len;
+        return true;
+    }
+
+    bool value(const size_t depth)
+    {
+        skipSpace();
+        if (m_pos >= m_end)
+        {
+            return false;
+        }
+
+        switch (*m_pos)
+        {
+        case '{':
+            return object(depth + 1);
+        case '[':
+            return array(depth + 1);
+        case '"':
+        {
+            if (!string(m_str))
+            {
+                return false;
+            }
+            m_handler.string(m_str);
+            return true;
+        }
+        case 't':
+            if (!literal("true"))
+                return false;
+            m_handler.boolean(true);
+            return true;
+        case 'f':
+            if (!literal("false"))
+                return false;
+            m_handler.boolean(false);
+            return true;
+        case 'n':
+            if (!literal("null"))
+                return false;
+            m_handler.null();
+            return true;
+        default:
+            return number();
+        }
+    }
+
+    bool object(const size_t depth)
+    {
+        if (depth > maxDepth)
+        {
+            return false;
+        }
+
+        ++m_pos;
+        m_handler.startObject();
+
+        skipSpace();
+        if (m_pos < m_end && *m_pos == '}')
+        {
+            ++m_pos;
+            m_handler.endObject();
+            return true;
+        }
+
+        while (true)
+        {
+            skipSpace();
+            if (m_pos >= m_end || *m_pos != '"' || !string(m_str))
+            {
+                return false;
+            }
+            m_handler.key(m_str);
+
+            skipSpace();
+            if (m_pos >= m_end || *m_pos != ':')
+            {
+                return false;
+            }
+            ++m_pos;
+
+            if (!value(depth))
+            {
+                return false;
+            }
+
+            skipSpace();
+            if (m_pos >= m_end)
+            {
+                return false;
+            }
+            if (*m_pos == ',')
+            {
+                ++m_pos;
+                continue;
+            }
+            if (*m_pos == '}')
+            {
+                ++m_pos;
+                m_handler.endObject();
+                return true;
+            }
+            return false;
+        }
+    }
+
+    bool array(const size_t depth)
+    {
+        if (depth > maxDepth)
+        {
+            return false;
+        }
+
+        ++m_pos;
+        m_handler.startArray();
+
+        skipSpace();
+        if (m_pos < m_end && *m_pos == ']')
+        {
+            ++m_pos;
+            m_handler.endArray();
+            return true;
+        }
+
+        while (true)
+        {
+            if (!value(depth))
+            {
+                return false;
+            }
+
+            skipSpace();
+            if (m_pos >= m_end)
+            {
+                return false;
+            }
+            if (*m_pos == ',')
+            {
+                ++m_pos;
+                continue;
+            }
+            if (*m_pos == ']')
+            {
+                ++m_pos;
+                m_handler.endArray();
+                return true;
+            }
+            return false;
+        }
+    }
+
+    static int hexDigit(const char c)
+    {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    bool hex4(uint32_t & code)
+    {
+        if (m_end - m_pos < 4)
+        {
+            return false;
+        }
+        code = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            const int d = hexDigit(*m_pos++);
+            if (d < 0)
+            {
+                return false;
+            }
+            code = (code << 4) | d;
+        }
+        return true;
+    }
+
+    static void appendUtf8(std::string & out, const uint32_t code)
+    {
+        if (code < 0x80)
+        {
+            out += static_cast<char>(code);
+        }
+        else if (code < 0x800)
+        {
+            out += static_cast<char>(0xc0 | (code >> 6));
+            out += static_cast<char>(0x80 | (code & 0x3f));
+        }
+        else if (code < 0x10000)
+        {
+            out += static_cast<char>(0xe0 | (code >> 12));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+            out += static_cast<char>(0x80 | (code & 0x3f));
+        }
+        else
+        {
+            out += static_cast<char>(0xf0 | (code >> 18));
+            out += static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+            out += static_cast<char>(0x80 | (code & 0x3f));
+        }
+    }
+
+    // string at m_pos, reuses out buffer
+    bool string(std::string & out)
+    {
+        ++m_pos;
+        out.clear();
+
+        while (m_pos < m_end)
+        {
+            // copy run without escapes at once
+            const char * begin = m_pos;
+            while (m_pos < m_end && *m_pos != '"' && *m_pos != '\\')
+            {
+                ++m_pos;
+            }
+            out.append(begin, m_pos);
+
+            if (m_pos >= m_end)
+            {
+                return false;
+            }
+            if (*m_pos == '"')
+            {
+                ++m_pos;
+                return true;
+            }
+
+            // escape
+            if (++m_pos >= m_end)
+            {
+                return false;
+            }
+            switch (*m_pos++)
+            {
+            case '"':  out += '"';  break;
+            case '\\': out += '\\'; break;
+            case '/':  out += '/';  break;
+            case 'b':  out += '\b'; break;
+            case 'f':  out += '\f'; break;
+            case 'n':  out += '\n'; break;
+            case 'r':  out += '\r'; break;
+            case 't':  out += '\t'; break;
+            case 'u':
+            {
+                uint32_t code = 0;
+                if (!hex4(code))
+                {
+                    return false;
+                }
+                // surrogate pair, an unpaired surrogate is not valid utf-8
+                if (code >= 0xdc00 && code < 0xe000)
+                {
+                    return false;
+                }
+                if (code >= 0xd800 && code < 0xdc00)
+                {
+                    if (m_end - m_pos < 6 || m_pos[0] != '\\' || m_pos[1] != 'u')
+                    {
+                        return false;
+                    }
+                    m_pos += 2;
+                    uint32_t low = 0;
+                    if (!hex4(low) || low < 0xdc00 || low >= 0xe000)
+                    {
+                        return false;
+                    }
+                    code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                }
+                appendUtf8(out, code);
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+
+        return false;
+    }
+
+    bool number()
+    {
+        const char * begin = m_pos;
+        if (m_pos < m_end && *m_pos == '-')
+        {
+            ++m_pos;
+        }
+
+        const char * digits = m_pos;
+        while (m_pos < m_end && *m_pos >= '0' && *m_pos <= '9')
+        {
+            ++m_pos;
+        }
+        if (m_pos == digits)
+        {
+            return false;
+        }
+
+        if (m_pos < m_end && *m_pos == '.')
+        {
+            const char * fraction = ++m_pos;
+            while (m_pos < m_end && *m_pos >= '0' && *m_pos <= '9')
+            {
+                ++m_pos;
+            }
+            if (m_pos == fraction)
+            {
+                return false;
+            }
+        }
+
+        if (m_pos < m_end && (*m_pos == 'e' || *m_pos == 'E'))
+        {
+            ++m_pos;
+            if (m_pos < m_end && (*m_pos == '+' || *m_pos == '-'))
+            {
+                ++m_pos;
+            }
+            const char * exponent = m_pos;
+            while (m_pos < m_end && *m_pos >= '0' && *m_pos <= '9')
+            {
+                ++m_pos;
+            }
+            if (m_pos == exponent)
+            {
+                return false;
+            }
+        }
+
+        m_handler.number(begin, m_pos);
+        return true;
+    }
+
+private:
+    const char *  m_pos;
+    const char *  m_end;
+    JsonHandler & m_handler;
+
+    // buffer of current string or key
+    std::string   m_str;
+};
+
+} // namespace
+
+//******************************************************************************
+//******************************************************************************
+bool readJson(const std::string & text, JsonHandler & handler)
+{
+    Reader r(text, handler);
+    return r.read();
+}
+
+//******************************************************************************
+//******************************************************************************
+bool parseDouble(const char * begin, const char * end, double & value)
+{
+    // strtod uses the decimal point of the C locale
+    char buf[64];
+    const size_t len = end - begin;
+    if (len == 0 || len >= sizeof(buf))
+    {
+        return false;
+    }
+    memcpy(buf, begin, len);
+    buf[len] = 0;
+
+    const char point = *localeconv()->decimal_point;
+    if (point != '.')
+    {
+        char * dot = static_cast<char *>(memchr(buf, '.', len));
+        if (dot)
+        {
+            *dot = point;
+        }
+    }
+
+    char * last = nullptr;
+    value = strtod(buf, &last);
+    return last == buf + len;
+}
+
+//******************************************************************************
+//******************************************************************************
+bool parseInt(const char * begin, const char * end, int64_t & value)
+{
+    const bool negative = begin < end && *begin == '-';
+    if (negative)
+    {
+        ++begin;
+    }
+    if (begin == end)
+    {
+        return false;
+    }
+
+    uint64_t v = 0;
+    for (; begin < end; ++begin)
+    {
+        if (*begin < '0' || *begin > '9')
+        {
+            return false;
+        }
+        const uint64_t d = *begin - '0';
+        if (v > (static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) - d) / 10)
+        {
+            return false;
+        }
+        v = v * 10 + d;
+    }
+
+    value = negative ? -static_cast<int64_t>(v) : static_cast<int64_t>(v);
+    return true;
+}
+
+//******************************************************************************
+//******************************************************************************
+JsonRpcReplyHandler::JsonRpcReplyHandler()
+    : m_depth(0)
+    , m_member(Other)
+    , m_hasResult(false)
+    , m_hasError(false)
+{
+}
+
+//******************************************************************************
+//******************************************************************************
+void JsonRpcReplyHandler::value()
+{
+    if (m_depth == 1)
+    {
+        if (m_member == Result)
+        {
+            m_hasResult = true;
+        }
+        else if (m_member == Error)
+        {
+            m_hasError = true;
+        }
+    }
+}
+
+//******************************************************************************
+//******************************************************************************
+void JsonRpcReplyHandler::startObject()
+{
+    value();
+    if (m_depth > 0 && m_member == Result)
+    {
+        resultStartObject(m_depth - 1);
+    }
+    ++m_depth;
+}
+
+//******************************************************************************
+//******************************************************************************
+void JsonRpcReplyHandler::endObject()
+{
+    --m_depth;
+    if (m_depth > 0 && m_member == Result)
+    {
+        resultEndObject(m_depth - 1);
+    }
+}
+
+//******************************************************************************
+//******************************************************************************
+void JsonRpcReplyHandler::startArray()
+{
+    value();
+    if (m_depth > 0 && m_member == Result)
+    {
+        resultStartArray(m_depth - 1);
+    }
+    ++m_depth;
+}
+
+//******************************************************************************
+//******************************************************************************
+void JsonRpcReplyHandler::endArray()
+{
+    --m_depth;
+    if (m_depth > 0 && m_member == Result)
+    {
+        resultEndArray(m_depth - 1);
+    }
+}
+
+//******************************************************************************
+//******************************************************************************
+void JsonRpcReplyHandler::key(const std::string & name)
+{
+    if (m_depth == 1)
+    {
+        m_member = name == "result" ? Result :
+                   name == "error"  ? Error  : Other;
+        return;
+    }
+
+    if (m_member == Result)
+    {
+        resultKey(m_depth - 2, name);
+    }
+    else if (m_member == Error)
+    {
+        m_errorKey = name;
+    }
+}
+
+//******************************************************************************
+//******************************************************************************
+void JsonRpcReplyHandler::string(const std::string & str)
+{
+    value();
+    if (m_member == Result)
+    {
+        resultString(m_depth - 1, str);
+    }
+    else if (m_member == Error && (m_depth == 1 || m_errorKey == "message"))
+    {
+        m_error = str;
+    }
+}
+
+//******************************************************************************
+//******************************************************************************
+void JsonRpcReplyHandler::number(const char * begin, const char * end)
+{
+    value();
+    if (m_member == Result)
+    {
+        resultNumber(m_depth - 1, begin, end);
+    }
+}
+
+//******************************************************************************
+//******************************************************************************
+void JsonRpcReplyHandler::boolean(const bool v)
+{
+    value();
+    if (m_member == Result)
+    {
+        resultBoolean(m_depth - 1, v);
+    }
+}
+
+//******************************************************************************
+//******************************************************************************
+void JsonRpcReplyHandler::null()
+{
+    // null result or error is no result or error
+}
+
+} // namespace xbridge
@@ -0,0 +1,123 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef XJSONREADER_H
+#define XJSONREADER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+//******************************************************************************
+//******************************************************************************
+namespace xbridge
+{
+
+/**
+ * @brief Receives the values of a json document in document order
+ *        (SAX style), no value tree is built.
+ */
+class JsonHandler
+{
+public:
+    virtual ~JsonHandler() {}
+
+    virtual void startObject() {}
+    virtual void endObject() {}
+    virtual void startArray() {}
+    virtual void endArray() {}
+
+    // name of the next member of an object
+    virtual void key(const std::string & /*name*/) {}
+
+    virtual void string(const std::string & /*value*/) {}
+    // number as written in the document, see parseDouble, parseInt
+    virtual void number(const char * /*begin*/, const char * /*end*/) {}
+    virtual void boolean(const bool /*value*/) {}
+    virtual void null() {}
+};
+
+/**
+ * @brief readJson - parse json text in one pass
+ * @param text - json document
+ * @param handler - receives the values
+ * @return false if text is not valid json or nested too deep
+ */
+bool readJson(const std::string & text, JsonHandler & handler);
+
+/**
+ * @brief parseDouble - number reported by JsonHandler::number,
+ * independent of the C locale
+ */
+bool parseDouble(const char * begin, const char * end, double & value);
+
+/**
+ * @brief parseInt - integer reported by JsonHandler::number
+ */
+bool parseInt(const char * begin, const char * end, int64_t & value);
+
+/**
+ * @brief Handler of a json-rpc reply, {"result": ..., "error": ..., "id": ...}.
+ *        Events of the result are forwarded to the result* methods with
+ *        depth of nesting inside the result, the result value itself
+ *        has depth 0 and keys have the depth of their object.
+ *        The error is kept as text.
+ */
+class JsonRpcReplyHandler : public JsonHandler
+{
+public:
+    JsonRpcReplyHandler();
+
+    // reply had a result which is not null
+    bool hasResult() const { return m_hasResult; }
+    // reply had an error which is not null
+    bool hasError() const  { return m_hasError; }
+    // message of the error
+    const std::string & error() const { return m_error; }
+
+protected:
+    virtual void resultStartObject(const size_t /*depth*/) {}
+    virtual void resultEndObject(const size_t /*depth*/) {}
+    virtual void resultStartArray(const size_t /*depth*/) {}
+    virtual void resultEndArray(const size_t /*depth*/) {}
+    virtual void resultKey(const size_t /*depth*/, const std::string & /*name*/) {}
+    virtual void resultString(const size_t /*depth*/, const std::string & /*value*/) {}
+    virtual void resultNumber(const size_t /*depth*/, const char * /*begin*/, const char * /*end*/) {}
+    virtual void resultBoolean(const size_t /*depth*/, const bool /*value*/) {}
+
+private:
+    void startObject();
+    void endObject();
+    void startArray();
+    void endArray();
+    void key(const std::string & name);
+    void string(const std::string & value);
+    void number(const char * begin, const char * end);
+    void boolean(const bool value);
+    void null();
+
+    // value of a reply member starts
+    void value();
+
+private:
+    enum Member
+    {
+        Other,
+        Result,
+        Error
+    };
+
+    // nesting, 1 inside the reply object
+    size_t      m_depth;
+    Member      m_member;
+    std::string m_errorKey;
+
+    bool        m_hasResult;
+    bool        m_hasError;
+    std::string m_error;
+};
+
+} // namespace xbridge
+
+#endif // XJSONREADER_H
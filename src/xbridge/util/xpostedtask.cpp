@@ -0,0 +1,59 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xpostedtask.h"
+
+//******************************************************************************
+//******************************************************************************
+namespace xbridge
+{
+
+//******************************************************************************
+//******************************************************************************
+PostedTask::PostedTask()
+    : m_inFlight(false)
+{
+}
+
+//******************************************************************************
+//******************************************************************************
+bool PostedTask::postIfDue(boost::asio::io_service & io,
+                           const boost::posix_time::ptime & due,
+                           const boost::posix_time::ptime & now,
+                           const std::function<void()> & job)
+{
+    if (due > now || m_inFlight.exchange(true))
+    {
+        return false;
+    }
+
+    io.post(std::bind(&PostedTask::run, this, job));
+    return true;
+}
+
+//******************************************************************************
+//******************************************************************************
+bool PostedTask::inFlight() const
+{
+    return m_inFlight;
+}
+
+//******************************************************************************
+//******************************************************************************
+void PostedTask::run(const std::function<void()> & job)
+{
+    try
+    {
+        job();
+    }
+    catch (...)
+    {
+        m_inFlight = false;
+        throw;
+    }
+
+    m_inFlight = false;
+}
+
+} // namespace xbridge
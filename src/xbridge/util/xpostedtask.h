@@ -0,0 +1,58 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef XPOSTEDTASK_H
+#define XPOSTEDTASK_H
+
+#include <atomic>
+#include <functional>
+
+#include <boost/asio.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+//******************************************************************************
+//******************************************************************************
+namespace xbridge
+{
+
+/**
+ * @brief Periodic job posted from the timer to a worker service, at most
+ *        one posted job is pending or running. Timer ticks while the job
+ *        waits in a busy service don't stack duplicates.
+ */
+class PostedTask
+{
+public:
+    PostedTask();
+
+    /**
+     * @brief postIfDue - post job to io if due is reached and
+     * no job posted before is pending or running
+     * @param io - worker service
+     * @param due - deadline of the task
+     * @param now - current time
+     * @param job - work, the task is free again when it returns or throws
+     * @return true, if job posted
+     */
+    bool postIfDue(boost::asio::io_service & io,
+                   const boost::posix_time::ptime & due,
+                   const boost::posix_time::ptime & now,
+                   const std::function<void()> & job);
+
+    /**
+     * @brief inFlight
+     * @return true, if posted job is pending or running
+     */
+    bool inFlight() const;
+
+private:
+    void run(const std::function<void()> & job);
+
+private:
+    std::atomic<bool> m_inFlight;
+};
+
+} // namespace xbridge
+
+#endif // XPOSTEDTASK_H
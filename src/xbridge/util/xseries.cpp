@@ -8,7 +8,9 @@
 #include "xseries.h"
 #include "xbridge/xbridgetransactiondescr.h"
 #include "xbridge/xbridgeapp.h"
+#include "main.h"
 #include "sync.h"
+#include "util.h"
 
 extern CurrencyPair TxOutToCurrencyPair(const CTxOut & txout, std::string& snode_pubkey);
 
@@ -94,6 +96,9 @@ namespace {
             return from_time_t(0);
         return from_time_t(((end_secs + psec - 1) / psec) * psec);
     }
+    // bound of buckets kept by the chain trades cache
+    const size_t maxCachedBuckets = 1 << 20;
+
     ptime get_end_time(ptime end_time, time_duration cache_granularity) {
         auto epoch_duration = end_time - from_time_t(0);
         return get_end_time(epoch_duration.total_seconds(), cache_granularity);
@@ -122,6 +127,19 @@ xSeriesCache::getChainXAggregateSeries(const xQuery& query)
         series[i].timeEnd = t;
     }
 
+    {
+        LOCK(m_xSeriesCacheUpdateLock);
+        if (m_tradeIndex) {
+            updateXSeriesFromIndex(series, q.fromCurrency, q.toCurrency,
+                                   q, xQuery::Transform::None);
+            if (q.with_inverse == xQuery::WithInverse::Included) {
+                updateXSeriesFromIndex(series, q.toCurrency, q.fromCurrency,
+                                       q, xQuery::Transform::Invert);
+            }
+            return series;
+        }
+    }
+
     if (not m_cache_period.contains(q.period))
         updateSeriesCache(q.period);
 
@@ -136,98 +154,153 @@ xSeriesCache::getChainXAggregateSeries(const xQuery& query)
 
 //******************************************************************************
 //******************************************************************************
-xSeriesCache::xAggregateContainer&
-xSeriesCache::getXAggregateContainer(const pairSymbol& key)
+bool xSeriesCache::openTradeIndex()
 {
-    auto f = mSparseSeries.find(key);
-    if (f == mSparseSeries.end()) {
-        mSparseSeries[key] = {};
-        f = mSparseSeries.find(key);
+    if (not GetBoolArg("-xbridgetradeindex", true))
+        return false;
+
+    {
+        LOCK(m_xSeriesCacheUpdateLock);
+        if (m_tradeIndex)
+            return true;
     }
-    return f->second;
+
+    std::unique_ptr<xTradeIndex> index;
+    try {
+        index.reset(new xTradeIndex{static_cast<size_t>(8) << 20});
+
+        // catch up without cs_main, then the blocks connected meanwhile
+        // are added and the index registered under cs_main, so no block
+        // is connected between sync and registration
+        if (not index->sync())
+            return false;
+        LOCK(cs_main);
+        if (not index->sync())
+            return false;
+        index->setChangedHandler(std::bind(&xSeriesCache::onTradesChanged, this,
+                                           std::placeholders::_1, std::placeholders::_2));
+        RegisterValidationInterface(index.get());
+    } catch (const std::exception& e) {
+        ERR() << "trade index not opened " << e.what() << " " << __FUNCTION__;
+        return false;
+    }
+
+    LOCK2(m_xSeriesCacheUpdateLock, m_bucketsLock);
+    m_buckets.clear();
+    m_bucketsCount = 0;
+    m_tradeIndex = std::move(index);
+    return true;
 }
 
 //******************************************************************************
 //******************************************************************************
-void xSeriesCache::updateSeriesCache(const time_period& period)
+void xSeriesCache::closeTradeIndex()
 {
-    // TODO(amdn) cached aggregate series for blocks that are purged from the chain
-    // need to be invalidated... this code invalidates on every query to
-    // ensure results are up-to-date, cache can be enabled when invalidation
-    // hook is in place
-    LOCK(m_xSeriesCacheUpdateLock);
-    std::vector<CurrencyPair> pairs = get_tradingdata(period);
-    std::sort(pairs.begin(), pairs.end(), // ascending by updated time
-              [](const CurrencyPair& a, const CurrencyPair& b) {
-                  return a.timeStamp < b.timeStamp; });
-
-    mSparseSeries.clear();
-    for (const auto& p : pairs) {
-        pairSymbol key = p.to.currency().to_string() +"/"+ p.from.currency().to_string();
-        auto& q = getXAggregateContainer(key);
-        if (q.empty() || q.back().timeEnd <= p.timeStamp) {
-            q.emplace_back(xAggregate{p.from.currency(), p.to.currency()});
-            q.back().timeEnd = get_end_time(p.timeStamp,m_cache_granularity);
-        }
-        q.back().update(p,xQuery::WithTxids::Included);
+    std::unique_ptr<xTradeIndex> index;
+    {
+        LOCK(m_xSeriesCacheUpdateLock);
+        index = std::move(m_tradeIndex);
     }
-    m_cache_period = period;
+    if (not index)
+        return;
+
+    LOCK(cs_main);
+    UnregisterValidationInterface(index.get());
 }
 
 //******************************************************************************
 //******************************************************************************
-xAggregate xAggregate::inverse() const {
-    xAggregate x{*this};
-    x.open = inverse(open);
-    x.high  = inverse(high);
-    x.low   = inverse(low);
-    x.close = inverse(close);
-    x.toVolume = fromVolume;
-    x.fromVolume = toVolume;
-    return x;
-}
+void xSeriesCache::updateXSeriesFromIndex(std::vector<xAggregate>& series,
+                                          const ccy::Currency& from,
+                                          const ccy::Currency& to,
+                                          const xQuery& q,
+                                          xQuery::Transform tf)
+{
+    if (series.empty())
+        return;
 
-void xAggregate::update(const CurrencyPair& x, xQuery::WithTxids with_txids) {
-    price_t price{x.price<price_t>()};
-    if (open == 0) {
-        open = high = low = price;
-    }
-    high = std::max(high,price);
-    low  = std::min(low,price);
-    close = price;
-    fromVolume += x.from;
-    toVolume += x.to;
-    if (with_txids == xQuery::WithTxids::Included)
-        orderIds.push_back(x.xid());
-}
+    const pairSymbol key = to.to_string() +"/"+ from.to_string();
+    const int64_t g = q.granularity.total_seconds();
+    const int64_t first = (q.period.begin() - from_time_t(0)).total_seconds() + g;
+    const int64_t last = first + static_cast<int64_t>(series.size() - 1) * g;
 
-void xAggregate::update(const xAggregate& x, xQuery::WithTxids with_txids) {
-    if (open == 0) {
-        open = high = low = x.open;
-    }
-    high = std::max(high,x.high);
-    low  = std::min(low,x.low);
-    close = x.close;
-    fromVolume += x.fromVolume;
-    toVolume += x.toVolume;
-    if (with_txids == xQuery::WithTxids::Included) {
-        for (const auto& it : x.orderIds)
-            orderIds.push_back(it);
+    while (true) {
+        // range of buckets not in cache
+        int64_t missFirst = 0, missLast = 0;
+        uint64_t generation = 0;
+        {
+            LOCK(m_bucketsLock);
+            if (m_bucketsCount > maxCachedBuckets) {
+                m_buckets.clear();
+                m_bucketsCount = 0;
+                ++m_bucketsGeneration;
+            }
+            const auto f = m_buckets.find(std::make_pair(key, g));
+            for (int64_t t = first; t <= last; t += g) {
+                if (f != m_buckets.end() && f->second.count(t))
+                    continue;
+                if (missFirst == 0)
+                    missFirst = t;
+                missLast = t;
+            }
+            generation = m_bucketsGeneration;
+        }
+
+        // read without m_bucketsLock, block connection invalidates buckets under cs_main
+        xBuckets read;
+        if (missFirst != 0) {
+            // buckets are (end - granularity, end]
+            const auto pairs = m_tradeIndex->trades(key,
+                                                    time_period{from_time_t(missFirst - g + 1),
+                                                                from_time_t(missLast + 1)});
+            for (int64_t t = missFirst; t <= missLast; t += g)
+                read.emplace(t, xBucket{from, to});
+            for (const auto& p : pairs) {
+                const int64_t ts = (p.timeStamp - from_time_t(0)).total_seconds();
+                xBucket& b = read.at(((ts + g - 1) / g) * g);
+                b.aggregate.update(p, xQuery::WithTxids::Included);
+                b.used = true;
+            }
+        }
+
+        LOCK(m_bucketsLock);
+        if (generation != m_bucketsGeneration)
+            continue; // a block was connected during the read, buckets may be stale
+        xBuckets& buckets = m_buckets[std::make_pair(key, g)];
+        for (const auto& b : read) {
+            if (buckets.insert(b).second)
+                ++m_bucketsCount;
+        }
+
+        for (int64_t t = first; t <= last; t += g) {
+            auto it = read.find(t);
+            if (it == read.end())
+                it = buckets.find(t);
+            const size_t idx = (t - first) / g;
+            if (it->second.used)
+                series[idx].update(tf == xQuery::Transform::Invert ? it->second.aggregate.inverse()
+                                                                   : it->second.aggregate,
+                                   q.with_txids);
+        }
+        return;
     }
 }
 
 //******************************************************************************
 //******************************************************************************
-void xSeriesCache::updateXSeries(std::vector<xAggregate>& series,
-                                 const ccy::Currency& from,
-                                 const ccy::Currency& to,
-                                 const xQuery& q,
-                                 xQuery::Transform tf)
+void xSeriesCache::onTradesChanged(const std::set<std::string>& pairs, int64_t blockTime)
 {
-    pairSymbol key = to.to_string() +"/"+ from.to_string();
-    auto& xac = getXAggregateContainer(key);
-    const auto& range = getXAggregateRange(xac.begin(), xac.end(), q.period);
-    updateXSeriesHelper(series, range, q, tf);
+    LOCK(m_bucketsLock);
+    ++m_bucketsGeneration;
+    for (const auto& pair : pairs) {
+        for (const int64_t g : xQuery::supported_seconds()) {
+            auto f = m_buckets.find(std::make_pair(pair, g));
+            if (f == m_buckets.end())
+                continue;
+            if (f->second.erase(((blockTime + g - 1) / g) * g))
+                --m_bucketsCount;
+        }
+    }
 }
 
 //******************************************************************************
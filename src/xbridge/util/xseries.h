@@ -9,6 +9,7 @@
 #include "currencypair.h"
 #include "xutil.h"
 #include "xbridge/xbridgetransactiondescr.h"
+#include "xbridge/util/xtradeindex.h"
 #include "sync.h"
 
 #include <boost/date_time/posix_time/posix_time.hpp>
@@ -18,6 +19,9 @@
 #include <cstdint>
 #include <deque>
 #include <limits>
+#include <map>
+#include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -116,10 +120,10 @@ public:
         }
         return str;
     }
-private:
     static inline constexpr std::array<int,6> supported_seconds() {
         return {{ 1*60, 5*60, 15*60, 1*60*60, 6*60*60, 24*60*60 }};
     }
+private:
     static inline time_duration validate_granularity(int val) {
         constexpr auto s = supported_seconds();
         const auto f = std::find(s.begin(), s.end(), val);
@@ -227,7 +231,27 @@ public:
 
     void updateSeriesCache(const time_period&);
 
+    /**
+     * @brief openTradeIndex - open and sync the blockchain trade index,
+     * queries read blocks from disk while it is closed (-xbridgetradeindex=0)
+     * @return true if index is open
+     */
+    bool openTradeIndex();
+    void closeTradeIndex();
+
 private:
+    /**
+     * @brief onTradesChanged - invalidate cached buckets of pairs that contain
+     * the time of a connected or disconnected block
+     */
+    void onTradesChanged(const std::set<std::string>& pairs, int64_t blockTime);
+
+    void updateXSeriesFromIndex(std::vector<xAggregate>& series,
+                                const ccy::Currency& from,
+                                const ccy::Currency& to,
+                                const xQuery& q,
+                                xQuery::Transform tf);
+
     void updateXSeries(std::vector<xAggregate>& series,
                        const ccy::Currency& from,
                        const ccy::Currency& to,
@@ -246,5 +270,25 @@ private:
                  time_duration{boost::posix_time::seconds{Params().TargetSpacing()}})};
     time_period m_cache_period{ptime{},ptime{}};
     std::unordered_map<pairSymbol, xAggregateContainer> mSparseSeries;
+    std::unique_ptr<xTradeIndex> m_tradeIndex;
+
+    /**
+     * Buckets of index trades kept across queries, by pair and granularity
+     * and keyed by bucket end time (seconds). Every bucket of a queried range
+     * is kept, also empty ones, so a present bucket is up to date until a
+     * block with a time inside it is connected or disconnected.
+     */
+    struct xBucket {
+        bool used{false};
+        xAggregate aggregate;
+        xBucket(const ccy::Currency& from, const ccy::Currency& to) : aggregate{from, to} {}
+    };
+    using xBuckets = std::map<int64_t, xBucket>;
+    CCriticalSection m_bucketsLock;
+    std::map<std::pair<pairSymbol, int64_t>, xBuckets> m_buckets;
+    size_t m_bucketsCount{0};
+    // incremented by every invalidation, buckets read from the index
+    // while it changed are not kept
+    uint64_t m_bucketsGeneration{0};
 };
 #endif // XSERIES_H
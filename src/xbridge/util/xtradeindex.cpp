@@ -0,0 +1,280 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xtradeindex.h"
+#include "xseries.h"
+#include "logger.h"
+
+#include "main.h"
+#include "serialize.h"
+#include "util.h"
+
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread.hpp>
+
+extern CurrencyPair TxOutToCurrencyPair(const CTxOut & txout, std::string& snode_pubkey);
+
+//******************************************************************************
+//******************************************************************************
+namespace {
+    const char DB_TRADE = 't';
+    const char DB_BEST_BLOCK = 'B';
+
+    // blocks read per cs_main lock while syncing
+    const size_t syncBatchSize = 1000;
+
+    /**
+     * @brief key of a trade, time is stored big endian so that
+     * trades of a pair iterate in time order
+     */
+    struct TradeKey {
+        std::string pair;
+        uint64_t time{0};
+        std::string xid;
+
+        TradeKey() = default;
+        TradeKey(const std::string& pair, uint64_t time, const std::string& xid)
+            : pair(pair), time(time), xid(xid) {}
+
+        ADD_SERIALIZE_METHODS;
+
+        template <typename Stream, typename Operation>
+        inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion) {
+            READWRITE(pair);
+            unsigned char be[8];
+            if (!ser_action.ForRead()) {
+                for (size_t i = 0; i < sizeof(be); ++i)
+                    be[i] = static_cast<unsigned char>(time >> (56 - 8 * i));
+            }
+            READWRITE(FLATDATA(be));
+            if (ser_action.ForRead()) {
+                time = 0;
+                for (size_t i = 0; i < sizeof(be); ++i)
+                    time = (time << 8) | be[i];
+            }
+            READWRITE(xid);
+        }
+    };
+
+    struct TradeRecord {
+        std::string fromSymbol;
+        uint64_t fromBasis{0};
+        uint64_t fromAmount{0};
+        std::string toSymbol;
+        uint64_t toBasis{0};
+        uint64_t toAmount{0};
+
+        TradeRecord() = default;
+        explicit TradeRecord(const CurrencyPair& p)
+            : fromSymbol(p.from.currency().to_string())
+            , fromBasis(p.from.currency().basis())
+            , fromAmount(p.from.accumulator())
+            , toSymbol(p.to.currency().to_string())
+            , toBasis(p.to.currency().basis())
+            , toAmount(p.to.accumulator()) {}
+
+        ADD_SERIALIZE_METHODS;
+
+        template <typename Stream, typename Operation>
+        inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion) {
+            READWRITE(fromSymbol);
+            READWRITE(fromBasis);
+            READWRITE(fromAmount);
+            READWRITE(toSymbol);
+            READWRITE(toBasis);
+            READWRITE(toAmount);
+        }
+    };
+
+    uint64_t to_seconds(const ptime& t) {
+        return (t - from_time_t(0)).total_seconds();
+    }
+}
+
+//******************************************************************************
+//******************************************************************************
+xTradeIndex::xTradeIndex(size_t nCacheSize, bool fMemory, bool fWipe)
+    : m_db(GetDataDir() / "tradeindex", nCacheSize, fMemory, fWipe)
+{
+}
+
+//******************************************************************************
+//******************************************************************************
+// static
+std::string xTradeIndex::pairKey(const CurrencyPair & p)
+{
+    return p.to.currency().to_string() + "/" + p.from.currency().to_string();
+}
+
+//******************************************************************************
+//******************************************************************************
+bool xTradeIndex::writeBlock(const CBlock & block, const CBlockIndex * pindex, const bool connect)
+{
+    CLevelDBBatch batch;
+    std::set<std::string> pairs;
+    const uint64_t time = pindex->GetBlockTime();
+    for (const CTransaction & tx : block.vtx)
+    {
+        for (const CTxOut & out : tx.vout)
+        {
+            std::string snode_pubkey{};
+            CurrencyPair p = TxOutToCurrencyPair(out, snode_pubkey);
+            if (p.tag != CurrencyPair::Tag::Valid)
+                continue;
+
+            TradeKey key{pairKey(p), time, p.xid()};
+            pairs.insert(key.pair);
+            if (connect)
+                batch.Write(std::make_pair(DB_TRADE, key), TradeRecord{p});
+            else
+                batch.Erase(std::make_pair(DB_TRADE, key));
+        }
+    }
+
+    const CBlockIndex * pbest = connect ? pindex : pindex->pprev;
+    batch.Write(DB_BEST_BLOCK, pbest ? pbest->GetBlockHash() : uint256());
+
+    try
+    {
+        m_db.WriteBatch(batch);
+    }
+    catch (const leveldb_error & e)
+    {
+        ERR() << "trade index write failed " << e.what() << " " << __FUNCTION__;
+        return false;
+    }
+
+    if (m_changed && !pairs.empty())
+        m_changed(pairs, time);
+    return true;
+}
+
+//******************************************************************************
+//******************************************************************************
+void xTradeIndex::BlockConnected(const CBlock & block, const CBlockIndex * pindex)
+{
+    writeBlock(block, pindex, true);
+}
+
+//******************************************************************************
+//******************************************************************************
+void xTradeIndex::BlockDisconnected(const CBlock & block, const CBlockIndex * pindex)
+{
+    writeBlock(block, pindex, false);
+}
+
+//******************************************************************************
+//******************************************************************************
+bool xTradeIndex::sync()
+{
+    const CBlockIndex * pbest = nullptr;
+    uint256 hashBest;
+    if (m_db.Read(DB_BEST_BLOCK, hashBest))
+    {
+        LOCK(cs_main);
+        BlockMap::iterator mi = mapBlockIndex.find(hashBest);
+        if (mi != mapBlockIndex.end())
+            pbest = mi->second;
+    }
+
+    // trades older than earliest query time are never requested
+    const int64_t earliest = to_seconds(xQuery::earliestTime());
+
+    while (true)
+    {
+        boost::this_thread::interruption_point();
+
+        // blocks of the next batch are collected under cs_main,
+        // read and written without it, so the node keeps running
+        // while the index catches up
+        std::vector<std::pair<const CBlockIndex *, bool> > steps;
+        {
+            LOCK(cs_main);
+
+            // rewind blocks disconnected while the index was closed
+            const CBlockIndex * pindex = pbest;
+            for (; pindex && !chainActive.Contains(pindex) && steps.size() < syncBatchSize; pindex = pindex->pprev)
+                steps.emplace_back(pindex, false);
+
+            if (steps.empty())
+            {
+                pindex = pbest ? chainActive.Next(pbest) : chainActive.Genesis();
+                for (; pindex && steps.size() < syncBatchSize; pindex = chainActive.Next(pindex))
+                {
+                    if (pindex->GetBlockTime() < earliest && chainActive.Next(pindex))
+                        continue;
+                    steps.emplace_back(pindex, true);
+                }
+            }
+
+            if (steps.empty())
+            {
+                LOG() << "trade index synced at height " << chainActive.Height();
+                return true;
+            }
+        }
+
+        for (const auto & step : steps)
+        {
+            CBlock block;
+            if (!ReadBlockFromDisk(block, step.first) || !writeBlock(block, step.first, step.second))
+            {
+                ERR() << "trade index sync failed at " << step.first->GetBlockHash().ToString() << " " << __FUNCTION__;
+                return false;
+            }
+            pbest = step.second ? step.first : step.first->pprev;
+        }
+    }
+}
+
+//******************************************************************************
+//******************************************************************************
+std::vector<CurrencyPair> xTradeIndex::trades(const std::string & pair,
+                                              const boost::posix_time::time_period & period)
+{
+    std::vector<CurrencyPair> records;
+
+    const uint64_t end = to_seconds(period.end());
+
+    boost::scoped_ptr<leveldb::Iterator> pcursor(m_db.NewIterator());
+
+    CDataStream ssKeySet(SER_DISK, CLIENT_VERSION);
+    ssKeySet << std::make_pair(DB_TRADE, TradeKey{pair, to_seconds(period.begin()), std::string()});
+    pcursor->Seek(ssKeySet.str());
+
+    for (; pcursor->Valid(); pcursor->Next())
+    {
+        try
+        {
+            leveldb::Slice slKey = pcursor->key();
+            CDataStream ssKey(slKey.data(), slKey.data() + slKey.size(), SER_DISK, CLIENT_VERSION);
+            char chType;
+            ssKey >> chType;
+            if (chType != DB_TRADE)
+                break;
+
+            TradeKey key;
+            ssKey >> key;
+            if (key.pair != pair || key.time >= end)
+                break;
+
+            leveldb::Slice slValue = pcursor->value();
+            CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
+            TradeRecord r;
+            ssValue >> r;
+
+            records.emplace_back(key.xid,
+                                 ccy::Asset{ccy::Currency{r.fromSymbol, r.fromBasis}, r.fromAmount},
+                                 ccy::Asset{ccy::Currency{r.toSymbol, r.toBasis}, r.toAmount},
+                                 from_time_t(key.time));
+        }
+        catch (const std::exception & e)
+        {
+            ERR() << "trade index read failed " << e.what() << " " << __FUNCTION__;
+            break;
+        }
+    }
+
+    return records;
+}
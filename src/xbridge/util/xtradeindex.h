@@ -0,0 +1,80 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef XTRADEINDEX_H
+#define XTRADEINDEX_H
+
+#include "currencypair.h"
+#include "leveldbwrapper.h"
+#include "validationinterface.h"
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+class CBlock;
+class CBlockIndex;
+
+/**
+ * @brief Persistent index (tradeindex/) of xbridge trades recorded in the blockchain,
+ *        keyed by (pair, block time, order id). It follows the active chain
+ *        through the validation interface, so queries never read block files
+ *        or take cs_main.
+ */
+class xTradeIndex : public CValidationInterface
+{
+public:
+    xTradeIndex(size_t nCacheSize, bool fMemory = false, bool fWipe = false);
+
+private:
+    xTradeIndex(const xTradeIndex&);
+    void operator=(const xTradeIndex&);
+
+public:
+    /**
+     * @brief sync - bring the index to the active chain tip, rewinds blocks
+     * that left the chain and adds blocks connected while the index was closed;
+     * takes cs_main only per batch of blocks, call again under cs_main
+     * to stay at the tip
+     * @return true if index is at the tip
+     */
+    bool sync();
+
+    /**
+     * @brief trades - trades of pair with block time in period
+     * @param pair - "TO/FROM" currency symbols
+     * @param period - time period
+     * @return list of trades ascending by block time
+     */
+    std::vector<CurrencyPair> trades(const std::string & pair,
+                                     const boost::posix_time::time_period & period);
+
+    static std::string pairKey(const CurrencyPair & p);
+
+    /**
+     * @brief setChangedHandler - handler is called (under cs_main) after the
+     * trades of a connected or disconnected block are written,
+     * with the pairs of the block and the block time
+     */
+    typedef std::function<void (const std::set<std::string> & pairs,
+                                const int64_t blockTime)> ChangedHandler;
+    void setChangedHandler(const ChangedHandler & handler) { m_changed = handler; }
+
+protected:
+    void BlockConnected(const CBlock & block, const CBlockIndex * pindex);
+    void BlockDisconnected(const CBlock & block, const CBlockIndex * pindex);
+
+private:
+    bool writeBlock(const CBlock & block, const CBlockIndex * pindex, const bool connect);
+
+private:
+    CLevelDBWrapper m_db;
+    ChangedHandler  m_changed;
+};
+
+#endif // XTRADEINDEX_H
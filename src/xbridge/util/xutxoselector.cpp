@@ -0,0 +1,210 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "xutxoselector.h"
+
+#include <algorithm>
+#include <limits>
+
+//******************************************************************************
+//******************************************************************************
+namespace xbridge
+{
+
+//******************************************************************************
+//******************************************************************************
+struct UtxoSelector::Search
+{
+    uint64_t              required{0};
+    // coins smaller than required, descending by amount, with original index
+    std::vector<std::pair<uint64_t, size_t> > coins;
+    // suffix[i] - sum of coins[i..]
+    std::vector<uint64_t> suffix;
+
+    std::vector<size_t>   current;
+    std::vector<size_t>   best;
+    uint64_t              bestSum{0};
+    size_t                bestCount{std::numeric_limits<size_t>::max()};
+    uint64_t              bestExcess{std::numeric_limits<uint64_t>::max()};
+    size_t                tries{0};
+};
+
+//******************************************************************************
+//******************************************************************************
+UtxoSelector::UtxoSelector(const std::vector<uint64_t> & fees, const uint64_t fee2,
+                           const uint64_t minChange, const size_t maxTries)
+    : m_fees(fees)
+    , m_fee2(fee2)
+    , m_minChange(minChange)
+    , m_maxTries(maxTries)
+{
+}
+
+//******************************************************************************
+//******************************************************************************
+uint64_t UtxoSelector::need(const uint64_t required, const size_t inputs) const
+{
+    return required + m_fee2 + m_fees[inputs];
+}
+
+//******************************************************************************
+//******************************************************************************
+bool UtxoSelector::usable(const uint64_t sum, const uint64_t required, const size_t inputs) const
+{
+    const uint64_t n = need(required, inputs);
+    return sum == n || (sum > n && sum - n >= m_minChange);
+}
+
+//******************************************************************************
+//******************************************************************************
+void UtxoSelector::branch(Search & s, const size_t pos, const size_t count, const uint64_t sum) const
+{
+    if (++s.tries > m_maxTries)
+    {
+        return;
+    }
+
+    if (count > 0 && sum >= need(s.required, count))
+    {
+        if (usable(sum, s.required, count))
+        {
+            const uint64_t excess = sum - need(s.required, count);
+            if (count < s.bestCount || (count == s.bestCount && excess < s.bestExcess))
+            {
+                s.best       = s.current;
+                s.bestSum    = sum;
+                s.bestCount  = count;
+                s.bestExcess = excess;
+            }
+
+            // more inputs only raise the fee
+            return;
+        }
+
+        // change is dust, another input may make it usable
+    }
+
+    // one more input can't beat the best, or best is exact already
+    if (count + 1 > s.bestCount || (count + 1 == s.bestCount && s.bestExcess == 0))
+    {
+        return;
+    }
+
+    if (pos >= s.coins.size() || count + 1 >= m_fees.size())
+    {
+        return;
+    }
+
+    // remaining coins can't cover even one more input
+    if (sum + s.suffix[pos] < need(s.required, count + 1))
+    {
+        return;
+    }
+
+    // include the largest remaining coin first, finds few inputs early
+    s.current.push_back(s.coins[pos].second);
+    branch(s, pos + 1, count + 1, sum + s.coins[pos].first);
+    s.current.pop_back();
+
+    // exclude it, skipping equal amounts that would repeat the same selections
+    size_t next = pos + 1;
+    while (next < s.coins.size() && s.coins[next].first == s.coins[pos].first)
+    {
+        ++next;
+    }
+    branch(s, next, count, sum);
+}
+
+//******************************************************************************
+//******************************************************************************
+bool UtxoSelector::select(const std::vector<uint64_t> & amounts, const uint64_t required,
+                          std::vector<size_t> & selected, uint64_t & total, uint64_t & fee1) const
+{
+    selected.clear();
+    total = 0;
+    fee1  = 0;
+
+    if (amounts.empty() || m_fees.size() < 2)
+    {
+        return false;
+    }
+
+    // one coin covering the order, the smallest one
+    bool     haveSingle   = false;
+    size_t   single       = 0;
+    for (size_t i = 0; i < amounts.size(); ++i)
+    {
+        if (!usable(amounts[i], required, 1))
+        {
+            continue;
+        }
+
+        if (!haveSingle || amounts[i] < amounts[single] ||
+            // exact match is preferred, no change output needed
+            (amounts[i] == need(required, 1) && amounts[single] != need(required, 1)))
+        {
+            haveSingle = true;
+            single     = i;
+        }
+    }
+
+    if (haveSingle && amounts[single] == need(required, 1))
+    {
+        selected.push_back(single);
+        total = amounts[single];
+        fee1  = m_fees[1];
+        return true;
+    }
+
+    // combination of coins smaller than required
+    Search s;
+    s.required = required;
+    for (size_t i = 0; i < amounts.size(); ++i)
+    {
+        if (amounts[i] > 0 && amounts[i] < required)
+        {
+            s.coins.emplace_back(amounts[i], i);
+        }
+    }
+    std::sort(s.coins.begin(), s.coins.end(),
+              [](const std::pair<uint64_t, size_t> & a, const std::pair<uint64_t, size_t> & b)
+    {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    });
+
+    s.suffix.resize(s.coins.size() + 1, 0);
+    for (size_t i = s.coins.size(); i > 0; --i)
+    {
+        s.suffix[i - 1] = s.suffix[i] + s.coins[i - 1].first;
+    }
+
+    if (!s.coins.empty())
+    {
+        s.current.reserve(s.coins.size());
+        branch(s, 0, 0, 0);
+    }
+
+    const bool haveCombination = !s.best.empty();
+    if (!haveSingle && !haveCombination)
+    {
+        return false;
+    }
+
+    // if one larger coin is over twice the smaller coins - use smaller coins
+    const uint64_t times = 2;
+    if (haveCombination && (!haveSingle || amounts[single] > s.bestSum * times))
+    {
+        selected = s.best;
+        total    = s.bestSum;
+        fee1     = m_fees[s.bestCount];
+        return true;
+    }
+
+    selected.push_back(single);
+    total = amounts[single];
+    fee1  = m_fees[1];
+    return true;
+}
+
+} // namespace xbridge
@@ -0,0 +1,73 @@
+// Copyright (c) 2018 The Blocknet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef XUTXOSELECTOR_H
+#define XUTXOSELECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//******************************************************************************
+//******************************************************************************
+namespace xbridge
+{
+
+/**
+ * @brief Deterministic selection of coins funding an order. Amounts and fees
+ *        are integers in the units of the caller (TransactionDescr::COIN).
+ *
+ *        Funding n inputs needs required + fee2 + fees[n]. A selection is
+ *        usable if it covers that exactly or leaves a change of at least
+ *        minChange (smaller change would be dust).
+ *
+ *        Coins smaller than the required amount are combined by a depth first
+ *        branch and bound over the coins sorted descending, looking for the
+ *        fewest inputs and then the smallest excess. The work is bounded by
+ *        maxTries visited nodes, the best selection found so far is kept.
+ *        The result is compared with the smallest single coin covering the
+ *        order, the single coin wins unless it is over twice the combination.
+ */
+class UtxoSelector
+{
+public:
+    /**
+     * @param fees - fee of the funding tx by input count, fees[n] for n inputs,
+     *               not decreasing, size limits the input count
+     * @param fee2 - fee of the payment tx
+     * @param minChange - smallest change that is not dust
+     * @param maxTries - bound of branch and bound nodes
+     */
+    UtxoSelector(const std::vector<uint64_t> & fees, const uint64_t fee2,
+                 const uint64_t minChange, const size_t maxTries = 100000);
+
+    /**
+     * @brief select - select coins
+     * @param amounts - amounts of available coins
+     * @param required - required amount without fees
+     * @param selected - indices of selected coins in amounts
+     * @param total - amount of selected coins
+     * @param fee1 - fee of the funding tx with the selected coins
+     * @return true if a usable selection is found
+     */
+    bool select(const std::vector<uint64_t> & amounts, const uint64_t required,
+                std::vector<size_t> & selected, uint64_t & total, uint64_t & fee1) const;
+
+private:
+    struct Search;
+
+    uint64_t need(const uint64_t required, const size_t inputs) const;
+    bool usable(const uint64_t sum, const uint64_t required, const size_t inputs) const;
+    void branch(Search & s, const size_t pos, const size_t count, const uint64_t sum) const;
+
+private:
+    const std::vector<uint64_t>   m_fees;
+    const uint64_t                m_fee2;
+    const uint64_t                m_minChange;
+    const size_t                  m_maxTries;
+};
+
+} // namespace xbridge
+
+#endif // XUTXOSELECTOR_H
@@ -9,6 +9,8 @@
 #include "util/xbridgeerror.h"
 #include "util/xassert.h"
 #include "util/xseries.h"
+#include "util/xutxoselector.h"
+#include "util/xpostedtask.h"
 #include "version.h"
 #include "config.h"
 #include "xuiconnector.h"
@@ -26,9 +28,11 @@
 #include "xbridgewalletconnectorbch.h"
 #include "xbridgewalletconnectordgb.h"
 #include "sync.h"
+#include "bloom.h"
 
 #include <algorithm>
 #include <assert.h>
+#include <limits>
 #include <numeric>
 #include <random>
 #include <string.h>
@@ -75,7 +79,39 @@ class App::Impl
 
     enum
     {
-        TIMER_INTERVAL = 15
+        TIMER_INTERVAL = 15,
+        // rebroadcast of pending orders
+        BROADCAST_INTERVAL = 5 * 60,
+        // timer never sleeps shorter, in milliseconds
+        TIMER_MIN_DELAY = 100
+    };
+
+    enum
+    {
+        // replay of unprocessed packet, delay doubles with each attempt
+        PACKET_RETRY_MIN_DELAY = 1,
+        PACKET_RETRY_MAX_DELAY = 30
+    };
+
+    /**
+     * @brief The PendingPacket struct - packet waiting for replay
+     */
+    struct PendingPacket
+    {
+        // empty after replay, until processed again or forgotten
+        XBridgePacketPtr         packet;
+        boost::posix_time::ptime due;
+        uint32_t                 attempts{0};
+    };
+
+    enum
+    {
+        // packets waiting in the ingress queue, for all peers and for one peer
+        INGRESS_MAX_PACKETS          = 4096,
+        INGRESS_MAX_PACKETS_PER_PEER = 512,
+        INGRESS_THREADS              = 2,
+        // misbehavior score of each packet over the limit of one peer
+        INGRESS_OVER_LIMIT_DOS       = 1
     };
 
 protected:
@@ -108,9 +144,21 @@ protected:
     /**
      * @brief onTimer call check expired transactions,
      * send transactions list, erase expired transactions,
-     * get addressbook,
+     * get addressbook, replay pending packets, each when due
+     * @param error - operation_aborted if timer rescheduled or stopped
+     */
+    void onTimer(const boost::system::error_code & error);
+    /**
+     * @brief scheduleTimer - wait for the nearest deadline, call on timer thread
+     * @param now - current time
      */
-    void onTimer();
+    void scheduleTimer(const boost::posix_time::ptime & now);
+    /**
+     * @brief wakeTimer - wake timer earlier if due is before
+     * its current deadline, call on timer thread
+     * @param due - new deadline
+     */
+    void wakeTimer(const boost::posix_time::ptime & due);
 
     /**
      * @brief getSession - move session to head of queue
@@ -124,6 +172,36 @@ protected:
      */
     SessionPtr getSession(const std::vector<unsigned char> & address);
 
+    /**
+     * @brief snapshot - returns published snapshot of orders list,
+     * the first reader after a change copies the list under m_txLocker
+     * @param snapshot - published snapshot, empty after a change
+     * @param source - orders list
+     * @return snapshot of list
+     */
+    App::TransactionMapPtr snapshot(App::TransactionMapPtr & snapshot,
+                                    const TransactionMap & source);
+    /**
+     * @brief resetSnapshots - drop published snapshots,
+     * call under m_txLocker after m_transactions or m_historicTransactions changed
+     */
+    void resetSnapshots();
+
+    /**
+     * @brief processedMessages - filter of processed messages,
+     * created on first use, call under m_messagesLock
+     * @return filter
+     */
+    CRollingBloomFilter & processedMessages();
+
+    /**
+     * @brief processIngress - relay packet to peers and process it,
+     * runs on the ingress threads
+     * @param nodeId - id of peer sent packet
+     * @param raw - packet with address and timestamp prefix
+     */
+    void processIngress(const int nodeId, const std::shared_ptr<std::vector<unsigned char> > & raw);
+
 protected:
     /**
      * @brief sendPendingTransaction - check transaction data,
@@ -169,11 +247,25 @@ protected:
     std::deque<WorkPtr>                                m_works;
     boost::thread_group                                m_threads;
 
+    // ingress, packets from peers
+    IoServicePtr                                       m_ingressIo;
+    WorkPtr                                            m_ingressWork;
+    boost::thread_group                                m_ingressThreads;
+    CCriticalSection                                       m_ingressLock;
+    size_t                                             m_ingressQueued{0};
+    std::map<int, size_t>                              m_ingressQueuedByPeer;
+    uint64_t                                           m_ingressDropped{0};
+
     // timer
     boost::asio::io_service                            m_timerIo;
     std::shared_ptr<boost::asio::io_service::work>     m_timerIoWork;
     boost::thread                                      m_timerThread;
     boost::asio::deadline_timer                        m_timer;
+    // deadlines of periodic tasks, used on timer thread
+    bool                                               m_timerActive{false};
+    boost::posix_time::ptime                           m_nextCheck;
+    boost::posix_time::ptime                           m_nextBroadcast;
+    PostedTask                                         m_expiryTask;
 
     // sessions
     mutable CCriticalSection                               m_sessionsLock;
@@ -187,9 +279,10 @@ protected:
     ConnectorsCurrencyMap                              m_connectorCurrencyMap;
 
     // pending messages (packet processing loop)
-    CCriticalSection                                       m_messagesLock;
-    typedef std::set<uint256> ProcessedMessages;
-    ProcessedMessages                                  m_processedMessages;
+    mutable CCriticalSection                               m_messagesLock;
+    std::unique_ptr<CRollingBloomFilter>               m_processedMessages;
+    uint64_t                                           m_processedMessagesInserted{0};
+    uint64_t                                           m_processedMessagesHits{0};
 
     // address book
     CCriticalSection                                       m_addressBookLock;
@@ -200,11 +293,17 @@ protected:
     CCriticalSection                                       m_txLocker;
     std::map<uint256, TransactionDescrPtr>             m_transactions;
     std::map<uint256, TransactionDescrPtr>             m_historicTransactions;
+    App::TransactionMapPtr                             m_transactionsSnapshot;
+    App::TransactionMapPtr                             m_historySnapshot;
+    OrderBook                                          m_orderBook;
     xSeriesCache                                       m_xSeriesCache;
 
     // network packets queue
     CCriticalSection                                       m_ppLocker;
-    std::map<uint256, XBridgePacketPtr>                m_pendingPackets;
+    std::map<uint256, PendingPacket>                   m_pendingPackets;
+    // deadlines of pending packets, entries not matching
+    // due time of the packet are stale and skipped
+    std::set<std::pair<boost::posix_time::ptime, uint256> > m_pendingPacketsDue;
 
     // services and xwallets
     mutable CCriticalSection                               m_xwalletsLocker;
@@ -214,11 +313,15 @@ protected:
 //*****************************************************************************
 //*****************************************************************************
 App::Impl::Impl()
-    : m_timerIoWork(new boost::asio::io_service::work(m_timerIo))
+    : m_ingressIo(new boost::asio::io_service)
+    , m_ingressWork(new boost::asio::io_service::work(*m_ingressIo))
+    , m_timerIoWork(new boost::asio::io_service::work(m_timerIo))
     , m_timerThread(boost::bind(&boost::asio::io_service::run, &m_timerIo))
-    , m_timer(m_timerIo, boost::posix_time::seconds(TIMER_INTERVAL))
+    , m_timer(m_timerIo)
 {
-
+    const boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
+    m_nextCheck     = now + boost::posix_time::seconds(static_cast<long>(TIMER_INTERVAL));
+    m_nextBroadcast = now + boost::posix_time::seconds(static_cast<long>(BROADCAST_INTERVAL));
 }
 
 //*****************************************************************************
@@ -308,7 +411,21 @@ bool App::Impl::start()
             m_threads.create_thread(boost::bind(&boost::asio::io_service::run, ios));
         }
 
-        m_timer.async_wait(boost::bind(&Impl::onTimer, this));
+        // packets queued by the net message handler
+        const int ingressThreads = std::max(1, static_cast<int>(GetArg("-xbridgeingressthreads", INGRESS_THREADS)));
+        for (int i = 0; i < ingressThreads; ++i)
+        {
+            m_ingressThreads.create_thread(boost::bind(&boost::asio::io_service::run, m_ingressIo));
+        }
+
+        m_timerIo.post([this]()
+        {
+            m_timerActive = true;
+            scheduleTimer(boost::posix_time::microsec_clock::universal_time());
+        });
+
+        // blockchain trades for order history
+        m_xSeriesCache.openTradeIndex();
     }
     catch (std::exception & e)
     {
@@ -416,6 +533,23 @@ bool App::Impl::stop()
     m_timerIoWork.reset();
     m_timerThread.join();
 
+    // queued packets are dropped
+    m_ingressWork.reset();
+    m_ingressIo->stop();
+    m_ingressThreads.join_all();
+
+    // queued wallet calls are dropped, not under the lock,
+    // a running call may look up connectors
+    Connectors connectors;
+    {
+        LOCK(m_connectorsLock);
+        connectors = m_connectors;
+    }
+    for (const WalletConnectorPtr & conn : connectors)
+    {
+        conn->stopService();
+    }
+
 //    for (IoServicePtr & i : m_services)
 //    {
 //        i->stop();
@@ -512,27 +646,90 @@ SessionPtr App::Impl::getSession(const std::vector<unsigned char> & address)
     return SessionPtr();
 }
 
+//*****************************************************************************
+//*****************************************************************************
+App::TransactionMapPtr App::Impl::snapshot(App::TransactionMapPtr & snapshot,
+                                           const TransactionMap & source)
+{
+    App::TransactionMapPtr result = std::atomic_load(&snapshot);
+    if (result)
+    {
+        return result;
+    }
+
+    LOCK(m_txLocker);
+
+    // another reader may have published it while we waited
+    result = std::atomic_load(&snapshot);
+    if (!result)
+    {
+        result = std::make_shared<const TransactionMap>(source);
+        std::atomic_store(&snapshot, result);
+    }
+
+    return result;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void App::Impl::resetSnapshots()
+{
+    std::atomic_store(&m_transactionsSnapshot, App::TransactionMapPtr());
+    std::atomic_store(&m_historySnapshot, App::TransactionMapPtr());
+}
+
+//*****************************************************************************
+//*****************************************************************************
+CRollingBloomFilter & App::Impl::processedMessages()
+{
+    if (!m_processedMessages)
+    {
+        // fixed size filter remembering the last messages, the oldest
+        // are forgotten a generation at a time instead of all at once,
+        // capacity is what -maxmempoolxbridge allowed with estimated
+        // 64 bytes per hash in a set, false positives drop 1 of 1e6 messages;
+        // clamped so the filter size stays within its 32 bit bit count
+        // (20M messages take about 215 MB)
+        const uint64_t maxCapacity = 20000000;
+        const int64_t maxMb = std::max<int64_t>(GetArg("-maxmempoolxbridge", 128), 0);
+        const uint64_t capacity64 = std::min<uint64_t>(maxMb, maxCapacity * 64 / 1000000) * 1000000 / 64;
+        const unsigned int capacity = static_cast<unsigned int>(std::max<uint64_t>(capacity64, 1000));
+        m_processedMessages.reset(new CRollingBloomFilter(capacity, 0.000001));
+    }
+    return *m_processedMessages;
+}
+
 //*****************************************************************************
 //*****************************************************************************
 void App::onMessageReceived(const std::vector<unsigned char> & id,
                             const std::vector<unsigned char> & message,
+                            CValidationState & state)
+{
+    onMessageReceived(id, message.data(), message.size(), state);
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void App::onMessageReceived(const std::vector<unsigned char> & id,
+                            const unsigned char * message, const size_t size,
                             CValidationState & /*state*/)
 {
-    if (isKnownMessage(message))
+    const uint256 hash = Hash(message, message + size);
+    if (isKnownMessage(hash))
     {
         return;
     }
 
-    addToKnown(message);
+    addToKnown(hash);
 
-    if (!Session::checkXBridgePacketVersion(message))
+    if (!Session::checkXBridgePacketVersion(message, size))
     {
         // TODO state.DoS()
         return;
     }
 
     XBridgePacketPtr packet(new XBridgePacket);
-    if (!packet->copyFrom(message))
+    if (!packet->copyFrom(message, size))
     {
         LOG() << "incorrect packet received " << __FUNCTION__;
         return;
@@ -607,14 +804,23 @@ void App::onMessageReceived(const std::vector<unsigned char> & id,
 void App::onBroadcastReceived(const std::vector<unsigned char> & message,
                               CValidationState & state)
 {
-    if (isKnownMessage(message))
+    onBroadcastReceived(message.data(), message.size(), state);
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void App::onBroadcastReceived(const unsigned char * message, const size_t size,
+                              CValidationState & /*state*/)
+{
+    const uint256 hash = Hash(message, message + size);
+    if (isKnownMessage(hash))
     {
         return;
     }
 
-    addToKnown(message);
+    addToKnown(hash);
 
-    if (!Session::checkXBridgePacketVersion(message))
+    if (!Session::checkXBridgePacketVersion(message, size))
     {
         // TODO state.DoS()
         return;
@@ -622,7 +828,7 @@ void App::onBroadcastReceived(const std::vector<unsigned char> & message,
 
     // process message
     XBridgePacketPtr packet(new XBridgePacket);
-    if (!packet->copyFrom(message))
+    if (!packet->copyFrom(message, size))
     {
         LOG() << "incorrect packet received " << __FUNCTION__;
         return;
@@ -644,12 +850,166 @@ void App::onBroadcastReceived(const std::vector<unsigned char> & message,
     }
 }
 
+//*****************************************************************************
+//*****************************************************************************
+bool App::enqueuePacket(const int nodeId, std::vector<unsigned char> && raw)
+{
+    // packet's top-level hash
+    const uint256 hash = Hash(raw.begin(), raw.end());
+    if (isKnownMessage(hash))
+    {
+        return false;
+    }
+
+    bool dropped = false;
+    bool peerOverLimit = false;
+    {
+        LOCK(m_p->m_ingressLock);
+
+        size_t & peerQueued = m_p->m_ingressQueuedByPeer[nodeId];
+        peerOverLimit = peerQueued >= Impl::INGRESS_MAX_PACKETS_PER_PEER;
+        if (peerOverLimit || m_p->m_ingressQueued >= Impl::INGRESS_MAX_PACKETS)
+        {
+            // not added to known, same packet from other peer
+            // is accepted when the queue is drained
+            dropped = true;
+            ++m_p->m_ingressDropped;
+            LogPrint("xbridge", "xbridge ingress queue full (%u queued, %u from peer=%d), %u packets dropped\n",
+                     m_p->m_ingressQueued, peerQueued, nodeId, m_p->m_ingressDropped);
+            if (peerQueued == 0)
+            {
+                m_p->m_ingressQueuedByPeer.erase(nodeId);
+            }
+        }
+        else
+        {
+            ++m_p->m_ingressQueued;
+            ++peerQueued;
+        }
+    }
+
+    if (peerOverLimit)
+    {
+        // peer sends faster than its packets are processed,
+        // a queue full of packets of all peers is not its fault
+        LOCK(cs_main);
+        Misbehaving(nodeId, Impl::INGRESS_OVER_LIMIT_DOS);
+    }
+
+    if (dropped)
+    {
+        return false;
+    }
+
+    addToKnown(hash);
+
+    m_p->m_ingressIo->post(boost::bind(&Impl::processIngress, m_p.get(), nodeId,
+                                       std::make_shared<std::vector<unsigned char> >(std::move(raw))));
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void App::Impl::processIngress(const int nodeId, const std::shared_ptr<std::vector<unsigned char> > & raw)
+{
+    {
+        LOCK(m_ingressLock);
+        --m_ingressQueued;
+        if (--m_ingressQueuedByPeer[nodeId] == 0)
+        {
+            m_ingressQueuedByPeer.erase(nodeId);
+        }
+    }
+
+    // Relay packets we haven't seen before
+    {
+        LOCK(cs_vNodes);
+        for (CNode * pnode : vNodes)
+            pnode->PushMessage("xbridge", *raw);
+    }
+
+    App & app = App::instance();
+
+    // Only process the packet if we are an exchange capable node, a servicenode, or xrouter node
+    if (!app.isEnabled() && !GetBoolArg("-xrouter", false))
+    {
+        return;
+    }
+
+    // packet follows address and timestamp, sliced in place
+    static const size_t prefixSize = 20 + sizeof(uint64_t);
+    static const std::vector<unsigned char> zero(20, 0);
+
+    const std::vector<unsigned char> addr(raw->begin(), raw->begin() + 20);
+    const unsigned char * message = raw->data() + prefixSize;
+    const size_t size = raw->size() - prefixSize;
+
+    CValidationState state;
+    if (addr != zero)
+    {
+        app.onMessageReceived(addr, message, size, state);
+    }
+    else
+    {
+        app.onBroadcastReceived(message, size, state);
+    }
+
+    int dos = 0;
+    if (state.IsInvalid(dos))
+    {
+        LogPrint("xbridge", "invalid xbridge packet from peer=%d : %s\n",
+                 nodeId, state.GetRejectReason());
+        if (dos > 0)
+        {
+            LOCK(cs_main);
+            Misbehaving(nodeId, dos);
+        }
+    }
+    else if (state.IsError())
+    {
+        LogPrint("xbridge", "xbridge packet from peer=%d processed with error: %s\n",
+                 nodeId, state.GetRejectReason());
+    }
+}
+
 //*****************************************************************************
 //*****************************************************************************
 bool App::processLater(const uint256 & txid, const XBridgePacketPtr & packet)
 {
-    LOCK(m_p->m_ppLocker);
-    m_p->m_pendingPackets[txid] = packet;
+    boost::posix_time::ptime due;
+
+    {
+        LOCK(m_p->m_ppLocker);
+
+        auto it = m_p->m_pendingPackets.find(txid);
+        if (it == m_p->m_pendingPackets.end())
+        {
+            it = m_p->m_pendingPackets.insert(std::make_pair(txid, Impl::PendingPacket())).first;
+        }
+        else if (!it->second.packet)
+        {
+            // replayed and not processed again
+            ++it->second.attempts;
+        }
+        else
+        {
+            // waiting already, keep deadline
+            it->second.packet = packet;
+            return true;
+        }
+
+        const uint32_t shift = std::min<uint32_t>(it->second.attempts, 5);
+        const long delay = std::min<long>(static_cast<long>(Impl::PACKET_RETRY_MIN_DELAY) << shift,
+                                          static_cast<long>(Impl::PACKET_RETRY_MAX_DELAY));
+
+        due = boost::posix_time::microsec_clock::universal_time() + boost::posix_time::seconds(delay);
+
+        it->second.packet = packet;
+        it->second.due    = due;
+        m_p->m_pendingPacketsDue.insert(std::make_pair(due, txid));
+    }
+
+    m_p->m_timerIo.post(boost::bind(&Impl::wakeTimer, m_p.get(), due));
     return true;
 }
 
@@ -922,8 +1282,7 @@ std::vector<WalletConnectorPtr> App::connectors() const
 //*****************************************************************************
 bool App::isKnownMessage(const std::vector<unsigned char> & message)
 {
-    LOCK(m_p->m_messagesLock);
-    return m_p->m_processedMessages.count(Hash(message.begin(), message.end())) > 0;
+    return isKnownMessage(Hash(message.begin(), message.end()));
 }
 
 //*****************************************************************************
@@ -931,18 +1290,19 @@ bool App::isKnownMessage(const std::vector<unsigned char> & message)
 bool App::isKnownMessage(const uint256 & hash)
 {
     LOCK(m_p->m_messagesLock);
-    return m_p->m_processedMessages.count(hash) > 0;
+    if (!m_p->processedMessages().contains(hash))
+    {
+        return false;
+    }
+    ++m_p->m_processedMessagesHits;
+    return true;
 }
 
 //*****************************************************************************
 //*****************************************************************************
 void App::addToKnown(const std::vector<unsigned char> & message)
 {
-    // add to known
-    LOCK(m_p->m_messagesLock);
-    // clear memory if it's larger than mempool threshold
-    clearMempool();
-    m_p->m_processedMessages.insert(Hash(message.begin(), message.end()));
+    addToKnown(Hash(message.begin(), message.end()));
 }
 
 //*****************************************************************************
@@ -951,9 +1311,25 @@ void App::addToKnown(const uint256 & hash)
 {
     // add to known
     LOCK(m_p->m_messagesLock);
-    // clear memory if it's larger than mempool threshold
-    clearMempool();
-    m_p->m_processedMessages.insert(hash);
+    m_p->processedMessages().insert(hash);
+    ++m_p->m_processedMessagesInserted;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+App::MessageFilterStats App::messageFilterStats() const
+{
+    LOCK(m_p->m_messagesLock);
+
+    const CRollingBloomFilter & filter = m_p->processedMessages();
+
+    MessageFilterStats stats;
+    stats.capacity = filter.capacity();
+    stats.entries  = std::min<uint64_t>(m_p->m_processedMessagesInserted, stats.capacity);
+    stats.inserted = m_p->m_processedMessagesInserted;
+    stats.hits     = m_p->m_processedMessagesHits;
+    stats.memory   = filter.memoryUsage();
+    return stats;
 }
 
 //******************************************************************************
@@ -983,18 +1359,27 @@ TransactionDescrPtr App::transaction(const uint256 & id) const
 
 //******************************************************************************
 //******************************************************************************
-std::map<uint256, xbridge::TransactionDescrPtr> App::transactions() const
+App::TransactionMapPtr App::transactions() const
 {
-    LOCK(m_p->m_txLocker);
-    return m_p->m_transactions;
+    return m_p->snapshot(m_p->m_transactionsSnapshot, m_p->m_transactions);
 }
 
 //******************************************************************************
 //******************************************************************************
-std::map<uint256, xbridge::TransactionDescrPtr> App::history() const
+std::vector<OrderBook::Level> App::orderBook(const std::string & fromCurrency,
+                                             const std::string & toCurrency,
+                                             const bool ascending,
+                                             const size_t maxLevels) const
 {
     LOCK(m_p->m_txLocker);
-    return m_p->m_historicTransactions;
+    return m_p->m_orderBook.levels(fromCurrency, toCurrency, ascending, maxLevels);
+}
+
+//******************************************************************************
+//******************************************************************************
+App::TransactionMapPtr App::history() const
+{
+    return m_p->snapshot(m_p->m_historySnapshot, m_p->m_historicTransactions);
 }
 
 //******************************************************************************
@@ -1003,11 +1388,9 @@ std::vector<CurrencyPair> App::history_matches(const App::TransactionFilter& fil
                                           const xQuery& query)
 {
     std::vector<CurrencyPair> matches{};
-    {
-        LOCK(m_p->m_txLocker);
-        for(const auto& it : m_p->m_historicTransactions) {
-            filter(matches, *it.second, query);
-        }
+    const TransactionMapPtr historic = history();
+    for(const auto& it : *historic) {
+        filter(matches, *it.second, query);
     }
     return matches;
 }
@@ -1031,7 +1414,9 @@ App::flushCancelledOrders(bpt::time_duration minAge) const
             if (ptr->state == xbridge::TransactionDescr::trCancelled
                 && ptr->txtime < keepTime) {
                 list.emplace_back(ptr->id,ptr->txtime,ptr.use_count());
+                m_p->m_orderBook.remove(ptr->id);
                 mp->erase(it++);
+                m_p->resetSnapshots();
             } else {
                 ++it;
             }
@@ -1056,6 +1441,8 @@ void App::appendTransaction(const TransactionDescrPtr & ptr)
     {
         // new transaction, copy data
         m_p->m_transactions[ptr->id] = ptr;
+        m_p->m_orderBook.add(ptr);
+        m_p->resetSnapshots();
     }
     else
     {
@@ -1064,6 +1451,22 @@ void App::appendTransaction(const TransactionDescrPtr & ptr)
     }
 }
 
+//******************************************************************************
+//******************************************************************************
+void App::updateOrderBook(const TransactionDescrPtr & ptr)
+{
+    LOCK(m_p->m_txLocker);
+
+    if (ptr->state == TransactionDescr::trPending && m_p->m_transactions.count(ptr->id))
+    {
+        m_p->m_orderBook.add(ptr);
+    }
+    else
+    {
+        m_p->m_orderBook.remove(ptr->id);
+    }
+}
+
 //******************************************************************************
 //******************************************************************************
 void App::moveTransactionToHistory(const uint256 & id)
@@ -1080,6 +1483,7 @@ void App::moveTransactionToHistory(const uint256 & id)
             xtx = m_p->m_transactions[id];
 
             counter = m_p->m_transactions.erase(id);
+            m_p->m_orderBook.remove(id);
             if(counter > 1) {
                 ERR() << "duplicate transaction id = " << id.GetHex() << " " << __FUNCTION__;
             }
@@ -1087,6 +1491,7 @@ void App::moveTransactionToHistory(const uint256 & id)
 
         if (xtx)
         {
+            m_p->resetSnapshots();
             if(m_p->m_historicTransactions.count(id) != 0) {
                 ERR() << "duplicate tx " << id.GetHex() << " in tx list and history " << __FUNCTION__;
                 return;
@@ -1177,7 +1582,7 @@ xbridge::Error App::sendXBridgeTransaction(const std::string & from,
     uint64_t fee2       = 0;
 
     std::vector<wallet::UtxoEntry> outputs;
-    connFrom->getUnspent(outputs);
+    connFrom->getCachedUnspent(outputs);
 
     // Select utxos
     std::vector<wallet::UtxoEntry> outputsForUse;
@@ -1294,6 +1699,8 @@ xbridge::Error App::sendXBridgeTransaction(const std::string & from,
     {
         LOCK(m_p->m_txLocker);
         m_p->m_transactions[id] = ptr;
+        m_p->m_orderBook.add(ptr);
+        m_p->resetSnapshots();
     }
 
     LOG() << "order created" << ptr << __FUNCTION__;
@@ -1422,7 +1829,7 @@ Error App::acceptXBridgeTransaction(const uint256     & id,
     uint64_t fee2       = 0;
 
     std::vector<wallet::UtxoEntry> outputs;
-    connFrom->getUnspent(outputs);
+    connFrom->getCachedUnspent(outputs);
 
     // Select utxos
     std::vector<wallet::UtxoEntry> outputsForUse;
@@ -1546,6 +1953,7 @@ bool App::Impl::sendAcceptingTransaction(const TransactionDescrPtr & ptr)
     onSend(ptr->hubAddress, packet->body());
 
     ptr->state = TransactionDescr::trAccepting;
+    App::instance().updateOrderBook(ptr);
     xuiConnector.NotifyXBridgeTransactionChanged(ptr->id);
 
     return true;
@@ -1583,6 +1991,7 @@ xbridge::Error App::cancelXBridgeTransaction(const uint256 &id,
 
         xtx->state  = TransactionDescr::trCancelled;
         xtx->reason = reason;
+        updateOrderBook(xtx);
 
         connFrom->lockCoins(ptr->usedCoins, false);
 
@@ -1600,7 +2009,8 @@ xbridge::Error App::cancelXBridgeTransaction(const uint256 &id,
 //******************************************************************************
 void App::cancelMyXBridgeTransactions()
 {
-    for(const auto &transaction : transactions())
+    const TransactionMapPtr list = transactions();
+    for(const auto &transaction : *list)
     {
         if(transaction.second == nullptr)
             continue;
@@ -1923,21 +2333,6 @@ bool App::Impl::hasNodeService(const ::CPubKey & nodePubKey,
     return false;
 }
 
-//******************************************************************************
-//******************************************************************************
-template <typename T>
-T random_element(T begin, T end)
-{
-    const unsigned long n = std::distance(begin, end);
-    const unsigned long divisor = (RAND_MAX + 1) / n;
-
-    unsigned long k;
-    do { k = std::rand() / divisor; } while (k >= n);
-
-    std::advance(begin, k);
-    return begin;
-}
-
 //******************************************************************************
 //******************************************************************************
 bool App::selectUtxos(const std::string &addr, const std::vector<wallet::UtxoEntry> &outputs,
@@ -1945,189 +2340,76 @@ bool App::selectUtxos(const std::string &addr, const std::vector<wallet::UtxoEnt
                       std::vector<wallet::UtxoEntry> &outputsForUse, uint64_t &utxoAmount,
                       uint64_t &fee1, uint64_t &fee2) const
 {
+    fee2 = connFrom->minTxFee2(1, 1) * TransactionDescr::COIN;
 
-    auto getUtxos = [&connFrom, &requiredAmount, &outputsForUse, &utxoAmount, &fee1, &fee2](const std::vector<wallet::UtxoEntry> & o) -> bool
+    // fee of deposit tx by input count, connector is asked once per count
+    std::vector<uint64_t> fees(1, 0);
+    auto feesFor = [&connFrom, &fees](const size_t inputs)
     {
-        fee2 = connFrom->minTxFee2(1, 1) * TransactionDescr::COIN;
-
-        if(o.empty())
+        for (size_t i = fees.size(); i <= inputs; ++i)
         {
-            LOG() << "outputs list are empty " << __FUNCTION__;
-            return false;
+            fees.push_back(static_cast<uint64_t>(connFrom->minTxFee1(i, 3) * TransactionDescr::COIN));
         }
+    };
 
-        //sort entries from smaller to larger
-        std::vector<wallet::UtxoEntry> outputsForSelection = o;
-        std::sort(outputsForSelection.begin(), outputsForSelection.end(),
-                  [](const wallet::UtxoEntry a, const wallet::UtxoEntry b) {
-                      return (a.amount) < (b.amount);
-                  });
-
-        //one output that larger than target value
-        std::vector<wallet::UtxoEntry> greaterThanTargetOutput;
-
-        //try to find best matching one output or one larger output
+    // smallest change that is not dust, isDustAmount is monotone
+    uint64_t minChange = 1;
+    {
+        uint64_t hi = std::numeric_limits<uint32_t>::max();
+        if (connFrom->isDustAmount(static_cast<double>(hi) / TransactionDescr::COIN))
         {
-            fee1 = connFrom->minTxFee1(1, 3) * TransactionDescr::COIN;
-            uint64_t fullAmount = requiredAmount + fee1 + fee2;
-
-            for(const wallet::UtxoEntry & entry : outputsForSelection)
-            {
-                uint64_t utxosAmount = (entry.amount * TransactionDescr::COIN);
-
-                if(utxosAmount == fullAmount)
-                {
-                    //we are lucky
-                    outputsForUse.emplace_back(entry);
-                    return true;
-                }
-
-                if (utxosAmount > fullAmount &&
-                    !connFrom->isDustAmount(static_cast<double>(utxosAmount - fullAmount) / TransactionDescr::COIN))
-                {
-                    greaterThanTargetOutput.emplace_back(entry);
-                    break;
-                }
-            }
+            minChange = hi;
         }
-
-
-        //try to find sum of smaller outputs that match target
-        std::vector<wallet::UtxoEntry> outputsSmallerThanTarget;
-        std::copy_if(outputsForSelection.begin(), outputsForSelection.end(),
-                     std::inserter(outputsSmallerThanTarget, outputsSmallerThanTarget.end()),
-                     [&requiredAmount](const wallet::UtxoEntry & entry)
-        {
-            return requiredAmount > entry.amount * TransactionDescr::COIN;
-        });
-
-        bool sumOfSmallerOutputsLargerThanTarget = false;
-        bool sumOfSmallerOutputsEqualTarget = false;
+        else
         {
-            fee1 = connFrom->minTxFee1(outputsSmallerThanTarget.size(), 3) * TransactionDescr::COIN;
-
-            uint64_t fullAmount = requiredAmount + fee1 + fee2;
-
-            uint64_t utxosAmount = std::accumulate(outputsSmallerThanTarget.begin(), outputsSmallerThanTarget.end(), 0,
-                                                  [](uint64_t accumulator, const wallet::UtxoEntry & entry)
+            uint64_t lo = 0;
+            while (hi - lo > 1)
             {
-                return accumulator += (entry.amount * TransactionDescr::COIN);
-            });
-
-            if (utxosAmount == fullAmount)
-            {
-                sumOfSmallerOutputsEqualTarget = true;
-            }
-
-            if (utxosAmount > fullAmount &&
-                !connFrom->isDustAmount(static_cast<double>(utxosAmount - fullAmount) / TransactionDescr::COIN))
-            {
-                sumOfSmallerOutputsLargerThanTarget = true;
+                const uint64_t mid = lo + (hi - lo) / 2;
+                if (connFrom->isDustAmount(static_cast<double>(mid) / TransactionDescr::COIN))
+                    lo = mid;
+                else
+                    hi = mid;
             }
+            minChange = hi;
         }
+    }
 
-        //best combination of smaller utxo's with lowest fee
-        std::vector<wallet::UtxoEntry> bestSmallerOutputsCombination;
-
-        //sum of all smaller outputs is lower than target, so return greater output
-        if(!sumOfSmallerOutputsLargerThanTarget)
+    auto getUtxos = [&](const std::vector<wallet::UtxoEntry> & o) -> bool
+    {
+        if(o.empty())
         {
-            if(greaterThanTargetOutput.empty())
-            {
-                LOG() << "can't make any list of utxo's " << __FUNCTION__;
-                return false;
-            }
-
-            outputsForUse = greaterThanTargetOutput;
-            return true;
+            LOG() << "outputs list are empty " << __FUNCTION__;
+            return false;
         }
-        //sum of all smaller outputs is equal target, so best combination is all smaller outputs
-        else if(sumOfSmallerOutputsEqualTarget)
+
+        std::vector<uint64_t> amounts;
+        amounts.reserve(o.size());
+        for (const wallet::UtxoEntry & entry : o)
         {
-            bestSmallerOutputsCombination = outputsSmallerThanTarget;
+            amounts.push_back(static_cast<uint64_t>(entry.amount * TransactionDescr::COIN));
         }
-        //try to combine small outputs to target sum
-        else
-        {
-            uint64_t smallestFee = std::numeric_limits<uint64_t>::max();
-            const uint32_t iterations = 1000;
-            for(uint32_t i = 0; i < iterations; ++i)
-            {
-                std::vector<wallet::UtxoEntry> uniqueOutputsSmallerThanTarget(outputsSmallerThanTarget);
-                std::vector<wallet::UtxoEntry> outputsForUse;
-
-                uint64_t utxosAmount = 0;
 
-                while (!uniqueOutputsSmallerThanTarget.empty())
-                {
-                    const auto it = random_element(uniqueOutputsSmallerThanTarget.begin(),
-                                                   uniqueOutputsSmallerThanTarget.end());
-                    wallet::UtxoEntry entry = *it;
-
-                    uniqueOutputsSmallerThanTarget.erase(it);
-
-                    outputsForUse.emplace_back(entry);
-
-                    fee1 = connFrom->minTxFee1(outputsForUse.size(), 3) * TransactionDescr::COIN;
-
-                    uint64_t fullAmount = requiredAmount + fee1 + fee2;
-
-                    utxosAmount += (entry.amount * TransactionDescr::COIN);
-
-                    if (utxosAmount == fullAmount && fee1 < smallestFee)
-                    {
-                        smallestFee = fee1;
-                        bestSmallerOutputsCombination = outputsForUse;
-                        break;
-                    }
-
-                    if (utxosAmount > fullAmount && fee1 < smallestFee &&
-                        !connFrom->isDustAmount(static_cast<double>(utxosAmount - fullAmount) / TransactionDescr::COIN))
-                    {
-                        smallestFee = fee1;
-                        bestSmallerOutputsCombination = outputsForUse;
-                        break;
-                    }
-                }
-            }
-        }
+        feesFor(o.size());
 
-        if(greaterThanTargetOutput.empty() && bestSmallerOutputsCombination.empty())
+        std::vector<size_t> selected;
+        uint64_t total = 0;
+        uint64_t fee   = 0;
+        UtxoSelector selector(fees, fee2, minChange);
+        if (!selector.select(amounts, requiredAmount, selected, total, fee))
         {
             LOG() << "all strategy are fail to create utxo's list " << __FUNCTION__;
             return false;
         }
-        else if(greaterThanTargetOutput.empty())
-            outputsForUse = bestSmallerOutputsCombination;
-        else if(bestSmallerOutputsCombination.empty())
-            outputsForUse = greaterThanTargetOutput;
-        else
-        {
-            uint64_t times = 2; //differences in times
-            uint64_t greaterThanTargetOutputAmount = 0;
-            uint64_t bestSmallerOutputsCombinationAmount = 0;
-
-            for(const wallet::UtxoEntry & entry : greaterThanTargetOutput)
-                greaterThanTargetOutputAmount += (entry.amount * TransactionDescr::COIN);
-
-            for(const wallet::UtxoEntry & entry : bestSmallerOutputsCombination)
-                bestSmallerOutputsCombinationAmount += (entry.amount * TransactionDescr::COIN);
 
-            //if one larger output bigger then sum of small outputs more then twice - better to use small outputs
-            if(greaterThanTargetOutputAmount > bestSmallerOutputsCombinationAmount * times)
-            {
-                utxoAmount = bestSmallerOutputsCombinationAmount;
-                outputsForUse = bestSmallerOutputsCombination;
-            }
-            else
-            {
-                utxoAmount = greaterThanTargetOutputAmount;
-                outputsForUse = greaterThanTargetOutput;
-            }
+        outputsForUse.clear();
+        outputsForUse.reserve(selected.size());
+        for (const size_t i : selected)
+        {
+            outputsForUse.push_back(o[i]);
         }
-
-        fee1 = connFrom->minTxFee1(outputsForUse.size(), 3) * TransactionDescr::COIN;
-
+        utxoAmount = total;
+        fee1       = fee;
         return true;
     };
 
@@ -2147,9 +2429,16 @@ bool App::selectUtxos(const std::string &addr, const std::vector<wallet::UtxoEnt
 
 //******************************************************************************
 //******************************************************************************
-void App::Impl::onTimer()
+void App::Impl::onTimer(const boost::system::error_code & error)
 {
+    if (error == boost::asio::error::operation_aborted)
+    {
+        // rescheduled or stopped
+        return;
+    }
+
     // DEBUG_TRACE();
+    const boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
     {
         m_services.push_back(m_services.front());
         m_services.pop_front();
@@ -2158,66 +2447,145 @@ void App::Impl::onTimer()
 
         IoServicePtr io = m_services.front();
 
-        // call check expired transactions
-        io->post(boost::bind(&xbridge::Session::checkFinishedTransactions, session));
+        if (now >= m_nextCheck)
+        {
+            m_nextCheck = now + boost::posix_time::seconds(static_cast<long>(TIMER_INTERVAL));
+
+            // call check expired transactions
+            io->post(boost::bind(&xbridge::Session::checkFinishedTransactions, session));
+
+            // get addressbook
+            io->post(boost::bind(&xbridge::Session::getAddressBook, session));
+
+            // update active xwallets (in case a wallet goes offline)
+            auto app = &xbridge::App::instance();
+            io->post(boost::bind(&xbridge::App::updateActiveWallets, app));
+        }
 
         // send transactions list
+        if (now >= m_nextBroadcast)
         {
-            static uint32_t counter = 0;
-            if (++counter == 20)
+            m_nextBroadcast = now + boost::posix_time::seconds(static_cast<long>(BROADCAST_INTERVAL));
+
+            // one snapshot of the lists for the round, packets are
+            // signed in parallel, each service sends its slice
+            const App::TransactionMapPtr transactions = snapshot(m_transactionsSnapshot, m_transactions);
+            std::vector<TransactionDescrPtr> orders;
+            orders.reserve(transactions->size());
+            for (const auto & i : *transactions)
             {
-                // 15 sec * 20 = 5 min
-                counter = 0;
-                io->post(boost::bind(&xbridge::Session::sendListOfTransactions, session));
+                orders.push_back(i.second);
+            }
+
+            std::vector<TransactionPtr> exchangeOrders;
+            Exchange & e = Exchange::instance();
+            if (e.isStarted())
+            {
+                const std::list<TransactionPtr> list = e.pendingTransactions();
+                exchangeOrders.assign(list.begin(), list.end());
             }
-        }
 
-        // erase expired tx
-        io->post(boost::bind(&xbridge::Session::eraseExpiredPendingTransactions, session));
+            const size_t parts = m_services.size();
+            for (size_t part = 0; part < parts; ++part)
+            {
+                const std::vector<TransactionDescrPtr> ordersPart(orders.begin() + orders.size() * part / parts,
+                                                                  orders.begin() + orders.size() * (part + 1) / parts);
+                const std::vector<TransactionPtr> exchangePart(exchangeOrders.begin() + exchangeOrders.size() * part / parts,
+                                                               exchangeOrders.begin() + exchangeOrders.size() * (part + 1) / parts);
+                if (ordersPart.empty() && exchangePart.empty())
+                {
+                    continue;
+                }
 
-        // get addressbook
-        io->post(boost::bind(&xbridge::Session::getAddressBook, session));
+                io->post(boost::bind(&xbridge::Session::sendListOfTransactions, getSession(), ordersPart, exchangePart));
+                m_services.push_back(m_services.front());
+                m_services.pop_front();
+                io = m_services.front();
+            }
+        }
 
-        // update active xwallets (in case a wallet goes offline)
-        auto app = &xbridge::App::instance();
-        io->post(boost::bind(&xbridge::App::updateActiveWallets, app));
+        // erase expired tx, when the first of them is due,
+        // the index is cleared by the job, so ticks until
+        // it is done don't post it again
+        m_expiryTask.postIfDue(*io, Exchange::instance().nextExpiryCheck(), now,
+                               boost::bind(&xbridge::Session::eraseExpiredPendingTransactions, session));
 
         // unprocessed packets
+        std::vector<XBridgePacketPtr> packets;
         {
-            static uint32_t counter = 0;
-            if (++counter == 2)
+            LOCK(m_ppLocker);
+
+            while (!m_pendingPacketsDue.empty() && m_pendingPacketsDue.begin()->first <= now)
             {
-                counter = 0;
-                std::map<uint256, XBridgePacketPtr> map;
+                const std::pair<boost::posix_time::ptime, uint256> item = *m_pendingPacketsDue.begin();
+                m_pendingPacketsDue.erase(m_pendingPacketsDue.begin());
+
+                auto it = m_pendingPackets.find(item.second);
+                if (it == m_pendingPackets.end() || it->second.due != item.first)
                 {
-                    LOCK(m_ppLocker);
-                    map = m_pendingPackets;
-                    m_pendingPackets.clear();
+                    // removed or rescheduled
+                    continue;
                 }
-                for (const std::pair<uint256, XBridgePacketPtr> & item : map)
+
+                if (!it->second.packet)
                 {
+                    // not returned after replay, forget attempts
+                    m_pendingPackets.erase(it);
+                    continue;
+                }
 
-                    xbridge::SessionPtr s = getSession();
-                    XBridgePacketPtr packet   = item.second;
-                    io->post(boost::bind(&xbridge::Session::processPacket, s, packet, nullptr));
+                packets.push_back(it->second.packet);
 
-                }
+                // keep attempts until the packet is processed again
+                it->second.packet.reset();
+                it->second.due = now + boost::posix_time::seconds(static_cast<long>(PACKET_RETRY_MAX_DELAY) * 2);
+                m_pendingPacketsDue.insert(std::make_pair(it->second.due, item.second));
             }
         }
+        for (const XBridgePacketPtr & packet : packets)
+        {
+            xbridge::SessionPtr s = getSession();
+            io->post(boost::bind(&xbridge::Session::processPacket, s, packet, nullptr));
+        }
     }
 
-    m_timer.expires_at(m_timer.expires_at() + boost::posix_time::seconds(TIMER_INTERVAL));
-    m_timer.async_wait(boost::bind(&Impl::onTimer, this));
+    scheduleTimer(now);
 }
 
-/**
- * Clears the xbridge message mempool. This is not threadsafe, locks required outside this func.
- */
-void App::clearMempool() {
-    auto count = m_p->m_processedMessages.size();
-    auto maxMBytes = static_cast<unsigned int>(GetArg("-maxmempoolxbridge", 128)) * 1000000;
-    if (count * 64 > maxMBytes) // estimated 64 bytes per hash
-        m_p->m_processedMessages.clear();
+//******************************************************************************
+//******************************************************************************
+void App::Impl::scheduleTimer(const boost::posix_time::ptime & now)
+{
+    boost::posix_time::ptime next = std::min(m_nextCheck, m_nextBroadcast);
+
+    next = std::min(next, Exchange::instance().nextExpiryCheck());
+
+    {
+        LOCK(m_ppLocker);
+        if (!m_pendingPacketsDue.empty())
+        {
+            next = std::min(next, m_pendingPacketsDue.begin()->first);
+        }
+    }
+
+    // posted work may not be done yet
+    next = std::max(next, now + boost::posix_time::milliseconds(static_cast<long>(TIMER_MIN_DELAY)));
+
+    m_timer.expires_at(next);
+    m_timer.async_wait(boost::bind(&Impl::onTimer, this, boost::asio::placeholders::error));
+}
+
+//******************************************************************************
+//******************************************************************************
+void App::Impl::wakeTimer(const boost::posix_time::ptime & due)
+{
+    if (!m_timerActive || due >= m_timer.expires_at())
+    {
+        return;
+    }
+
+    // cancels current wait
+    scheduleTimer(boost::posix_time::microsec_clock::universal_time());
 }
 
 } // namespace xbridge
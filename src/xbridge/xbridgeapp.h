@@ -10,6 +10,7 @@
 #include "xbridgepacket.h"
 #include "uint256.h"
 #include "xbridgetransactiondescr.h"
+#include "xbridgeorderbook.h"
 #include "util/xbridgeerror.h"
 #include "xbridgewalletconnector.h"
 #include "xbridgedef.h"
@@ -130,6 +131,13 @@ public:
             : id{id}, txtime{txtime}, use_count{use_count} {}
     };
 
+    /**
+     * @brief immutable snapshot of orders list, readers share it without
+     * locking, each change of the list makes the next snapshot
+     */
+    typedef std::map<uint256, TransactionDescrPtr> TransactionMap;
+    typedef std::shared_ptr<const TransactionMap>  TransactionMapPtr;
+
     // Settings
     /**
      * @brief Load xbridge.conf settings file.
@@ -151,18 +159,30 @@ public:
     TransactionDescrPtr transaction(const uint256 & id) const;
     /**
      * @brief transactions
-     * @return map of all transaction
+     * @return snapshot of all transaction
      */
-    std::map<uint256, xbridge::TransactionDescrPtr> transactions() const;
+    TransactionMapPtr transactions() const;
+    /**
+     * @brief orderBook - pending orders of pair grouped by price levels
+     * @param fromCurrency - currency of orders maker
+     * @param toCurrency - currency of orders taker
+     * @param ascending - direction by price (toAmount / fromAmount)
+     * @param maxLevels - max count of levels
+     * @return list of levels with pending orders
+     */
+    std::vector<OrderBook::Level> orderBook(const std::string & fromCurrency,
+                                            const std::string & toCurrency,
+                                            const bool ascending,
+                                            const size_t maxLevels) const;
     /**
      * @brief history
-     * @return map of historical transaction (local canceled and finished)
+     * @return snapshot of historical transaction (local canceled and finished)
      */
-    std::map<uint256, xbridge::TransactionDescrPtr> history() const;
+    TransactionMapPtr history() const;
 
     /**
      * @brief history_matches returns details of local transactions that match given filter,
-     * it is like the history() call but instead of copying the entire map container it
+     * it is like the history() call but instead of returning the entire map container it
      * includes only transactions matching TransactionFilter and xQuery
      * @param - filter to apply and other query parameters
      * @return - list of individual matching local transactions
@@ -191,6 +211,13 @@ public:
      */
     void appendTransaction(const TransactionDescrPtr & ptr);
 
+    /**
+     * @brief updateOrderBook - keep order in the order book while it is
+     * pending, call after state of the order changed
+     * @param ptr
+     */
+    void updateOrderBook(const TransactionDescrPtr & ptr);
+
     /**
      * @brief moveTransactionToHistory - move transaction from list of opened transactions
      * to list (map) historycal transactions,
@@ -363,6 +390,23 @@ public:
     void addToKnown(const std::vector<unsigned char> & message);
     void addToKnown(const uint256 & hash);
 
+    /**
+     * @brief The MessageFilterStats struct - counters of the filter of processed messages
+     */
+    struct MessageFilterStats
+    {
+        uint64_t capacity;  // messages remembered before the oldest are forgotten
+        uint64_t entries;   // messages currently remembered
+        uint64_t inserted;  // messages added since start
+        uint64_t hits;      // messages found known
+        uint64_t memory;    // size of the filter in bytes
+    };
+    /**
+     * @brief messageFilterStats
+     * @return counters of the filter of processed messages
+     */
+    MessageFilterStats messageFilterStats() const;
+
     //
     /**
      * @brief sendPacket send packet btadcast to xbridge network
@@ -386,6 +430,9 @@ public:
     void onMessageReceived(const std::vector<unsigned char> & id,
                            const std::vector<unsigned char> & message,
                            CValidationState & state);
+    void onMessageReceived(const std::vector<unsigned char> & id,
+                           const unsigned char * message, const size_t size,
+                           CValidationState & state);
     //
     /**
      * @brief onBroadcastReceived - processing recieved   broadcast message
@@ -394,6 +441,18 @@ public:
      */
     void onBroadcastReceived(const std::vector<unsigned char> & message,
                              CValidationState & state);
+    void onBroadcastReceived(const unsigned char * message, const size_t size,
+                             CValidationState & state);
+
+    /**
+     * @brief enqueuePacket - queue packet received from peer for relay and
+     * processing on the xbridge ingress threads, called by the net message handler
+     * @param nodeId - id of peer
+     * @param raw - packet with address and timestamp prefix, moved to the queue
+     * @return false if packet is known or dropped because the queue is full,
+     * a peer over its own queue limit is punished with Misbehaving
+     */
+    bool enqueuePacket(const int nodeId, std::vector<unsigned char> && raw);
 
     /**
      * @brief processLater
@@ -442,9 +501,6 @@ public:
 
     bool findNodeWithService(const std::set<std::string> & services, CPubKey & node) const;
 
-protected:
-    void clearMempool();
-
 private:
     std::unique_ptr<Impl> m_p;
     bool m_disconnecting;
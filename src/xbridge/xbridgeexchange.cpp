@@ -3,6 +3,8 @@
 
 #include "xbridgeexchange.h"
 #include "xbridgeapp.h"
+#include "xbridgeexpiryindex.h"
+#include "xbridgeutxoreservations.h"
 #include "util/logger.h"
 #include "util/settings.h"
 #include "util/xutil.h"
@@ -16,7 +18,9 @@
 #include "sync.h"
 
 #include <algorithm>
+#include <array>
 #include <boost/algorithm/string/join.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 
 //******************************************************************************
 //******************************************************************************
@@ -34,28 +38,75 @@ protected:
 
     std::list<TransactionPtr> transactions(bool onlyFinished) const;
 
+    /**
+     * @brief The TransactionShard struct - part of transactions
+     * selected by id, with own lock
+     */
+    struct TransactionShard
+    {
+        mutable CCriticalSection                            lock;
+        std::map<uint256, TransactionPtr>                   items;
+        // pending transactions by time of next expiration check
+        ExpiryIndex                                         expiry;
+    };
+
+    enum
+    {
+        shardCount = 16
+    };
+
+    typedef std::array<TransactionShard, shardCount> TransactionShards;
+
+    static TransactionShard & shard(TransactionShards & shards, const uint256 & id);
+    static const TransactionShard & shard(const TransactionShards & shards, const uint256 & id);
+
+    // schedule expiration check of pending transaction, call under shard lock
+    static void scheduleExpiry(TransactionShard & s, const TransactionPtr & tx,
+                               const boost::posix_time::ptime & now);
+
 protected:
     // connected wallets
     typedef std::map<std::string, WalletParam> WalletList;
     WalletList                                         m_wallets;
     mutable CCriticalSection                           m_walletsLock;
 
-    mutable CCriticalSection                               m_pendingTransactionsLock;
-    std::map<uint256, uint256>                         m_hashToIdMap;
-    std::map<uint256, TransactionPtr>                  m_pendingTransactions;
-
-    mutable CCriticalSection                               m_transactionsLock;
-    std::map<uint256, TransactionPtr>                  m_transactions;
+    // transactions are sharded by id, so packets
+    // of unrelated orders don't wait for each other
+    TransactionShards                                  m_pendingTransactions;
+    TransactionShards                                  m_transactions;
 
     // utxo records
-    CCriticalSection                                       m_utxoLocker;
-    std::set<wallet::UtxoEntry>                        m_utxoItems;
-    std::map<uint256, std::vector<wallet::UtxoEntry> > m_utxoTxMap;
+    UtxoReservations                                   m_utxos;
 
     std::vector<unsigned char>                         m_pubkey;
     std::vector<unsigned char>                         m_privkey;
 };
 
+//*****************************************************************************
+//*****************************************************************************
+// static
+Exchange::Impl::TransactionShard & Exchange::Impl::shard(TransactionShards & shards, const uint256 & id)
+{
+    return shards[id.GetLow64() % shardCount];
+}
+
+//*****************************************************************************
+//*****************************************************************************
+// static
+const Exchange::Impl::TransactionShard & Exchange::Impl::shard(const TransactionShards & shards, const uint256 & id)
+{
+    return shards[id.GetLow64() % shardCount];
+}
+
+//*****************************************************************************
+//*****************************************************************************
+// static
+void Exchange::Impl::scheduleExpiry(TransactionShard & s, const TransactionPtr & tx,
+                                    const boost::posix_time::ptime & now)
+{
+    s.expiry.schedule(tx->id(), ExpiryIndex::dueTime(tx->expirationTime(), now));
+}
+
 //*****************************************************************************
 //*****************************************************************************
 Exchange::Exchange()
@@ -239,9 +290,16 @@ std::vector<std::string> Exchange::connectedWallets() const
 //*****************************************************************************
 bool Exchange::checkUtxoItems(const uint256 & txid, const std::vector<wallet::UtxoEntry> & items)
 {
-    LOCK(m_p->m_utxoLocker);
+    for (const wallet::UtxoEntry & item : items)
+    {
+        if (!UtxoReservations::isValid(item))
+        {
+            // malformed txid
+            return false;
+        }
+    }
 
-    if (m_p->m_utxoTxMap.count(txid))
+    if (m_p->m_utxos.has(txid))
     {
         // transaction found
         return true;
@@ -250,7 +308,8 @@ bool Exchange::checkUtxoItems(const uint256 & txid, const std::vector<wallet::Ut
     // check
     for (const wallet::UtxoEntry & item : items)
     {
-        if (m_p->m_utxoItems.count(item) || !CoinValidator::instance().IsCoinValid(item.txId)) // check not in bad funds
+        const UtxoReservations::Outpoint outpoint(item);
+        if (m_p->m_utxos.isReserved(outpoint) || !CoinValidator::instance().IsCoinValid(outpoint.txid)) // check not in bad funds
         {
             // duplicate items
             return false;
@@ -264,25 +323,13 @@ bool Exchange::checkUtxoItems(const uint256 & txid, const std::vector<wallet::Ut
 //*****************************************************************************
 bool Exchange::getUtxoItems(const uint256 & txid, std::vector<wallet::UtxoEntry> & items)
 {
-    LOCK(m_p->m_utxoLocker);
-
     if(txid.IsNull())
     {
-        for(const wallet::UtxoEntry & entry : m_p->m_utxoItems)
-            items.push_back(entry);
-
+        m_p->m_utxos.all(items);
         return true;
     }
 
-    if (m_p->m_utxoTxMap.count(txid))
-    {
-        for(const wallet::UtxoEntry & entry : m_p->m_utxoTxMap[txid])
-            items.push_back(entry);
-
-        return true;
-    }
-
-    return false;
+    return m_p->m_utxos.items(txid, items);
 }
 
 //*****************************************************************************
@@ -363,41 +410,48 @@ bool Exchange::createTransaction(const uint256                        & txid,
     }
 
     {
-        LOCK(m_p->m_pendingTransactionsLock);
+        Impl::TransactionShard & s = Impl::shard(m_p->m_pendingTransactions, txid);
+        LOCK(s.lock);
 
-        if (!m_p->m_pendingTransactions.count(txid))
+        // add locked items, fails if another order got them first
+        if (!lockUtxos(txid, items))
+        {
+            LOG() << "utxo's locked by another order " << txid.ToString();
+            return false;
+        }
+
+        auto it = s.items.find(txid);
+        if (it == s.items.end())
         {
             // new transaction
             isCreated = true;
-            m_p->m_pendingTransactions[txid] = tr;
+            s.items[txid] = tr;
+            Impl::scheduleExpiry(s, tr, boost::posix_time::microsec_clock::universal_time());
         }
         else
         {
-            m_p->m_pendingTransactions[txid]->m_lock.lock();
+            TransactionPtr ptr = it->second;
+            ptr->m_lock.lock();
 
             // found, check if expired
-            if (!m_p->m_pendingTransactions[txid]->isExpired())
+            if (!ptr->isExpired())
             {
-                m_p->m_pendingTransactions[txid]->updateTimestamp();
+                ptr->updateTimestamp();
 
-                m_p->m_pendingTransactions[txid]->m_lock.unlock();
+                ptr->m_lock.unlock();
             }
             else
             {
-                m_p->m_pendingTransactions[txid]->m_lock.unlock();
+                ptr->m_lock.unlock();
 
-                // if expired - delete old transaction
-                m_p->m_pendingTransactions.erase(txid);
-
-                // create new
-                m_p->m_pendingTransactions[txid] = tr;
+                // if expired - replace old transaction with new,
+                // its check replaces the one of the old transaction
+                it->second = tr;
+                Impl::scheduleExpiry(s, tr, boost::posix_time::microsec_clock::universal_time());
             }
         }
     }
 
-    // add locked items
-    lockUtxos(txid, items);
-
     return true;
 }
 
@@ -445,9 +499,11 @@ bool Exchange::acceptTransaction(const uint256                        & txid,
     TransactionPtr tmp;
 
     {
-        LOCK(m_p->m_pendingTransactionsLock);
+        Impl::TransactionShard & s = Impl::shard(m_p->m_pendingTransactions, txid);
+        LOCK(s.lock);
 
-        if (!m_p->m_pendingTransactions.count(txid))
+        auto it = s.items.find(txid);
+        if (it == s.items.end())
         {
             LOG() << "transaction not found " << __FUNCTION__;
             // no pending
@@ -455,35 +511,46 @@ bool Exchange::acceptTransaction(const uint256                        & txid,
         }
         else
         {
-            m_p->m_pendingTransactions[txid]->m_lock.lock();
+            TransactionPtr ptr = it->second;
+            ptr->m_lock.lock();
 
             // found, check if expired
-            if (m_p->m_pendingTransactions[txid]->isExpired())
+            if (ptr->isExpired())
             {
-                m_p->m_pendingTransactions[txid]->m_lock.unlock();
+                ptr->m_lock.unlock();
 
                 // if expired - delete old transaction
-                m_p->m_pendingTransactions.erase(txid);
+                s.items.erase(it);
                 LOG() << "try accept expired transaction " << __FUNCTION__;
                 return false;
             }
             else
             {
+                // add locked items, fails if another order got them first
+                std::vector<wallet::UtxoEntry> locked;
+                if (!m_p->m_utxos.reserve(txid, items, &locked))
+                {
+                    LOG() << "dx accept items locked by another order " << __FUNCTION__;
+                    ptr->m_lock.unlock();
+                    return false;
+                }
+
                 // try join with existing transaction
-                if (!m_p->m_pendingTransactions[txid]->tryJoin(tr))
+                if (!ptr->tryJoin(tr))
                 {
                     LOG() << "transaction not joined " << __FUNCTION__;
-                    m_p->m_pendingTransactions[txid]->m_lock.unlock();
+                    m_p->m_utxos.release(txid, locked);
+                    ptr->m_lock.unlock();
                     return false;
                 }
                 else
                 {
                     LOG() << "transactions joined, id <" << tr->id().GetHex() << ">";
-                    tmp = m_p->m_pendingTransactions[txid];
+                    tmp = ptr;
                 }
             }
 
-            m_p->m_pendingTransactions[txid]->m_lock.unlock();
+            ptr->m_lock.unlock();
         }
     }
 
@@ -491,18 +558,17 @@ bool Exchange::acceptTransaction(const uint256                        & txid,
     {
         // move to transactions
         {
-            LOCK(m_p->m_transactionsLock);
-            m_p->m_transactions[txid] = tmp;
+            Impl::TransactionShard & s = Impl::shard(m_p->m_transactions, txid);
+            LOCK(s.lock);
+            s.items[txid] = tmp;
         }
         {
-            LOCK(m_p->m_pendingTransactionsLock);
-            m_p->m_pendingTransactions.erase(txid);
+            Impl::TransactionShard & s = Impl::shard(m_p->m_pendingTransactions, txid);
+            LOCK(s.lock);
+            s.items.erase(txid);
         }
     }
 
-    // add locked items
-    lockUtxos(txid, items);
-
     return true;
 }
 
@@ -510,14 +576,15 @@ bool Exchange::acceptTransaction(const uint256                        & txid,
 //*****************************************************************************
 bool Exchange::deletePendingTransaction(const uint256 & id)
 {
-    LOCK(m_p->m_pendingTransactionsLock);
+    Impl::TransactionShard & s = Impl::shard(m_p->m_pendingTransactions, id);
+    LOCK(s.lock);
 
     LOG() << "delete pending transaction <" << id.GetHex() << ">";
 
     // if there are any locked utxo's for this txid, unlock them
     unlockUtxos(id);
 
-    m_p->m_pendingTransactions.erase(id);
+    s.items.erase(id);
 
     return true;
 }
@@ -526,11 +593,12 @@ bool Exchange::deletePendingTransaction(const uint256 & id)
 //*****************************************************************************
 bool Exchange::deleteTransaction(const uint256 & txid)
 {
-    LOCK(m_p->m_transactionsLock);
+    Impl::TransactionShard & s = Impl::shard(m_p->m_transactions, txid);
+    LOCK(s.lock);
 
     LOG() << "delete transaction <" << txid.GetHex() << ">";
 
-    m_p->m_transactions.erase(txid);
+    s.items.erase(txid);
 
     unlockUtxos(txid);
 
@@ -612,11 +680,13 @@ bool Exchange::updateTransactionWhenConfirmedReceived(const TransactionPtr & tx,
 const TransactionPtr Exchange::transaction(const uint256 & hash)
 {
     {
-        LOCK(m_p->m_transactionsLock);
+        const Impl::TransactionShard & s = Impl::shard(m_p->m_transactions, hash);
+        LOCK(s.lock);
 
-        if (m_p->m_transactions.count(hash))
+        auto it = s.items.find(hash);
+        if (it != s.items.end())
         {
-            return m_p->m_transactions[hash];
+            return it->second;
         }
         else
         {
@@ -633,11 +703,13 @@ const TransactionPtr Exchange::transaction(const uint256 & hash)
 const TransactionPtr Exchange::pendingTransaction(const uint256 & hash)
 {
     {
-        LOCK(m_p->m_pendingTransactionsLock);
+        const Impl::TransactionShard & s = Impl::shard(m_p->m_pendingTransactions, hash);
+        LOCK(s.lock);
 
-        if (m_p->m_pendingTransactions.count(hash))
+        auto it = s.items.find(hash);
+        if (it != s.items.end())
         {
-            return m_p->m_pendingTransactions[hash];
+            return it->second;
         }
         else
         {
@@ -654,14 +726,15 @@ const TransactionPtr Exchange::pendingTransaction(const uint256 & hash)
 //*****************************************************************************
 std::list<TransactionPtr> Exchange::pendingTransactions() const
 {
-    LOCK(m_p->m_pendingTransactionsLock);
-
     std::list<TransactionPtr> list;
 
-    for (std::map<uint256, TransactionPtr>::const_iterator i = m_p->m_pendingTransactions.begin();
-         i != m_p->m_pendingTransactions.end(); ++i)
+    for (const Impl::TransactionShard & s : m_p->m_pendingTransactions)
     {
-        list.push_back(i->second);
+        LOCK(s.lock);
+        for (const std::pair<const uint256, TransactionPtr> & i : s.items)
+        {
+            list.push_back(i.second);
+        }
     }
 
     return list;
@@ -671,21 +744,23 @@ std::list<TransactionPtr> Exchange::pendingTransactions() const
 //*****************************************************************************
 std::list<TransactionPtr> Exchange::Impl::transactions(bool onlyFinished) const
 {
-    LOCK(m_transactionsLock);
-
     std::list<TransactionPtr> list;
 
-    for (const std::pair<uint256, TransactionPtr> & i : m_transactions)
+    for (const TransactionShard & s : m_transactions)
     {
-        if (!onlyFinished)
+        LOCK(s.lock);
+        for (const std::pair<const uint256, TransactionPtr> & i : s.items)
         {
-            list.push_back(i.second);
-        }
-        else if (i.second->isExpired() ||
-                 !i.second->isValid() ||
-                 i.second->isFinished())
-        {
-            list.push_back(i.second);
+            if (!onlyFinished)
+            {
+                list.push_back(i.second);
+            }
+            else if (i.second->isExpired() ||
+                     !i.second->isValid() ||
+                     i.second->isFinished())
+            {
+                list.push_back(i.second);
+            }
         }
     }
 
@@ -706,6 +781,21 @@ std::list<TransactionPtr> Exchange::finishedTransactions() const
     return m_p->transactions(true);
 }
 
+//*****************************************************************************
+//*****************************************************************************
+boost::posix_time::ptime Exchange::nextExpiryCheck() const
+{
+    boost::posix_time::ptime result(boost::posix_time::pos_infin);
+
+    for (const Impl::TransactionShard & s : m_p->m_pendingTransactions)
+    {
+        LOCK(s.lock);
+        result = std::min(result, s.expiry.next());
+    }
+
+    return result;
+}
+
 //*****************************************************************************
 //*****************************************************************************
 size_t Exchange::eraseExpiredTransactions()
@@ -717,26 +807,42 @@ size_t Exchange::eraseExpiredTransactions()
 
     size_t result = 0;
 
-    LOCK(m_p->m_pendingTransactionsLock);
+    const boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
 
-    // Use non-hoisted iterator to prevent invalidation during erase
-    for (auto it = m_p->m_pendingTransactions.cbegin(); it != m_p->m_pendingTransactions.cend(); )
+    // only transactions due in expiry index are checked
+    for (Impl::TransactionShard & s : m_p->m_pendingTransactions)
     {
-        TransactionPtr ptr = it->second;
-
-        LOCK(ptr->m_lock);
+        LOCK(s.lock);
 
-        if (ptr->isExpired() || ptr->isExpiredByBlockNumber())
+        uint256 id;
+        while (s.expiry.pop(now, id))
         {
-            LOG() << __FUNCTION__ << std::endl << "order expired" << ptr;
+            auto it = s.items.find(id);
+            if (it == s.items.end())
+            {
+                // already removed
+                continue;
+            }
+
+            TransactionPtr ptr = it->second;
+
+            LOCK(ptr->m_lock);
+
+            if (ptr->isExpired() || ptr->isExpiredByBlockNumber())
+            {
+                LOG() << __FUNCTION__ << std::endl << "order expired" << ptr;
 
-            m_p->m_pendingTransactions.erase(it++);
+                s.items.erase(it);
 
-            unlockUtxos(ptr->id());
+                unlockUtxos(ptr->id());
 
-            ++result;
-        } else {
-            ++it;
+                ++result;
+            }
+            else
+            {
+                // timestamp updated, check again later
+                Impl::scheduleExpiry(s, ptr, now);
+            }
         }
     }
 
@@ -750,76 +856,48 @@ size_t Exchange::eraseExpiredTransactions()
 //******************************************************************************
 bool Exchange::lockUtxos(const uint256 &id, const std::vector<wallet::UtxoEntry> &items)
 {
-    if (items.empty())
-    {
-        return false;
-    }
-
-    LOCK(m_p->m_utxoLocker);
-    // use set to prevent overwriting utxo's from 'A' or 'B' role
-    std::set<wallet::UtxoEntry> utxoTxMapItems;
-    for (const wallet::UtxoEntry & item : m_p->m_utxoTxMap[id])
-    {
-        utxoTxMapItems.insert(item);
-    }
-
-    for (const wallet::UtxoEntry & item : items)
-    {
-        m_p->m_utxoItems.insert(item);
-        if (!utxoTxMapItems.count(item))
-        {
-            utxoTxMapItems.insert(item);
-            m_p->m_utxoTxMap[id].push_back(item);
-        }
-    }
-
-    return true;
+    return m_p->m_utxos.reserve(id, items);
 }
 
 //******************************************************************************
 //******************************************************************************
 bool Exchange::unlockUtxos(const uint256 &id)
 {
-    LOCK(m_p->m_utxoLocker);
-
-    if (!m_p->m_utxoTxMap.count(id))
-    {
-        return false;
-    }
-
-    for (const wallet::UtxoEntry & item : m_p->m_utxoTxMap[id])
-    {
-        m_p->m_utxoItems.erase(item);
-    }
-
-    m_p->m_utxoTxMap.erase(id);
-
-    return true;
+    return m_p->m_utxos.release(id);
 }
 
 //*****************************************************************************
 //*****************************************************************************
 bool Exchange::updateTimestampOrRemoveExpired(const TransactionPtr & tx)
 {
-    LOCK(m_p->m_pendingTransactionsLock);
-
     auto txid = tx->id();
-    m_p->m_pendingTransactions[txid]->m_lock.lock();
+
+    Impl::TransactionShard & s = Impl::shard(m_p->m_pendingTransactions, txid);
+    LOCK(s.lock);
+
+    auto it = s.items.find(txid);
+    if (it == s.items.end())
+    {
+        return false;
+    }
+
+    TransactionPtr ptr = it->second;
+    ptr->m_lock.lock();
 
     // found, check if expired
-    if (!m_p->m_pendingTransactions[txid]->isExpired())
+    if (!ptr->isExpired())
     {
-        m_p->m_pendingTransactions[txid]->updateTimestamp();
+        ptr->updateTimestamp();
 
-        m_p->m_pendingTransactions[txid]->m_lock.unlock();
+        ptr->m_lock.unlock();
         return true;
     }
     else
     {
-        m_p->m_pendingTransactions[txid]->m_lock.unlock();
+        ptr->m_lock.unlock();
 
         // if expired - delete old transaction
-        m_p->m_pendingTransactions.erase(txid);
+        s.items.erase(it);
         return false;
     }
 }
@@ -92,6 +92,8 @@ public:
      */
     std::vector<std::string> connectedWallets() const;
 
+    // early check of the packet, items are reserved
+    // by createTransaction and acceptTransaction
     bool checkUtxoItems(const uint256 & txid,
                         const std::vector<wallet::UtxoEntry> & items);
     bool getUtxoItems(const uint256 & txid,
@@ -234,11 +236,18 @@ public:
      * @return status of operation
      */
     size_t eraseExpiredTransactions();
+    /**
+     * @brief nextExpiryCheck
+     * @return time when eraseExpiredTransactions has pending
+     * transactions to check, pos_infin if there are none
+     */
+    boost::posix_time::ptime nextExpiryCheck() const;
 
     /**
      * @brief lockUtxos - locks the utxo's with the specified tx id
      * @param id - id of transaction
-     * @return true, if utxo's were added
+     * @return true, if utxo's were added, false and nothing is
+     * locked if any utxo is locked by another transaction
      */
     bool lockUtxos(const uint256 &id, const std::vector<wallet::UtxoEntry> &items);
 
@@ -0,0 +1,76 @@
+//*****************************************************************************
+//*****************************************************************************
+
+#include "xbridgeexpiryindex.h"
+
+#include <algorithm>
+
+//*****************************************************************************
+//*****************************************************************************
+namespace xbridge
+{
+
+//*****************************************************************************
+//*****************************************************************************
+// static
+boost::posix_time::ptime ExpiryIndex::dueTime(const boost::posix_time::ptime & expiration,
+                                              const boost::posix_time::ptime & now)
+{
+    boost::posix_time::ptime due = std::min(expiration,
+                                            now + boost::posix_time::seconds(static_cast<long>(recheckSeconds)));
+    // isExpired is true only after expiration time passed
+    return std::max(due, now + boost::posix_time::seconds(1));
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void ExpiryIndex::schedule(const uint256 & id, const boost::posix_time::ptime & due)
+{
+    auto it = m_due.find(id);
+    if (it != m_due.end())
+    {
+        m_checks.erase(std::make_pair(it->second, id));
+        it->second = due;
+    }
+    else
+    {
+        m_due[id] = due;
+    }
+
+    m_checks.insert(std::make_pair(due, id));
+}
+
+//*****************************************************************************
+//*****************************************************************************
+bool ExpiryIndex::pop(const boost::posix_time::ptime & now, uint256 & id)
+{
+    if (m_checks.empty() || m_checks.begin()->first > now)
+    {
+        return false;
+    }
+
+    id = m_checks.begin()->second;
+    m_checks.erase(m_checks.begin());
+    m_due.erase(id);
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+boost::posix_time::ptime ExpiryIndex::next() const
+{
+    if (m_checks.empty())
+    {
+        return boost::posix_time::ptime(boost::posix_time::pos_infin);
+    }
+    return m_checks.begin()->first;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+size_t ExpiryIndex::size() const
+{
+    return m_checks.size();
+}
+
+} // namespace xbridge
@@ -0,0 +1,83 @@
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef XBRIDGEEXPIRYINDEX_H
+#define XBRIDGEEXPIRYINDEX_H
+
+#include "uint256.h"
+
+#include <map>
+#include <set>
+#include <utility>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+//*****************************************************************************
+//*****************************************************************************
+namespace xbridge
+{
+
+//*****************************************************************************
+//*****************************************************************************
+/**
+ * @brief The ExpiryIndex class - pending orders by time of next expiration
+ * check, one check per order. Checks of removed orders are dropped when
+ * due. Not thread safe, used under the lock of the order map.
+ */
+class ExpiryIndex
+{
+public:
+    enum
+    {
+        // orders expire by block number too,
+        // so they are checked at least this often
+        recheckSeconds = 60
+    };
+
+public:
+    /**
+     * @brief dueTime
+     * @param expiration - expiration time of order
+     * @param now - current time
+     * @return time of next check, not later than recheckSeconds
+     * and after expiration time passed
+     */
+    static boost::posix_time::ptime dueTime(const boost::posix_time::ptime & expiration,
+                                            const boost::posix_time::ptime & now);
+
+    /**
+     * @brief schedule - schedule check of order, replaces
+     * the check scheduled before
+     * @param id - id of order
+     * @param due - time of check
+     */
+    void schedule(const uint256 & id, const boost::posix_time::ptime & due);
+
+    /**
+     * @brief pop - remove first due check
+     * @param now - current time
+     * @param id - id of order to check
+     * @return true, if a check was due
+     */
+    bool pop(const boost::posix_time::ptime & now, uint256 & id);
+
+    /**
+     * @brief next
+     * @return time of first check, pos_infin if there are none
+     */
+    boost::posix_time::ptime next() const;
+
+    /**
+     * @brief size
+     * @return number of scheduled checks
+     */
+    size_t size() const;
+
+private:
+    std::set<std::pair<boost::posix_time::ptime, uint256> > m_checks;
+    std::map<uint256, boost::posix_time::ptime>             m_due;
+};
+
+} // namespace xbridge
+
+#endif // XBRIDGEEXPIRYINDEX_H
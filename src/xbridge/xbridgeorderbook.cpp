@@ -0,0 +1,160 @@
+//*****************************************************************************
+//*****************************************************************************
+
+#include "xbridgeorderbook.h"
+#include "xbridgetransactiondescr.h"
+#include "util/xutil.h"
+
+#include <cmath>
+#include <limits>
+
+//*****************************************************************************
+//*****************************************************************************
+namespace xbridge
+{
+
+//*****************************************************************************
+//*****************************************************************************
+namespace
+{
+
+// floating point comparisons
+// see Knuth 4.2.2 Eq 36
+bool floatCompare(const double a, const double b)
+{
+    const auto epsilon = std::numeric_limits<double>::epsilon();
+    return (fabs(a - b) / fabs(a) <= epsilon) && (fabs(a - b) / fabs(b) <= epsilon);
+}
+
+//*****************************************************************************
+//*****************************************************************************
+template <class Iterator>
+void collectLevels(Iterator begin, Iterator end, const size_t maxLevels,
+                   std::vector<OrderBook::Level> & result)
+{
+    for (Iterator it = begin; it != end && result.size() < maxLevels; ++it)
+    {
+        result.push_back(it->second);
+    }
+}
+
+} // namespace
+
+//*****************************************************************************
+//*****************************************************************************
+void OrderBook::add(const TransactionDescrPtr & order)
+{
+    if (!order || order->state != TransactionDescr::trPending ||
+        order->fromAmount <= 0 || order->toAmount <= 0)
+    {
+        return;
+    }
+
+    if (m_orders.count(order->id))
+    {
+        return;
+    }
+
+    const PairKey pair(order->fromCurrency, order->toCurrency);
+    const double price = util::price(order);
+
+    Levels & levels = m_books[pair];
+
+    // join level with equal price
+    Levels::iterator it = levels.lower_bound(price);
+    if (it == levels.end() || !floatCompare(it->first, price))
+    {
+        if (it != levels.begin() && floatCompare(std::prev(it)->first, price))
+        {
+            --it;
+        }
+        else
+        {
+            it = levels.emplace_hint(it, price, Level{price, 0, 0, {}});
+        }
+    }
+
+    Level & level = it->second;
+    level.orders.push_back(order);
+    level.fromAmount += order->fromAmount;
+    level.toAmount   += order->toAmount;
+    m_orders[order->id] = std::make_pair(pair, it->first);
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void OrderBook::remove(const uint256 & id)
+{
+    auto ordersIt = m_orders.find(id);
+    if (ordersIt == m_orders.end())
+    {
+        return;
+    }
+
+    const PairKey & pair  = ordersIt->second.first;
+    const double    price = ordersIt->second.second;
+
+    auto bookIt = m_books.find(pair);
+    if (bookIt != m_books.end())
+    {
+        Levels & levels = bookIt->second;
+        auto levelIt = levels.find(price);
+        if (levelIt != levels.end())
+        {
+            Level & level = levelIt->second;
+            std::vector<TransactionDescrPtr> & orders = level.orders;
+            for (auto it = orders.begin(); it != orders.end(); ++it)
+            {
+                if ((*it)->id == id)
+                {
+                    level.fromAmount -= (*it)->fromAmount;
+                    level.toAmount   -= (*it)->toAmount;
+                    orders.erase(it);
+                    break;
+                }
+            }
+
+            if (orders.empty())
+            {
+                levels.erase(levelIt);
+            }
+        }
+
+        if (levels.empty())
+        {
+            m_books.erase(bookIt);
+        }
+    }
+
+    m_orders.erase(ordersIt);
+}
+
+//*****************************************************************************
+//*****************************************************************************
+std::vector<OrderBook::Level> OrderBook::levels(const std::string & fromCurrency,
+                                                const std::string & toCurrency,
+                                                const bool ascending,
+                                                const size_t maxLevels) const
+{
+    std::vector<Level> result;
+
+    auto bookIt = m_books.find(PairKey(fromCurrency, toCurrency));
+    if (bookIt == m_books.end())
+    {
+        return result;
+    }
+
+    const Levels & levels = bookIt->second;
+    if (ascending)
+    {
+        collectLevels(levels.begin(), levels.end(), maxLevels, result);
+    }
+    else
+    {
+        collectLevels(levels.rbegin(), levels.rend(), maxLevels, result);
+    }
+
+    return result;
+}
+
+} // namespace xbridge
@@ -0,0 +1,80 @@
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef XBRIDGEORDERBOOK_H
+#define XBRIDGEORDERBOOK_H
+
+#include "uint256.h"
+#include "xbridgedef.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+
+//*****************************************************************************
+//*****************************************************************************
+namespace xbridge
+{
+
+//*****************************************************************************
+//*****************************************************************************
+/**
+ * @brief The OrderBook class - pending orders of each currency pair grouped
+ * in price levels, price of order is toAmount / fromAmount (util::price),
+ * orders within level keep arrival order.
+ * Not thread safe, owner keeps it in step with the orders list and
+ * removes orders leaving trPending state.
+ */
+class OrderBook
+{
+public:
+    /**
+     * @brief The Level struct - orders of one price and their total amounts
+     */
+    struct Level
+    {
+        double                           price;
+        uint64_t                         fromAmount;
+        uint64_t                         toAmount;
+        std::vector<TransactionDescrPtr> orders;
+    };
+
+public:
+    /**
+     * @brief add - add order to book of its pair, orders
+     * not in trPending state or with empty amounts are ignored
+     * @param order
+     */
+    void add(const TransactionDescrPtr & order);
+
+    /**
+     * @brief remove - remove order from book
+     * @param id - order id
+     */
+    void remove(const uint256 & id);
+
+    /**
+     * @brief levels - levels of pair
+     * @param fromCurrency - currency of orders maker
+     * @param toCurrency - currency of orders taker
+     * @param ascending - direction by price
+     * @param maxLevels - max count of levels
+     * @return list of levels
+     */
+    std::vector<Level> levels(const std::string & fromCurrency,
+                              const std::string & toCurrency,
+                              const bool ascending,
+                              const size_t maxLevels) const;
+
+private:
+    typedef std::pair<std::string, std::string> PairKey;
+    typedef std::map<double, Level>             Levels;
+
+    std::map<PairKey, Levels>                         m_books;
+    std::map<uint256, std::pair<PairKey, double> >    m_orders;
+};
+
+} // namespace xbridge
+
+#endif // XBRIDGEORDERBOOK_H
@@ -6,7 +6,13 @@
 #include "random.h"
 #include "allocators.h"
 #include "crypto/sha256.h"
+#include "cuckoocache.h"
+#include "script/sigcache.h"
 #include "xbridge/util/logger.h"
+#include "uint256.h"
+
+#include <boost/thread/locks.hpp>
+#include <boost/thread/shared_mutex.hpp>
 
 //******************************************************************************
 //******************************************************************************
@@ -47,6 +53,62 @@ public:
 };
 static SecpInstance secpInstance;
 
+//******************************************************************************
+//******************************************************************************
+/**
+ * Verified signatures, a packet processed again (pending packets, relayed
+ * copies of one packet) skips the secp256k1 verification; entries are kept
+ * in a cuckoo table like the script signature cache
+ */
+class SignatureCache
+{
+public:
+    enum
+    {
+        MAX_ENTRIES = 20000
+    };
+
+public:
+    SignatureCache()
+    {
+        GetRandBytes(m_nonce.begin(), 32);
+        m_valid.setup(MAX_ENTRIES);
+    }
+
+    uint256 key(const unsigned char * hash, const unsigned char * signature,
+                const unsigned char * pubkey) const
+    {
+        uint256 result;
+        CSHA256 sha256;
+        sha256.Write(m_nonce.begin(), 32);
+        sha256.Write(hash, CSHA256::OUTPUT_SIZE);
+        sha256.Write(signature, XBridgePacket::rawSignatureSize);
+        sha256.Write(pubkey, XBridgePacket::pubkeySize);
+        sha256.Finalize(result.begin());
+        return result;
+    }
+
+    bool get(const uint256 & key)
+    {
+        boost::shared_lock<boost::shared_mutex> lock(m_lock);
+        return m_valid.contains(key, false);
+    }
+
+    void set(const uint256 & key)
+    {
+        boost::unique_lock<boost::shared_mutex> lock(m_lock);
+        m_valid.insert(key);
+    }
+
+private:
+    //! salts entries, so positions in the table can't be chosen by peers
+    uint256 m_nonce;
+
+    boost::shared_mutex m_lock;
+    CuckooCache::cache<uint256, SignatureCacheHasher> m_valid;
+};
+static SignatureCache signatureCache;
+
 } // namespace
 
 //******************************************************************************
@@ -103,6 +165,12 @@ bool XBridgePacket::verify()
     // restore signature
     memcpy(signatureField(), signature, rawSignatureSize);
 
+    const uint256 cacheKey = signatureCache.key(hash, signatureField(), pubkeyField());
+    if (signatureCache.get(cacheKey))
+    {
+        return true;
+    }
+
     secp256k1_ecdsa_signature sig;
     if (secp256k1_ecdsa_signature_parse_compact(secpContext, &sig, signatureField()) == 0)
     {
@@ -140,6 +208,7 @@ bool XBridgePacket::verify()
     }
 
     // all correct
+    signatureCache.set(cacheKey);
     return true;
 }
 
@@ -458,15 +458,20 @@ public:
 
     bool copyFrom(const std::vector<unsigned char> & data)
     {
-        if (data.size() < headerSize)
+        return copyFrom(data.data(), data.size());
+    }
+
+    bool copyFrom(const unsigned char * data, const size_t size)
+    {
+        if (size < headerSize)
         {
             ERR() << "received data size less than packet header size " << __FUNCTION__;
             return false;
         }
 
-        m_body = data;
+        m_body.assign(data, data + size);
 
-        if (sizeField() != static_cast<uint32_t>(data.size())-headerSize)
+        if (sizeField() != static_cast<uint32_t>(size)-headerSize)
         {
             ERR() << "incorrect data size " << __FUNCTION__;
             return false;
@@ -65,7 +65,7 @@ struct PrintErrorCode
 
 //*****************************************************************************
 //*****************************************************************************
-class Session::Impl
+class Session::Impl : public std::enable_shared_from_this<Session::Impl>
 {
     friend class Session;
 
@@ -83,6 +83,12 @@ protected:
     bool isAddressInTransaction(const std::vector<unsigned char> & address,
                                 const TransactionPtr & tx) const;
 
+    // fn request amounts and check signatures of utxo items in one
+    // wallet call each, drops not found or not signed items
+    bool checkUtxoEntries(const WalletConnectorPtr & conn,
+                          std::vector<wallet::UtxoEntry> & items,
+                          double & commonAmount) const;
+
 protected:
     bool encryptPacket(XBridgePacketPtr packet) const;
     bool decryptPacket(XBridgePacketPtr packet) const;
@@ -114,6 +120,58 @@ protected:
     bool processTransactionConfirmB(XBridgePacketPtr packet) const;
     bool processTransactionConfirmedB(XBridgePacketPtr packet) const;
 
+    // order of xbcTransaction / xbcTransactionAccepting,
+    // held by its pending wallet call
+    struct OrderPacket
+    {
+        uint256                        id;
+        std::vector<unsigned char>     saddr;
+        std::string                    scurrency;
+        uint64_t                       samount;
+        std::vector<unsigned char>     daddr;
+        std::string                    dcurrency;
+        uint64_t                       damount;
+        uint64_t                       timestamp;
+        uint256                        blockHash;
+        std::vector<unsigned char>     mpubkey;
+        std::vector<wallet::UtxoEntry> utxoItems;
+        WalletConnectorPtr             sconn;
+        WalletConnectorPtr             dconn;
+    };
+    typedef std::shared_ptr<OrderPacket> OrderPacketPtr;
+
+    // check utxo items of the order, then create or accept it,
+    // run on the service of the source connector
+    void createPendingTransaction(const OrderPacketPtr & o) const;
+    void acceptPendingTransaction(const OrderPacketPtr & o) const;
+
+    // step of a local order, held by its pending wallet calls
+    struct SwapStep
+    {
+        TransactionDescrPtr        xtx;
+        // connector the wallet calls of the step run on
+        WalletConnectorPtr         conn;
+        XBridgePacketPtr           packet;
+        uint256                    txid;
+        std::vector<unsigned char> thisAddress;
+        std::vector<unsigned char> hubAddress;
+        // create, counterparty key and hash of secret of A
+        std::vector<unsigned char> mPubKey;
+        std::vector<unsigned char> hx;
+        // confirm, deposit of the counterparty
+        std::string                binTxId;
+        std::vector<unsigned char> xPubKey;
+        std::vector<unsigned char> innerScript;
+    };
+    typedef std::shared_ptr<SwapStep> SwapStepPtr;
+
+    // create and send deposit and refund tx
+    void createDeposit(const SwapStepPtr & step) const;
+    // check deposit of the counterparty, create and send payment tx
+    void sendPayment(const SwapStepPtr & step) const;
+    // send refund tx of a cancelled order
+    void sendRefund(const SwapStepPtr & step) const;
+
     bool finishTransaction(TransactionPtr tr) const;
 
     bool sendCancelTransaction(const TransactionPtr & tx,
@@ -412,7 +470,20 @@ bool Session::Impl::processZero(XBridgePacketPtr /*packet*/) const
 // static
 bool Session::checkXBridgePacketVersion(const std::vector<unsigned char> & message)
 {
-    const uint32_t version = *reinterpret_cast<const uint32_t *>(&message[0]);
+    return checkXBridgePacketVersion(message.data(), message.size());
+}
+
+//*****************************************************************************
+//*****************************************************************************
+// static
+bool Session::checkXBridgePacketVersion(const unsigned char * message, const size_t size)
+{
+    if (size < sizeof(uint32_t))
+    {
+        return false;
+    }
+
+    const uint32_t version = *reinterpret_cast<const uint32_t *>(message);
 
     if (version != static_cast<boost::uint32_t>(XBRIDGE_PROTOCOL_VERSION))
     {
@@ -543,8 +614,6 @@ bool Session::Impl::processTransaction(XBridgePacketPtr packet) const
         return true;
     }
 
-    double commonAmount = 0;
-
     // utxo items
     std::vector<wallet::UtxoEntry> utxoItems;
     {
@@ -581,39 +650,73 @@ bool Session::Impl::processTransaction(XBridgePacketPtr packet) const
             entry.signature = std::vector<unsigned char>(packet->data()+offset, packet->data()+offset+XBridgePacket::signatureSize);
             offset += XBridgePacket::signatureSize;
 
-            if (!sconn->getTxOut(entry))
-            {
-                LOG() << "not found utxo entry <" << entry.txId
-                      << "> no " << entry.vout << " " << __FUNCTION__;
-                continue;
-            }
+            utxoItems.push_back(entry);
+        }
+    }
 
-            // check signature
-            std::string signature = EncodeBase64(&entry.signature[0], entry.signature.size());
-            if (!sconn->verifyMessage(entry.address, entry.toString(), signature))
-            {
-                LOG() << "not valid signature, bad utxo entry" << entry.txId
-                      << "> no " << entry.vout << " " << __FUNCTION__;
-                continue;
-            }
+    OrderPacketPtr o(new OrderPacket);
+    o->id        = id;
+    o->saddr     = saddr;
+    o->scurrency = scurrency;
+    o->samount   = samount;
+    o->daddr     = daddr;
+    o->dcurrency = dcurrency;
+    o->damount   = damount;
+    o->timestamp = timestamp;
+    o->blockHash = blockHash;
+    o->mpubkey   = mpubkey;
+    o->utxoItems = utxoItems;
+    o->sconn     = sconn;
+    o->dconn     = dconn;
 
-            commonAmount += entry.amount;
+    // wallet calls of the checks run on the source connector
+    std::shared_ptr<const Impl> self = shared_from_this();
+    sconn->post([self, o]()
+    {
+        self->createPendingTransaction(o);
+    });
 
-            utxoItems.push_back(entry);
-        }
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void Session::Impl::createPendingTransaction(const OrderPacketPtr & o) const
+{
+    Exchange & e = Exchange::instance();
+
+    const uint256 & id                         = o->id;
+    const std::vector<unsigned char> & saddr   = o->saddr;
+    const std::string & scurrency              = o->scurrency;
+    const uint64_t samount                     = o->samount;
+    const std::vector<unsigned char> & daddr   = o->daddr;
+    const std::string & dcurrency              = o->dcurrency;
+    const uint64_t damount                     = o->damount;
+    const uint64_t timestamp                   = o->timestamp;
+    uint256 blockHash                          = o->blockHash;
+    const std::vector<unsigned char> & mpubkey = o->mpubkey;
+    const WalletConnectorPtr & sconn           = o->sconn;
+    const WalletConnectorPtr & dconn           = o->dconn;
+
+    double commonAmount = 0;
+
+    std::vector<wallet::UtxoEntry> utxoItems = o->utxoItems;
+    if (!checkUtxoEntries(sconn, utxoItems, commonAmount))
+    {
+        return;
     }
 
     if (utxoItems.empty())
     {
         LOG() << "transaction rejected, utxo items are empty <" << __FUNCTION__;
-        return true;
+        return;
     }
 
     if (commonAmount * TransactionDescr::COIN < samount)
     {
         LOG() << "transaction rejected, amount from utxo items <" << commonAmount
               << "> less than required <" << samount << "> " << __FUNCTION__;
-        return true;
+        return;
     }
 
     // check dust amount
@@ -622,7 +725,7 @@ bool Session::Impl::processTransaction(XBridgePacketPtr packet) const
         dconn->isDustAmount(static_cast<double>(damount) / TransactionDescr::COIN))
     {
         LOG() << "reject dust amount transaction " << id.ToString() << " " << __FUNCTION__;
-        return true;
+        return;
     }
 
     LOG() << "received transaction " << id.GetHex() << std::endl
@@ -652,7 +755,7 @@ bool Session::Impl::processTransaction(XBridgePacketPtr packet) const
                << "body hash:" << checkId.GetHex() << std::endl
                << __FUNCTION__;
 
-        return true;
+        return;
     }
 
     // check utxo items
@@ -660,7 +763,7 @@ bool Session::Impl::processTransaction(XBridgePacketPtr packet) const
     {
         LOG() << "transaction rejected, error check utxo items "  << id.ToString()
               << " " << __FUNCTION__;
-        return true;
+        return;
     }
 
     {
@@ -674,7 +777,7 @@ bool Session::Impl::processTransaction(XBridgePacketPtr packet) const
         {
             // not created
             LOG() << "transaction create error "  << id.ToString() << " " << __FUNCTION__;
-            return true;
+            return;
         }
 
         if (isCreated)
@@ -699,7 +802,7 @@ bool Session::Impl::processTransaction(XBridgePacketPtr packet) const
             {
                 LOG() << "transaction not found after create. " << id.ToString()
                       << " " << __FUNCTION__;
-                return false;
+                return;
             }
 
             LOCK(tr->m_lock);
@@ -729,8 +832,6 @@ bool Session::Impl::processTransaction(XBridgePacketPtr packet) const
             LOG() << __FUNCTION__ << tr;
         }
     }
-
-    return true;
 }
 
 //******************************************************************************
@@ -813,6 +914,7 @@ bool Session::Impl::processPendingTransaction(XBridgePacketPtr packet) const
         {
             LOG() << "received confirmed order from snode, setting status to pending " << __FUNCTION__;
             ptr->state = TransactionDescr::trPending;
+            xapp.updateOrderBook(ptr);
         }
 
         // update timestamp
@@ -931,8 +1033,6 @@ bool Session::Impl::processTransactionAccepting(XBridgePacketPtr packet) const
         return true;
     }
 
-    double commonAmount = 0;
-
     // utxo items
     std::vector<wallet::UtxoEntry> utxoItems;
     {
@@ -972,33 +1072,62 @@ bool Session::Impl::processTransactionAccepting(XBridgePacketPtr packet) const
                                                          packet->data()+offset+XBridgePacket::signatureSize);
             offset += XBridgePacket::signatureSize;
 
-            if (!conn->getTxOut(entry))
-            {
-                LOG() << "not found utxo entry <" << entry.txId
-                      << "> no " << entry.vout << " " << __FUNCTION__;
-                continue;
-            }
+            utxoItems.push_back(entry);
+        }
+    }
 
-            // check signature
-            std::string signature = EncodeBase64(&entry.signature[0], entry.signature.size());
-            if (!conn->verifyMessage(entry.address, entry.toString(), signature))
-            {
-                LOG() << "not valid signature, bad utxo entry <" << entry.txId
-                      << "> no " << entry.vout << " " << __FUNCTION__;
-                continue;
-            }
+    OrderPacketPtr o(new OrderPacket);
+    o->id        = id;
+    o->saddr     = saddr;
+    o->scurrency = scurrency;
+    o->samount   = samount;
+    o->daddr     = daddr;
+    o->dcurrency = dcurrency;
+    o->damount   = damount;
+    o->timestamp = 0;
+    o->mpubkey   = mpubkey;
+    o->utxoItems = utxoItems;
+    o->sconn     = conn;
 
-            commonAmount += entry.amount;
+    // wallet calls of the checks run on the source connector
+    std::shared_ptr<const Impl> self = shared_from_this();
+    conn->post([self, o]()
+    {
+        self->acceptPendingTransaction(o);
+    });
 
-            utxoItems.push_back(entry);
-        }
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void Session::Impl::acceptPendingTransaction(const OrderPacketPtr & o) const
+{
+    Exchange & e = Exchange::instance();
+
+    const uint256 & id                         = o->id;
+    const std::vector<unsigned char> & saddr   = o->saddr;
+    const std::string & scurrency              = o->scurrency;
+    const uint64_t samount                     = o->samount;
+    const std::vector<unsigned char> & daddr   = o->daddr;
+    const std::string & dcurrency              = o->dcurrency;
+    const uint64_t damount                     = o->damount;
+    const std::vector<unsigned char> & mpubkey = o->mpubkey;
+    const WalletConnectorPtr & conn            = o->sconn;
+
+    double commonAmount = 0;
+
+    std::vector<wallet::UtxoEntry> utxoItems = o->utxoItems;
+    if (!checkUtxoEntries(conn, utxoItems, commonAmount))
+    {
+        return;
     }
 
     if (commonAmount * TransactionDescr::COIN < samount)
     {
         LOG() << "transaction rejected, amount from utxo items <" << commonAmount
               << "> less than required <" << samount << "> " << __FUNCTION__;
-        return true;
+        return;
     }
 
     // check dust amount
@@ -1006,7 +1135,7 @@ bool Session::Impl::processTransactionAccepting(XBridgePacketPtr packet) const
         conn->isDustAmount(commonAmount - (static_cast<double>(samount) / TransactionDescr::COIN)))
     {
         LOG() << "reject dust amount transaction " << id.ToString() << " " << __FUNCTION__;
-        return true;
+        return;
     }
 
     LOG() << "received accepting transaction " << id.ToString() << std::endl
@@ -1020,7 +1149,7 @@ bool Session::Impl::processTransactionAccepting(XBridgePacketPtr packet) const
     {
         LOG() << "error check utxo items, transaction accept request rejected "
               << __FUNCTION__;
-        return true;
+        return;
     }
 
     {
@@ -1038,7 +1167,7 @@ bool Session::Impl::processTransactionAccepting(XBridgePacketPtr packet) const
                 WARN() << "wrong tx state " << tr->id().ToString()
                        << " state " << tr->state()
                        << " in " << __FUNCTION__;
-                return true;
+                return;
             }
 
             LOG() << __FUNCTION__ << tr;
@@ -1056,8 +1185,6 @@ bool Session::Impl::processTransactionAccepting(XBridgePacketPtr packet) const
             sendPacketBroadcast(reply1);
         }
     }
-
-    return true;
 }
 
 //******************************************************************************
@@ -1190,6 +1317,7 @@ bool Session::Impl::processTransactionHold(XBridgePacketPtr packet) const
     }
 
     xtx->state = TransactionDescr::trHold;
+    xapp.updateOrderBook(xtx);
 
     LOG() << __FUNCTION__ << std::endl << "order holded" << xtx;
 
@@ -1641,6 +1769,65 @@ bool Session::Impl::isAddressInTransaction(const std::vector<unsigned char> & ad
     return false;
 }
 
+//******************************************************************************
+//******************************************************************************
+bool Session::Impl::checkUtxoEntries(const WalletConnectorPtr & conn,
+                                     std::vector<wallet::UtxoEntry> & items,
+                                     double & commonAmount) const
+{
+    commonAmount = 0;
+
+    std::vector<bool> found;
+    if (!conn->getTxOuts(items, found))
+    {
+        LOG() << "utxo entries request failed " << __FUNCTION__;
+        return false;
+    }
+
+    std::vector<wallet::UtxoEntry> foundItems;
+    std::vector<WalletConnector::MessageSignature> signatures;
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        const wallet::UtxoEntry & entry = items[i];
+        if (!found[i])
+        {
+            LOG() << "not found utxo entry <" << entry.txId
+                  << "> no " << entry.vout << " " << __FUNCTION__;
+            continue;
+        }
+
+        foundItems.push_back(entry);
+        signatures.emplace_back(entry.address, entry.toString(),
+                                EncodeBase64(&entry.signature[0], entry.signature.size()));
+    }
+
+    // check signatures
+    std::vector<bool> valid;
+    if (!conn->verifyMessages(signatures, valid))
+    {
+        LOG() << "utxo entries signature check failed " << __FUNCTION__;
+        return false;
+    }
+
+    items.clear();
+    for (size_t i = 0; i < foundItems.size(); ++i)
+    {
+        const wallet::UtxoEntry & entry = foundItems[i];
+        if (!valid[i])
+        {
+            LOG() << "not valid signature, bad utxo entry <" << entry.txId
+                  << "> no " << entry.vout << " " << __FUNCTION__;
+            continue;
+        }
+
+        commonAmount += entry.amount;
+
+        items.push_back(entry);
+    }
+
+    return true;
+}
+
 //******************************************************************************
 //******************************************************************************
 bool Session::Impl::processTransactionCreateA(XBridgePacketPtr packet) const
@@ -1716,184 +1903,21 @@ bool Session::Impl::processTransactionCreateA(XBridgePacketPtr packet) const
         return true;
     }
 
-    double outAmount = static_cast<double>(xtx->fromAmount) / TransactionDescr::COIN;
-
-    double fee1      = 0;
-    double fee2      = connFrom->minTxFee2(1, 1);
-    double inAmount  = 0;
-
-    std::vector<wallet::UtxoEntry> usedInTx;
-    for (const wallet::UtxoEntry & entry : xtx->usedCoins)
-    {
-        usedInTx.push_back(entry);
-        inAmount += entry.amount;
-        fee1 = connFrom->minTxFee1(usedInTx.size(), 3);
-
-        LOG() << "using utxo item, id: <" << entry.txId << "> amount: " << entry.amount << " vout: " << entry.vout;
-
-        // check amount
-        if (inAmount >= outAmount+fee1+fee2)
-        {
-            break;
-        }
-    }
-
-    LOG() << "fee1: " << fee1;
-    LOG() << "fee2: " << fee2;
-    LOG() << "amount of used utxo items: " << inAmount << " required amount + fees: " << outAmount + fee1 + fee2;
-
-    // check amount
-    if (inAmount < outAmount+fee1+fee2)
-    {
-        // no money, cancel transaction
-        LOG() << "no money, transaction canceled " << __FUNCTION__;
-        sendCancelTransaction(xtx, crNoMoney);
-        return true;
-    }
-
-    // lock time
-    xtx->lockTimeTx1 = connFrom->lockTime(xtx->role);
-    if (xtx->lockTimeTx1 == 0)
-    {
-        LOG() << "lockTime error, transaction canceled " << __FUNCTION__;
-        sendCancelTransaction(xtx, crRpcError);
-        return true;
-    }
-
-    // store opponent public key (packet verification)
-    xtx->oPubKey = mPubKey;
-
-    // create transactions
-
-    // hash of secret
-    std::vector<unsigned char> hx = connFrom->getKeyId(xtx->xPubKey);
-
-#ifdef LOG_KEYPAIR_VALUES
-    LOG() << "unlock script pub keys" << std::endl <<
-             "    my       " << HexStr(xtx->mPubKey) << std::endl <<
-             "    my id    " << HexStr(connFrom->getKeyId(xtx->mPubKey)) << std::endl <<
-             "    other    " << HexStr(mPubKey) << std::endl <<
-             "    other id " << HexStr(connFrom->getKeyId(mPubKey)) << std::endl <<
-             "    x id     " << HexStr(hx);
-#endif
-
-    // create address for first tx
-    connFrom->createDepositUnlockScript(xtx->mPubKey, mPubKey, hx, xtx->lockTimeTx1, xtx->innerScript);
-    xtx->depositP2SH = connFrom->scriptIdToString(connFrom->getScriptId(xtx->innerScript));
-
-    // depositTx
-    {
-        std::vector<xbridge::XTxIn>                  inputs;
-        std::vector<std::pair<std::string, double> > outputs;
-
-        // inputs
-        wallet::UtxoEntry largestUtxo;
-        for (const wallet::UtxoEntry & entry : usedInTx)
-        {
-            if (entry.amount > largestUtxo.amount)
-                largestUtxo = entry;
-            inputs.emplace_back(entry.txId, entry.vout, entry.amount);
-        }
-
-        // outputs
-
-        // amount
-        outputs.push_back(std::make_pair(xtx->depositP2SH, outAmount+fee2));
-
-        // rest
-        if (inAmount > outAmount+fee1+fee2)
-        {
-            double rest = inAmount-outAmount-fee1-fee2;
-            outputs.push_back(std::make_pair(largestUtxo.address, rest)); // change back to largest input used in order
-        }
-
-        if (!connFrom->createDepositTransaction(inputs, outputs, xtx->binTxId, xtx->binTx))
-        {
-            // cancel transaction
-            ERR() << "deposit not created, transaction canceled " << __FUNCTION__;
-            TXERR() << "deposit sendrawtransaction " << xtx->binTx;
-            sendCancelTransaction(xtx, crRpcError);
-            return true;
-        }
-
-        TXLOG() << "deposit sendrawtransaction " << xtx->binTx;
-
-    } // depositTx
-
-    // refundTx
-    {
-        std::vector<xbridge::XTxIn>                  inputs;
-        std::vector<std::pair<std::string, double> > outputs;
-
-        // inputs from binTx
-        inputs.emplace_back(xtx->binTxId, 0, outAmount+fee2);
-
-        // outputs
-        {
-            std::string addr;
-            if (!connFrom->getNewAddress(addr))
-            {
-                // cancel transaction
-                LOG() << "rpc error, transaction canceled " << __FUNCTION__;
-                sendCancelTransaction(xtx, crRpcError);
-                return true;
-            }
-
-            outputs.push_back(std::make_pair(addr, outAmount));
-        }
-
-        if (!connFrom->createRefundTransaction(inputs, outputs,
-                                               xtx->mPubKey, xtx->mPrivKey,
-                                               xtx->innerScript, xtx->lockTimeTx1,
-                                               xtx->refTxId, xtx->refTx))
-        {
-            // cancel transaction
-            ERR() << "refund transaction not created, transaction canceled " << __FUNCTION__;
-            TXERR() << "refund sendrawtransaction " << xtx->refTx;
-            sendCancelTransaction(xtx, crRpcError);
-            return true;
-        }
-
-        TXLOG() << "refund sendrawtransaction " << xtx->refTx;
-
-    } // refundTx
-
-    xtx->state = TransactionDescr::trCreated;
-
-    xuiConnector.NotifyXBridgeTransactionChanged(txid);
+    SwapStepPtr step(new SwapStep);
+    step->xtx         = xtx;
+    step->conn        = connFrom;
+    step->packet      = packet;
+    step->txid        = txid;
+    step->thisAddress = thisAddress;
+    step->hubAddress  = hubAddress;
+    step->mPubKey     = mPubKey;
 
-    // send transactions
+    // wallet calls of the deposit run on the source connector
+    std::shared_ptr<const Impl> self = shared_from_this();
+    connFrom->post([self, step]()
     {
-        std::string sentid;
-        int32_t errCode = 0;
-        std::string errorMessage;
-        if (connFrom->sendRawTransaction(xtx->binTx, sentid, errCode, errorMessage))
-        {
-            LOG() << "deposit " << xtx->role << " " << sentid;
-        }
-        else
-        {
-            LOG() << "deposit tx not send, transaction canceled " << __FUNCTION__;
-            sendCancelTransaction(xtx, crRpcError);
-            return true;
-        }
-    }
-
-    // send reply
-    XBridgePacketPtr reply;
-    reply.reset(new XBridgePacket(xbcTransactionCreatedA));
-
-    reply->append(hubAddress);
-    reply->append(thisAddress);
-    reply->append(txid.begin(), 32);
-    reply->append(xtx->binTxId);
-    reply->append(hx);
-    reply->append(static_cast<uint32_t>(xtx->innerScript.size()));
-    reply->append(xtx->innerScript);
-
-    reply->sign(xtx->mPubKey, xtx->mPrivKey);
-
-    sendPacket(hubAddress, reply);
+        self->createDeposit(step);
+    });
 
     return true;
 }
@@ -2087,31 +2111,79 @@ bool Session::Impl::processTransactionCreateB(XBridgePacketPtr packet) const
         return true;
     }
 
-    double outAmount = static_cast<double>(xtx->fromAmount) / TransactionDescr::COIN;
     double checkAmount = static_cast<double>(xtx->toAmount) / TransactionDescr::COIN;
 
     // TODO check A iner script
 
+    SwapStepPtr step(new SwapStep);
+    step->xtx         = xtx;
+    step->conn        = connFrom;
+    step->packet      = packet;
+    step->txid        = txid;
+    step->thisAddress = thisAddress;
+    step->hubAddress  = hubAddress;
+    step->mPubKey     = mPubKey;
+    step->hx          = hx;
+
+    // check A deposit tx on the destination connector,
+    // then create the deposit on the source connector
+    std::shared_ptr<const Impl> self = shared_from_this();
+    connTo->checkDepositTransactionAsync(binATxId, std::string(), checkAmount,
+                                         [self, step](const bool result, const double /*amount*/, const bool isGood)
+    {
+        xbridge::App & xapp = xbridge::App::instance();
+
+        if (step->xtx->state >= TransactionDescr::trCreated)
+        {
+            // cancelled while waiting
+            return;
+        }
 
-    // check A deposit tx
-    {
-        bool isGood = false;
-        if (!connTo->checkDepositTransaction(binATxId, std::string(), checkAmount, isGood))
+        if (!result)
         {
             // move packet to pending
-            xapp.processLater(txid, packet);
-            return true;
+            xapp.processLater(step->txid, step->packet);
+            return;
         }
         else if (!isGood)
         {
-            LOG() << "check A deposit tx error for " << txid.GetHex() << " " << __FUNCTION__;
-            sendCancelTransaction(xtx, crBadADepositTx);
-            return true;
+            LOG() << "check A deposit tx error for " << step->txid.GetHex();
+            self->sendCancelTransaction(step->xtx, crBadADepositTx);
+            return;
         }
 
-        LOG() << "deposit A tx confirmed " << txid.GetHex();
+        LOG() << "deposit A tx confirmed " << step->txid.GetHex();
+
+        step->conn->post([self, step]()
+        {
+            self->createDeposit(step);
+        });
+    });
+
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void Session::Impl::createDeposit(const SwapStepPtr & step) const
+{
+    const TransactionDescrPtr & xtx                = step->xtx;
+    const WalletConnectorPtr & connFrom            = step->conn;
+    const uint256 & txid                           = step->txid;
+    const std::vector<unsigned char> & mPubKey     = step->mPubKey;
+    const std::vector<unsigned char> & thisAddress = step->thisAddress;
+    const std::vector<unsigned char> & hubAddress  = step->hubAddress;
+
+    if (xtx->state >= TransactionDescr::trCreated)
+    {
+        // created for an earlier packet or cancelled while waiting
+        LOG() << "deposit " << xtx->role << " dropped, tx state " << xtx->strState()
+              << " " << txid.GetHex() << " " << __FUNCTION__;
+        return;
     }
 
+    double outAmount = static_cast<double>(xtx->fromAmount) / TransactionDescr::COIN;
+
     double fee1      = 0;
     double fee2      = connFrom->minTxFee2(1, 1);
     double inAmount  = 0;
@@ -2142,7 +2214,7 @@ bool Session::Impl::processTransactionCreateB(XBridgePacketPtr packet) const
         // no money, cancel transaction
         LOG() << "no money, transaction canceled " << __FUNCTION__;
         sendCancelTransaction(xtx, crNoMoney);
-        return true;
+        return;
     }
 
     // lock time
@@ -2151,7 +2223,7 @@ bool Session::Impl::processTransactionCreateB(XBridgePacketPtr packet) const
     {
         LOG() << "lockTime error, transaction canceled " << __FUNCTION__;
         sendCancelTransaction(xtx, crRpcError);
-        return true;
+        return;
     }
 
     // store opponent public key (packet verification)
@@ -2159,6 +2231,9 @@ bool Session::Impl::processTransactionCreateB(XBridgePacketPtr packet) const
 
     // create transactions
 
+    // hash of secret, of A from the packet
+    const std::vector<unsigned char> hx = xtx->role == 'A' ? connFrom->getKeyId(xtx->xPubKey) : step->hx;
+
 #ifdef LOG_KEYPAIR_VALUES
     LOG() << "unlock script pub keys" << std::endl <<
              "    my       " << HexStr(xtx->mPubKey) << std::endl <<
@@ -2204,7 +2279,7 @@ bool Session::Impl::processTransactionCreateB(XBridgePacketPtr packet) const
             ERR() << "deposit not created, transaction canceled " << __FUNCTION__;
             TXERR() << "deposit sendrawtransaction " << xtx->binTx;
             sendCancelTransaction(xtx, crRpcError);
-            return true;
+            return;
         }
 
         TXLOG() << "deposit sendrawtransaction " << xtx->binTx;
@@ -2227,7 +2302,7 @@ bool Session::Impl::processTransactionCreateB(XBridgePacketPtr packet) const
                 // cancel transaction
                 LOG() << "rpc error, transaction canceled " << __FUNCTION__;
                 sendCancelTransaction(xtx, crRpcError);
-                return true;
+                return;
             }
 
             outputs.push_back(std::make_pair(addr, outAmount));
@@ -2242,7 +2317,7 @@ bool Session::Impl::processTransactionCreateB(XBridgePacketPtr packet) const
             ERR() << "refund transaction not created, transaction canceled " << __FUNCTION__;
             TXERR() << "refund sendrawtransaction " << xtx->refTx;
             sendCancelTransaction(xtx, crRpcError);
-            return true;
+            return;
         }
 
         TXLOG() << "refund sendrawtransaction " << xtx->refTx;
@@ -2266,26 +2341,28 @@ bool Session::Impl::processTransactionCreateB(XBridgePacketPtr packet) const
         {
             LOG() << "deposit tx not send, transaction canceled " << __FUNCTION__;
             sendCancelTransaction(xtx, crRpcError);
-            return true;
+            return;
         }
     }
 
     // send reply
     XBridgePacketPtr reply;
-    reply.reset(new XBridgePacket(xbcTransactionCreatedB));
+    reply.reset(new XBridgePacket(xtx->role == 'A' ? xbcTransactionCreatedA : xbcTransactionCreatedB));
 
     reply->append(hubAddress);
     reply->append(thisAddress);
     reply->append(txid.begin(), 32);
     reply->append(xtx->binTxId);
+    if (xtx->role == 'A')
+    {
+        reply->append(hx);
+    }
     reply->append(static_cast<uint32_t>(xtx->innerScript.size()));
     reply->append(xtx->innerScript);
 
     reply->sign(xtx->mPubKey, xtx->mPrivKey);
 
     sendPacket(hubAddress, reply);
-
-    return true;
 }
 
 //*****************************************************************************
@@ -2453,97 +2530,23 @@ bool Session::Impl::processTransactionConfirmA(XBridgePacketPtr packet) const
         return true;
     }
 
-    double outAmount   = static_cast<double>(xtx->toAmount)/TransactionDescr::COIN;
-    double checkAmount = outAmount;
+    SwapStepPtr step(new SwapStep);
+    step->xtx         = xtx;
+    step->conn        = conn;
+    step->packet      = packet;
+    step->txid        = txid;
+    step->thisAddress = thisAddress;
+    step->hubAddress  = hubAddress;
+    step->binTxId     = binTxId;
+    step->xPubKey     = xtx->xPubKey;
+    step->innerScript = innerScript;
 
-    // check B deposit tx
+    // wallet calls of the payment run on the destination connector
+    std::shared_ptr<const Impl> self = shared_from_this();
+    conn->post([self, step]()
     {
-        // TODO check tx in blockchain and move packet to pending if not
-
-        bool   isGood      = false;
-        if (!conn->checkDepositTransaction(binTxId, std::string(), checkAmount, isGood))
-        {
-            xapp.processLater(txid, packet);
-            return true;
-        }
-        else if (!isGood)
-        {
-            LOG() << "check B deposit tx error for " << txid.GetHex() << " " << __FUNCTION__;
-            sendCancelTransaction(xtx, crBadBDepositTx);
-            return true;
-        }
-
-        LOG() << "deposit B tx confirmed " << txid.GetHex();
-    }
-
-    // payTx
-    {
-        std::vector<xbridge::XTxIn>                  inputs;
-        std::vector<std::pair<std::string, double> > outputs;
-
-        // inputs from binTx
-        inputs.emplace_back(binTxId, 0, checkAmount);
-
-        // outputs
-        {
-            outputs.push_back(std::make_pair(conn->fromXAddr(xtx->to), outAmount));
-        }
-
-        if (!conn->createPaymentTransaction(inputs, outputs,
-                                            xtx->mPubKey, xtx->mPrivKey,
-                                            xtx->xPubKey, innerScript,
-                                            xtx->payTxId, xtx->payTx))
-        {
-            // cancel transaction
-            ERR() << "payment transaction create error, transaction canceled " << __FUNCTION__;
-            TXERR() << "payment A sendrawtransaction " << xtx->payTx;
-            sendCancelTransaction(xtx, crRpcError);
-            return true;
-        }
-
-        TXLOG() << "payment A sendrawtransaction " << xtx->payTx;
-
-    } // payTx
-
-    // send pay tx
-    std::string sentid;
-    int32_t errCode = 0;
-    std::string errorMessage;
-    if (conn->sendRawTransaction(xtx->payTx, sentid, errCode, errorMessage))
-    {
-        LOG() << "payment A " << sentid;
-    }
-    else
-    {
-        if (errCode == -25)
-        {
-            // missing inputs, wait deposit tx
-            LOG() << "payment A not sent, no deposit tx, move to pending";
-
-            xapp.processLater(txid, packet);
-            return true;
-        }
-
-        LOG() << "payment A tx not sent, transaction canceled " << __FUNCTION__;
-        sendCancelTransaction(xtx, crRpcError);
-        return true;
-    }
-
-    xtx->state = TransactionDescr::trCommited;
-    xuiConnector.NotifyXBridgeTransactionChanged(txid);
-
-    // LOG() << __FUNCTION__ << xtx;
-
-    // send reply
-    XBridgePacketPtr reply(new XBridgePacket(xbcTransactionConfirmedA));
-    reply->append(hubAddress);
-    reply->append(thisAddress);
-    reply->append(txid.begin(), 32);
-    reply->append(xtx->xPubKey);
-
-    reply->sign(xtx->mPubKey, xtx->mPrivKey);
-
-    sendPacket(hubAddress, reply);
+        self->sendPayment(step);
+    });
 
     return true;
 }
@@ -2705,26 +2708,86 @@ bool Session::Impl::processTransactionConfirmB(XBridgePacketPtr packet) const
         return true;
     }
 
-    // payTx
+    SwapStepPtr step(new SwapStep);
+    step->xtx         = xtx;
+    step->conn        = conn;
+    step->packet      = packet;
+    step->txid        = txid;
+    step->thisAddress = thisAddress;
+    step->hubAddress  = hubAddress;
+    step->binTxId     = binTxId;
+    step->xPubKey     = x;
+    step->innerScript = innerScript;
+
+    // wallet calls of the payment run on the destination connector
+    std::shared_ptr<const Impl> self = shared_from_this();
+    conn->post([self, step]()
+    {
+        self->sendPayment(step);
+    });
+
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void Session::Impl::sendPayment(const SwapStepPtr & step) const
+{
+    xbridge::App & xapp = xbridge::App::instance();
+    const TransactionDescrPtr & xtx = step->xtx;
+    const WalletConnectorPtr & conn = step->conn;
+    const uint256 & txid            = step->txid;
+
+    if (xtx->state >= TransactionDescr::trCommited)
     {
-        double outAmount   = static_cast<double>(xtx->toAmount)/TransactionDescr::COIN;
-        double checkAmount = outAmount;
+        // paid for an earlier packet or cancelled while waiting
+        LOG() << "payment " << xtx->role << " dropped, tx state " << xtx->strState()
+              << " " << txid.GetHex() << " " << __FUNCTION__;
+        return;
+    }
+
+    double outAmount   = static_cast<double>(xtx->toAmount)/TransactionDescr::COIN;
+    double checkAmount = outAmount;
+
+    // check deposit tx of the counterparty
+    {
+        // TODO check tx in blockchain and move packet to pending if not
 
         bool isGood = false;
-        if (!conn->checkDepositTransaction(binTxId, std::string(), checkAmount, isGood) || !isGood)
+        bool result = conn->checkDepositTransaction(step->binTxId, std::string(), checkAmount, isGood);
+        if (xtx->role == 'A')
+        {
+            if (!result)
+            {
+                xapp.processLater(txid, step->packet);
+                return;
+            }
+            else if (!isGood)
+            {
+                LOG() << "check B deposit tx error for " << txid.GetHex() << " " << __FUNCTION__;
+                sendCancelTransaction(xtx, crBadBDepositTx);
+                return;
+            }
+
+            LOG() << "deposit B tx confirmed " << txid.GetHex();
+        }
+        else if (!result || !isGood)
         {
             // oops....shit happens, alert needed
             // this tx already checked before deposit created
-            WARN() << "deposit not found " << binTxId << " " << __FUNCTION__;
+            WARN() << "deposit not found " << step->binTxId << " " << __FUNCTION__;
             sendCancelTransaction(xtx, crBadADepositTx);
-            return true;
+            return;
         }
+    }
 
+    // payTx
+    {
         std::vector<xbridge::XTxIn>                  inputs;
         std::vector<std::pair<std::string, double> > outputs;
 
         // inputs from binTx
-        inputs.emplace_back(binTxId, 0, checkAmount);
+        inputs.emplace_back(step->binTxId, 0, checkAmount);
 
         // outputs
         {
@@ -2733,17 +2796,17 @@ bool Session::Impl::processTransactionConfirmB(XBridgePacketPtr packet) const
 
         if (!conn->createPaymentTransaction(inputs, outputs,
                                             xtx->mPubKey, xtx->mPrivKey,
-                                            x, innerScript,
+                                            step->xPubKey, step->innerScript,
                                             xtx->payTxId, xtx->payTx))
         {
             // cancel transaction
             ERR() << "payment transaction create error, transaction canceled " << __FUNCTION__;
-            TXERR() << "payment B sendrawtransaction " << xtx->payTx;
+            TXERR() << "payment " << xtx->role << " sendrawtransaction " << xtx->payTx;
             sendCancelTransaction(xtx, crRpcError);
-            return true;
+            return;
         }
 
-        TXLOG() << "payment B sendrawtransaction " << xtx->payTx;
+        TXLOG() << "payment " << xtx->role << " sendrawtransaction " << xtx->payTx;
 
     } // payTx
 
@@ -2753,41 +2816,40 @@ bool Session::Impl::processTransactionConfirmB(XBridgePacketPtr packet) const
     std::string errorMessage;
     if (conn->sendRawTransaction(xtx->payTx, sentid, errCode, errorMessage))
     {
-        LOG() << "payment B " << sentid;
+        LOG() << "payment " << xtx->role << " " << sentid;
     }
     else
     {
         if (errCode == -25)
         {
             // missing inputs, wait deposit tx
-            // move packet to pending
-            LOG() << "payment B not sent, no deposit tx, move to pending";
+            LOG() << "payment " << xtx->role << " not sent, no deposit tx, move to pending";
 
-            xapp.processLater(txid, packet);
-            return true;
+            xapp.processLater(txid, step->packet);
+            return;
         }
 
-        LOG() << "payment B tx not sent, transaction canceled " << __FUNCTION__;
+        LOG() << "payment " << xtx->role << " tx not sent, transaction canceled " << __FUNCTION__;
         sendCancelTransaction(xtx, crRpcError);
-        return true;
+        return;
     }
 
     xtx->state = TransactionDescr::trCommited;
     xuiConnector.NotifyXBridgeTransactionChanged(txid);
 
-    // LOG() << __FUNCTION__ << xtx;
-
     // send reply
-    XBridgePacketPtr reply(new XBridgePacket(xbcTransactionConfirmedB));
-    reply->append(hubAddress);
-    reply->append(thisAddress);
+    XBridgePacketPtr reply(new XBridgePacket(xtx->role == 'A' ? xbcTransactionConfirmedA : xbcTransactionConfirmedB));
+    reply->append(step->hubAddress);
+    reply->append(step->thisAddress);
     reply->append(txid.begin(), 32);
+    if (xtx->role == 'A')
+    {
+        reply->append(xtx->xPubKey);
+    }
 
     reply->sign(xtx->mPubKey, xtx->mPrivKey);
 
-    sendPacket(hubAddress, reply);
-
-    return true;
+    sendPacket(step->hubAddress, reply);
 }
 
 //*****************************************************************************
@@ -2958,7 +3020,36 @@ bool Session::Impl::processTransactionCancel(XBridgePacketPtr packet) const
         return true;
     }
 
-    // Process rollback
+    // Process rollback, wallet calls run on the source connector
+    SwapStepPtr step(new SwapStep);
+    step->xtx    = xtx;
+    step->conn   = conn;
+    step->packet = packet;
+    step->txid   = txid;
+
+    std::shared_ptr<const Impl> self = shared_from_this();
+    conn->post([self, step]()
+    {
+        self->sendRefund(step);
+    });
+
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void Session::Impl::sendRefund(const SwapStepPtr & step) const
+{
+    xbridge::App & xapp = xbridge::App::instance();
+    const TransactionDescrPtr & xtx = step->xtx;
+    const WalletConnectorPtr & conn = step->conn;
+    const uint256 & txid            = step->txid;
+
+    if (xtx->state == TransactionDescr::trRollback)
+    {
+        // sent for an earlier cancel packet
+        return;
+    }
 
     std::string sid;
     int32_t errCode = 0;
@@ -2970,7 +3061,7 @@ bool Session::Impl::processTransactionCancel(XBridgePacketPtr packet) const
     if(infoRecieved && info.blocks < xtx->lockTimeTx1)
     {
         LOG() << "waiting for loctime expiration before refund tx " << txid.GetHex() << " " << __FUNCTION__;
-        xapp.processLater(txid, packet);
+        xapp.processLater(txid, step->packet);
     }
     else
     {
@@ -2982,7 +3073,7 @@ bool Session::Impl::processTransactionCancel(XBridgePacketPtr packet) const
             // TODO move packet to pending if error
             LOG() << "send rollback error, tx " << txid.GetHex() << " " << __FUNCTION__;
             xtx->state = TransactionDescr::trRollbackFailed;
-            xapp.processLater(txid, packet);
+            xapp.processLater(txid, step->packet);
         }
         else
         {
@@ -2994,8 +3085,6 @@ bool Session::Impl::processTransactionCancel(XBridgePacketPtr packet) const
 
     // update transaction state for gui
     xuiConnector.NotifyXBridgeTransactionChanged(txid);
-
-    return true;
 }
 
 //*****************************************************************************
@@ -3068,6 +3157,7 @@ bool Session::Impl::sendCancelTransaction(const TransactionDescrPtr & tx,
     // update transaction state for gui
     tx->state  = TransactionDescr::trCancelled;
     tx->reason = reason;
+    App::instance().updateOrderBook(tx);
     xuiConnector.NotifyXBridgeTransactionChanged(tx->id);
 
     return true;
@@ -3075,39 +3165,30 @@ bool Session::Impl::sendCancelTransaction(const TransactionDescrPtr & tx,
 
 //*****************************************************************************
 //*****************************************************************************
-void Session::sendListOfTransactions() const
+void Session::sendListOfTransactions(const std::vector<TransactionDescrPtr> & orders,
+                                     const std::vector<TransactionPtr> & exchangeOrders) const
 {
     xbridge::App & xapp = xbridge::App::instance();
 
     // send my trx
-    // TODO maybe move this to app?
-    std::map<uint256, xbridge::TransactionDescrPtr> transactions = xapp.transactions();
-    if (transactions.size())
+    for (const TransactionDescrPtr & ptr : orders)
     {
-        // send pending transactions
-        for (const auto & i : transactions)
+        if (ptr->state == xbridge::TransactionDescr::trNew ||
+            ptr->state == xbridge::TransactionDescr::trPending)
         {
-            if (i.second->state == xbridge::TransactionDescr::trNew ||
-                i.second->state == xbridge::TransactionDescr::trPending)
-            {
-                xapp.sendPendingTransaction(i.second);
-            }
+            xapp.sendPendingTransaction(ptr);
         }
     }
 
     // send exchange trx
     Exchange & e = Exchange::instance();
-    if (!e.isStarted())
+    if (exchangeOrders.empty() || !e.isStarted())
     {
         return;
     }
 
-    std::list<TransactionPtr> list = e.pendingTransactions();
-    std::list<TransactionPtr>::iterator i = list.begin();
-    for (; i != list.end(); ++i)
+    for (const TransactionPtr & ptr : exchangeOrders)
     {
-        TransactionPtr & ptr = *i;
-
         LOCK(ptr->m_lock);
 
         XBridgePacketPtr packet(new XBridgePacket(xbcPendingTransaction));
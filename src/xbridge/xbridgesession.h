@@ -60,6 +60,13 @@ public:
      * @return true, packet version == current xbridge protocol version
      */
     static bool checkXBridgePacketVersion(const std::vector<unsigned char> & message);
+    /**
+     * @brief checkXBridgePacketVersion - equal packet version with current xbridge protocol version
+     * @param message - data
+     * @param size - size of data
+     * @return true, packet version == current xbridge protocol version
+     */
+    static bool checkXBridgePacketVersion(const unsigned char * message, const size_t size);
     /**
      * @brief checkXBridgePacketVersion - equal packet version with current xbridge protocol version
      * @param packet - data
@@ -75,7 +82,14 @@ public:
 
 public:
     // service functions
-    void sendListOfTransactions() const;
+    /**
+     * @brief sendListOfTransactions - rebroadcast pending orders,
+     * the lists are split in slices signed on different threads
+     * @param orders - slice of own orders, new and pending are sent
+     * @param exchangeOrders - slice of pending orders of the exchange
+     */
+    void sendListOfTransactions(const std::vector<TransactionDescrPtr> & orders,
+                                const std::vector<TransactionPtr> & exchangeOrders) const;
     void checkFinishedTransactions() const;
     void eraseExpiredPendingTransactions() const;
     void getAddressBook() const;
@@ -85,7 +99,8 @@ private:
     void setNotWorking() { m_isWorking = false; }
 
 private:
-    std::unique_ptr<Impl> m_p;
+    // shared with pending wallet calls of the packet handlers
+    std::shared_ptr<Impl> m_p;
     bool m_isWorking;
 };
 
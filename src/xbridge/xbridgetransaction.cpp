@@ -11,6 +11,8 @@
 #include "main.h"
 #include "sync.h"
 
+#include <algorithm>
+
 #include <boost/date_time/posix_time/conversion.hpp>
 
 //******************************************************************************
@@ -238,6 +240,19 @@ bool Transaction::isExpired() const
     return false;
 }
 
+//*****************************************************************************
+//*****************************************************************************
+boost::posix_time::ptime Transaction::expirationTime() const
+{
+    if (m_state == trNew)
+    {
+        return std::min(m_created + boost::posix_time::seconds(static_cast<long>(deadlineTTL)),
+                        m_last + boost::posix_time::seconds(static_cast<long>(pendingTTL)));
+    }
+
+    return m_last + boost::posix_time::seconds(static_cast<long>(TTL));
+}
+
 //*****************************************************************************
 //*****************************************************************************
 bool Transaction::isExpiredByBlockNumber() const
@@ -134,6 +134,11 @@ public:
      */
     bool isExpired() const;
     bool isExpiredByBlockNumber() const;
+    /**
+     * @brief expirationTime
+     * @return time after which isExpired is true unless timestamp is updated
+     */
+    boost::posix_time::ptime expirationTime() const;
 
     /**
      * @brief cancel - set transaction state to trCancelled
@@ -0,0 +1,269 @@
+//*****************************************************************************
+//*****************************************************************************
+
+#include "xbridgeutxoreservations.h"
+#include "random.h"
+#include "utilstrencodings.h"
+
+#include <algorithm>
+#include <memory>
+
+//*****************************************************************************
+//*****************************************************************************
+namespace xbridge
+{
+
+//*****************************************************************************
+//*****************************************************************************
+UtxoReservations::Outpoint::Outpoint(const wallet::UtxoEntry & entry)
+    : txid(uint256S(entry.txId.c_str()))
+    , vout(entry.vout)
+{
+}
+
+//*****************************************************************************
+//*****************************************************************************
+UtxoReservations::UtxoReservations()
+{
+    // txids come from order makers, salt keeps buckets unpredictable
+    m_outpointHasher.salt = GetRandHash();
+    m_idHasher.salt       = GetRandHash();
+
+    for (OutpointShard & s : m_outpoints)
+    {
+        s.items = OutpointMap(0, m_outpointHasher);
+    }
+    for (OrderShard & s : m_orders)
+    {
+        s.orders = OrderMap(0, m_idHasher);
+    }
+}
+
+//*****************************************************************************
+//*****************************************************************************
+size_t UtxoReservations::shardIndex(const Outpoint & o) const
+{
+    // high bits, low bits select the bucket inside the shard
+    return (m_outpointHasher.hash(o) >> 48) % shardCount;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+UtxoReservations::OutpointShard & UtxoReservations::shard(const Outpoint & o)
+{
+    return m_outpoints[shardIndex(o)];
+}
+
+//*****************************************************************************
+//*****************************************************************************
+const UtxoReservations::OutpointShard & UtxoReservations::shard(const Outpoint & o) const
+{
+    return m_outpoints[shardIndex(o)];
+}
+
+//*****************************************************************************
+//*****************************************************************************
+UtxoReservations::OrderShard & UtxoReservations::shard(const uint256 & orderId)
+{
+    return m_orders[(m_idHasher.hash(orderId) >> 48) % shardCount];
+}
+
+//*****************************************************************************
+//*****************************************************************************
+const UtxoReservations::OrderShard & UtxoReservations::shard(const uint256 & orderId) const
+{
+    return m_orders[(m_idHasher.hash(orderId) >> 48) % shardCount];
+}
+
+//*****************************************************************************
+//*****************************************************************************
+bool UtxoReservations::has(const uint256 & orderId) const
+{
+    const OrderShard & s = shard(orderId);
+    LOCK(s.lock);
+    return s.orders.count(orderId) > 0;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+bool UtxoReservations::isReserved(const Outpoint & outpoint) const
+{
+    const OutpointShard & s = shard(outpoint);
+    LOCK(s.lock);
+    return s.items.count(outpoint) > 0;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+// static
+bool UtxoReservations::isValid(const wallet::UtxoEntry & entry)
+{
+    // uint256S takes short or malformed hex silently,
+    // different strings must not map to one key
+    return entry.txId.size() == 64 && IsHex(entry.txId);
+}
+
+//*****************************************************************************
+//*****************************************************************************
+bool UtxoReservations::reserve(const uint256 & orderId,
+                               const std::vector<wallet::UtxoEntry> & items,
+                               std::vector<wallet::UtxoEntry> * added)
+{
+    if (items.empty())
+    {
+        return false;
+    }
+
+    std::vector<size_t> shards;
+    for (const wallet::UtxoEntry & item : items)
+    {
+        if (!isValid(item))
+        {
+            return false;
+        }
+        shards.push_back(shardIndex(Outpoint(item)));
+    }
+
+    OrderShard & os = shard(orderId);
+    LOCK(os.lock);
+
+    // hold the shards of all items while checking and reserving,
+    // so two orders can't both pass the check for one utxo
+    std::sort(shards.begin(), shards.end());
+    shards.erase(std::unique(shards.begin(), shards.end()), shards.end());
+
+    std::vector<std::unique_ptr<CCriticalBlock> > locks;
+    for (const size_t i : shards)
+    {
+        locks.emplace_back(new CCriticalBlock(m_outpoints[i].lock, "m_outpoints", __FILE__, __LINE__));
+    }
+
+    for (const wallet::UtxoEntry & item : items)
+    {
+        const Outpoint o(item);
+        OutpointMap::const_iterator i = shard(o).items.find(o);
+        if (i != shard(o).items.end() && i->second.orderId != orderId)
+        {
+            // held by another order
+            return false;
+        }
+    }
+
+    // items of 'A' and 'B' roles are reserved under the same id
+    std::vector<wallet::UtxoEntry> & reserved = os.orders[orderId];
+    for (const wallet::UtxoEntry & item : items)
+    {
+        const Outpoint o(item);
+        OutpointMap & outpoints = shard(o).items;
+        if (outpoints.count(o))
+        {
+            continue;
+        }
+
+        Reservation & r = outpoints[o];
+        r.orderId = orderId;
+        r.entry   = item;
+
+        reserved.push_back(item);
+        if (added)
+        {
+            added->push_back(item);
+        }
+    }
+
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+bool UtxoReservations::release(const uint256 & orderId)
+{
+    OrderShard & os = shard(orderId);
+    LOCK(os.lock);
+
+    OrderMap::iterator it = os.orders.find(orderId);
+    if (it == os.orders.end())
+    {
+        return false;
+    }
+
+    for (const wallet::UtxoEntry & item : it->second)
+    {
+        const Outpoint o(item);
+        OutpointShard & s = shard(o);
+        LOCK(s.lock);
+        s.items.erase(o);
+    }
+
+    os.orders.erase(it);
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+bool UtxoReservations::release(const uint256 & orderId, const std::vector<wallet::UtxoEntry> & items)
+{
+    OrderShard & os = shard(orderId);
+    LOCK(os.lock);
+
+    OrderMap::iterator it = os.orders.find(orderId);
+    if (it == os.orders.end())
+    {
+        return false;
+    }
+
+    std::vector<wallet::UtxoEntry> & reserved = it->second;
+    for (const wallet::UtxoEntry & item : items)
+    {
+        std::vector<wallet::UtxoEntry>::iterator i = std::find(reserved.begin(), reserved.end(), item);
+        if (i == reserved.end())
+        {
+            continue;
+        }
+        reserved.erase(i);
+
+        const Outpoint o(item);
+        OutpointShard & s = shard(o);
+        LOCK(s.lock);
+        s.items.erase(o);
+    }
+
+    if (reserved.empty())
+    {
+        os.orders.erase(it);
+    }
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+bool UtxoReservations::items(const uint256 & orderId, std::vector<wallet::UtxoEntry> & items) const
+{
+    const OrderShard & os = shard(orderId);
+    LOCK(os.lock);
+
+    OrderMap::const_iterator it = os.orders.find(orderId);
+    if (it == os.orders.end())
+    {
+        return false;
+    }
+
+    items.insert(items.end(), it->second.begin(), it->second.end());
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+void UtxoReservations::all(std::vector<wallet::UtxoEntry> & items) const
+{
+    for (const OutpointShard & s : m_outpoints)
+    {
+        LOCK(s.lock);
+        for (const auto & i : s.items)
+        {
+            items.push_back(i.second.entry);
+        }
+    }
+}
+
+} // namespace xbridge
@@ -0,0 +1,185 @@
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef XBRIDGEUTXORESERVATIONS_H
+#define XBRIDGEUTXORESERVATIONS_H
+
+#include "uint256.h"
+#include "xbridgewallet.h"
+#include "sync.h"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+//*****************************************************************************
+//*****************************************************************************
+namespace xbridge
+{
+
+//*****************************************************************************
+//*****************************************************************************
+/**
+ * @brief The UtxoReservations class - utxo's locked by orders of the exchange,
+ * hashed by binary (txid, vout) with a reverse index by order id.
+ * Both tables are split in shards with own locks, so checks of
+ * different orders don't wait for each other. Thread safe.
+ */
+class UtxoReservations
+{
+public:
+    /**
+     * @brief The Outpoint struct - binary key of utxo
+     */
+    struct Outpoint
+    {
+        uint256  txid;
+        uint32_t vout;
+
+        Outpoint() : vout(0) {}
+        explicit Outpoint(const wallet::UtxoEntry & entry);
+
+        bool operator == (const Outpoint & other) const
+        {
+            return vout == other.vout && txid == other.txid;
+        }
+    };
+
+public:
+    UtxoReservations();
+
+    /**
+     * @brief has
+     * @param orderId - id of order
+     * @return true, if order has reserved utxo's
+     */
+    bool has(const uint256 & orderId) const;
+
+    /**
+     * @brief isReserved
+     * @param outpoint - utxo
+     * @return true, if utxo is reserved by any order
+     */
+    bool isReserved(const Outpoint & outpoint) const;
+
+    /**
+     * @brief isValid
+     * @param entry - utxo
+     * @return true, if txid of utxo is 64 hex chars
+     */
+    static bool isValid(const wallet::UtxoEntry & entry);
+
+    /**
+     * @brief reserve - check and reserve utxo's for order in one step,
+     * items already reserved for the order are skipped (items of
+     * 'A' and 'B' roles are reserved under the same id)
+     * @param orderId - id of order
+     * @param items - utxo's
+     * @param added - if not null, items reserved by this call, appended
+     * @return true, if items is not empty, all items are valid and
+     * no item is reserved by another order, nothing is reserved otherwise
+     */
+    bool reserve(const uint256 & orderId, const std::vector<wallet::UtxoEntry> & items,
+                 std::vector<wallet::UtxoEntry> * added = nullptr);
+
+    /**
+     * @brief release - release utxo's of order
+     * @param orderId - id of order
+     * @return true, if order had reserved utxo's
+     */
+    bool release(const uint256 & orderId);
+
+    /**
+     * @brief release - release some utxo's of order
+     * @param orderId - id of order
+     * @param items - utxo's to release, items not reserved
+     * for the order are skipped
+     * @return true, if order had reserved utxo's
+     */
+    bool release(const uint256 & orderId, const std::vector<wallet::UtxoEntry> & items);
+
+    /**
+     * @brief items - utxo's reserved for order
+     * @param orderId - id of order
+     * @param items - list of utxo's, appended
+     * @return true, if order has reserved utxo's
+     */
+    bool items(const uint256 & orderId, std::vector<wallet::UtxoEntry> & items) const;
+
+    /**
+     * @brief all - utxo's reserved by all orders
+     * @param items - list of utxo's, appended
+     */
+    void all(std::vector<wallet::UtxoEntry> & items) const;
+
+private:
+    struct OutpointHasher
+    {
+        uint256 salt;
+        uint64_t hash(const Outpoint & o) const
+        {
+            return o.txid.GetHash(salt) ^ (static_cast<uint64_t>(o.vout) * 0x9e3779b97f4a7c15ULL);
+        }
+        size_t operator()(const Outpoint & o) const
+        {
+            return static_cast<size_t>(hash(o));
+        }
+    };
+
+    struct IdHasher
+    {
+        uint256 salt;
+        uint64_t hash(const uint256 & id) const
+        {
+            return id.GetHash(salt);
+        }
+        size_t operator()(const uint256 & id) const
+        {
+            return static_cast<size_t>(hash(id));
+        }
+    };
+
+    struct Reservation
+    {
+        uint256           orderId;
+        wallet::UtxoEntry entry;
+    };
+
+    typedef std::unordered_map<Outpoint, Reservation, OutpointHasher> OutpointMap;
+    typedef std::unordered_map<uint256, std::vector<wallet::UtxoEntry>, IdHasher> OrderMap;
+
+    struct OutpointShard
+    {
+        mutable CCriticalSection lock;
+        OutpointMap              items;
+    };
+
+    struct OrderShard
+    {
+        mutable CCriticalSection lock;
+        OrderMap                 orders;
+    };
+
+    enum
+    {
+        shardCount = 16
+    };
+
+    size_t shardIndex(const Outpoint & o) const;
+    OutpointShard & shard(const Outpoint & o);
+    const OutpointShard & shard(const Outpoint & o) const;
+    OrderShard & shard(const uint256 & orderId);
+    const OrderShard & shard(const uint256 & orderId) const;
+
+private:
+    // lock order is order shard then outpoint shards by index
+    OutpointHasher                           m_outpointHasher;
+    IdHasher                                 m_idHasher;
+    std::array<OutpointShard, shardCount>    m_outpoints;
+    std::array<OrderShard, shardCount>       m_orders;
+};
+
+} // namespace xbridge
+
+#endif // XBRIDGEUTXORESERVATIONS_H
@@ -4,6 +4,7 @@
 #include "xbridgewalletconnector.h"
 #include "xbridgetransactiondescr.h"
 #include "base58.h"
+#include "util.h"
 
 //*****************************************************************************
 //*****************************************************************************
@@ -29,9 +30,20 @@ std::string UtxoEntry::toString() const
 //*****************************************************************************
 //*****************************************************************************
 WalletConnector::WalletConnector()
+    : m_serviceStopped(false)
+    , m_unspentTime(0)
+    , m_unspentValid(false)
+    , m_unspentGeneration(0)
 {
 }
 
+//*****************************************************************************
+//*****************************************************************************
+WalletConnector::~WalletConnector()
+{
+    stopService();
+}
+
 //******************************************************************************
 //******************************************************************************
 
@@ -46,9 +58,9 @@ WalletConnector::WalletConnector()
 double WalletConnector::getWalletBalance(const std::string & addr) const
 {
     std::vector<wallet::UtxoEntry> entries;
-    if (!getUnspent(entries))
+    if (!getCachedUnspent(entries))
     {
-        LOG() << "getUnspent failed " << __FUNCTION__;
+        LOG() << "getCachedUnspent failed " << __FUNCTION__;
         return -1.;//return negative value for check in called methods
     }
 
@@ -66,6 +78,71 @@ double WalletConnector::getWalletBalance(const std::string & addr) const
     return amount;
 }
 
+//******************************************************************************
+//******************************************************************************
+bool WalletConnector::getCachedUnspent(std::vector<wallet::UtxoEntry> & inputs,
+                                       const bool withLocked) const
+{
+    const int64_t maxAge = GetArg("-xbridgeutxocachetime", 60);
+
+    std::string state;
+    const bool haveState = maxAge > 0 && getWalletState(state);
+
+    uint64_t generation = 0;
+    {
+        LOCK(m_unspentLocker);
+
+        if (haveState && m_unspentValid && m_unspentState == state &&
+            GetTime() - m_unspentTime < maxAge)
+        {
+            inputs = m_unspent;
+            if (!withLocked)
+            {
+                removeLocked(inputs);
+            }
+            return true;
+        }
+
+        generation = m_unspentGeneration;
+    }
+
+    std::vector<wallet::UtxoEntry> entries;
+    if (!getUnspent(entries, true))
+    {
+        invalidateUnspent();
+        return false;
+    }
+
+    if (haveState)
+    {
+        LOCK(m_unspentLocker);
+        if (generation == m_unspentGeneration)
+        {
+            m_unspent      = entries;
+            m_unspentState = state;
+            m_unspentTime  = GetTime();
+            m_unspentValid = true;
+        }
+    }
+
+    inputs.swap(entries);
+    if (!withLocked)
+    {
+        removeLocked(inputs);
+    }
+    return true;
+}
+
+//******************************************************************************
+//******************************************************************************
+void WalletConnector::invalidateUnspent() const
+{
+    LOCK(m_unspentLocker);
+    m_unspentValid = false;
+    m_unspent.clear();
+    ++m_unspentGeneration;
+}
+
 //******************************************************************************
 //******************************************************************************
 bool WalletConnector::lockCoins(const std::vector<wallet::UtxoEntry> & inputs,
@@ -79,6 +156,9 @@ bool WalletConnector::lockCoins(const std::vector<wallet::UtxoEntry> & inputs,
         {
             lockedCoins.erase(entry);
         }
+
+        // released coins may have been spent by the order
+        invalidateUnspent();
     }
     else
     {
@@ -97,6 +177,34 @@ bool WalletConnector::lockCoins(const std::vector<wallet::UtxoEntry> & inputs,
     return true;
 }
 
+//******************************************************************************
+//******************************************************************************
+bool WalletConnector::getTxOuts(std::vector<wallet::UtxoEntry> & entries,
+                                std::vector<bool> & found)
+{
+    found.assign(entries.size(), false);
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        found[i] = getTxOut(entries[i]);
+    }
+
+    return true;
+}
+
+//******************************************************************************
+//******************************************************************************
+bool WalletConnector::verifyMessages(const std::vector<MessageSignature> & items,
+                                     std::vector<bool> & valid)
+{
+    valid.assign(items.size(), false);
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        valid[i] = verifyMessage(std::get<0>(items[i]), std::get<1>(items[i]), std::get<2>(items[i]));
+    }
+
+    return true;
+}
+
 //******************************************************************************
 //******************************************************************************
 void WalletConnector::removeLocked(std::vector<wallet::UtxoEntry> & inputs) const
@@ -116,4 +224,95 @@ void WalletConnector::removeLocked(std::vector<wallet::UtxoEntry> & inputs) cons
     }
 }
 
+//******************************************************************************
+//******************************************************************************
+void WalletConnector::post(const WalletCall & call)
+{
+    auto guarded = [call]()
+    {
+        try
+        {
+            call();
+        }
+        catch (std::exception & e)
+        {
+            ERR() << "wallet call failed " << e.what();
+        }
+    };
+
+    IoServicePtr service;
+    {
+        boost::mutex::scoped_lock l(m_serviceLock);
+
+        if (!m_service && !m_serviceStopped)
+        {
+            m_service.reset(new boost::asio::io_service);
+            m_serviceWork.reset(new boost::asio::io_service::work(*m_service));
+            m_serviceThread.reset(new boost::thread(boost::bind(&boost::asio::io_service::run, m_service)));
+        }
+
+        if (!m_serviceStopped)
+        {
+            service = m_service;
+        }
+    }
+
+    if (!service)
+    {
+        guarded();
+        return;
+    }
+    service->post(guarded);
+}
+
+//******************************************************************************
+//******************************************************************************
+void WalletConnector::checkDepositTransactionAsync(const std::string & depositTxId,
+                                                   const std::string & destination,
+                                                   const double amount,
+                                                   const CheckDepositTransactionHandler & handler)
+{
+    WalletConnectorPtr self = shared_from_this();
+    post([self, depositTxId, destination, amount, handler]()
+    {
+        double checkAmount = amount;
+        bool isGood = false;
+        bool result = self->checkDepositTransaction(depositTxId, destination, checkAmount, isGood);
+        handler(result, checkAmount, isGood);
+    });
+}
+
+//******************************************************************************
+//******************************************************************************
+void WalletConnector::stopService()
+{
+    std::unique_ptr<boost::thread> thread;
+    {
+        boost::mutex::scoped_lock l(m_serviceLock);
+
+        // queued calls are dropped, a running call ends with its rpc
+        m_serviceStopped = true;
+        m_serviceWork.reset();
+        if (m_service)
+        {
+            m_service->stop();
+        }
+        thread.swap(m_serviceThread);
+    }
+
+    if (!thread)
+    {
+        return;
+    }
+
+    if (thread->get_id() == boost::this_thread::get_id())
+    {
+        // last reference dropped by a call of this connector,
+        // the thread ends after it
+        thread->detach();
+        return;
+    }
+    thread->join();
+}
+
 } // namespace xbridge
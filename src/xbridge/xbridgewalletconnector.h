@@ -5,11 +5,14 @@
 #define XBRIDGEWALLETCONNECTOR_H
 
 #include "xbridgewallet.h"
+#include "xbridgedef.h"
 #include "uint256.h"
 
 #include <vector>
 #include <string>
 #include <memory>
+#include <tuple>
+#include <functional>
 
 //*****************************************************************************
 //*****************************************************************************
@@ -50,9 +53,11 @@ struct WalletInfo
 //*****************************************************************************
 //*****************************************************************************
 class WalletConnector : public WalletParam
+                      , public std::enable_shared_from_this<WalletConnector>
 {
 public:
     WalletConnector();
+    virtual ~WalletConnector();
 
 public:
     WalletConnector & operator = (const WalletParam & other)
@@ -81,6 +86,19 @@ public:
 
     virtual bool getUnspent(std::vector<wallet::UtxoEntry> & inputs, const bool withLocked = false) const = 0;
 
+    // chain tip and wallet transaction count of the wallet, changes
+    // when wallet coins may change, false if not supported
+    virtual bool getWalletState(std::string & /*state*/) const { return false; }
+
+    // getUnspent from the last listunspent reply, it is kept while the
+    // wallet state is the same, up to -xbridgeutxocachetime seconds,
+    // so a check costs getbestblockhash and getwalletinfo calls
+    // instead of listunspent
+    bool getCachedUnspent(std::vector<wallet::UtxoEntry> & inputs, const bool withLocked = false) const;
+
+    // drop the cached listunspent reply, call when wallet coins change
+    void invalidateUnspent() const;
+
     // if lock returns false if already locked
     // if unlock always return true
     virtual bool lockCoins(const std::vector<wallet::UtxoEntry> & inputs,
@@ -91,6 +109,10 @@ public:
 
     virtual bool getTxOut(wallet::UtxoEntry & entry) = 0;
 
+    // batch of getTxOut, found[i] is false if entries[i] not found
+    // return false if wallet call failed
+    virtual bool getTxOuts(std::vector<wallet::UtxoEntry> & entries, std::vector<bool> & found);
+
     virtual bool sendRawTransaction(const std::string & rawtx,
                                     std::string & txid,
                                     int32_t & errorCode,
@@ -99,6 +121,32 @@ public:
     virtual bool signMessage(const std::string & address, const std::string & message, std::string & signature) = 0;
     virtual bool verifyMessage(const std::string & address, const std::string & message, const std::string & signature) = 0;
 
+    // batch of verifyMessage, items is (address, message, signature)
+    // return false if wallet call failed
+    typedef std::tuple<std::string, std::string, std::string> MessageSignature;
+    virtual bool verifyMessages(const std::vector<MessageSignature> & items, std::vector<bool> & valid);
+
+public:
+    // async wallet RPC
+    // calls run on a service and thread of the connector, so a slow
+    // wallet daemon only delays swaps on its own chain. Calls of a
+    // connector run one after another in the order posted, the thread
+    // starts on the first call. Called in place after stopService
+
+    typedef std::function<void ()> WalletCall;
+    void post(const WalletCall & call);
+
+    typedef std::function<void (const bool result,
+                                const double amount,
+                                const bool isGood)> CheckDepositTransactionHandler;
+    void checkDepositTransactionAsync(const std::string & depositTxId,
+                                      const std::string & destination,
+                                      const double amount,
+                                      const CheckDepositTransactionHandler & handler);
+
+    // drop queued calls and join the thread
+    void stopService();
+
 public:
     // helper functions
     virtual bool hasValidAddressPrefix(const std::string & addr) const = 0;
@@ -149,6 +197,24 @@ public:
                                           const std::vector<unsigned char> & innerScript,
                                           std::string & txId,
                                           std::string & rawTx) = 0;
+
+private:
+    // async wallet RPC
+    boost::mutex                           m_serviceLock;
+    IoServicePtr                           m_service;
+    WorkPtr                                m_serviceWork;
+    std::unique_ptr<boost::thread>         m_serviceThread;
+    bool                                   m_serviceStopped;
+
+    // cached getUnspent(withLocked) reply
+    mutable CCriticalSection               m_unspentLocker;
+    mutable std::vector<wallet::UtxoEntry> m_unspent;
+    mutable std::string                    m_unspentState;
+    mutable int64_t                        m_unspentTime;
+    mutable bool                           m_unspentValid;
+    // incremented by invalidateUnspent, a reply requested before
+    // an invalidation is not cached
+    mutable uint64_t                       m_unspentGeneration;
 };
 
 } // namespace xbridge
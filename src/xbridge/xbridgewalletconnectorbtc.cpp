@@ -11,6 +11,7 @@
 
 #include "util/logger.h"
 #include "util/txlog.h"
+#include "util/xjsonreader.h"
 
 #include "xbitcoinaddress.h"
 #include "xbitcointransaction.h"
@@ -40,6 +41,233 @@ Object CallRPC(const std::string & rpcuser, const std::string & rpcpasswd,
                const std::string & rpcip, const std::string & rpcport,
                const std::string & strMethod, const Array & params);
 
+Array CallRPCBatch(const std::string & rpcuser, const std::string & rpcpasswd,
+                   const std::string & rpcip, const std::string & rpcport,
+                   const std::vector<std::pair<std::string, Array> > & calls);
+
+std::string CallRPCText(const std::string & rpcuser, const std::string & rpcpasswd,
+                        const std::string & rpcip, const std::string & rpcport,
+                        const std::string & strMethod, const Array & params);
+
+//*****************************************************************************
+//*****************************************************************************
+namespace
+{
+
+//*****************************************************************************
+// listunspent reply read in one pass into utxo entries
+//*****************************************************************************
+class UnspentReplyHandler : public JsonRpcReplyHandler
+{
+public:
+    UnspentReplyHandler(std::vector<wallet::UtxoEntry> & entries)
+        : m_entries(entries)
+        , m_isArray(false)
+        , m_field(None)
+    {
+    }
+
+    bool isArray() const { return m_isArray; }
+
+protected:
+    void resultStartArray(const size_t depth)
+    {
+        if (depth == 0)
+        {
+            m_isArray = true;
+        }
+    }
+
+    void resultStartObject(const size_t depth)
+    {
+        if (depth == 1)
+        {
+            m_entry = wallet::UtxoEntry();
+            m_entry.vout   = 0;
+            m_entry.amount = 0;
+        }
+    }
+
+    void resultEndObject(const size_t depth)
+    {
+        if (depth == 1 && !m_entry.txId.empty() && m_entry.amount > 0)
+        {
+            m_entries.push_back(std::move(m_entry));
+        }
+    }
+
+    void resultKey(const size_t depth, const std::string & name)
+    {
+        if (depth == 1)
+        {
+            m_field = name == "txid"         ? Txid :
+                      name == "vout"         ? Vout :
+                      name == "amount"       ? Amount :
+                      name == "scriptPubKey" ? ScriptPubKey : None;
+        }
+    }
+
+    void resultString(const size_t depth, const std::string & value)
+    {
+        if (depth != 2)
+        {
+            return;
+        }
+
+        if (m_field == Txid)
+        {
+            m_entry.txId = value;
+        }
+        else if (m_field == ScriptPubKey)
+        {
+            m_entry.scriptPubKey = value;
+        }
+    }
+
+    void resultNumber(const size_t depth, const char * begin, const char * end)
+    {
+        if (depth != 2)
+        {
+            return;
+        }
+
+        if (m_field == Vout)
+        {
+            int64_t vout = 0;
+            if (parseInt(begin, end, vout))
+            {
+                m_entry.vout = static_cast<uint32_t>(vout);
+            }
+        }
+        else if (m_field == Amount)
+        {
+            parseDouble(begin, end, m_entry.amount);
+        }
+    }
+
+private:
+    enum Field
+    {
+        None,
+        Txid,
+        Vout,
+        Amount,
+        ScriptPubKey
+    };
+
+    std::vector<wallet::UtxoEntry> & m_entries;
+    bool                             m_isArray;
+    Field                            m_field;
+    wallet::UtxoEntry                m_entry;
+};
+
+//*****************************************************************************
+// decoderawtransaction reply read in one pass for the value of one output
+//*****************************************************************************
+class VoutValueReplyHandler : public JsonRpcReplyHandler
+{
+public:
+    VoutValueReplyHandler(const uint32_t n)
+        : m_n(n)
+        , m_isObject(false)
+        , m_isVoutArray(false)
+        , m_found(false)
+        , m_amount(0)
+        , m_inVout(false)
+        , m_field(None)
+        , m_voutN(-1)
+        , m_voutValue(0)
+    {
+    }
+
+    bool isObject() const    { return m_isObject; }
+    bool isVoutArray() const { return m_isVoutArray; }
+    bool found() const       { return m_found; }
+    double amount() const    { return m_amount; }
+
+protected:
+    void resultStartObject(const size_t depth)
+    {
+        if (depth == 0)
+        {
+            m_isObject = true;
+        }
+        else if (depth == 2 && m_inVout)
+        {
+            m_voutN     = -1;
+            m_voutValue = 0;
+        }
+    }
+
+    void resultEndObject(const size_t depth)
+    {
+        if (depth == 2 && m_inVout && !m_found && m_voutN == m_n)
+        {
+            m_found  = true;
+            m_amount = m_voutValue;
+        }
+    }
+
+    void resultStartArray(const size_t depth)
+    {
+        if (depth == 1 && m_inVout)
+        {
+            m_isVoutArray = true;
+        }
+    }
+
+    void resultKey(const size_t depth, const std::string & name)
+    {
+        if (depth == 0)
+        {
+            m_inVout = name == "vout";
+        }
+        else if (depth == 2 && m_inVout)
+        {
+            m_field = name == "n"     ? N :
+                      name == "value" ? Amount : None;
+        }
+    }
+
+    void resultNumber(const size_t depth, const char * begin, const char * end)
+    {
+        if (depth != 3 || !m_inVout)
+        {
+            return;
+        }
+
+        if (m_field == N)
+        {
+            parseInt(begin, end, m_voutN);
+        }
+        else if (m_field == Amount)
+        {
+            parseDouble(begin, end, m_voutValue);
+        }
+    }
+
+private:
+    enum Field
+    {
+        None,
+        N,
+        Amount
+    };
+
+    const int64_t m_n;
+    bool          m_isObject;
+    bool          m_isVoutArray;
+    bool          m_found;
+    double        m_amount;
+
+    bool          m_inVout;
+    Field         m_field;
+    int64_t       m_voutN;
+    double        m_voutValue;
+};
+
+} // namespace
+
 //*****************************************************************************
 //*****************************************************************************
 bool getinfo(const std::string & rpcuser, const std::string & rpcpasswd,
@@ -183,6 +411,97 @@ bool getblockchaininfo(const std::string & rpcuser, const std::string & rpcpassw
     return true;
 }
 
+//*****************************************************************************
+//*****************************************************************************
+bool getbestblockhash(const std::string & rpcuser, const std::string & rpcpasswd,
+                      const std::string & rpcip, const std::string & rpcport,
+                      std::string & hash)
+{
+    try
+    {
+        Array params;
+        Object reply = CallRPC(rpcuser, rpcpasswd, rpcip, rpcport,
+                               "getbestblockhash", params);
+
+        // Parse reply
+        const Value & result = find_value(reply, "result");
+        const Value & error  = find_value(reply, "error");
+
+        if (error.type() != null_type)
+        {
+            // Error
+            LOG() << "error: " << write_string(error, false);
+            return false;
+        }
+        else if (result.type() != str_type)
+        {
+            // Result
+            LOG() << "result not an string " <<
+                     (result.type() == null_type ? "" :
+                                                   write_string(result, true));
+            return false;
+        }
+
+        hash = result.get_str();
+    }
+    catch (std::exception & e)
+    {
+        LOG() << "getbestblockhash exception " << e.what();
+        return false;
+    }
+
+    return true;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+bool getwallettxcount(const std::string & rpcuser, const std::string & rpcpasswd,
+                      const std::string & rpcip, const std::string & rpcport,
+                      uint64_t & txcount)
+{
+    try
+    {
+        Array params;
+        Object reply = CallRPC(rpcuser, rpcpasswd, rpcip, rpcport,
+                               "getwalletinfo", params);
+
+        // Parse reply
+        const Value & result = find_value(reply, "result");
+        const Value & error  = find_value(reply, "error");
+
+        if (error.type() != null_type)
+        {
+            // Error
+            LOG() << "error: " << write_string(error, false);
+            return false;
+        }
+        else if (result.type() != obj_type)
+        {
+            // Result
+            LOG() << "result not an object " <<
+                     (result.type() == null_type ? "" :
+                                                   write_string(result, true));
+            return false;
+        }
+
+        const Value & count = find_value(result.get_obj(), "txcount");
+        if (count.type() != int_type)
+        {
+            LOG() << "txcount not found " << __FUNCTION__;
+            return false;
+        }
+
+        txcount = count.get_uint64();
+    }
+    catch (std::exception & e)
+    {
+        LOG() << "getwalletinfo exception " << e.what();
+        return false;
+    }
+
+    return true;
+}
+
 //*****************************************************************************
 //*****************************************************************************
 bool listaccounts(const std::string & rpcuser, const std::string & rpcpasswd,
@@ -342,6 +661,35 @@ bool validateaddress(const std::string & rpcuser, const std::string & rpcpasswd,
     return true;
 }
 
+//*****************************************************************************
+//*****************************************************************************
+bool parseUnspentReply(const std::string & reply,
+                       std::vector<wallet::UtxoEntry> & entries)
+{
+    // Parse reply straight into entries, reply of a big wallet
+    // is megabytes and is not copied into a value tree
+    UnspentReplyHandler handler(entries);
+    if (!readJson(reply, handler))
+    {
+        throw std::runtime_error("couldn't parse reply from server");
+    }
+
+    if (handler.hasError())
+    {
+        // Error
+        LOG() << "error: " << handler.error();
+        return false;
+    }
+    else if (!handler.isArray())
+    {
+        // Result
+        LOG() << "result not an array";
+        return false;
+    }
+
+    return true;
+}
+
 //*****************************************************************************
 //*****************************************************************************
 bool listUnspent(const std::string & rpcuser,
@@ -350,84 +698,21 @@ bool listUnspent(const std::string & rpcuser,
                  const std::string & rpcport,
                  std::vector<wallet::UtxoEntry> & entries)
 {
-    const static std::string txid("txid");
-    const static std::string vout("vout");
-    const static std::string amount("amount");
-    const static std::string scriptPubKey("scriptPubKey");
-
-
     try
     {
         LOG() << "rpc call <listunspent>";
 
         Array params;
-        Object reply = CallRPC(rpcuser, rpcpasswd, rpcip, rpcport,
-                               "listunspent", params);
-
-        // Parse reply
-        const Value & result = find_value(reply, "result");
-        const Value & error  = find_value(reply, "error");
+        std::string reply = CallRPCText(rpcuser, rpcpasswd, rpcip, rpcport,
+                                        "listunspent", params);
 
-        if (error.type() != null_type)
-        {
-            // Error
-            LOG() << "error: " << write_string(error, false);
-            // int code = find_value(error.get_obj(), "code").get_int();
-            return false;
-        }
-        else if (result.type() != array_type)
-        {
-            // Result
-            LOG() << "result not an array " <<
-                     (result.type() == null_type ? "" :
-                      result.type() == str_type  ? result.get_str() :
-                                                   write_string(result, true));
-            return false;
-        }
-
-        Array arr = result.get_array();
-        for (const Value & v : arr)
-        {
-            if (v.type() == obj_type)
-            {
-
-                wallet::UtxoEntry u;
-
-                Object o = v.get_obj();
-                for (const auto & v : o)
-                {
-                    if (v.name_ == txid)
-                    {
-                        u.txId = v.value_.get_str();
-                    }
-                    else if (v.name_ == vout)
-                    {
-                        u.vout = v.value_.get_int();
-                    }
-                    else if (v.name_ == amount)
-                    {
-                        u.amount = v.value_.get_real();
-                    }
-                    else if (v.name_ == scriptPubKey)
-                    {
-                        u.scriptPubKey = v.value_.get_str();
-                    }
-                }
-
-                if (!u.txId.empty() && u.amount > 0)
-                {
-                    entries.push_back(u);
-                }
-            }
-        }
+        return parseUnspentReply(reply, entries);
     }
     catch (std::exception & e)
     {
         LOG() << "listunspent exception " << e.what();
         return false;
     }
-
-    return true;
 }
 
 //*****************************************************************************
@@ -551,6 +836,68 @@ bool gettxout(const std::string & rpcuser,
     return true;
 }
 
+//*****************************************************************************
+//*****************************************************************************
+bool gettxouts(const std::string & rpcuser,
+               const std::string & rpcpasswd,
+               const std::string & rpcip,
+               const std::string & rpcport,
+               std::vector<wallet::UtxoEntry> & txouts,
+               std::vector<bool> & found)
+{
+    found.assign(txouts.size(), false);
+
+    try
+    {
+        LOG() << "rpc call <gettxout> batch of " << txouts.size();
+
+        std::vector<std::pair<std::string, Array> > calls;
+        calls.reserve(txouts.size());
+        for (wallet::UtxoEntry & txout : txouts)
+        {
+            txout.amount = 0;
+
+            Array params;
+            params.push_back(txout.txId);
+            params.push_back(static_cast<int>(txout.vout));
+            calls.emplace_back("gettxout", params);
+        }
+
+        Array replies = CallRPCBatch(rpcuser, rpcpasswd, rpcip, rpcport, calls);
+
+        for (size_t i = 0; i < replies.size(); ++i)
+        {
+            const Object & reply = replies[i].get_obj();
+
+            // Parse reply
+            const Value & result = find_value(reply, "result");
+            const Value & error  = find_value(reply, "error");
+
+            if (error.type() != null_type)
+            {
+                // Error
+                LOG() << "error: " << write_string(error, false);
+                continue;
+            }
+            else if (result.type() != obj_type)
+            {
+                // not found or spent
+                continue;
+            }
+
+            txouts[i].amount = find_value(result.get_obj(), "value").get_real();
+            found[i] = true;
+        }
+    }
+    catch (std::exception & e)
+    {
+        LOG() << "gettxout batch exception " << e.what();
+        return false;
+    }
+
+    return true;
+}
+
 //*****************************************************************************
 //*****************************************************************************
 bool gettransaction(const std::string & rpcuser,
@@ -592,52 +939,36 @@ bool gettransaction(const std::string & rpcuser,
 
 
         Array d { Value(result.get_str()) };
-        reply = CallRPC(rpcuser, rpcpasswd, rpcip, rpcport, "decoderawtransaction", d);
+        std::string decoded = CallRPCText(rpcuser, rpcpasswd, rpcip, rpcport,
+                                          "decoderawtransaction", d);
 
-        const Value & result2 = find_value(reply, "result");
-        const Value & error2  = find_value(reply, "error");
+        VoutValueReplyHandler handler(txout.vout);
+        if (!readJson(decoded, handler))
+        {
+            throw std::runtime_error("couldn't parse reply from server");
+        }
 
-        if (error2.type() != null_type)
+        if (handler.hasError())
         {
             // Error
-            LOG() << "error: " << write_string(error2, false);
+            LOG() << "error: " << handler.error();
             return false;
         }
-        else if (result2.type() != obj_type)
+        else if (!handler.isObject())
         {
             // Result
-            LOG() << "result of decoderawtransaction not an object " <<
-                     (result2.type() == null_type ? "" :
-                      result2.type() == str_type  ? result2.get_str() :
-                                                   write_string(result2, true));
+            LOG() << "result of decoderawtransaction not an object";
             return false;
         }
-
-        Object o = result2.get_obj();
-
-        const Value & vouts = find_value(o, "vout");
-        if(vouts.type() != array_type)
+        else if (!handler.isVoutArray())
         {
             LOG() << "vout not an array type";
             return false;
         }
 
-        for(const Value & element : vouts.get_array())
+        if (handler.found())
         {
-            if(element.type() != obj_type)
-            {
-                LOG() << "vouts element not an object type";
-                return false;
-            }
-
-            Object elementObj = element.get_obj();
-
-            uint32_t vout = find_value(elementObj, "n").get_int();
-            if(vout == txout.vout)
-            {
-                txout.amount = find_value(elementObj, "value").get_real();
-                break;
-            }
+            txout.amount = handler.amount();
         }
     }
     catch (std::exception & e)
@@ -1213,6 +1544,65 @@ bool verifyMessage(const std::string & rpcuser, const std::string & rpcpasswd,
     return true;
 }
 
+//*****************************************************************************
+//*****************************************************************************
+bool verifyMessages(const std::string & rpcuser, const std::string & rpcpasswd,
+                    const std::string & rpcip,   const std::string & rpcport,
+                    const std::vector<WalletConnector::MessageSignature> & items,
+                    std::vector<bool> & valid)
+{
+    valid.assign(items.size(), false);
+
+    try
+    {
+        LOG() << "rpc call <verifymessage> batch of " << items.size();
+
+        std::vector<std::pair<std::string, Array> > calls;
+        calls.reserve(items.size());
+        for (const WalletConnector::MessageSignature & item : items)
+        {
+            Array params;
+            params.push_back(std::get<0>(item));
+            params.push_back(std::get<2>(item));
+            params.push_back(std::get<1>(item));
+            calls.emplace_back("verifymessage", params);
+        }
+
+        Array replies = CallRPCBatch(rpcuser, rpcpasswd, rpcip, rpcport, calls);
+
+        for (size_t i = 0; i < replies.size(); ++i)
+        {
+            const Object & reply = replies[i].get_obj();
+
+            // reply
+            const Value & error  = find_value(reply, "error");
+            if (error.type() != null_type)
+            {
+                // Error
+                LOG() << "error: " << write_string(error, false);
+                continue;
+            }
+
+            const Value & result = find_value(reply, "result");
+            if (result.type() != bool_type)
+            {
+                // Result
+                LOG() << "result not a bool " << write_string(result, true);
+                continue;
+            }
+
+            valid[i] = result.get_bool();
+        }
+    }
+    catch (std::exception & e)
+    {
+        LOG() << "verifymessage batch exception " << e.what();
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace rpc
 
 namespace
@@ -1427,6 +1817,31 @@ bool BtcWalletConnector<CryptoProvider>::getInfo(rpc::WalletInfo & info) const
     return true;
 }
 
+//******************************************************************************
+//******************************************************************************
+template <class CryptoProvider>
+bool BtcWalletConnector<CryptoProvider>::getWalletState(std::string & state) const
+{
+    std::string hash;
+    if (!rpc::getbestblockhash(m_user, m_passwd, m_ip, m_port, hash))
+    {
+        LOG() << "rpc::getbestblockhash failed " << __FUNCTION__;
+        return false;
+    }
+
+    // wallet transactions entering the mempool (spends and receives)
+    // change the count, blocks change the tip
+    uint64_t txcount = 0;
+    if (!rpc::getwallettxcount(m_user, m_passwd, m_ip, m_port, txcount))
+    {
+        LOG() << "rpc::getwallettxcount failed " << __FUNCTION__;
+        return false;
+    }
+
+    state = hash + ":" + std::to_string(txcount);
+    return true;
+}
+
 //******************************************************************************
 //******************************************************************************
 template <class CryptoProvider>
@@ -1518,6 +1933,37 @@ bool BtcWalletConnector<CryptoProvider>::getTxOut(wallet::UtxoEntry & entry)
     return true;
 }
 
+//******************************************************************************
+//******************************************************************************
+template <class CryptoProvider>
+bool BtcWalletConnector<CryptoProvider>::getTxOuts(std::vector<wallet::UtxoEntry> & entries,
+                                                   std::vector<bool> & found)
+{
+    if (!rpc::gettxouts(m_user, m_passwd, m_ip, m_port, entries, found))
+    {
+        LOG() << "gettxout batch failed, trying call gettxout for each entry " << __FUNCTION__;
+        return WalletConnector::getTxOuts(entries, found);
+    }
+
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        if (found[i])
+        {
+            continue;
+        }
+
+        LOG() << "gettxout failed, trying call gettransaction " << __FUNCTION__;
+
+        found[i] = rpc::gettransaction(m_user, m_passwd, m_ip, m_port, entries[i]);
+        if (!found[i])
+        {
+            WARN() << "both calls of gettxout and gettransaction failed " << __FUNCTION__;
+        }
+    }
+
+    return true;
+}
+
 //******************************************************************************
 //******************************************************************************
 template <class CryptoProvider>
@@ -1538,6 +1984,9 @@ bool BtcWalletConnector<CryptoProvider>::sendRawTransaction(const std::string &
         return false;
     }
 
+    // spent coins leave the wallet
+    invalidateUnspent();
+
     return true;
 }
 
@@ -1575,6 +2024,21 @@ bool BtcWalletConnector<CryptoProvider>::verifyMessage(const std::string & addre
     return true;
 }
 
+//******************************************************************************
+//******************************************************************************
+template <class CryptoProvider>
+bool BtcWalletConnector<CryptoProvider>::verifyMessages(const std::vector<MessageSignature> & items,
+                                                        std::vector<bool> & valid)
+{
+    if (!rpc::verifyMessages(m_user, m_passwd, m_ip, m_port, items, valid))
+    {
+        LOG() << "rpc::verifyMessages failed, trying call verifymessage for each item " << __FUNCTION__;
+        return WalletConnector::verifyMessages(items, valid);
+    }
+
+    return true;
+}
+
 //******************************************************************************
 //******************************************************************************
 
@@ -13,6 +13,21 @@
 namespace xbridge
 {
 
+//*****************************************************************************
+//*****************************************************************************
+namespace rpc
+{
+
+/**
+ * @brief parseUnspentReply - read a listunspent reply into utxo entries,
+ * throws if the reply is not valid json
+ * @return false if the reply is an error or its result is not an array
+ */
+bool parseUnspentReply(const std::string & reply,
+                       std::vector<wallet::UtxoEntry> & entries);
+
+} // namespace rpc
+
 //*****************************************************************************
 //*****************************************************************************
 template <class CryptoProvider>
@@ -35,6 +50,8 @@ public:
 
     bool getInfo(rpc::WalletInfo & info) const;
 
+    bool getWalletState(std::string & state) const;
+
     bool getUnspent(std::vector<wallet::UtxoEntry> & inputs, const bool withLocked = false) const;
 
     bool lockCoins(const std::vector<wallet::UtxoEntry> & inputs, const bool lock = true);
@@ -42,6 +59,7 @@ public:
     bool getNewAddress(std::string & addr);
 
     bool getTxOut(wallet::UtxoEntry & entry);
+    bool getTxOuts(std::vector<wallet::UtxoEntry> & entries, std::vector<bool> & found);
 
     bool sendRawTransaction(const std::string & rawtx,
                             std::string & txid,
@@ -50,6 +68,7 @@ public:
 
     bool signMessage(const std::string & address, const std::string & message, std::string & signature);
     bool verifyMessage(const std::string & address, const std::string & message, const std::string & signature);
+    bool verifyMessages(const std::vector<MessageSignature> & items, std::vector<bool> & valid);
 
 public:
     bool hasValidAddressPrefix(const std::string & addr) const;